@@ -0,0 +1,87 @@
+/**
+ * @file bench_animation.cpp
+ * @brief NovaCore Engine - Animation Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/animation/animation.hpp>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::animation;
+
+namespace {
+
+constexpr i32 BONE_COUNT = 48;
+constexpr u32 KEYS_PER_CHANNEL = 30;
+constexpr f32 CLIP_DURATION = 2.0f;
+
+/// Humanoid-sized chain hierarchy (each bone parented to one a few above it)
+SkeletonData makeSkeleton() {
+    SkeletonData data;
+    data.name = "BenchSkeleton";
+    for (i32 i = 0; i < BONE_COUNT; ++i) {
+        BoneInfo bone;
+        bone.name = "Bone" + std::to_string(i);
+        bone.parentIndex = i == 0 ? -1 : std::max(0, i - 1 - (i % 4));
+        data.boneNameToIndex[bone.name] = i;
+        data.bones.push_back(std::move(bone));
+    }
+    return data;
+}
+
+AnimationClipData makeClip(BenchmarkState& state) {
+    AnimationClipData data;
+    data.name = "BenchClip";
+    data.duration = CLIP_DURATION;
+
+    for (i32 bone = 0; bone < BONE_COUNT; ++bone) {
+        AnimationChannel channel;
+        channel.boneIndex = bone;
+        channel.boneName = "Bone" + std::to_string(bone);
+        for (u32 k = 0; k < KEYS_PER_CHANNEL; ++k) {
+            f32 time = CLIP_DURATION * static_cast<f32>(k) / static_cast<f32>(KEYS_PER_CHANNEL - 1);
+            Vec3 position(state.uniform(-0.1f, 0.1f), state.uniform(-0.1f, 0.1f), state.uniform(-0.1f, 0.1f));
+            Quat rotation = Quat::fromEuler(state.uniform(-0.5f, 0.5f), state.uniform(-0.5f, 0.5f),
+                                            state.uniform(-0.5f, 0.5f));
+            channel.positionKeys.push_back({time, position, InterpolationMode::Linear, {}, {}});
+            channel.rotationKeys.push_back({time, rotation, InterpolationMode::Linear});
+        }
+        data.channels.push_back(std::move(channel));
+    }
+    return data;
+}
+
+} // namespace
+
+NOVA_BENCHMARK("animation/sample", ({100, 1'000, 5'000}), [](BenchmarkState& state) {
+    auto& system = AnimationSystem::get();
+    system.initialize();
+
+    auto skeleton = system.createSkeleton(makeSkeleton());
+    auto clip = system.createClip(makeClip(state));
+
+    std::vector<AnimationSampler*> samplers;
+    for (usize i = 0; i < state.size(); ++i) {
+        AnimationSampler* sampler = system.createSampler(skeleton);
+        sampler->play(clip);
+        // Spread characters over the clip so key lookups differ
+        sampler->update(state.uniform(0.0f, CLIP_DURATION));
+        samplers.push_back(sampler);
+    }
+
+    state.run([&] { system.update(1.0f / 60.0f); });
+    state.setItemsPerRun(state.size());
+    state.counter("bones", BONE_COUNT);
+
+    for (AnimationSampler* sampler : samplers) {
+        system.destroySampler(sampler);
+    }
+    system.unloadClip(clip);
+    system.unloadSkeleton(skeleton);
+    system.shutdown();
+});
@@ -0,0 +1,135 @@
+/**
+ * @file bench_culling.cpp
+ * @brief NovaCore Engine - Culling Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Frustum culling of instances scattered around one camera: "scalar" calls
+ * Frustum::testAABB per object, "batch" tests SoA bounds 8 at a time,
+ * "batch_threads" splits the batch across a worker pool and "hierarchical"
+ * culls clusters of CLUSTER_SIZE instances by their parent bounds first.
+ *
+ * The batch paths use AVX2 or NEON when the build enables them and a scalar
+ * fallback otherwise; the "simd" counter records which one ran.
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/platform/worker_pool.hpp>
+#include <nova/core/render/occlusion_culling.hpp>
+
+#include <thread>
+
+using namespace nova;
+using namespace nova::bench;
+
+namespace {
+
+constexpr u32 CLUSTER_SIZE = 64;
+constexpr f32 WORLD_EXTENT = 500.0f;
+
+#if NOVA_SIMD_AVX2 || NOVA_SIMD_NEON
+constexpr f64 SIMD_BATCH = 1.0;
+#else
+constexpr f64 SIMD_BATCH = 0.0;
+#endif
+
+Frustum makeFrustum() {
+    Mat4 view = Mat4::lookAt(Vec3{0.0f, 20.0f, 0.0f}, Vec3{100.0f, 0.0f, 100.0f}, Vec3{0.0f, 1.0f, 0.0f});
+    Mat4 proj = Mat4::perspective(math::radians(60.0f), 16.0f / 9.0f, 0.1f, 400.0f);
+    Frustum frustum;
+    frustum.extractFromMatrix(proj * view);
+    return frustum;
+}
+
+/// Instances in clusters of CLUSTER_SIZE, each cluster a few meters across
+struct Scene {
+    std::vector<AABB> boxes;
+    BoundsSoA objects;
+    BoundsSoA clusterBounds;
+    std::vector<CullingGroup> clusters;
+};
+
+Scene makeScene(BenchmarkState& state) {
+    Scene scene;
+    u32 count = static_cast<u32>(state.size());
+    scene.objects.reserve(count);
+    for (u32 first = 0; first < count; first += CLUSTER_SIZE) {
+        Vec3 center(state.uniform(-WORLD_EXTENT, WORLD_EXTENT), state.uniform(0.0f, 40.0f),
+                    state.uniform(-WORLD_EXTENT, WORLD_EXTENT));
+        CullingGroup cluster{first, std::min(CLUSTER_SIZE, count - first)};
+        AABB enclosing(center, center);
+        for (u32 i = 0; i < cluster.objectCount; ++i) {
+            Vec3 offset(state.uniform(-8.0f, 8.0f), state.uniform(-2.0f, 2.0f), state.uniform(-8.0f, 8.0f));
+            f32 size = state.uniform(0.2f, 1.5f);
+            AABB box = AABB::fromCenterHalfExtents(center + offset, Vec3(size, size, size));
+            enclosing.expandToInclude(box);
+            scene.boxes.push_back(box);
+            scene.objects.add(box);
+        }
+        scene.clusters.push_back(cluster);
+        scene.clusterBounds.add(enclosing);
+    }
+    return scene;
+}
+
+} // namespace
+
+NOVA_BENCHMARK("culling/frustum_scalar", ({10'000, 200'000}), [](BenchmarkState& state) {
+    Scene scene = makeScene(state);
+    Frustum frustum = makeFrustum();
+    std::vector<u64> bits((scene.boxes.size() + 63) / 64);
+
+    state.run([&] {
+        std::fill(bits.begin(), bits.end(), u64{0});
+        for (u32 i = 0; i < scene.boxes.size(); ++i) {
+            bits[i / 64] |= static_cast<u64>(frustum.isAABBVisible(scene.boxes[i])) << (i % 64);
+        }
+        doNotOptimize(bits);
+    });
+    state.setItemsPerRun(state.size());
+});
+
+NOVA_BENCHMARK("culling/frustum_batch", ({10'000, 200'000}), [](BenchmarkState& state) {
+    Scene scene = makeScene(state);
+    Frustum frustum = makeFrustum();
+    std::vector<u64> bits((scene.objects.size() + 63) / 64);
+
+    state.run([&] {
+        cullFrustum(frustum, scene.objects, bits);
+        doNotOptimize(bits);
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("simd", SIMD_BATCH);
+});
+
+NOVA_BENCHMARK("culling/frustum_batch_threads", ({200'000}), [](BenchmarkState& state) {
+    Scene scene = makeScene(state);
+    Frustum frustum = makeFrustum();
+    std::vector<u64> bits((scene.objects.size() + 63) / 64);
+    u32 threads = std::max(1u, std::thread::hardware_concurrency());
+    WorkerPool pool(threads);
+
+    state.run([&] {
+        cullFrustum(frustum, scene.objects, bits, &pool);
+        doNotOptimize(bits);
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("threads", threads);
+    state.counter("simd", SIMD_BATCH);
+});
+
+NOVA_BENCHMARK("culling/frustum_hierarchical", ({10'000, 200'000}), [](BenchmarkState& state) {
+    Scene scene = makeScene(state);
+    Frustum frustum = makeFrustum();
+    std::vector<u64> bits((scene.objects.size() + 63) / 64);
+
+    state.run([&] {
+        cullFrustumHierarchical(frustum, scene.clusterBounds, scene.clusters, scene.objects, bits);
+        doNotOptimize(bits);
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("cluster_size", CLUSTER_SIZE);
+    state.counter("simd", SIMD_BATCH);
+});
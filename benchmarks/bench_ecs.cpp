@@ -0,0 +1,76 @@
+/**
+ * @file bench_ecs.cpp
+ * @brief NovaCore Engine - ECS Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/ecs/world.hpp>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::ecs;
+
+namespace {
+
+struct BenchPosition { f32 x = 0.0f, y = 0.0f, z = 0.0f; };
+struct BenchVelocity { f32 x = 0.0f, y = 0.0f, z = 0.0f; };
+struct BenchHealth { f32 value = 100.0f; };
+
+/// Every entity has Position/Velocity; every fourth also has Health
+void populate(World& world, BenchmarkState& state) {
+    world.reserve(state.size());
+    for (usize i = 0; i < state.size(); ++i) {
+        BenchPosition p{state.uniform(-500.0f, 500.0f), state.uniform(-500.0f, 500.0f), state.uniform(-500.0f, 500.0f)};
+        BenchVelocity v{state.uniform(-1.0f, 1.0f), state.uniform(-1.0f, 1.0f), state.uniform(-1.0f, 1.0f)};
+        if (i % 4 == 0) {
+            (void)world.createEntity(std::move(p), std::move(v), BenchHealth{});
+        } else {
+            (void)world.createEntity(std::move(p), std::move(v));
+        }
+    }
+}
+
+} // namespace
+
+NOVA_BENCHMARK("ecs/iterate", ({10'000, 100'000, 1'000'000}), [](BenchmarkState& state) {
+    World world;
+    populate(world, state);
+
+    constexpr f32 dt = 1.0f / 60.0f;
+    state.run([&] {
+        world.each<BenchPosition, BenchVelocity>([](BenchPosition& p, const BenchVelocity& v) {
+            p.x += v.x * dt;
+            p.y += v.y * dt;
+            p.z += v.z * dt;
+        });
+    });
+    state.setItemsPerRun(state.size());
+});
+
+NOVA_BENCHMARK("ecs/spawn", ({10'000, 100'000, 1'000'000}), [](BenchmarkState& state) {
+    World world;
+    state.run([&] { world.clear(); }, [&] { populate(world, state); });
+    state.setItemsPerRun(state.size());
+});
+
+NOVA_BENCHMARK("ecs/destroy", ({10'000, 100'000}), [](BenchmarkState& state) {
+    World world;
+    std::vector<Entity> entities;
+    entities.reserve(state.size());
+    state.run([&] {
+        world.clear();
+        entities.clear();
+        for (usize i = 0; i < state.size(); ++i) {
+            entities.push_back(world.createEntity(BenchPosition{}, BenchVelocity{}));
+        }
+    }, [&] {
+        for (Entity entity : entities) {
+            world.destroyEntity(entity);
+        }
+    });
+    state.setItemsPerRun(state.size());
+});
@@ -0,0 +1,105 @@
+/**
+ * @file bench_memory.cpp
+ * @brief NovaCore Engine - Memory Allocator Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/memory/memory.hpp>
+
+#include <cstdlib>
+#include <thread>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::memory;
+
+namespace {
+
+constexpr usize WORKER_THREADS = 4;
+
+/// Mixed small sizes typical of components, packets and script values
+[[nodiscard]] usize requestSize(u64 i) noexcept {
+    return 16 + (i * 2654435761u) % 496;
+}
+
+/// Each worker allocates a batch, then frees the batch of its neighbour,
+/// so every free after the first round crosses threads
+template<typename Alloc, typename Free>
+void producerConsumer(usize count, Alloc&& alloc, Free&& free) {
+    std::vector<std::vector<void*>> batches(WORKER_THREADS, std::vector<void*>(count));
+    std::vector<std::thread> workers;
+    for (usize t = 0; t < WORKER_THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            for (usize i = 0; i < count; ++i) {
+                batches[t][i] = alloc(requestSize(t * count + i));
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+    for (usize t = 0; t < WORKER_THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            for (void* ptr : batches[(t + 1) % WORKER_THREADS]) {
+                free(ptr);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace
+
+NOVA_BENCHMARK("memory/scalable_alloc_free", ({1'000, 100'000}), [](BenchmarkState& state) {
+    ScalableAllocator allocator;
+    std::vector<void*> blocks(state.size());
+    state.run([&] {
+        for (usize i = 0; i < blocks.size(); ++i) {
+            blocks[i] = allocator.allocate(requestSize(i));
+        }
+        for (void* ptr : blocks) {
+            allocator.deallocate(ptr);
+        }
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("peak_reserved_bytes", static_cast<f64>(allocator.getStats().peakAllocated));
+});
+
+NOVA_BENCHMARK("memory/system_alloc_free", ({1'000, 100'000}), [](BenchmarkState& state) {
+    std::vector<void*> blocks(state.size());
+    state.run([&] {
+        for (usize i = 0; i < blocks.size(); ++i) {
+            blocks[i] = std::malloc(requestSize(i));
+        }
+        for (void* ptr : blocks) {
+            std::free(ptr);
+        }
+    });
+    state.setItemsPerRun(state.size());
+});
+
+NOVA_BENCHMARK("memory/scalable_cross_thread", ({10'000}), [](BenchmarkState& state) {
+    ScalableAllocator allocator;
+    state.run([&] {
+        producerConsumer(
+            state.size(), [&](usize size) { return allocator.allocate(size); },
+            [&](void* ptr) { allocator.deallocate(ptr); });
+    });
+    state.setItemsPerRun(state.size() * WORKER_THREADS);
+    state.counter("heaps", static_cast<f64>(allocator.getHeapCount()));
+});
+
+NOVA_BENCHMARK("memory/system_cross_thread", ({10'000}), [](BenchmarkState& state) {
+    state.run([&] {
+        producerConsumer(
+            state.size(), [](usize size) { return std::malloc(size); }, [](void* ptr) { std::free(ptr); });
+    });
+    state.setItemsPerRun(state.size() * WORKER_THREADS);
+});
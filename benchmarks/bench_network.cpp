@@ -0,0 +1,110 @@
+/**
+ * @file bench_network.cpp
+ * @brief NovaCore Engine - Network Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/network/network.hpp>
+#include <nova/core/network/network_replication.hpp>
+
+#include <cstddef>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::network;
+
+namespace {
+
+struct BenchNetTransform {
+    f32 x = 0.0f;
+    f32 y = 0.0f;
+    f32 z = 0.0f;
+    i32 health = 100;
+};
+
+} // namespace
+
+NOVA_BENCHMARK("network/packet_roundtrip", ({64, 512, 1'200}), [](BenchmarkState& state) {
+    NetworkPacket packet = NetworkPacket::create(PacketType::UnreliableData, ChannelType::Default);
+    packet.payload.resize(state.size());
+    for (auto& byte : packet.payload) {
+        byte = static_cast<u8>(state.rng()());
+    }
+
+    state.run([&] {
+        std::vector<u8> bytes = packet.serialize();
+        auto decoded = NetworkPacket::deserialize(bytes);
+        doNotOptimize(decoded);
+    });
+    state.setItemsPerRun(1);
+    state.counter("wire_bytes", static_cast<f64>(packet.totalSize()));
+});
+
+NOVA_BENCHMARK("network/bitpack", ({1'000, 10'000}), [](BenchmarkState& state) {
+    std::vector<u32> values(state.size());
+    for (auto& value : values) {
+        value = static_cast<u32>(state.rng()() & 0xFFFFF);
+    }
+
+    std::vector<u8> buffer;
+    state.run([&] {
+        BitWriter writer(buffer);
+        for (u32 value : values) {
+            writer.write(value, 20);
+        }
+        BitReader reader(buffer.data(), buffer.size());
+        u32 sum = 0;
+        for (usize i = 0; i < values.size(); ++i) {
+            sum += reader.read(20);
+        }
+        doNotOptimize(sum);
+    });
+    state.setItemsPerRun(state.size());
+});
+
+NOVA_BENCHMARK("network/replication_update", ({1'000, 10'000}), [](BenchmarkState& state) {
+    ReplicationRegistry registry;
+    (void)registry.registerComponent<BenchNetTransform>({
+        ReplicatedField::f32Quantized(offsetof(BenchNetTransform, x), -1024.0f, 1024.0f, 20),
+        ReplicatedField::f32Quantized(offsetof(BenchNetTransform, y), -1024.0f, 1024.0f, 20),
+        ReplicatedField::f32Quantized(offsetof(BenchNetTransform, z), -1024.0f, 1024.0f, 20),
+        ReplicatedField::integer(offsetof(BenchNetTransform, health), 8),
+    }, 0);
+
+    ecs::World world;
+    std::vector<ecs::Entity> entities;
+    for (usize i = 0; i < state.size(); ++i) {
+        ecs::Entity entity = world.createEntity();
+        world.addComponent(entity, Replicated{NetworkId(i + 1), ReplicationPriority::Normal});
+        world.addComponent(entity, BenchNetTransform{state.uniform(-500.0f, 500.0f), 0.0f,
+                                                     state.uniform(-500.0f, 500.0f), 100});
+        entities.push_back(entity);
+    }
+
+    // One client that sees everything and has room for it, acking every tick
+    ReplicationClientConfig client;
+    client.interestRadius = 4096.0f;
+    client.budgetBytes = 1u << 24;
+
+    NetworkReplicator replicator(registry);
+    replicator.setClient(1, client);
+
+    std::vector<u8> update;
+    u32 tick = 0;
+    state.run([&] {
+        ++tick;
+        // A quarter of the entities move each tick
+        for (usize i = tick % 4; i < entities.size(); i += 4) {
+            world.getComponent<BenchNetTransform>(entities[i])->x += 0.25f;
+        }
+        replicator.captureSnapshot(world, tick);
+        replicator.buildUpdate(1, update);
+        replicator.acknowledge(1, tick);
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("update_bytes", static_cast<f64>(update.size()));
+});
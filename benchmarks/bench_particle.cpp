@@ -0,0 +1,43 @@
+/**
+ * @file bench_particle.cpp
+ * @brief NovaCore Engine - Particle Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/particle/particle.hpp>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::particle;
+
+NOVA_BENCHMARK("particle/update", ({10'000, 100'000, 500'000}), [](BenchmarkState& state) {
+    ParticleSystemData data;
+    data.name = "BenchParticles";
+    data.main.maxParticles = static_cast<u32>(state.size());
+    // Long-lived particles keep the count constant while the update is timed
+    data.main.startLifetime = MinMaxValue::constant(1.0e6f);
+    data.main.gravityModifier = 1.0f;
+    data.emission.enabled = false;
+    data.sizeOverLifetime.enabled = true;
+    data.colorOverLifetime.enabled = true;
+
+    ParticleEmitter emitter;
+    emitter.initialize(data);
+    emitter.play();
+    emitter.emit(static_cast<u32>(state.size()));
+
+    ForceField wind;
+    wind.name = "Wind";
+    wind.type = ForceType::Wind;
+    wind.direction = Vec3(1.0f, 0.0f, 0.0f);
+    wind.strength = 2.0f;
+    std::vector<ForceField> forces{wind};
+
+    state.run([&] { emitter.update(1.0f / 60.0f, forces); });
+    state.setItemsPerRun(emitter.getParticleCount());
+    state.counter("particles", emitter.getParticleCount());
+});
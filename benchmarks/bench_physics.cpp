@@ -0,0 +1,128 @@
+/**
+ * @file bench_physics.cpp
+ * @brief NovaCore Engine - Physics Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Bodies start packed tightly enough to touch, so every timed step has
+ * broad-phase pairs and contacts to solve. The world is reset to the same
+ * initial state before each step.
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/physics/physics.hpp>
+
+#include <cmath>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::physics;
+
+namespace {
+
+struct PhysicsScene {
+    std::unique_ptr<PhysicsWorld> world;
+    std::vector<BodyId> bodies;
+    std::vector<Vec3> initialPositions;
+};
+
+/// A square pile of spheres and boxes resting on a static ground box
+PhysicsScene buildScene(BenchmarkState& state) {
+    PhysicsWorldConfig config;
+    config.maxBodies = static_cast<u32>(state.size()) + 1;
+    config.maxContacts = static_cast<u32>(state.size()) * 8;
+    config.enableSleeping = false;
+
+    PhysicsScene scene;
+    scene.world = PhysicsWorld::create(config);
+
+    auto ground = RigidBodyDesc::staticBody(ShapeFactory::createBox(Vec3(1000.0f, 1.0f, 1000.0f)));
+    ground.position = Vec3(0.0f, -1.0f, 0.0f);
+    (void)scene.world->createBody(ground);
+
+    auto sphere = ShapeFactory::createSphere(0.5f);
+    auto box = ShapeFactory::createBox(Vec3(0.45f, 0.45f, 0.45f));
+
+    const usize side = static_cast<usize>(std::ceil(std::sqrt(static_cast<f64>(state.size()) / 4.0)));
+    constexpr f32 SPACING = 0.95f;
+    for (usize i = 0; i < state.size(); ++i) {
+        usize layer = i / (side * side);
+        usize x = i % side;
+        usize z = (i / side) % side;
+        Vec3 jitter(state.uniform(-0.05f, 0.05f), 0.0f, state.uniform(-0.05f, 0.05f));
+        Vec3 position = Vec3(static_cast<f32>(x) * SPACING, 0.5f + static_cast<f32>(layer) * SPACING,
+                             static_cast<f32>(z) * SPACING) + jitter;
+
+        auto desc = RigidBodyDesc::dynamicBody(i % 3 == 0 ? std::shared_ptr<CollisionShape>(box)
+                                                          : std::shared_ptr<CollisionShape>(sphere));
+        desc.position = position;
+        scene.bodies.push_back(scene.world->createBody(desc));
+        scene.initialPositions.push_back(position);
+    }
+    return scene;
+}
+
+void resetScene(PhysicsScene& scene) {
+    for (usize i = 0; i < scene.bodies.size(); ++i) {
+        RigidBody* body = scene.world->getBody(scene.bodies[i]);
+        body->setPosition(scene.initialPositions[i]);
+        body->setOrientation(Quat::identity());
+        body->setLinearVelocity(Vec3::zero());
+        body->setAngularVelocity(Vec3::zero());
+    }
+}
+
+void recordStats(BenchmarkState& state, const PhysicsWorld& world) {
+    const auto& stats = world.getStats();
+    state.counter("broadphase_pairs", stats.broadPhasePairs);
+    state.counter("contacts", stats.contactCount);
+    state.counter("broadphase_ms", stats.broadPhaseTime);
+    state.counter("narrowphase_ms", stats.narrowPhaseTime);
+    state.counter("solver_ms", stats.solverTime);
+}
+
+} // namespace
+
+NOVA_BENCHMARK("physics/step", ({1'000, 5'000, 20'000}), [](BenchmarkState& state) {
+    PhysicsScene scene = buildScene(state);
+    state.run([&] { resetScene(scene); }, [&] { scene.world->stepFixed(1.0f / 60.0f); });
+    state.setItemsPerRun(state.size());
+    recordStats(state, *scene.world);
+});
+
+NOVA_BENCHMARK("physics/broadphase", ({1'000, 5'000, 20'000}), [](BenchmarkState& state) {
+    // Boxes scattered over a region sized for a few neighbours each, moved
+    // slightly every iteration so the tree is refit as in a real step
+    const f32 extent = std::sqrt(static_cast<f32>(state.size())) * 2.0f;
+    std::vector<Vec3> centers(state.size());
+    for (auto& center : centers) {
+        center = Vec3(state.uniform(0.0f, extent), state.uniform(0.0f, 4.0f), state.uniform(0.0f, extent));
+    }
+
+    auto boundsAt = [](const Vec3& center) {
+        AABB bounds;
+        bounds.min = center - Vec3(0.5f);
+        bounds.max = center + Vec3(0.5f);
+        return bounds;
+    };
+
+    BVHBroadPhase broadPhase;
+    for (usize i = 0; i < centers.size(); ++i) {
+        broadPhase.addBody(static_cast<BodyId>(i + 1), boundsAt(centers[i]));
+    }
+
+    std::vector<std::pair<BodyId, BodyId>> pairs;
+    f32 offset = 0.0f;
+    state.run([&] {
+        offset = offset > 0.0f ? -0.01f : 0.01f;
+        for (usize i = 0; i < centers.size(); ++i) {
+            broadPhase.updateBody(static_cast<BodyId>(i + 1), boundsAt(centers[i] + Vec3(offset, 0.0f, 0.0f)));
+        }
+        pairs.clear();
+        broadPhase.findPairs(pairs);
+    });
+    state.setItemsPerRun(state.size());
+    state.counter("pairs", static_cast<f64>(pairs.size()));
+});
@@ -0,0 +1,234 @@
+/**
+ * @file bench_resource.cpp
+ * @brief NovaCore Engine - Resource Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Load latency through ResourceManager for files written to a temporary
+ * directory: "cold" loads go through file read and loader every time,
+ * "async" loads go through the I/O, decode and finalize pipeline, "cached"
+ * loads hit the path cache, and "pack" loads read the same files from a
+ * memory-mapped resource pack. The "contended" benchmarks issue cache hits
+ * from many threads at once, with and without a global lock around them.
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/resource/resource.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <thread>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::resource;
+
+namespace {
+
+constexpr usize FILE_COUNT = 64;
+constexpr usize CONTENDED_THREADS = 16;
+constexpr usize CONTENDED_RESOURCES = 256;
+
+class BenchBlob : public Resource {
+public:
+    void assign(const std::vector<u8>& data) { m_data = data; }
+
+protected:
+    bool load(const std::vector<u8>& data) override {
+        m_data = data;
+        return true;
+    }
+    void unload() override { m_data.clear(); }
+    usize calculateMemorySize() const override { return m_data.size(); }
+
+private:
+    std::vector<u8> m_data;
+};
+
+class BenchBlobLoader : public IResourceLoader {
+public:
+    std::vector<std::string> getSupportedExtensions() const override { return {"benchblob"}; }
+    ResourceType getResourceType() const override { return ResourceType::Unknown; }
+    bool canLoad(const ResourcePath& path) const override { return path.getExtension() == "benchblob"; }
+    std::shared_ptr<Resource> createResource() override { return std::make_shared<BenchBlob>(); }
+    bool load(Resource* resource, const std::vector<u8>& data) override {
+        static_cast<BenchBlob*>(resource)->assign(data);
+        return true;
+    }
+    const char* getName() const override { return "BenchBlobLoader"; }
+};
+
+/// Temporary mounted directory of FILE_COUNT files of state.size() bytes
+class ResourceFixture {
+public:
+    explicit ResourceFixture(BenchmarkState& state)
+        : m_root(std::filesystem::temp_directory_path() / "nova_benchmarks_resources") {
+        std::filesystem::remove_all(m_root);
+        std::filesystem::create_directories(m_root);
+
+        std::vector<char> bytes(state.size());
+        for (auto& byte : bytes) {
+            byte = static_cast<char>(state.rng()());
+        }
+        ResourcePackWriter writer;
+        for (usize i = 0; i < FILE_COUNT; ++i) {
+            std::string name = "blob" + std::to_string(i) + ".benchblob";
+            std::ofstream(m_root / name, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+            paths.emplace_back("bench/" + name);
+            packedPaths.emplace_back("packed/" + name);
+            writer.add(packedPaths.back(), std::span(reinterpret_cast<const u8*>(bytes.data()), bytes.size()));
+        }
+        packPath = (m_root / "bench.pak").string();
+        (void)writer.write(packPath);
+
+        auto& manager = ResourceManager::get();
+        manager.initialize(ResourceConfig::DEFAULT_CACHE_SIZE, 1);
+        manager.registerLoader(std::make_unique<BenchBlobLoader>());
+        manager.mount("bench", m_root.string());
+    }
+
+    ~ResourceFixture() {
+        auto& manager = ResourceManager::get();
+        manager.unmount("bench");
+        manager.shutdown();
+        std::error_code ec;
+        std::filesystem::remove_all(m_root, ec);
+    }
+
+    std::vector<ResourcePath> paths;
+    std::vector<ResourcePath> packedPaths;     ///< Same files in the pack at packPath
+    std::string packPath;
+
+private:
+    std::filesystem::path m_root;
+};
+
+/// Every thread looks up state.size() resources, spread over all of them
+template<typename Lookup>
+void contendedLookups(usize count, Lookup&& lookup) {
+    std::vector<std::thread> workers;
+    for (usize t = 0; t < CONTENDED_THREADS; ++t) {
+        workers.emplace_back([&, t] {
+            for (usize i = 0; i < count; ++i) {
+                lookup((t * 7 + i) % CONTENDED_RESOURCES);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+} // namespace
+
+NOVA_BENCHMARK("resource/load_cold", ({4'096, 65'536, 1'048'576}), [](BenchmarkState& state) {
+    ResourceFixture fixture(state);
+    auto& manager = ResourceManager::get();
+
+    state.run([&] { manager.unloadAll(); }, [&] {
+        for (const auto& path : fixture.paths) {
+            auto handle = manager.load<Resource>(path);
+            doNotOptimize(handle);
+        }
+    });
+    state.setItemsPerRun(FILE_COUNT);
+    state.counter("file_bytes", static_cast<f64>(state.size()));
+});
+
+NOVA_BENCHMARK("resource/load_pack", ({4'096, 65'536, 1'048'576}), [](BenchmarkState& state) {
+    ResourceFixture fixture(state);
+    auto& manager = ResourceManager::get();
+    manager.loadBundle(fixture.packPath);
+
+    state.run([&] { manager.unloadAll(); }, [&] {
+        for (const auto& path : fixture.packedPaths) {
+            auto handle = manager.load<Resource>(path);
+            doNotOptimize(handle);
+        }
+    });
+    state.setItemsPerRun(FILE_COUNT);
+    state.counter("file_bytes", static_cast<f64>(state.size()));
+});
+
+NOVA_BENCHMARK("resource/load_async", ({4'096, 65'536}), [](BenchmarkState& state) {
+    ResourceFixture fixture(state);
+    auto& manager = ResourceManager::get();
+    std::vector<ResourceManager::LoadFuture> futures;
+    futures.reserve(FILE_COUNT);
+
+    state.run([&] { manager.unloadAll(); }, [&] {
+        futures.clear();
+        for (const auto& path : fixture.paths) {
+            futures.push_back(manager.requestLoad(path));
+        }
+        for (auto& future : futures) {
+            // Give the pipeline threads the core between frames, as a game would
+            while (future.wait_for(std::chrono::seconds(0)) != std::future_status::ready) {
+                manager.update(0.0f);
+                std::this_thread::yield();
+            }
+        }
+    });
+    state.setItemsPerRun(FILE_COUNT);
+    state.counter("file_bytes", static_cast<f64>(state.size()));
+});
+
+NOVA_BENCHMARK("resource/load_cached", ({4'096}), [](BenchmarkState& state) {
+    ResourceFixture fixture(state);
+    auto& manager = ResourceManager::get();
+
+    std::vector<ResourceHandle<>> held;
+    for (const auto& path : fixture.paths) {
+        held.push_back(manager.load<Resource>(path));
+    }
+
+    state.run([&] {
+        for (const auto& path : fixture.paths) {
+            auto handle = manager.load<Resource>(path);
+            doNotOptimize(handle);
+        }
+    });
+    state.setItemsPerRun(FILE_COUNT);
+});
+
+namespace {
+
+/// Cache hits from CONTENDED_THREADS threads at once
+void contendedHits(BenchmarkState& state, std::mutex* globalLock) {
+    auto& manager = ResourceManager::get();
+    manager.initialize(ResourceConfig::DEFAULT_CACHE_SIZE, 1);
+    std::vector<ResourcePath> paths;
+    for (usize i = 0; i < CONTENDED_RESOURCES; ++i) {
+        paths.emplace_back("contended/" + std::to_string(i));
+        manager.registerResource(std::make_shared<BenchBlob>(), paths.back());
+    }
+
+    state.run([&] {
+        contendedLookups(state.size(), [&](usize i) {
+            std::unique_lock<std::mutex> lock;
+            if (globalLock) {
+                lock = std::unique_lock<std::mutex>(*globalLock);
+            }
+            auto handle = manager.load<Resource>(paths[i]);
+            doNotOptimize(handle);
+        });
+    });
+    state.setItemsPerRun(state.size() * CONTENDED_THREADS);
+    state.counter("threads", static_cast<f64>(CONTENDED_THREADS));
+    manager.shutdown();
+}
+
+} // namespace
+
+NOVA_BENCHMARK("resource/contended_hits", ({10'000}), [](BenchmarkState& state) {
+    contendedHits(state, nullptr);
+});
+
+NOVA_BENCHMARK("resource/contended_hits_global_lock", ({10'000}), [](BenchmarkState& state) {
+    // The same hits serialized on one mutex, as they were before the registry
+    std::mutex mutex;
+    contendedHits(state, &mutex);
+});
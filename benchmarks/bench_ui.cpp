@@ -0,0 +1,85 @@
+/**
+ * @file bench_ui.cpp
+ * @brief NovaCore Engine - UI Benchmarks
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include "benchmark.hpp"
+
+#include <nova/core/ui/ui.hpp>
+
+using namespace nova;
+using namespace nova::bench;
+using namespace nova::ui;
+
+namespace {
+
+const Rect SCREEN(0.0f, 0.0f, 1920.0f, 1080.0f);
+
+/// HUD of fixed-size panels, each holding a background and a value label
+struct Hud {
+    Container root;
+    std::vector<Label*> labels;
+};
+
+void buildHud(Hud& hud, usize panels) {
+    hud.root.getStyle().width = Dimension::pixels(SCREEN.width);
+    hud.root.getStyle().height = Dimension::pixels(SCREEN.height);
+    hud.root.getStyle().flexDirection = FlexDirection::Row;
+    hud.root.getStyle().flexWrap = FlexWrap::Wrap;
+
+    for (usize i = 0; i < panels; ++i) {
+        auto panel = std::make_unique<Container>();
+        panel->getStyle().width = Dimension::pixels(96.0f);
+        panel->getStyle().height = Dimension::pixels(24.0f);
+        panel->getStyle().backgroundColor = Color(0.1f, 0.1f, 0.1f, 0.8f);
+
+        auto label = std::make_unique<Label>("value " + std::to_string(i));
+        hud.labels.push_back(label.get());
+        panel->addChild(std::move(label));
+        hud.root.addChild(std::move(panel));
+    }
+    hud.root.layout(SCREEN);
+}
+
+void recordDrawStats(BenchmarkState& state, const UIDrawList& drawList) {
+    state.counter("vertices", drawList.stats().vertices);
+    state.counter("batches", drawList.stats().batches);
+}
+
+} // namespace
+
+NOVA_BENCHMARK("ui/draw_list_update", ({100, 1'000}), [](BenchmarkState& state) {
+    Hud hud;
+    buildHud(hud, state.size());
+
+    UIDrawList drawList;
+    drawList.build(&hud.root);
+
+    // One changing value per frame, as in a typical HUD
+    u64 frame = 0;
+    state.run([&] {
+        hud.labels[frame % hud.labels.size()]->setText("value " + std::to_string(frame));
+        ++frame;
+        hud.root.layout(SCREEN);
+        drawList.build(&hud.root);
+    });
+    state.setItemsPerRun(state.size());
+    recordDrawStats(state, drawList);
+    state.counter("widgets_rebuilt", drawList.stats().widgetsRebuilt);
+});
+
+NOVA_BENCHMARK("ui/draw_list_full", ({100, 1'000}), [](BenchmarkState& state) {
+    Hud hud;
+    buildHud(hud, state.size());
+
+    UIDrawList drawList;
+    state.run([&] {
+        drawList.clear();
+        drawList.build(&hud.root);
+    });
+    state.setItemsPerRun(state.size());
+    recordDrawStats(state, drawList);
+});
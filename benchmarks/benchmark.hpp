@@ -0,0 +1,159 @@
+/**
+ * @file benchmark.hpp
+ * @brief NovaCore Engine - Microbenchmark Harness
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Minimal harness behind the nova_benchmarks target:
+ * - Benchmarks register themselves with NOVA_BENCHMARK and run once per size
+ * - Every run gets a fixed seed, so inputs are identical between commits
+ * - Timed bodies are batched until a sample exceeds a minimum duration;
+ *   the median of several samples is reported
+ *
+ * @code
+ * NOVA_BENCHMARK("ecs/iterate", ({10'000, 100'000}), [](BenchmarkState& state) {
+ *     World world = makeWorld(state.size(), state.rng());
+ *     state.run([&] { world.each<Position, Velocity>(integrate); });
+ *     state.setItemsPerRun(state.size());
+ * });
+ * @endcode
+ */
+
+#pragma once
+
+#include <nova/core/types/types.hpp>
+
+#include <chrono>
+#include <functional>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace nova::bench {
+
+/// Problem sizes a benchmark runs at
+using Sizes = std::vector<usize>;
+
+/**
+ * @brief Harness settings shared by all benchmarks
+ */
+struct BenchmarkConfig {
+    u32 samples = 7;                                ///< Timed samples per run (median is reported)
+    std::chrono::nanoseconds minSampleTime{20'000'000}; ///< Batch iterations until a sample takes this long
+    bool quick = false;                             ///< Only run the smallest size of each benchmark
+    u64 seed = 0x5EED'C0DE;                         ///< Base seed for every run
+};
+
+/**
+ * @brief Result of one benchmark at one size
+ */
+struct BenchmarkResult {
+    std::string name;                       ///< "<benchmark>/<size>"
+    usize size = 0;
+    u64 iterations = 0;                     ///< Timed iterations across all samples
+    f64 medianNs = 0.0;                     ///< Median time per iteration
+    f64 minNs = 0.0;
+    f64 maxNs = 0.0;
+    f64 itemsPerSecond = 0.0;               ///< From the median (0 if not set)
+    std::map<std::string, f64> counters;    ///< Benchmark-specific metrics
+};
+
+/**
+ * @brief Handle a benchmark body uses to time its work
+ */
+class BenchmarkState {
+public:
+    BenchmarkState(const BenchmarkConfig& config, usize size, u64 seed)
+        : m_config(config), m_size(size), m_rng(seed) {}
+
+    /// Problem size of this run
+    [[nodiscard]] usize size() const noexcept { return m_size; }
+
+    /// Deterministic generator seeded per benchmark and size
+    [[nodiscard]] std::mt19937_64& rng() noexcept { return m_rng; }
+
+    /// Uniform float in [lo, hi) from rng()
+    [[nodiscard]] f32 uniform(f32 lo, f32 hi) {
+        return std::uniform_real_distribution<f32>(lo, hi)(m_rng);
+    }
+
+    /**
+     * @brief Time @p body; it is repeated, so it must be re-runnable
+     */
+    void run(const std::function<void()>& body);
+
+    /**
+     * @brief Time @p body after an untimed @p setup before every iteration
+     *
+     * For work that consumes its input (spawning, first-time loads).
+     */
+    void run(const std::function<void()>& setup, const std::function<void()>& body);
+
+    /// Items processed by one iteration of the body (for items/sec)
+    void setItemsPerRun(u64 items) noexcept { m_itemsPerRun = items; }
+
+    /// Record a benchmark-specific metric (last value wins)
+    void counter(const std::string& name, f64 value) { m_counters[name] = value; }
+
+    /// Summarize the timed samples
+    [[nodiscard]] BenchmarkResult result(const std::string& name) const;
+
+private:
+    const BenchmarkConfig& m_config;
+    usize m_size;
+    std::mt19937_64 m_rng;
+    u64 m_itemsPerRun = 0;
+    u64 m_iterations = 0;
+    std::vector<f64> m_samplesNs;   ///< Time per iteration of each sample
+    std::map<std::string, f64> m_counters;
+};
+
+using BenchmarkFn = std::function<void(BenchmarkState&)>;
+
+/**
+ * @brief A registered benchmark
+ */
+struct Benchmark {
+    std::string name;
+    Sizes sizes;
+    BenchmarkFn fn;
+};
+
+/**
+ * @brief Benchmarks registered in this executable, in name order
+ */
+[[nodiscard]] std::vector<Benchmark>& registry();
+
+/**
+ * @brief Static registration helper used by NOVA_BENCHMARK
+ */
+struct BenchmarkRegistrar {
+    BenchmarkRegistrar(std::string name, Sizes sizes, BenchmarkFn fn) {
+        registry().push_back({std::move(name), std::move(sizes), std::move(fn)});
+    }
+};
+
+/**
+ * @brief Keep the optimizer from discarding a computed value
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+} // namespace nova::bench
+
+#define NOVA_BENCHMARK_CONCAT_INNER(a, b) a##b
+#define NOVA_BENCHMARK_CONCAT(a, b) NOVA_BENCHMARK_CONCAT_INNER(a, b)
+
+/// Register a benchmark: NOVA_BENCHMARK("module/name", ({size, ...}), fn)
+#define NOVA_BENCHMARK(name, sizes, ...) \
+    static const ::nova::bench::BenchmarkRegistrar NOVA_BENCHMARK_CONCAT(s_novaBenchmark, __LINE__)( \
+        name, ::nova::bench::Sizes sizes, __VA_ARGS__)
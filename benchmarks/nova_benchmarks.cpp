@@ -0,0 +1,427 @@
+/**
+ * @file nova_benchmarks.cpp
+ * @brief NovaCore Engine - Microbenchmark Runner
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Usage: nova_benchmarks [options]
+ *   --filter <text>[,<text>...]   Run benchmarks whose name contains any text
+ *   --quick                       Smallest size only, shorter samples
+ *   --samples <n>                 Timed samples per run (default 7)
+ *   --min-time <ms>               Minimum duration of one sample (default 20)
+ *   --out <file.json>             Write results as JSON
+ *   --compare <file.json>         Compare medians against an earlier run
+ *   --threshold <percent>         Slowdown reported as a regression (default 10)
+ *   --list                        Print benchmark names and sizes
+ *
+ * The JSON output keeps one result per line so runs from two commits can be
+ * diffed directly. With --compare the exit code is 1 if any benchmark
+ * regressed past the threshold.
+ */
+
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <fstream>
+#include <string_view>
+#include <unordered_map>
+
+namespace nova::bench {
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+std::vector<Benchmark>& registry() {
+    static std::vector<Benchmark> benchmarks;
+    return benchmarks;
+}
+
+// ============================================================================
+// Timing
+// ============================================================================
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr u64 MAX_ITERATIONS_PER_SAMPLE = 1ull << 24;
+
+[[nodiscard]] f64 elapsedNs(Clock::time_point start) {
+    return std::chrono::duration<f64, std::nano>(Clock::now() - start).count();
+}
+
+/// Iterations needed for one sample to reach the minimum sample time
+[[nodiscard]] u64 iterationsFor(const BenchmarkConfig& config, f64 iterationNs) {
+    f64 target = static_cast<f64>(config.minSampleTime.count());
+    f64 iterations = target / std::max(iterationNs, 1.0);
+    return std::clamp<u64>(static_cast<u64>(iterations) + 1, 1, MAX_ITERATIONS_PER_SAMPLE);
+}
+
+} // namespace
+
+void BenchmarkState::run(const std::function<void()>& body) {
+    auto start = Clock::now();
+    body();     // warm-up, also sizes the samples
+    u64 iterations = iterationsFor(m_config, elapsedNs(start));
+
+    for (u32 s = 0; s < m_config.samples; ++s) {
+        start = Clock::now();
+        for (u64 i = 0; i < iterations; ++i) {
+            body();
+        }
+        m_samplesNs.push_back(elapsedNs(start) / static_cast<f64>(iterations));
+        m_iterations += iterations;
+    }
+}
+
+void BenchmarkState::run(const std::function<void()>& setup, const std::function<void()>& body) {
+    setup();
+    auto start = Clock::now();
+    body();
+    u64 iterations = iterationsFor(m_config, elapsedNs(start));
+
+    for (u32 s = 0; s < m_config.samples; ++s) {
+        f64 total = 0.0;
+        for (u64 i = 0; i < iterations; ++i) {
+            setup();
+            start = Clock::now();
+            body();
+            total += elapsedNs(start);
+        }
+        m_samplesNs.push_back(total / static_cast<f64>(iterations));
+        m_iterations += iterations;
+    }
+}
+
+BenchmarkResult BenchmarkState::result(const std::string& name) const {
+    BenchmarkResult result;
+    result.name = name;
+    result.size = m_size;
+    result.iterations = m_iterations;
+    result.counters = m_counters;
+
+    if (m_samplesNs.empty()) {
+        return result;
+    }
+
+    std::vector<f64> sorted = m_samplesNs;
+    std::sort(sorted.begin(), sorted.end());
+    usize mid = sorted.size() / 2;
+    result.medianNs = (sorted.size() % 2) ? sorted[mid] : 0.5 * (sorted[mid - 1] + sorted[mid]);
+    result.minNs = sorted.front();
+    result.maxNs = sorted.back();
+    if (m_itemsPerRun > 0 && result.medianNs > 0.0) {
+        result.itemsPerSecond = static_cast<f64>(m_itemsPerRun) * 1e9 / result.medianNs;
+    }
+    return result;
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+namespace {
+
+[[nodiscard]] std::string jsonEscape(std::string_view text) {
+    std::string out;
+    out.reserve(text.size());
+    for (char c : text) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n"; break;
+            default:   out += c; break;
+        }
+    }
+    return out;
+}
+
+[[nodiscard]] std::string jsonNumber(f64 value) {
+    char buffer[32];
+    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), value,
+                                   std::chars_format::general, 6);
+    return ec == std::errc() ? std::string(buffer, end) : std::string("0");
+}
+
+/// One result per line so successive runs diff cleanly
+void writeJson(std::ostream& out, const BenchmarkConfig& config,
+               const std::vector<BenchmarkResult>& results) {
+    out << "{\n";
+    out << "  \"format\": \"nova-benchmarks-1\",\n";
+    out << "  \"samples\": " << config.samples << ",\n";
+    out << "  \"min_sample_ns\": " << config.minSampleTime.count() << ",\n";
+    out << "  \"quick\": " << (config.quick ? "true" : "false") << ",\n";
+    out << "  \"seed\": " << config.seed << ",\n";
+    out << "  \"results\": [\n";
+    for (usize i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        out << "    {\"name\": \"" << jsonEscape(r.name) << "\""
+            << ", \"size\": " << r.size
+            << ", \"iterations\": " << r.iterations
+            << ", \"median_ns\": " << jsonNumber(r.medianNs)
+            << ", \"min_ns\": " << jsonNumber(r.minNs)
+            << ", \"max_ns\": " << jsonNumber(r.maxNs)
+            << ", \"items_per_second\": " << jsonNumber(r.itemsPerSecond)
+            << ", \"counters\": {";
+        bool first = true;
+        for (const auto& [key, value] : r.counters) {
+            out << (first ? "" : ", ") << "\"" << jsonEscape(key) << "\": " << jsonNumber(value);
+            first = false;
+        }
+        out << "}}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+[[nodiscard]] std::string formatDuration(f64 ns) {
+    char buffer[32];
+    if (ns < 1e3) {
+        std::snprintf(buffer, sizeof(buffer), "%8.1f ns", ns);
+    } else if (ns < 1e6) {
+        std::snprintf(buffer, sizeof(buffer), "%8.2f us", ns / 1e3);
+    } else if (ns < 1e9) {
+        std::snprintf(buffer, sizeof(buffer), "%8.2f ms", ns / 1e6);
+    } else {
+        std::snprintf(buffer, sizeof(buffer), "%8.2f s ", ns / 1e9);
+    }
+    return buffer;
+}
+
+void printResult(const BenchmarkResult& r) {
+    std::printf("%-44s %s  (min %s)", r.name.c_str(),
+                formatDuration(r.medianNs).c_str(), formatDuration(r.minNs).c_str());
+    if (r.itemsPerSecond > 0.0) {
+        std::printf("  %10.3f M items/s", r.itemsPerSecond / 1e6);
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+}
+
+// ============================================================================
+// Baseline Comparison
+// ============================================================================
+
+/// Extract a numeric field from one result line written by writeJson
+[[nodiscard]] bool readNumberField(std::string_view line, std::string_view key, f64& value) {
+    std::string pattern = "\"" + std::string(key) + "\": ";
+    usize pos = line.find(pattern);
+    if (pos == std::string_view::npos) {
+        return false;
+    }
+    const char* begin = line.data() + pos + pattern.size();
+    auto [end, ec] = std::from_chars(begin, line.data() + line.size(), value);
+    return ec == std::errc();
+}
+
+/// Median per result name from a file written by writeJson
+[[nodiscard]] bool loadBaseline(const std::string& path, std::unordered_map<std::string, f64>& medians) {
+    std::ifstream file(path);
+    if (!file) {
+        return false;
+    }
+    static constexpr std::string_view NAME_KEY = "{\"name\": \"";
+    std::string line;
+    while (std::getline(file, line)) {
+        usize pos = line.find(NAME_KEY);
+        if (pos == std::string::npos) {
+            continue;
+        }
+        usize begin = pos + NAME_KEY.size();
+        usize end = line.find('"', begin);
+        f64 median = 0.0;
+        if (end != std::string::npos && readNumberField(line, "median_ns", median)) {
+            medians[line.substr(begin, end - begin)] = median;
+        }
+    }
+    return true;
+}
+
+/// Print per-benchmark deltas; returns the number of regressions
+u32 compareResults(const std::vector<BenchmarkResult>& results,
+                   const std::unordered_map<std::string, f64>& baseline, f64 thresholdPercent) {
+    std::printf("\n%-44s %11s  %11s  %8s\n", "comparison", "baseline", "current", "delta");
+    u32 regressions = 0;
+    for (const auto& r : results) {
+        auto it = baseline.find(r.name);
+        if (it == baseline.end() || it->second <= 0.0) {
+            std::printf("%-44s %11s  %s  %8s\n", r.name.c_str(), "-",
+                        formatDuration(r.medianNs).c_str(), "new");
+            continue;
+        }
+        f64 delta = (r.medianNs - it->second) / it->second * 100.0;
+        bool regressed = delta > thresholdPercent;
+        regressions += regressed ? 1 : 0;
+        std::printf("%-44s %s  %s  %+7.1f%%%s\n", r.name.c_str(),
+                    formatDuration(it->second).c_str(), formatDuration(r.medianNs).c_str(),
+                    delta, regressed ? "  REGRESSION" : "");
+    }
+    return regressions;
+}
+
+// ============================================================================
+// Command Line
+// ============================================================================
+
+struct Options {
+    BenchmarkConfig config;
+    std::vector<std::string> filters;
+    std::string outPath;
+    std::string comparePath;
+    f64 thresholdPercent = 10.0;
+    bool list = false;
+};
+
+void printUsage() {
+    std::printf(
+        "usage: nova_benchmarks [--filter a,b] [--quick] [--samples n] [--min-time ms]\n"
+        "                       [--out file.json] [--compare file.json] [--threshold pct] [--list]\n");
+}
+
+[[nodiscard]] std::vector<std::string> splitList(std::string_view text) {
+    std::vector<std::string> parts;
+    while (!text.empty()) {
+        usize comma = text.find(',');
+        std::string_view part = text.substr(0, comma);
+        if (!part.empty()) {
+            parts.emplace_back(part);
+        }
+        if (comma == std::string_view::npos) {
+            break;
+        }
+        text.remove_prefix(comma + 1);
+    }
+    return parts;
+}
+
+[[nodiscard]] bool parseOptions(int argc, char** argv, Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+
+        if (arg == "--quick") {
+            options.config.quick = true;
+            options.config.samples = 3;
+            options.config.minSampleTime = std::chrono::milliseconds(2);
+        } else if (arg == "--list") {
+            options.list = true;
+        } else if (arg == "--filter") {
+            const char* value = next();
+            if (!value) return false;
+            options.filters = splitList(value);
+        } else if (arg == "--samples") {
+            const char* value = next();
+            if (!value) return false;
+            options.config.samples = static_cast<u32>(std::max(1, std::atoi(value)));
+        } else if (arg == "--min-time") {
+            const char* value = next();
+            if (!value) return false;
+            options.config.minSampleTime = std::chrono::milliseconds(std::max(1, std::atoi(value)));
+        } else if (arg == "--out") {
+            const char* value = next();
+            if (!value) return false;
+            options.outPath = value;
+        } else if (arg == "--compare") {
+            const char* value = next();
+            if (!value) return false;
+            options.comparePath = value;
+        } else if (arg == "--threshold") {
+            const char* value = next();
+            if (!value) return false;
+            options.thresholdPercent = std::atof(value);
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]] bool matchesFilter(const std::string& name, const std::vector<std::string>& filters) {
+    if (filters.empty()) {
+        return true;
+    }
+    return std::any_of(filters.begin(), filters.end(),
+                       [&](const std::string& f) { return name.find(f) != std::string::npos; });
+}
+
+/// Seed for one run: the same benchmark and size always get the same inputs
+[[nodiscard]] u64 runSeed(u64 base, const std::string& name) {
+    return base ^ fnv1aHash(name.data(), name.size());
+}
+
+} // namespace
+
+} // namespace nova::bench
+
+int main(int argc, char** argv) {
+    using namespace nova;
+    using namespace nova::bench;
+
+    Options options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 2;
+    }
+
+    auto& benchmarks = registry();
+    std::sort(benchmarks.begin(), benchmarks.end(),
+              [](const Benchmark& a, const Benchmark& b) { return a.name < b.name; });
+
+    if (options.list) {
+        for (const auto& b : benchmarks) {
+            std::printf("%s:", b.name.c_str());
+            for (usize size : b.sizes) {
+                std::printf(" %zu", size);
+            }
+            std::printf("\n");
+        }
+        return 0;
+    }
+
+    std::unordered_map<std::string, f64> baseline;
+    if (!options.comparePath.empty() && !loadBaseline(options.comparePath, baseline)) {
+        std::fprintf(stderr, "nova_benchmarks: cannot read baseline '%s'\n", options.comparePath.c_str());
+        return 2;
+    }
+
+    std::vector<BenchmarkResult> results;
+    for (const auto& b : benchmarks) {
+        if (!matchesFilter(b.name, options.filters)) {
+            continue;
+        }
+        Sizes sizes = b.sizes;
+        if (options.config.quick && !sizes.empty()) {
+            sizes = {*std::min_element(sizes.begin(), sizes.end())};
+        }
+        for (usize size : sizes) {
+            std::string name = b.name + "/" + std::to_string(size);
+            BenchmarkState state(options.config, size, runSeed(options.config.seed, name));
+            b.fn(state);
+            results.push_back(state.result(name));
+            printResult(results.back());
+        }
+    }
+
+    if (!options.outPath.empty()) {
+        std::ofstream out(options.outPath);
+        if (!out) {
+            std::fprintf(stderr, "nova_benchmarks: cannot write '%s'\n", options.outPath.c_str());
+            return 2;
+        }
+        writeJson(out, options.config, results);
+    }
+
+    if (!options.comparePath.empty()) {
+        u32 regressions = compareResults(results, baseline, options.thresholdPercent);
+        if (regressions > 0) {
+            std::printf("\n%u benchmark(s) regressed by more than %.1f%%\n",
+                        regressions, options.thresholdPercent);
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -12,6 +12,7 @@
 
 #include "animation_types.hpp"
 #include "animation_system.hpp"
+#include "cooked_animation.hpp"
 
 namespace nova::animation {
 
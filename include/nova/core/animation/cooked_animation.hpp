@@ -0,0 +1,297 @@
+/**
+ * @file cooked_animation.hpp
+ * @brief NovaCore Animation System™ - Cooked Skeleton and Clip Formats
+ *
+ * Runtime-ready binary forms of SkeletonData and AnimationClipData, written
+ * offline by nova_cook and used in place from a mapped file:
+ * - Fixed header, then dense POD tables addressed by offsets from the start
+ *   of the blob, so no pointers need fixing up after mapping
+ * - Bones ordered parents first, with a pre-built name hash index
+ * - Keyframes sorted by time and stored contiguously per clip
+ * - Names in one string table, referenced by offset and length
+ *
+ * A blob is validated once when it is viewed; accessors do no bounds checks.
+ *
+ * Skeleton layout (little-endian):
+ * @code
+ *     CookedSkeletonHeader
+ *     CookedBone[boneCount]          parents before children
+ *     u32 index[indexSize]           bone + 1 per slot, 0 = empty
+ *     char names[namesSize]          not terminated
+ * @endcode
+ *
+ * Clip layout:
+ * @code
+ *     CookedClipHeader
+ *     CookedChannel[channelCount]    ordered by bone index
+ *     CookedVec3Key[positionKeyCount]
+ *     CookedQuatKey[rotationKeyCount]
+ *     CookedVec3Key[scaleKeyCount]
+ *     CookedEvent[eventCount]        ordered by time
+ *     char names[namesSize]
+ * @endcode
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#pragma once
+
+#include "animation_types.hpp"
+
+#include <nova/core/types/result.hpp>
+
+#include <bit>
+#include <span>
+#include <string_view>
+
+namespace nova::animation {
+
+static_assert(std::endian::native == std::endian::little,
+              "Cooked animation data is used in place and assumes a little-endian host");
+
+// ============================================================================
+// Format
+// ============================================================================
+
+namespace CookedFormat {
+    constexpr u32 SKELETON_MAGIC = 0x4B53564E;      // "NVSK"
+    constexpr u32 SKELETON_VERSION = 2;             // Version 1 is the streamed source format
+    constexpr u32 CLIP_MAGIC = 0x4E41564E;          // "NVAN"
+    constexpr u32 CLIP_VERSION = 1;
+    constexpr u32 TABLE_ALIGNMENT = 16;
+}
+
+/**
+ * @brief Hash of a bone name, as stored in cooked data
+ */
+[[nodiscard]] inline u32 boneNameHash(std::string_view name) noexcept {
+    return static_cast<u32>(fnv1aHash(name.data(), name.size()));
+}
+
+struct CookedSkeletonHeader {
+    u32 magic = CookedFormat::SKELETON_MAGIC;
+    u32 version = CookedFormat::SKELETON_VERSION;
+    u64 fileSize = 0;
+    u32 boneCount = 0;
+    u32 indexSize = 0;          ///< Index slots, a power of two
+    u32 bonesOffset = 0;
+    u32 indexOffset = 0;
+    u32 namesOffset = 0;
+    u32 namesSize = 0;
+    u32 nameOffset = 0;         ///< Skeleton name in the name table
+    u32 nameLength = 0;
+};
+
+struct CookedBone {
+    f32 inverseBindMatrix[16];  ///< Column-major
+    f32 position[3];
+    f32 rotation[4];            ///< Quaternion xyzw
+    f32 scale[3];
+    f32 minRotation[3];
+    f32 maxRotation[3];
+    i32 parentIndex;            ///< Less than the bone's own index, -1 for roots
+    u32 nameHash;               ///< boneNameHash() of the name
+    u32 nameOffset;
+    u32 nameLength;
+};
+
+struct CookedClipHeader {
+    u32 magic = CookedFormat::CLIP_MAGIC;
+    u32 version = CookedFormat::CLIP_VERSION;
+    u64 fileSize = 0;
+    f32 duration = 0.0f;
+    f32 framesPerSecond = 30.0f;
+    u32 channelCount = 0;
+    u32 eventCount = 0;
+    u32 positionKeyCount = 0;
+    u32 rotationKeyCount = 0;
+    u32 scaleKeyCount = 0;
+    u32 flags = 0;              ///< CookedClipHeader::ROOT_MOTION
+    f32 rootMotionPosition[3] = {};
+    f32 rootMotionRotation = 0.0f;
+    u32 channelsOffset = 0;
+    u32 positionKeysOffset = 0;
+    u32 rotationKeysOffset = 0;
+    u32 scaleKeysOffset = 0;
+    u32 eventsOffset = 0;
+    u32 namesOffset = 0;
+    u32 namesSize = 0;
+    u32 nameOffset = 0;
+    u32 nameLength = 0;
+    u32 reserved = 0;
+
+    static constexpr u32 ROOT_MOTION = 1u << 0;
+};
+
+struct CookedChannel {
+    i32 boneIndex;
+    u32 boneNameHash;           ///< For remapping onto another skeleton
+    u32 nameOffset;
+    u32 nameLength;
+    u32 firstPositionKey;
+    u32 positionKeyCount;
+    u32 firstRotationKey;
+    u32 rotationKeyCount;
+    u32 firstScaleKey;
+    u32 scaleKeyCount;
+};
+
+struct CookedVec3Key {
+    f32 time;
+    f32 value[3];
+    f32 inTangent[3];
+    f32 outTangent[3];
+    u32 interpolation;          ///< InterpolationMode
+};
+
+struct CookedQuatKey {
+    f32 time;
+    f32 value[4];               ///< xyzw
+    u32 interpolation;
+};
+
+struct CookedEvent {
+    f32 time;
+    u32 type;                   ///< AnimationEventType
+    i32 intParam;
+    f32 floatParam;
+    u32 nameOffset;
+    u32 nameLength;
+    u32 stringOffset;
+    u32 stringLength;
+};
+
+static_assert(sizeof(CookedSkeletonHeader) == 48);
+static_assert(sizeof(CookedBone) == 144);
+static_assert(sizeof(CookedClipHeader) == 104);
+static_assert(sizeof(CookedChannel) == 40);
+static_assert(sizeof(CookedVec3Key) == 44);
+static_assert(sizeof(CookedQuatKey) == 24);
+static_assert(sizeof(CookedEvent) == 32);
+
+// ============================================================================
+// Views
+// ============================================================================
+
+/**
+ * @brief Validated view of a cooked skeleton
+ *
+ * @code
+ *     auto file = MappedFile::open("characters/hero.nvskel");
+ *     if (auto skeleton = CookedSkeleton::view(file->bytes())) {
+ *         i32 hand = skeleton->findBone("RightHand");
+ *     }
+ * @endcode
+ *
+ * @note Does not own the blob; it must outlive the view.
+ */
+class CookedSkeleton {
+public:
+    /**
+     * @brief Whether a blob starts like a cooked skeleton of this version
+     */
+    [[nodiscard]] static bool isCooked(std::span<const u8> blob) noexcept;
+
+    /**
+     * @brief Validate a blob and view it
+     */
+    [[nodiscard]] static Result<CookedSkeleton> view(std::span<const u8> blob);
+
+    [[nodiscard]] std::string_view getName() const noexcept { return name(m_header->nameOffset, m_header->nameLength); }
+    [[nodiscard]] std::span<const CookedBone> getBones() const noexcept { return m_bones; }
+    [[nodiscard]] std::string_view getBoneName(const CookedBone& bone) const noexcept {
+        return name(bone.nameOffset, bone.nameLength);
+    }
+
+    /**
+     * @brief Bone index by name through the cooked hash index, -1 if absent
+     */
+    [[nodiscard]] i32 findBone(std::string_view boneName) const noexcept;
+
+    /**
+     * @brief Copy into the runtime representation
+     */
+    [[nodiscard]] SkeletonData unpack() const;
+
+private:
+    CookedSkeleton() = default;
+
+    std::string_view name(u32 offset, u32 length) const noexcept { return {m_names + offset, length}; }
+
+    const CookedSkeletonHeader* m_header = nullptr;
+    std::span<const CookedBone> m_bones;
+    std::span<const u32> m_index;
+    const char* m_names = nullptr;
+};
+
+/**
+ * @brief Validated view of a cooked animation clip
+ *
+ * @note Does not own the blob; it must outlive the view.
+ */
+class CookedClip {
+public:
+    [[nodiscard]] static bool isCooked(std::span<const u8> blob) noexcept;
+    [[nodiscard]] static Result<CookedClip> view(std::span<const u8> blob);
+
+    [[nodiscard]] const CookedClipHeader& getHeader() const noexcept { return *m_header; }
+    [[nodiscard]] std::string_view getName() const noexcept { return name(m_header->nameOffset, m_header->nameLength); }
+    [[nodiscard]] std::span<const CookedChannel> getChannels() const noexcept { return m_channels; }
+    [[nodiscard]] std::span<const CookedEvent> getEvents() const noexcept { return m_events; }
+    [[nodiscard]] std::string_view getBoneName(const CookedChannel& channel) const noexcept {
+        return name(channel.nameOffset, channel.nameLength);
+    }
+
+    /// Keys of a channel, sorted by time
+    [[nodiscard]] std::span<const CookedVec3Key> getPositionKeys(const CookedChannel& channel) const noexcept {
+        return m_positionKeys.subspan(channel.firstPositionKey, channel.positionKeyCount);
+    }
+    [[nodiscard]] std::span<const CookedQuatKey> getRotationKeys(const CookedChannel& channel) const noexcept {
+        return m_rotationKeys.subspan(channel.firstRotationKey, channel.rotationKeyCount);
+    }
+    [[nodiscard]] std::span<const CookedVec3Key> getScaleKeys(const CookedChannel& channel) const noexcept {
+        return m_scaleKeys.subspan(channel.firstScaleKey, channel.scaleKeyCount);
+    }
+
+    /**
+     * @brief Copy into the runtime representation
+     */
+    [[nodiscard]] AnimationClipData unpack() const;
+
+private:
+    CookedClip() = default;
+
+    std::string_view name(u32 offset, u32 length) const noexcept { return {m_names + offset, length}; }
+
+    const CookedClipHeader* m_header = nullptr;
+    std::span<const CookedChannel> m_channels;
+    std::span<const CookedVec3Key> m_positionKeys;
+    std::span<const CookedQuatKey> m_rotationKeys;
+    std::span<const CookedVec3Key> m_scaleKeys;
+    std::span<const CookedEvent> m_events;
+    const char* m_names = nullptr;
+};
+
+// ============================================================================
+// Cooking
+// ============================================================================
+
+/**
+ * @brief Cook a skeleton
+ * @return validation error if a bone's parent does not come before it;
+ *         the sampler builds world transforms in one pass over that order
+ */
+[[nodiscard]] Result<std::vector<u8>> cookSkeleton(const SkeletonData& skeleton);
+
+/**
+ * @brief Cook a clip, sorting its keys and events by time
+ */
+[[nodiscard]] Result<std::vector<u8>> cookClip(const AnimationClipData& clip);
+
+/**
+ * @brief Read a skeleton in the streamed source format (.nvskel version 1)
+ */
+[[nodiscard]] Result<SkeletonData> readSkeletonSource(std::span<const u8> data);
+
+} // namespace nova::animation
@@ -22,6 +22,7 @@
 #include <unordered_map>
 #include <memory>
 #include <cassert>
+#include <cstdlib>
 
 namespace nova::ecs {
 
@@ -41,8 +42,13 @@ public:
     static constexpr usize DEFAULT_SIZE = 16 * 1024;
     
 private:
-    /// Raw storage for the chunk
-    std::unique_ptr<u8[]> m_storage;
+    /// Returns chunk storage to the general allocator
+    struct StorageDeleter {
+        void operator()(u8* ptr) const noexcept { memory::generalAllocator().deallocate(ptr); }
+    };
+
+    /// Raw storage for the chunk (cache-line aligned)
+    std::unique_ptr<u8[], StorageDeleter> m_storage;
     
     /// Total size of the chunk in bytes
     usize m_size = 0;
@@ -71,7 +77,11 @@ public:
     void initialize(const std::vector<const ComponentInfo*>& componentInfos,
                     usize chunkSize = DEFAULT_SIZE) {
         m_size = chunkSize;
-        m_storage = std::make_unique<u8[]>(chunkSize);
+        m_storage.reset(static_cast<u8*>(memory::generalAllocator().allocate(chunkSize, memory::CACHE_LINE_SIZE)));
+        if (!m_storage) {
+            // Entity moves cannot fail, so running out of chunk memory is fatal
+            std::abort();
+        }
         std::memset(m_storage.get(), 0, chunkSize);
         
         // Calculate storage layout
@@ -380,9 +390,11 @@ public:
         Entity movedEntity = chunk->remove(row, m_componentInfos);
         --m_entityCount;
         
-        // Clean up empty chunks (but keep at least one for reuse)
-        if (chunk->isEmpty() && m_chunks.size() > 1) {
-            m_chunks.erase(m_chunks.begin() + chunkIndex);
+        // Clean up an empty trailing chunk (but keep at least one for reuse).
+        // Erasing any other chunk would shift the chunk indices stored in
+        // entity locations.
+        if (chunk->isEmpty() && m_chunks.size() > 1 && chunkIndex == m_chunks.size() - 1) {
+            m_chunks.pop_back();
         }
         
         return movedEntity;
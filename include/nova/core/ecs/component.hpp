@@ -17,8 +17,9 @@
 #pragma once
 
 #include "nova/core/types/types.hpp"
-#include <typeinfo>
+#include <array>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 #include <functional>
@@ -96,6 +97,41 @@ inline ComponentId getNextComponentId() {
     return g_nextComponentId.fetch_add(1, std::memory_order_relaxed);
 }
 
+namespace detail {
+
+/// Function signature naming T; read at compile time since RTTI is disabled
+template<typename T>
+constexpr std::string_view typeSignature() noexcept {
+#if defined(_MSC_VER)
+    return __FUNCSIG__;
+#else
+    return __PRETTY_FUNCTION__;
+#endif
+}
+
+/// Spelling of T, cut out of typeSignature<T>() using a probe type's offsets
+template<typename T>
+constexpr std::string_view typeName() noexcept {
+    constexpr std::string_view probe = typeSignature<double>();
+    constexpr usize prefix = probe.find("double");
+    constexpr usize suffix = probe.size() - prefix - std::string_view("double").size();
+    constexpr std::string_view signature = typeSignature<T>();
+    return signature.substr(prefix, signature.size() - prefix - suffix);
+}
+
+/// Null-terminated copy of typeName<T>() with static storage
+template<typename T>
+inline constexpr auto TYPE_NAME_STORAGE = [] {
+    constexpr std::string_view name = typeName<T>();
+    std::array<char, name.size() + 1> storage{};
+    for (usize i = 0; i < name.size(); ++i) {
+        storage[i] = name[i];
+    }
+    return storage;
+}();
+
+} // namespace detail
+
 /**
  * @brief Component type traits providing compile-time type ID
  * 
@@ -125,8 +161,8 @@ private:
         info.id = id();
         info.size = sizeof(T);
         info.alignment = alignof(T);
-        info.name = typeid(T).name();
-        info.typeHash = runtimeHash(typeid(T).name());
+        info.name = detail::TYPE_NAME_STORAGE<T>.data();
+        info.typeHash = runtimeHash(info.name);
         info.isTrivial = std::is_trivially_copyable_v<T>;
         
         // Setup construction/destruction functions
@@ -409,7 +445,7 @@ namespace std {
     template<>
     struct hash<nova::ecs::ComponentMask> {
         size_t operator()(const nova::ecs::ComponentMask& mask) const noexcept {
-            return static_cast<size_t>(mask.hash());
+            return mask.hash();
         }
     };
 }
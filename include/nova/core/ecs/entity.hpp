@@ -77,8 +77,8 @@ public:
     /// Construct from index and generation
     constexpr Entity(u32 index, u32 generation, u8 flags = 0) noexcept
         : m_id(static_cast<u64>(index) |
-               (static_cast<u64>(generation & GENERATION_MASK) << GENERATION_SHIFT) |
-               (static_cast<u64>(flags & FLAG_MASK) << FLAG_SHIFT)) {}
+               ((generation & GENERATION_MASK) << GENERATION_SHIFT) |
+               ((flags & FLAG_MASK) << FLAG_SHIFT)) {}
     
     /// Get the entity index
     [[nodiscard]] constexpr u32 index() const noexcept {
@@ -374,7 +374,7 @@ public:
         
         ScopedLock scopedLock(m_lock);
         u32 index = entity.index();
-        m_records[index].flags &= ~Entity::FLAG_LOCKED;
+        m_records[index].flags = static_cast<u8>(m_records[index].flags & ~Entity::FLAG_LOCKED);
         return true;
     }
     
@@ -397,7 +397,7 @@ namespace std {
     template<>
     struct hash<nova::ecs::Entity> {
         size_t operator()(const nova::ecs::Entity& entity) const noexcept {
-            return static_cast<size_t>(entity.hash());
+            return entity.hash();
         }
     };
 }
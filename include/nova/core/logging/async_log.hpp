@@ -0,0 +1,268 @@
+// =============================================================================
+// NovaCore Engine - Asynchronous Logging Backend
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Building blocks for Logger's async mode:
+// - Per-thread single-producer/single-consumer byte ring buffers
+// - Binary encoding of format arguments on the logging thread
+// - Deferred std::format on the backend thread
+// =============================================================================
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+#include "nova/core/types/types.hpp"
+
+namespace nova::logging {
+
+enum class LogLevel : u8;
+enum class LogCategory : u16;
+
+// =============================================================================
+// Configuration
+// =============================================================================
+
+/// @brief What a logging thread does when its ring buffer is full
+enum class LogOverflowPolicy : u8 {
+    Block,  ///< Wait for the backend to make room (no message is lost)
+    Drop,   ///< Discard the message silently
+    Count   ///< Discard the message; the backend reports how many were lost
+};
+
+/// @brief Async logging configuration
+struct AsyncLogConfig {
+    usize bufferSize = 256 * 1024;                          ///< Ring size per thread (rounded to a power of two)
+    LogOverflowPolicy overflowPolicy = LogOverflowPolicy::Block;
+    std::chrono::microseconds pollInterval{1000};           ///< Backend sleep when all rings are empty
+};
+
+/// @brief Async logging counters (totals across all threads)
+struct AsyncLogStats {
+    u64 enqueued = 0;   ///< Messages written to a ring buffer
+    u64 dropped = 0;    ///< Messages discarded because a ring was full
+    u64 blocked = 0;    ///< Times a logging thread waited for space
+    u64 processed = 0;  ///< Messages delivered to sinks
+    u32 threads = 0;    ///< Registered logging threads
+};
+
+namespace detail {
+
+// =============================================================================
+// Argument Encoding
+// =============================================================================
+
+/// @brief Strings whose std::formatter behaves exactly like string_view's
+template<typename T>
+inline constexpr bool isStringLogArg =
+    std::is_same_v<std::decay_t<T>, std::string> || std::is_same_v<std::decay_t<T>, std::string_view> ||
+    std::is_same_v<std::decay_t<T>, const char*> || std::is_same_v<std::decay_t<T>, char*>;
+
+/// @brief Type an argument is stored as in a log record
+/// @note Stored types format like the originals, so a format string checked
+///       against the caller's argument types stays valid on the backend
+template<typename T>
+using LogArgStorage = std::conditional_t<isStringLogArg<T>, std::string_view, std::decay_t<T>>;
+
+/// @brief Arguments that can be copied into a ring buffer as bytes
+template<typename T>
+inline constexpr bool isEncodableLogArg =
+    std::is_same_v<LogArgStorage<T>, std::string_view> ||
+    (std::is_trivially_copyable_v<std::decay_t<T>> &&
+     std::is_default_constructible_v<std::decay_t<T>> &&
+     !std::is_pointer_v<std::decay_t<T>>);
+
+template<typename T>
+[[nodiscard]] usize encodedLogArgSize(const T& arg) noexcept {
+    if constexpr (std::is_same_v<LogArgStorage<T>, std::string_view>) {
+        return sizeof(u32) + std::string_view(arg).size();
+    } else {
+        return sizeof(T);
+    }
+}
+
+template<typename T>
+std::byte* encodeLogArg(std::byte* out, const T& arg) noexcept {
+    if constexpr (std::is_same_v<LogArgStorage<T>, std::string_view>) {
+        std::string_view text(arg);
+        auto length = static_cast<u32>(text.size());
+        std::memcpy(out, &length, sizeof(length));
+        std::memcpy(out + sizeof(length), text.data(), length);
+        return out + sizeof(length) + length;
+    } else {
+        std::memcpy(out, &arg, sizeof(T));
+        return out + sizeof(T);
+    }
+}
+
+template<typename T>
+const std::byte* decodeLogArg(const std::byte* in, T& out) noexcept {
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        u32 length = 0;
+        std::memcpy(&length, in, sizeof(length));
+        out = std::string_view(reinterpret_cast<const char*>(in + sizeof(length)), length);
+        return in + sizeof(length) + length;
+    } else {
+        std::memcpy(&out, in, sizeof(T));
+        return in + sizeof(T);
+    }
+}
+
+/// @brief Formats a record payload; runs on the backend thread
+using LogFormatFn = void (*)(std::string& out, std::string_view fmt, const std::byte* args);
+
+/// @brief Decode the arguments of one record and format them
+template<typename... Args>
+void formatLogRecord(std::string& out, std::string_view fmt, const std::byte* args) {
+    std::tuple<LogArgStorage<Args>...> values;
+    std::apply([&](auto&... value) { ((args = decodeLogArg(args, value)), ...); }, values);
+    std::apply([&](auto&... value) {
+        std::vformat_to(std::back_inserter(out), fmt, std::make_format_args(value...));
+    }, values);
+}
+
+// =============================================================================
+// Log Record
+// =============================================================================
+
+/// @brief Fixed header preceding each record in a ring buffer
+struct LogRecordHeader {
+    u32 size;               ///< Header + payload, rounded up to the record alignment
+    u32 line;
+    LogLevel level;
+    LogCategory category;
+    i64 timestampNs;        ///< system_clock time since epoch
+    const char* file;       ///< Static storage (std::source_location)
+    const char* function;   ///< Static storage (std::source_location)
+    const char* fmt;        ///< Static storage (format string literal)
+    u32 fmtSize;
+    u32 threadId;
+    LogFormatFn format;     ///< Null: payload is the preformatted message
+};
+
+inline constexpr usize LOG_RECORD_ALIGNMENT = alignof(LogRecordHeader);
+
+// =============================================================================
+// Ring Buffer
+// =============================================================================
+
+/// @brief Lock-free single-producer/single-consumer byte ring
+///
+/// Records are contiguous: when one does not fit before the end of the
+/// buffer, the producer skips to the start (writing a zero-sized header as
+/// a wrap marker when there is room for one).
+class LogRingBuffer {
+public:
+    explicit LogRingBuffer(usize capacity)
+        : m_capacity(roundCapacity(capacity))
+        , m_data(std::make_unique<std::byte[]>(m_capacity)) {}
+
+    [[nodiscard]] usize capacity() const noexcept { return m_capacity; }
+
+    /// @brief Reserve a contiguous record; returns null if the ring is full
+    [[nodiscard]] std::byte* tryReserve(usize size) noexcept {
+        size = alignRecord(size);
+        if (size > m_capacity) return nullptr;
+
+        u64 tail = m_tail.load(std::memory_order_relaxed);
+        usize offset = tail & (m_capacity - 1);
+        usize skip = (m_capacity - offset < size) ? m_capacity - offset : 0;
+
+        if (tail + skip + size - m_cachedHead > m_capacity) {
+            m_cachedHead = m_head.load(std::memory_order_acquire);
+            if (tail + skip + size - m_cachedHead > m_capacity) {
+                return nullptr;
+            }
+        }
+
+        if (skip >= sizeof(LogRecordHeader)) {
+            auto* marker = reinterpret_cast<LogRecordHeader*>(m_data.get() + offset);
+            marker->size = 0;
+        }
+        m_pendingTail = tail + skip + size;
+        return m_data.get() + (skip ? 0 : offset);
+    }
+
+    /// @brief Publish the record returned by the last tryReserve
+    void commit() noexcept { m_tail.store(m_pendingTail, std::memory_order_release); }
+
+    /// @brief Next readable record, or null if the ring is empty
+    [[nodiscard]] const LogRecordHeader* peek() noexcept {
+        for (;;) {
+            u64 head = m_head.load(std::memory_order_relaxed);
+            if (head == m_tail.load(std::memory_order_acquire)) return nullptr;
+
+            usize offset = head & (m_capacity - 1);
+            usize remaining = m_capacity - offset;
+            if (remaining < sizeof(LogRecordHeader)) {
+                m_head.store(head + remaining, std::memory_order_release);
+                continue;
+            }
+
+            const auto* record = reinterpret_cast<const LogRecordHeader*>(m_data.get() + offset);
+            if (record->size == 0) {
+                m_head.store(head + remaining, std::memory_order_release);
+                continue;
+            }
+            return record;
+        }
+    }
+
+    /// @brief Release the record returned by peek
+    void pop(const LogRecordHeader* record) noexcept {
+        m_head.store(m_head.load(std::memory_order_relaxed) + record->size, std::memory_order_release);
+    }
+
+    [[nodiscard]] bool empty() const noexcept {
+        return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire);
+    }
+
+    [[nodiscard]] static constexpr usize alignRecord(usize size) noexcept {
+        return (size + LOG_RECORD_ALIGNMENT - 1) & ~(LOG_RECORD_ALIGNMENT - 1);
+    }
+
+private:
+    [[nodiscard]] static usize roundCapacity(usize capacity) noexcept {
+        usize rounded = 1024;
+        while (rounded < capacity) rounded <<= 1;
+        return rounded;
+    }
+
+    usize m_capacity;
+    std::unique_ptr<std::byte[]> m_data;
+
+    // Producer side
+    alignas(64) std::atomic<u64> m_tail{0};
+    u64 m_pendingTail = 0;
+    u64 m_cachedHead = 0;
+
+    // Consumer side
+    alignas(64) std::atomic<u64> m_head{0};
+};
+
+/// @brief Ring buffer and counters owned by one logging thread
+struct LogThreadBuffer {
+    LogThreadBuffer(usize capacity, u32 id) : ring(capacity), threadId(id) {}
+
+    LogRingBuffer ring;
+    u32 threadId;
+    std::atomic<u64> enqueued{0};
+    std::atomic<u64> dropped{0};
+    std::atomic<u64> blocked{0};
+    std::atomic<bool> writing{false};   ///< Owning thread is between reserve and commit
+    std::atomic<bool> retired{false};   ///< Owning thread has exited
+};
+
+} // namespace detail
+
+} // namespace nova::logging
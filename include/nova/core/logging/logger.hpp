@@ -23,8 +23,13 @@
 #include <array>
 #include <atomic>
 #include <mutex>
+#include <condition_variable>
+#include <memory>
+#include <thread>
+#include <vector>
 
 #include "nova/core/types/types.hpp"
+#include "nova/core/logging/async_log.hpp"
 
 namespace nova::logging {
 
@@ -225,19 +230,83 @@ public:
              const std::source_location& loc = std::source_location::current());
     
     /// @brief Formatted log message
+    /// @note In async mode, string and trivially copyable arguments are copied
+    ///       into the thread's ring buffer and formatted on the backend thread;
+    ///       messages with other argument types are formatted here first.
     template<typename... Args>
     void logFmt(LogLevel level, LogCategory category,
                 std::format_string<Args...> fmt, Args&&... args) {
         if (!shouldLog(level, category)) return;
+        if constexpr ((detail::isEncodableLogArg<Args> && ...)) {
+            if (m_async.load(std::memory_order_acquire) &&
+                enqueueDeferred<Args...>(level, category, fmt.get(), args...)) {
+                return;
+            }
+        }
         log(level, category, std::format(fmt, std::forward<Args>(args)...));
     }
     
     /// @brief Flush all sinks
+    /// @note In async mode, waits until every message logged before the call
+    ///       has been delivered
     void flush();
     
+    // -------------------------------------------------------------------------
+    // Async Mode
+    // -------------------------------------------------------------------------
+    
+    /// @brief Switch to asynchronous logging
+    ///
+    /// Each logging thread gets its own lock-free ring buffer; a background
+    /// thread formats the records and writes them to the sinks. Sinks are
+    /// then only called from that thread (and from flush()).
+    void startAsync(const AsyncLogConfig& config = {});
+    
+    /// @brief Drain all pending messages and return to synchronous logging
+    void stopAsync();
+    
+    /// @brief Check if async mode is active
+    [[nodiscard]] bool isAsync() const noexcept { return m_async.load(std::memory_order_acquire); }
+    
+    /// @brief Get async counters (zero when async mode never ran)
+    [[nodiscard]] AsyncLogStats getAsyncStats() const;
+    
 private:
+    /// @brief Space for one record in the calling thread's ring buffer
+    struct AsyncReservation {
+        detail::LogThreadBuffer* buffer = nullptr;
+        detail::LogRecordHeader* header = nullptr;   ///< Null when the message was dropped
+        bool accepted = false;                       ///< False when async mode is off
+    };
+    
+    template<typename... Args>
+    bool enqueueDeferred(LogLevel level, LogCategory category,
+                         std::string_view fmt, const Args&... args) {
+        usize payload = (usize{0} + ... + detail::encodedLogArgSize(args));
+        AsyncReservation slot = reserveAsync(level, category, payload);
+        if (!slot.accepted) return false;
+        if (slot.header) {
+            slot.header->fmt = fmt.data();
+            slot.header->fmtSize = static_cast<u32>(fmt.size());
+            slot.header->format = &detail::formatLogRecord<Args...>;
+            [[maybe_unused]] auto* cursor = reinterpret_cast<std::byte*>(slot.header + 1);
+            ((cursor = detail::encodeLogArg(cursor, args)), ...);
+            commitAsync(slot, level);
+        }
+        return true;
+    }
+    
+    AsyncReservation reserveAsync(LogLevel level, LogCategory category, usize payloadSize,
+                                  const char* file = nullptr, const char* function = nullptr,
+                                  u32 line = 0);
+    void commitAsync(const AsyncReservation& slot, LogLevel level);
+    void asyncThreadMain();
+    void retireBuffers();
+    usize drainAsync();
+    void writeToSinks(const LogMessage& msg);
+    
     Logger() = default;
-    ~Logger() = default;
+    ~Logger();
     
     Logger(const Logger&) = delete;
     Logger& operator=(const Logger&) = delete;
@@ -250,6 +319,29 @@ private:
     
     // Default console sink
     ConsoleSink m_consoleSink;
+    
+    // Async mode
+    std::atomic<bool> m_async{false};
+    AsyncLogConfig m_asyncConfig;
+    std::thread m_asyncThread;
+    bool m_asyncStop{false};
+    std::mutex m_asyncMutex;                    ///< Guards the wake/flush state below
+    std::condition_variable m_asyncWake;
+    std::condition_variable m_flushDone;
+    u64 m_flushRequested{0};
+    u64 m_flushCompleted{0};
+    
+    mutable std::mutex m_bufferMutex;           ///< Guards m_buffers and m_retiredStats
+    std::vector<std::shared_ptr<detail::LogThreadBuffer>> m_buffers;
+    std::vector<std::shared_ptr<detail::LogThreadBuffer>> m_drainList;  ///< Backend thread only
+    std::atomic<u64> m_bufferGeneration{0};
+    // Copies of m_asyncConfig for writer threads, published by the generation bump
+    std::atomic<usize> m_asyncBufferSize{0};
+    std::atomic<LogOverflowPolicy> m_asyncOverflowPolicy{LogOverflowPolicy::Block};
+    AsyncLogStats m_retiredStats;               ///< Counters of buffers whose thread exited
+    std::atomic<u64> m_processed{0};
+    u64 m_reportedDrops{0};
+    LogMessage m_asyncMessage{};                ///< Reused by the backend thread
 };
 
 // =============================================================================
@@ -11,6 +11,7 @@
 
 #include "nova/core/logging/logger.hpp"
 #include "nova/core/logging/profiler.hpp"
+#include "nova/core/logging/metrics.hpp"
 
 namespace nova::logging {
 
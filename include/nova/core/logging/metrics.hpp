@@ -0,0 +1,294 @@
+// =============================================================================
+// NovaCore Engine - Metrics Registry
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Always-on runtime telemetry shared by all subsystems:
+// - Counters (monotonic totals) and gauges (last value)
+// - Log-linear latency histograms with 1/16 relative precision whose
+//   percentiles cover a rolling window of recent activity
+// - Lock-free updates from any thread; registration takes a lock, so hot
+//   paths look a metric up once and keep the reference
+// - Snapshots and Prometheus-style text output for live servers
+// =============================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "nova/core/types/types.hpp"
+
+namespace nova::profiling {
+
+// =============================================================================
+// Counter
+// =============================================================================
+
+/// @brief Monotonic total (events, bytes, cache hits)
+class Counter {
+public:
+    void add(u64 amount = 1) noexcept { m_value.fetch_add(amount, std::memory_order_relaxed); }
+    [[nodiscard]] u64 value() const noexcept { return m_value.load(std::memory_order_relaxed); }
+    void reset() noexcept { m_value.store(0, std::memory_order_relaxed); }
+
+private:
+    alignas(64) std::atomic<u64> m_value{0};
+};
+
+// =============================================================================
+// Gauge
+// =============================================================================
+
+/// @brief Instantaneous value (body count, memory in use)
+class Gauge {
+public:
+    void set(f64 value) noexcept { m_value.store(value, std::memory_order_relaxed); }
+    void add(f64 delta) noexcept { m_value.fetch_add(delta, std::memory_order_relaxed); }
+    [[nodiscard]] f64 value() const noexcept { return m_value.load(std::memory_order_relaxed); }
+    void reset() noexcept { set(0.0); }
+
+private:
+    alignas(64) std::atomic<f64> m_value{0.0};
+};
+
+// =============================================================================
+// Histogram
+// =============================================================================
+
+/// @brief Summary of a histogram (durations in nanoseconds)
+struct HistogramSnapshot {
+    std::string name;
+    u64 count = 0;          ///< Lifetime samples
+    u64 sum = 0;            ///< Lifetime sum
+    u64 min = 0;            ///< Lifetime minimum
+    u64 max = 0;            ///< Lifetime maximum
+    u64 windowCount = 0;    ///< Samples in the rolling window
+    u64 p50 = 0;            ///< Rolling-window percentiles
+    u64 p90 = 0;
+    u64 p99 = 0;
+    u64 p999 = 0;
+
+    [[nodiscard]] f64 mean() const noexcept {
+        return count > 0 ? static_cast<f64>(sum) / static_cast<f64>(count) : 0.0;
+    }
+};
+
+/**
+ * @brief Latency histogram with log-linear buckets
+ *
+ * Values below 32 get exact buckets; above that every power of two is split
+ * into 16 sub-buckets (HDR histogram layout), so a reported percentile is
+ * at most 1/16 above the true value. Values are clamped to 2^40 - 1
+ * (~18 minutes in ns).
+ *
+ * Counts are kept per time window in a ring of WINDOW_COUNT windows;
+ * rotate() retires the oldest window, so percentiles describe the last
+ * WINDOW_COUNT rotation periods while count/sum/min/max are lifetime values.
+ */
+class Histogram {
+public:
+    static constexpr u32 SUB_BUCKET_BITS = 5;
+    static constexpr u32 SUB_BUCKET_COUNT = 1u << SUB_BUCKET_BITS;
+    static constexpr u32 SUB_BUCKET_HALF = SUB_BUCKET_COUNT / 2;
+    static constexpr u32 MAX_VALUE_BITS = 40;
+    static constexpr u64 MAX_VALUE = (u64{1} << MAX_VALUE_BITS) - 1;
+    static constexpr u32 BUCKET_COUNT = (MAX_VALUE_BITS - SUB_BUCKET_BITS + 1) * SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+    static constexpr u32 WINDOW_COUNT = 8;
+
+    /// Record one sample
+    void record(u64 value) noexcept {
+        value = value > MAX_VALUE ? MAX_VALUE : value;
+        u32 window = m_window.load(std::memory_order_relaxed);
+        m_buckets[window][bucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        m_sum.fetch_add(value, std::memory_order_relaxed);
+
+        u64 lowest = m_min.load(std::memory_order_relaxed);
+        while (value < lowest && !m_min.compare_exchange_weak(lowest, value, std::memory_order_relaxed)) {}
+        u64 highest = m_max.load(std::memory_order_relaxed);
+        while (value > highest && !m_max.compare_exchange_weak(highest, value, std::memory_order_relaxed)) {}
+    }
+
+    /// Record a duration
+    template<typename Rep, typename Period>
+    void record(std::chrono::duration<Rep, Period> duration) noexcept {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+        record(static_cast<u64>(ns > 0 ? ns : 0));
+    }
+
+    /// Record a duration given in milliseconds (the unit most subsystem stats use)
+    void recordMs(f64 ms) noexcept { record(static_cast<u64>(ms > 0.0 ? ms * 1.0e6 : 0.0)); }
+
+    /**
+     * @brief Value at quantile @p q (0..1) over the rolling window
+     *
+     * Reports the upper bound of the containing bucket, clamped to the
+     * largest value seen; 0 if the window is empty.
+     */
+    [[nodiscard]] u64 percentile(f64 q) const noexcept;
+
+    /// Lifetime totals plus rolling-window percentiles
+    [[nodiscard]] HistogramSnapshot snapshot() const;
+
+    /// Start a new window, discarding the oldest one
+    void rotate() noexcept;
+
+    /// Clear all windows and lifetime totals
+    void reset() noexcept;
+
+    [[nodiscard]] u64 count() const noexcept { return m_count.load(std::memory_order_relaxed); }
+
+    /// Bucket holding @p value
+    [[nodiscard]] static constexpr u32 bucketIndex(u64 value) noexcept {
+        if (value < SUB_BUCKET_COUNT) {
+            return static_cast<u32>(value);
+        }
+        u32 shift = static_cast<u32>(std::bit_width(value)) - SUB_BUCKET_BITS;
+        return shift * SUB_BUCKET_HALF + static_cast<u32>(value >> shift);
+    }
+
+    /// Largest value mapped to @p index
+    [[nodiscard]] static constexpr u64 bucketUpperBound(u32 index) noexcept {
+        if (index < SUB_BUCKET_COUNT) {
+            return index;
+        }
+        u32 shift = index / SUB_BUCKET_HALF - 1;
+        u64 sub = index % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+        return ((sub + 1) << shift) - 1;
+    }
+
+private:
+    using Window = std::array<std::atomic<u32>, BUCKET_COUNT>;
+
+    std::array<Window, WINDOW_COUNT> m_buckets{};
+    std::atomic<u32> m_window{0};
+    std::atomic<u64> m_count{0};
+    std::atomic<u64> m_sum{0};
+    std::atomic<u64> m_min{~u64{0}};
+    std::atomic<u64> m_max{0};
+};
+
+/// @brief Records the lifetime of a scope into a histogram
+class ScopedLatency {
+public:
+    explicit ScopedLatency(Histogram& histogram) noexcept
+        : m_histogram(histogram), m_start(std::chrono::steady_clock::now()) {}
+    ~ScopedLatency() { m_histogram.record(std::chrono::steady_clock::now() - m_start); }
+
+    ScopedLatency(const ScopedLatency&) = delete;
+    ScopedLatency& operator=(const ScopedLatency&) = delete;
+
+private:
+    Histogram& m_histogram;
+    std::chrono::steady_clock::time_point m_start;
+};
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+/// @brief Named value in a snapshot
+struct MetricValue {
+    std::string name;
+    f64 value = 0.0;
+};
+
+/// @brief Point-in-time copy of every registered metric, sorted by name
+struct MetricsSnapshot {
+    std::vector<MetricValue> counters;
+    std::vector<MetricValue> gauges;
+    std::vector<HistogramSnapshot> histograms;
+
+    [[nodiscard]] const MetricValue* findCounter(std::string_view name) const;
+    [[nodiscard]] const MetricValue* findGauge(std::string_view name) const;
+    [[nodiscard]] const HistogramSnapshot* findHistogram(std::string_view name) const;
+};
+
+/**
+ * @brief Process-wide metrics registry
+ *
+ * Metric names are dotted paths ("physics.solver", "frame.time").
+ * Lookups return references that stay valid for the life of the process,
+ * so subsystems resolve them once:
+ *
+ * @code
+ * static auto& solveTime = MetricsRegistry::get().histogram("physics.solver");
+ * solveTime.recordMs(m_stats.solverTime);
+ * @endcode
+ */
+class MetricsRegistry {
+public:
+    [[nodiscard]] static MetricsRegistry& get();
+
+    /// Get or create a metric (takes the registry lock)
+    [[nodiscard]] Counter& counter(std::string_view name, std::string_view help = {});
+    [[nodiscard]] Gauge& gauge(std::string_view name, std::string_view help = {});
+    [[nodiscard]] Histogram& histogram(std::string_view name, std::string_view help = {});
+
+    /**
+     * @brief Rotate histogram windows if a window period has elapsed
+     *
+     * Call once per frame (EngineApi does); cheap when no rotation is due.
+     * Percentiles then cover the last Histogram::WINDOW_COUNT periods.
+     */
+    void tick();
+
+    /// Length of one histogram window (default 1 s)
+    void setWindowDuration(std::chrono::milliseconds duration);
+    [[nodiscard]] std::chrono::milliseconds windowDuration() const noexcept;
+
+    /// Copy all metrics
+    [[nodiscard]] MetricsSnapshot snapshot() const;
+
+    /**
+     * @brief Prometheus text exposition of snapshot()
+     *
+     * Names are prefixed with "nova_" and dots become underscores;
+     * histograms are written as summaries in seconds.
+     */
+    [[nodiscard]] std::string formatText() const;
+
+    /// Zero every metric (registrations are kept)
+    void reset();
+
+private:
+    MetricsRegistry();
+
+    template<typename T>
+    struct Entry {
+        std::string name;
+        std::string help;
+        T metric;
+    };
+
+    template<typename T>
+    T& findOrCreate(std::deque<Entry<T>>& entries, std::unordered_map<std::string, T*>& index,
+                    std::string_view name, std::string_view help);
+
+    mutable std::mutex m_mutex;
+    std::deque<Entry<Counter>> m_counters;
+    std::deque<Entry<Gauge>> m_gauges;
+    std::deque<Entry<Histogram>> m_histograms;
+    std::unordered_map<std::string, Counter*> m_counterIndex;
+    std::unordered_map<std::string, Gauge*> m_gaugeIndex;
+    std::unordered_map<std::string, Histogram*> m_histogramIndex;
+
+    std::atomic<i64> m_windowNs{1'000'000'000};
+    std::atomic<i64> m_lastRotationNs{0};
+};
+
+} // namespace nova::profiling
+
+namespace nova {
+    using profiling::MetricsRegistry;
+}
@@ -6,6 +6,9 @@
 //
 // Performance profiling system with:
 // - Scoped timing markers
+// - Runtime capture into per-thread lock-free event buffers
+// - Counters, plots and frame markers
+// - Chrome trace / Perfetto JSON export
 // - Memory tracking
 // - GPU timing (when available)
 // - Tracy profiler integration (optional)
@@ -14,10 +17,22 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <iosfwd>
+#include <memory>
+#include <new>
+#include <string>
 #include <string_view>
 
 #include "nova/core/types/types.hpp"
+#include "nova/core/types/result.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif
 
 namespace nova::profiling {
 
@@ -71,6 +86,30 @@ using Timestamp = std::chrono::high_resolution_clock::time_point;
     return static_cast<f64>(durationNs(start, end)) / 1000000.0;
 }
 
+/// @brief Read the CPU cycle/tick counter (cheapest monotonic clock available)
+[[nodiscard]] inline u64 ticks() noexcept {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    return __rdtsc();
+#elif defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#elif defined(__aarch64__)
+    u64 value;
+    asm volatile("mrs %0, cntvct_el0" : "=r"(value));
+    return value;
+#else
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+}
+
+/// @brief Tick counter frequency (calibrated once on first use where needed)
+[[nodiscard]] f64 ticksPerSecond() noexcept;
+
+/// @brief Convert a tick delta to milliseconds
+[[nodiscard]] inline f64 ticksToMs(u64 tickDelta) noexcept {
+    return static_cast<f64>(tickDelta) * 1000.0 / ticksPerSecond();
+}
+
 // =============================================================================
 // Profiling Zone
 // =============================================================================
@@ -100,16 +139,226 @@ struct ZoneColor {
     static constexpr ZoneColor asset()   { return purple(); }
 };
 
+// =============================================================================
+// Capture
+// =============================================================================
+
+/// @brief Kind of captured event
+enum class ProfileEventType : u8 {
+    Zone,       ///< Timed scope (start .. end)
+    Counter,    ///< Integer counter sample
+    Plot,       ///< Floating-point plot sample
+    FrameMark   ///< End of a frame
+};
+
+/// @brief One captured event (32 bytes)
+/// @note Names are not copied; they must outlive the capture (string literals, __func__)
+struct ProfileEvent {
+    const char* name;
+    u32 nameLength;
+    ProfileEventType type;
+    ZoneColor color;
+    u64 start;              ///< Tick counter at the event (zone start)
+    union {
+        u64 end;            ///< Zone end ticks
+        i64 counter;        ///< Counter value
+        f64 plot;           ///< Plot value
+        u64 frame;          ///< Frame number
+    };
+};
+
+static_assert(sizeof(ProfileEvent) == 32, "ProfileEvent should stay 32 bytes");
+
+/// @brief Capture configuration
+struct ProfilerConfig {
+    usize maxEventsPerThread = 1 << 20;     ///< Later events are dropped (32 MiB per thread)
+};
+
+/// @brief Capture statistics
+struct ProfilerStats {
+    u64 events = 0;         ///< Events recorded
+    u64 dropped = 0;        ///< Events lost to full thread buffers
+    u64 frames = 0;         ///< Frame markers recorded
+    u32 threads = 0;        ///< Threads that recorded events
+};
+
+/// @brief Append-only event storage owned by one thread
+///
+/// Only the owning thread writes; readers (export) may run concurrently
+/// and see every event published before they load the count.
+class ProfileThreadBuffer {
+public:
+    static constexpr usize CHUNK_EVENTS = 16384;
+    
+    ProfileThreadBuffer(usize maxEvents, u32 threadIndex)
+        : m_chunkCount((maxEvents + CHUNK_EVENTS - 1) / CHUNK_EVENTS)
+        , m_chunks(std::make_unique<std::atomic<ProfileEvent*>[]>(m_chunkCount))
+        , m_threadIndex(threadIndex) {}
+    
+    ~ProfileThreadBuffer() {
+        for (usize i = 0; i < m_chunkCount; ++i) {
+            delete[] m_chunks[i].load(std::memory_order_relaxed);
+        }
+    }
+    
+    ProfileThreadBuffer(const ProfileThreadBuffer&) = delete;
+    ProfileThreadBuffer& operator=(const ProfileThreadBuffer&) = delete;
+    
+    /// @brief Append an event (owning thread only)
+    void push(const ProfileEvent& event) noexcept {
+        usize count = m_count.load(std::memory_order_relaxed);
+        usize chunkIndex = count / CHUNK_EVENTS;
+        if (chunkIndex >= m_chunkCount) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        
+        ProfileEvent* chunk = m_chunks[chunkIndex].load(std::memory_order_relaxed);
+        if (!chunk) {
+            chunk = new (std::nothrow) ProfileEvent[CHUNK_EVENTS];
+            if (!chunk) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            m_chunks[chunkIndex].store(chunk, std::memory_order_release);
+        }
+        
+        chunk[count % CHUNK_EVENTS] = event;
+        m_count.store(count + 1, std::memory_order_release);
+    }
+    
+    /// @brief Visit the events published so far (any thread)
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        usize count = m_count.load(std::memory_order_acquire);
+        for (usize i = 0; i < count; ++i) {
+            fn(m_chunks[i / CHUNK_EVENTS].load(std::memory_order_acquire)[i % CHUNK_EVENTS]);
+        }
+    }
+    
+    [[nodiscard]] usize size() const noexcept { return m_count.load(std::memory_order_acquire); }
+    [[nodiscard]] u64 dropped() const noexcept { return m_dropped.load(std::memory_order_relaxed); }
+    [[nodiscard]] u32 threadIndex() const noexcept { return m_threadIndex; }
+    
+private:
+    usize m_chunkCount;
+    std::unique_ptr<std::atomic<ProfileEvent*>[]> m_chunks;
+    std::atomic<usize> m_count{0};
+    std::atomic<u64> m_dropped{0};
+    u32 m_threadIndex;
+};
+
+namespace detail {
+    /// Capture switch, read on every zone
+    inline std::atomic<bool> g_profilerCapturing{false};
+    
+    /// Bumped by every startCapture; stale thread buffers re-register
+    inline std::atomic<u64> g_profilerGeneration{0};
+    
+    inline thread_local ProfileThreadBuffer* t_profilerBuffer = nullptr;
+    inline thread_local u64 t_profilerGeneration = 0;
+    
+    /// Slow path: register the calling thread with the current capture
+    [[nodiscard]] ProfileThreadBuffer* registerProfilerThread() noexcept;
+    
+    /// Calling thread's buffer for the current capture (null when not capturing)
+    [[nodiscard]] inline ProfileThreadBuffer* profilerThreadBuffer() noexcept {
+        if (!g_profilerCapturing.load(std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        if (t_profilerGeneration == g_profilerGeneration.load(std::memory_order_acquire)) {
+            return t_profilerBuffer;
+        }
+        return registerProfilerThread();
+    }
+}
+
+/// @brief Runtime profiler capture
+///
+/// Capture is off until startCapture(); while off, zones cost two tick
+/// reads and a flag check. While on, each thread appends to its own buffer
+/// without locking. exportChromeTrace() can run at any time, including
+/// during a capture, and writes JSON that chrome://tracing and Perfetto load.
+class Profiler {
+public:
+    /// @brief Get singleton instance
+    [[nodiscard]] static Profiler& instance() noexcept;
+    
+    /// @brief Begin a new capture, discarding the previous one
+    void startCapture(const ProfilerConfig& config = {});
+    
+    /// @brief Stop recording; the capture stays available for export
+    void stopCapture();
+    
+    /// @brief Check if events are being recorded
+    [[nodiscard]] static bool isCapturing() noexcept {
+        return detail::g_profilerCapturing.load(std::memory_order_relaxed);
+    }
+    
+    /// @brief Record a completed zone
+    static void zone(std::string_view name, ZoneColor color, u64 startTicks, u64 endTicks) noexcept {
+        ProfileEvent event{name.data(), static_cast<u32>(name.size()), ProfileEventType::Zone, color, startTicks, {}};
+        event.end = endTicks;
+        record(event);
+    }
+    
+    /// @brief Record an integer counter sample
+    static void counter(std::string_view name, i64 value) noexcept {
+        if (!isCapturing()) return;
+        ProfileEvent event{name.data(), static_cast<u32>(name.size()), ProfileEventType::Counter, {}, ticks(), {}};
+        event.counter = value;
+        record(event);
+    }
+    
+    /// @brief Record a floating-point plot sample
+    static void plot(std::string_view name, f64 value) noexcept {
+        if (!isCapturing()) return;
+        ProfileEvent event{name.data(), static_cast<u32>(name.size()), ProfileEventType::Plot, {}, ticks(), {}};
+        event.plot = value;
+        record(event);
+    }
+    
+    /// @brief Mark the end of a frame
+    static void frameMark(std::string_view name = "Frame") noexcept;
+    
+    /// @brief Name the calling thread in exported traces
+    void setThreadName(std::string_view name);
+    
+    /// @brief Get statistics of the current capture
+    [[nodiscard]] ProfilerStats getStats() const;
+    
+    /// @brief Write the current capture as Chrome trace JSON
+    void exportChromeTrace(std::ostream& out) const;
+    
+    /// @brief Write the current capture as Chrome trace JSON to a file
+    [[nodiscard]] Result<void> exportChromeTrace(const std::string& path) const;
+    
+private:
+    Profiler() = default;
+    ~Profiler() = default;
+    
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    
+    static void record(const ProfileEvent& event) noexcept {
+        if (ProfileThreadBuffer* buffer = detail::profilerThreadBuffer()) {
+            buffer->push(event);
+        }
+    }
+};
+
 #if NOVA_PROFILING_ENABLED
 
 /// @brief Scoped profiling zone
+/// @note The name is kept by reference when a capture is running
 class ScopedZone {
 public:
     /// @brief Start a profiling zone
     explicit ScopedZone(std::string_view name, ZoneColor color = ZoneColor::gray()) noexcept
         : m_name(name)
         , m_color(color)
-        , m_start(now())
+        , m_capturing(Profiler::isCapturing())
+        , m_start(ticks())
     {
 #if NOVA_TRACY_INTEGRATION
         // Tracy zone start would go here
@@ -118,20 +367,18 @@ public:
     
     /// @brief End profiling zone
     ~ScopedZone() {
-        m_end = now();
-        
 #if NOVA_TRACY_INTEGRATION
         // Tracy zone end would go here
 #endif
         
-        // Could log timing data here
-        (void)m_name;
-        (void)m_color;
+        if (m_capturing) {
+            Profiler::zone(m_name, m_color, m_start, ticks());
+        }
     }
     
     /// @brief Get elapsed time so far
     [[nodiscard]] f64 elapsedMs() const noexcept {
-        return durationMs(m_start, now());
+        return ticksToMs(ticks() - m_start);
     }
     
     // Non-copyable
@@ -141,8 +388,8 @@ public:
 private:
     std::string_view m_name;
     ZoneColor m_color;
-    Timestamp m_start;
-    Timestamp m_end;
+    bool m_capturing;
+    u64 m_start;
 };
 
 /// @brief Manual timing for non-scoped measurements
@@ -319,14 +566,17 @@ private:
 // Profiling Macros
 // =============================================================================
 
+#define NOVA_PROFILE_CONCAT_IMPL(a, b) a##b
+#define NOVA_PROFILE_CONCAT(a, b) NOVA_PROFILE_CONCAT_IMPL(a, b)
+
 #if NOVA_PROFILING_ENABLED
     /// @brief Create a scoped profiling zone
     #define NOVA_PROFILE_ZONE(name) \
-        ::nova::profiling::ScopedZone _nova_zone_##__LINE__(name)
+        ::nova::profiling::ScopedZone NOVA_PROFILE_CONCAT(_nova_zone_, __LINE__)(name)
     
     /// @brief Create a scoped profiling zone with color
     #define NOVA_PROFILE_ZONE_COLOR(name, color) \
-        ::nova::profiling::ScopedZone _nova_zone_##__LINE__(name, color)
+        ::nova::profiling::ScopedZone NOVA_PROFILE_CONCAT(_nova_zone_, __LINE__)(name, color)
     
     /// @brief Profile the current function
     #define NOVA_PROFILE_FUNCTION() \
@@ -341,6 +591,11 @@ private:
     #define NOVA_PROFILE_NETWORK(name) NOVA_PROFILE_ZONE_COLOR(name, ::nova::profiling::ZoneColor::network())
     #define NOVA_PROFILE_ASSET(name)   NOVA_PROFILE_ZONE_COLOR(name, ::nova::profiling::ZoneColor::asset())
     
+    /// @brief Capture markers
+    #define NOVA_PROFILE_FRAME()              ::nova::profiling::Profiler::frameMark()
+    #define NOVA_PROFILE_COUNTER(name, value) ::nova::profiling::Profiler::counter(name, value)
+    #define NOVA_PROFILE_PLOT(name, value)    ::nova::profiling::Profiler::plot(name, value)
+    
 #else
     #define NOVA_PROFILE_ZONE(name) ((void)0)
     #define NOVA_PROFILE_ZONE_COLOR(name, color) ((void)0)
@@ -352,6 +607,9 @@ private:
     #define NOVA_PROFILE_AI(name) ((void)0)
     #define NOVA_PROFILE_NETWORK(name) ((void)0)
     #define NOVA_PROFILE_ASSET(name) ((void)0)
+    #define NOVA_PROFILE_FRAME() ((void)0)
+    #define NOVA_PROFILE_COUNTER(name, value) ((void)0)
+    #define NOVA_PROFILE_PLOT(name, value) ((void)0)
 #endif
 
 } // namespace nova::profiling
@@ -362,4 +620,5 @@ namespace nova {
     using profiling::FrameTimer;
     using profiling::FrameStats;
     using profiling::ScopedZone;
+    using profiling::Profiler;
 }
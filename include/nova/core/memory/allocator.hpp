@@ -15,6 +15,8 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdlib>
+#include <memory_resource>
 #include <new>
 
 #include "nova/core/types/types.hpp"
@@ -283,9 +285,92 @@ template<typename T, typename... Args>
     return ScopedAlloc<T>(allocator, allocateObject<T>(allocator, static_cast<Args&&>(args)...));
 }
 
+// =============================================================================
+// Standard Container Adapter
+// =============================================================================
+
+/// @brief std::allocator-compatible adapter over a NovaCore Allocator
+/// @tparam T Element type
+/// @note Containers copy the adapter, so the Allocator must outlive them.
+///
+/// @code
+/// std::vector<Packet, StdAllocator<Packet>> packets{StdAllocator<Packet>(generalAllocator())};
+/// @endcode
+template<typename T>
+class StdAllocator {
+public:
+    using value_type = T;
+    
+    explicit StdAllocator(Allocator& allocator) noexcept : m_allocator(&allocator) {}
+    
+    template<typename U>
+    StdAllocator(const StdAllocator<U>& other) noexcept : m_allocator(&other.getAllocator()) {}
+    
+    [[nodiscard]] T* allocate(usize count) noexcept {
+        void* memory = m_allocator->allocate(sizeof(T) * count, alignof(T));
+        if (!memory) {
+            // Containers have no way to see a failed allocation without exceptions
+            std::abort();
+        }
+        return static_cast<T*>(memory);
+    }
+    
+    void deallocate(T* ptr, usize /*count*/) noexcept {
+        m_allocator->deallocate(ptr);
+    }
+    
+    [[nodiscard]] Allocator& getAllocator() const noexcept { return *m_allocator; }
+    
+    template<typename U>
+    [[nodiscard]] bool operator==(const StdAllocator<U>& other) const noexcept {
+        return m_allocator == &other.getAllocator();
+    }
+    
+private:
+    Allocator* m_allocator;
+};
+
+/// @brief std::pmr::memory_resource over a NovaCore Allocator
+/// @note The Allocator must outlive the resource and every container using it.
+///       Resources compare equal only to themselves, so containers share
+///       memory only when they use the same resource object.
+///
+/// @code
+/// AllocatorResource resource(frameAllocator);
+/// std::pmr::vector<u32> indices(&resource);
+/// @endcode
+class AllocatorResource final : public std::pmr::memory_resource {
+public:
+    explicit AllocatorResource(Allocator& allocator) noexcept : m_allocator(&allocator) {}
+    
+    [[nodiscard]] Allocator& getAllocator() const noexcept { return *m_allocator; }
+    
+private:
+    void* do_allocate(usize bytes, usize alignment) override {
+        void* memory = m_allocator->allocate(bytes, alignment);
+        if (!memory) {
+            // Containers have no way to see a failed allocation without exceptions
+            std::abort();
+        }
+        return memory;
+    }
+    
+    void do_deallocate(void* ptr, usize /*bytes*/, usize /*alignment*/) override {
+        m_allocator->deallocate(ptr);
+    }
+    
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+    
+    Allocator* m_allocator;
+};
+
 } // namespace nova::memory
 
 namespace nova {
     using Allocator = memory::Allocator;
     using AllocationStats = memory::AllocationStats;
+    using memory::StdAllocator;
+    using memory::AllocatorResource;
 }
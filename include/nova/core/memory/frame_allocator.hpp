@@ -0,0 +1,251 @@
+// =============================================================================
+// NovaCore Engine - Frame Allocator (Per-Frame Scratch Memory)
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Ring of LinearAllocators, one per frame in flight, for short-lived data.
+// Characteristics:
+// - O(1) bump allocation, no individual deallocation
+// - Memory of frame N stays valid until frame N + framesInFlight begins
+// - Requests that do not fit spill to the general allocator and are
+//   released with the frame, so a busy frame degrades instead of failing
+// - Per-frame peak usage is recorded for budgeting
+// - FrameMemory gives every thread its own ring, advanced by one global
+//   frame counter, and FrameScope rewinds scratch use on scope exit
+// =============================================================================
+
+#pragma once
+
+#include "nova/core/memory/linear_allocator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <vector>
+
+namespace nova::memory {
+
+/// @brief Memory use of one frame
+struct FrameMemoryStats {
+    u64 frame = 0;              ///< Frame index
+    usize peakBytes = 0;        ///< High-water mark of ring bytes
+    usize overflowBytes = 0;    ///< Bytes spilled to the general allocator
+    usize allocationCount = 0;  ///< Allocations made during the frame
+};
+
+/// @brief Per-frame ring of linear allocators
+/// @note Not thread-safe; use one per thread (see FrameMemory).
+class FrameAllocator final : public Allocator {
+public:
+    static constexpr u32 DEFAULT_FRAMES_IN_FLIGHT = 2;
+    static constexpr u32 MAX_FRAMES_IN_FLIGHT = 4;
+
+    /// @brief Position to rewind to (see FrameScope)
+    struct Marker {
+        u64 frame;
+        usize offset;
+        usize overflowCount;
+    };
+
+    /// @brief Construct a frame ring
+    /// @param capacityPerFrame Ring bytes available to each frame
+    /// @param framesInFlight Frames whose memory stays valid (1 to MAX_FRAMES_IN_FLIGHT)
+    /// @param name Optional name for debugging
+    /// @note If the ring cannot be reserved, capacity per frame is 0 and every
+    ///       allocation spills to the general allocator
+    explicit FrameAllocator(usize capacityPerFrame,
+                            u32 framesInFlight = DEFAULT_FRAMES_IN_FLIGHT,
+                            const char* name = "FrameAllocator");
+    ~FrameAllocator() override;
+
+    FrameAllocator(const FrameAllocator&) = delete;
+    FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+    /// @brief Bump-allocate from the current frame, spilling if it is full
+    [[nodiscard]] void* allocate(usize size, usize alignment = DEFAULT_ALIGNMENT) noexcept override {
+        Slot& slot = *m_slot;
+        void* ptr = slot.linear.allocate(size, alignment);
+        if (!ptr) {
+            return allocateOverflow(size, alignment);
+        }
+        m_current.allocationCount++;
+        m_current.peakBytes = std::max(m_current.peakBytes, slot.linear.getAllocatedSize());
+        return ptr;
+    }
+
+    /// @brief Does nothing; memory is released when its frame slot is reused
+    void deallocate([[maybe_unused]] void* ptr) noexcept override {}
+
+    /// @brief Advance to a frame
+    /// @note Finishes the current frame's stats and resets the slot last
+    ///       used framesInFlight frames ago. Calling it again with the
+    ///       current frame does nothing.
+    void beginFrame(u64 frame) noexcept;
+
+    /// @brief Current position, for a later resetToMarker()
+    [[nodiscard]] Marker getMarker() const noexcept {
+        const Slot& slot = *m_slot;
+        return {m_current.frame, slot.linear.getMarker(), slot.overflow.size()};
+    }
+
+    /// @brief Release everything allocated since a marker
+    /// @note Markers of earlier frames are ignored; their slot is reset
+    ///       when the ring comes back around to it.
+    void resetToMarker(const Marker& marker) noexcept;
+
+    [[nodiscard]] u64 getFrame() const noexcept { return m_current.frame; }
+    [[nodiscard]] u32 getFramesInFlight() const noexcept { return static_cast<u32>(m_slots.size()); }
+    [[nodiscard]] usize getCapacityPerFrame() const noexcept { return m_capacityPerFrame; }
+
+    /// @brief Stats of the frame in progress
+    [[nodiscard]] const FrameMemoryStats& getFrameStats() const noexcept { return m_current; }
+
+    /// @brief Stats of the last finished frame (safe to read from any thread)
+    [[nodiscard]] FrameMemoryStats getLastFrameStats() const noexcept;
+
+    /// @brief Largest per-frame peak seen so far (safe to read from any thread)
+    [[nodiscard]] usize getMaxFramePeak() const noexcept {
+        return m_maxPeakBytes.load(std::memory_order_relaxed);
+    }
+
+    // Allocator interface implementation
+    [[nodiscard]] usize getAllocatedSize() const noexcept override {
+        return m_slot->linear.getAllocatedSize();
+    }
+
+    [[nodiscard]] AllocationStats getStats() const noexcept override;
+
+    [[nodiscard]] bool owns(const void* ptr) const noexcept override {
+        auto p = static_cast<const u8*>(ptr);
+        return p >= m_buffer && p < m_buffer + m_capacityPerFrame * m_slots.size();
+    }
+
+    [[nodiscard]] const char* getName() const noexcept override {
+        return m_name;
+    }
+
+private:
+    struct Slot {
+        Slot(u8* buffer, usize size, const char* name) noexcept : linear(buffer, size, name) {}
+
+        LinearAllocator linear;
+        std::vector<void*> overflow;    ///< Spilled blocks, freed with the slot
+    };
+
+    [[nodiscard]] void* allocateOverflow(usize size, usize alignment) noexcept;
+    void releaseOverflow(Slot& slot, usize keep) noexcept;
+
+    u8* m_buffer = nullptr;
+    usize m_capacityPerFrame;
+    const char* m_name;
+    std::deque<Slot> m_slots;           ///< Allocators are not movable
+    Slot* m_slot = nullptr;             ///< Slot of the current frame
+    FrameMemoryStats m_current;
+
+    // Published by beginFrame() for readers on other threads
+    std::atomic<u64> m_lastFrame{0};
+    std::atomic<usize> m_lastPeakBytes{0};
+    std::atomic<usize> m_lastOverflowBytes{0};
+    std::atomic<usize> m_lastAllocationCount{0};
+    std::atomic<usize> m_maxPeakBytes{0};
+
+    usize m_totalOverflowCount = 0;
+};
+
+// =============================================================================
+// Per-Thread Frame Memory
+// =============================================================================
+
+/// @brief Per-thread frame allocators driven by one global frame counter
+///
+/// The main loop calls endFrame() once per frame. Each thread's ring
+/// catches up lazily the next time that thread asks for it, so worker
+/// threads need no frame hooks of their own.
+class FrameMemory {
+public:
+    /// Ring bytes per frame for threads that have not created their ring yet
+    static constexpr usize DEFAULT_CAPACITY_PER_FRAME = 1024 * 1024;
+
+    /// @brief Set the ring size of threads that create their ring later
+    static void configure(usize capacityPerFrame,
+                          u32 framesInFlight = FrameAllocator::DEFAULT_FRAMES_IN_FLIGHT) noexcept;
+
+    /// @brief Finish the frame; every ring advances on its next use
+    static void endFrame() noexcept;
+
+    /// @brief Global frame index
+    [[nodiscard]] static u64 getFrame() noexcept;
+
+    /// @brief This thread's ring, advanced to the global frame
+    [[nodiscard]] static FrameAllocator& threadAllocator();
+
+    /// @brief Last finished frame summed over all threads
+    /// @note Threads that did not use frame memory in a frame report their
+    ///       most recent finished frame instead.
+    [[nodiscard]] static FrameMemoryStats getLastFrameStats();
+
+    /// @brief Largest single-thread frame peak seen so far
+    [[nodiscard]] static usize getMaxFramePeak();
+};
+
+// =============================================================================
+// Frame Scope
+// =============================================================================
+
+template<typename T>
+using FrameVector = std::vector<T, StdAllocator<T>>;
+
+/// @brief RAII scratch region of a frame allocator
+///
+/// Everything allocated through the scope (or from the allocator while it
+/// is alive) is released when it ends, so hot paths can use frame memory
+/// without depending on frame boundaries. Declare containers after the
+/// scope so they are destroyed first.
+///
+/// @code
+/// FrameScope scratch;
+/// auto bodies = scratch.makeVector<RigidBody*>(bodyCount);
+/// std::pmr::vector<u32> indices(scratch.resource());
+/// @endcode
+class FrameScope {
+public:
+    explicit FrameScope(FrameAllocator& allocator = FrameMemory::threadAllocator()) noexcept
+        : m_allocator(allocator)
+        , m_marker(allocator.getMarker())
+        , m_resource(allocator) {}
+
+    ~FrameScope() {
+        m_allocator.resetToMarker(m_marker);
+    }
+
+    FrameScope(const FrameScope&) = delete;
+    FrameScope& operator=(const FrameScope&) = delete;
+
+    [[nodiscard]] FrameAllocator& allocator() noexcept { return m_allocator; }
+
+    /// @brief Memory resource for std::pmr containers
+    [[nodiscard]] std::pmr::memory_resource* resource() noexcept { return &m_resource; }
+
+    /// @brief Empty vector on scope memory with room for @p capacity elements
+    template<typename T>
+    [[nodiscard]] FrameVector<T> makeVector(usize capacity = 0) {
+        FrameVector<T> vector{StdAllocator<T>(m_allocator)};
+        vector.reserve(capacity);
+        return vector;
+    }
+
+private:
+    FrameAllocator& m_allocator;
+    FrameAllocator::Marker m_marker;
+    AllocatorResource m_resource;
+};
+
+} // namespace nova::memory
+
+namespace nova {
+    using FrameAllocator = memory::FrameAllocator;
+    using FrameMemory = memory::FrameMemory;
+    using FrameScope = memory::FrameScope;
+    using memory::FrameVector;
+}
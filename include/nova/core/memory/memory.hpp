@@ -13,11 +13,15 @@
 
 #pragma once
 
+#include <cstring>
+
 // All allocator types
 #include "nova/core/memory/allocator.hpp"
 #include "nova/core/memory/linear_allocator.hpp"
 #include "nova/core/memory/stack_allocator.hpp"
 #include "nova/core/memory/pool_allocator.hpp"
+#include "nova/core/memory/scalable_allocator.hpp"
+#include "nova/core/memory/frame_allocator.hpp"
 
 namespace nova::memory {
 
@@ -0,0 +1,127 @@
+// =============================================================================
+// NovaCore Engine - Scalable Allocator
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Thread-caching general-purpose allocator backed by the system heap.
+// Characteristics:
+// - Size-class segregated 64 KiB pages (16 B to 16 KiB), larger blocks
+//   go straight to the system
+// - Each thread allocates from its own heap without locks
+// - Frees from other threads go to a lock-free per-page remote queue that
+//   the owning thread drains when it runs out of local blocks
+// - Heaps of exited threads are adopted by the next new thread
+// =============================================================================
+
+#pragma once
+
+#include "nova/core/memory/allocator.hpp"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+namespace nova::memory {
+
+/// @brief Thread-caching, size-class segregated allocator
+/// @note Thread-safe. Any thread may free any block.
+class ScalableAllocator final : public Allocator {
+public:
+    /// Page size; every small block lives in a page aligned to this
+    static constexpr usize PAGE_SIZE = 64 * 1024;
+
+    /// Largest request served from size-class pages
+    static constexpr usize MAX_SMALL_SIZE = 16 * 1024;
+
+    /// Largest alignment served from size-class pages
+    static constexpr usize MAX_SMALL_ALIGNMENT = 4096;
+
+    /// Number of size classes (16 B steps to 128 B, then 4 per doubling)
+    static constexpr u32 SIZE_CLASS_COUNT = 36;
+
+    /// Empty pages kept for reuse instead of returning them to the system
+    static constexpr usize MAX_CACHED_PAGES = 16;
+
+    explicit ScalableAllocator(const char* name = "ScalableAllocator");
+    ~ScalableAllocator() override;
+
+    [[nodiscard]] void* allocate(usize size, usize alignment = DEFAULT_ALIGNMENT) noexcept override;
+    void deallocate(void* ptr) noexcept override;
+    [[nodiscard]] void* reallocate(void* ptr, usize newSize, usize alignment = DEFAULT_ALIGNMENT) noexcept override;
+
+    /// @brief Bytes usable in a block (its size class or large size)
+    [[nodiscard]] usize usableSize(const void* ptr) const noexcept;
+
+    // Allocator interface implementation
+    [[nodiscard]] usize getAllocatedSize() const noexcept override;
+
+    /// @brief Totals across all threads
+    /// @note Sizes are block sizes. peakAllocated is the high-water mark of
+    ///       memory taken from the system (pages plus large blocks).
+    [[nodiscard]] AllocationStats getStats() const noexcept override;
+
+    [[nodiscard]] bool owns(const void* ptr) const noexcept override;
+
+    [[nodiscard]] const char* getName() const noexcept override {
+        return m_name;
+    }
+
+    /// @brief Statistics of one size class (peakAllocated = peak page bytes)
+    [[nodiscard]] AllocationStats getSizeClassStats(u32 sizeClass) const noexcept;
+
+    /// @brief Block size of a size class
+    [[nodiscard]] static usize getSizeClassSize(u32 sizeClass) noexcept;
+
+    /// @brief Size class serving a request (SIZE_CLASS_COUNT if it is large)
+    [[nodiscard]] static u32 getSizeClass(usize size) noexcept;
+
+    /// @brief Number of thread heaps created so far
+    [[nodiscard]] usize getHeapCount() const noexcept;
+
+private:
+    struct Page;
+    struct Heap;
+
+    friend struct ThreadHeapCache;
+
+    [[nodiscard]] Heap* threadHeap() noexcept;
+    [[nodiscard]] Heap* createHeap() noexcept;
+    static void abandonHeap(u64 allocatorId, Heap* heap) noexcept;
+
+    [[nodiscard]] static Page* pageOf(const void* ptr) noexcept;
+    [[nodiscard]] static void* popBlock(Page& page) noexcept;
+
+    [[nodiscard]] void* allocateSmall(Heap& heap, u32 sizeClass) noexcept;
+    [[nodiscard]] void* allocateLarge(Heap* heap, usize size, usize alignment) noexcept;
+    [[nodiscard]] Page* findPage(Heap& heap, u32 sizeClass) noexcept;
+    [[nodiscard]] Page* acquirePage(Heap& heap, u32 sizeClass) noexcept;
+    void retirePage(Heap& heap, Page* page) noexcept;
+    void releaseLarge(Page* page) noexcept;
+
+    const char* m_name;
+    u64 m_id;
+
+    mutable std::mutex m_mutex;                 ///< Guards everything below
+    std::vector<Heap*> m_heaps;
+    std::vector<Heap*> m_abandonedHeaps;
+    std::vector<Page*> m_freePages;
+    std::unordered_set<uintptr_t> m_blocks;     ///< Live pages and large blocks
+    usize m_reservedBytes = 0;
+    usize m_peakReservedBytes = 0;
+    std::array<usize, SIZE_CLASS_COUNT> m_classPages{};
+    std::array<usize, SIZE_CLASS_COUNT> m_classPeakPages{};
+};
+
+/// @brief Process-wide scalable allocator for engine containers and storage
+/// @note Never destroyed, so it is safe to use from static destructors.
+[[nodiscard]] ScalableAllocator& generalAllocator() noexcept;
+
+} // namespace nova::memory
+
+namespace nova {
+    using ScalableAllocator = memory::ScalableAllocator;
+    using memory::generalAllocator;
+}
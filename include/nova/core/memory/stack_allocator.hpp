@@ -48,7 +48,6 @@ public:
     [[nodiscard]] void* allocateTop(usize size, usize alignment = DEFAULT_ALIGNMENT) noexcept {
         // Store header before allocation for deallocation
         usize headerSize = sizeof(AllocationHeader);
-        usize totalSize = headerSize + size;
         
         // Calculate aligned offset (after header)
         usize alignedHeaderEnd = alignUp(m_topOffset + headerSize, alignment);
@@ -0,0 +1,63 @@
+/**
+ * @file metrics_endpoint.hpp
+ * @brief Nova Network™ - Local HTTP endpoint serving engine metrics
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * A minimal HTTP/1.0 listener for dedicated servers and dev builds:
+ * GET /metrics returns MetricsRegistry::formatText() so a Prometheus
+ * scraper (or curl) can read live frame-time and subsystem stats.
+ * Binds to loopback by default; nothing is started unless start() is called.
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#pragma once
+
+#include "nova/core/types/types.hpp"
+#include "nova/core/types/result.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+
+namespace nova::network {
+
+/**
+ * @brief Serves the process metrics registry over plain HTTP
+ */
+class MetricsEndpoint {
+public:
+    MetricsEndpoint() = default;
+    ~MetricsEndpoint();
+
+    MetricsEndpoint(const MetricsEndpoint&) = delete;
+    MetricsEndpoint& operator=(const MetricsEndpoint&) = delete;
+
+    /**
+     * @brief Start listening
+     * @param port TCP port (0 picks a free port, see port())
+     * @param bindAddress IPv4 address to bind
+     */
+    Result<void> start(u16 port, const std::string& bindAddress = "127.0.0.1");
+
+    /// Stop the listener thread and close the socket
+    void stop();
+
+    [[nodiscard]] bool isRunning() const noexcept { return m_running.load(std::memory_order_acquire); }
+
+    /// Bound port (valid while running)
+    [[nodiscard]] u16 port() const noexcept { return m_port; }
+
+private:
+    void serve();
+    void handleClient(std::intptr_t client);
+
+    std::intptr_t m_socket = -1;
+    u16 m_port = 0;
+    std::atomic<bool> m_running{false};
+    std::thread m_thread;
+};
+
+} // namespace nova::network
@@ -11,6 +11,8 @@
 
 #include "network_types.hpp"
 #include "network_system.hpp"
+#include "network_replication.hpp"
+#include "metrics_endpoint.hpp"
 
 namespace nova::network {
 
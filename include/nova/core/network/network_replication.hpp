@@ -0,0 +1,528 @@
+/**
+ * @file network_replication.hpp
+ * @brief Nova Network™ - ECS entity replication with delta compression
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * Features:
+ * - Replicable components described by quantized field schemas
+ * - Per-tick world snapshots kept in a short history ring
+ * - Per-client, per-entity delta encoding against the last acked baseline
+ * - Bit-packed wire format
+ * - Spatial interest grid and per-client bandwidth budget with
+ *   priority accumulation, so per-client cost scales with what is
+ *   relevant rather than with world size
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ * @see NOVAFORGE_NOVACORE_ENGINE_BLUEPRINT.md for full technical specifications
+ */
+
+#pragma once
+
+#include "network_types.hpp"
+#include "nova/core/ecs/world.hpp"
+#include "nova/core/types/result.hpp"
+
+#include <unordered_map>
+#include <vector>
+#include <algorithm>
+#include <cstring>
+#include <cstddef>
+#include <array>
+
+namespace nova::network {
+
+class NetworkServer;
+
+// ============================================================================
+// Replication Constants
+// ============================================================================
+
+/// Number of snapshots kept for delta baselines (ticks)
+constexpr u32 REPLICATION_HISTORY = 64;
+
+/// Maximum number of replicable component types
+constexpr u32 MAX_REPLICATED_COMPONENTS = 32;
+
+/// Default per-client budget for one update in bytes
+constexpr u32 DEFAULT_REPLICATION_BUDGET = 1024;
+
+// ============================================================================
+// Bit Packing
+// ============================================================================
+
+/**
+ * @brief Appends values of arbitrary bit width to a byte buffer
+ */
+class BitWriter {
+public:
+    explicit BitWriter(std::vector<u8>& buffer) : m_buffer(buffer) { m_buffer.clear(); }
+
+    /// Write the low @p bits bits of @p value (bits <= 32)
+    void write(u32 value, u32 bits) {
+        if (bits < 32) {
+            value &= (1u << bits) - 1;
+        }
+        m_buffer.resize((m_bitPos + bits + 7) >> 3, 0);
+        while (bits > 0) {
+            u32 shift = static_cast<u32>(m_bitPos & 7);
+            u32 count = std::min(8u - shift, bits);
+            u8& byte = m_buffer[m_bitPos >> 3];
+            byte = static_cast<u8>(byte | ((value & ((1u << count) - 1)) << shift));
+            value = count < 32 ? value >> count : 0;
+            bits -= count;
+            m_bitPos += count;
+        }
+    }
+
+    void writeBool(bool value) { write(value ? 1u : 0u, 1); }
+
+    /// Write an unsigned integer 7 bits at a time with continuation bits
+    void writeVarint(u64 value) {
+        do {
+            u32 group = static_cast<u32>(value & 0x7F);
+            value >>= 7;
+            write(group, 7);
+            writeBool(value != 0);
+        } while (value != 0);
+    }
+
+    /// Current size in bits
+    [[nodiscard]] usize bitPosition() const noexcept { return m_bitPos; }
+
+    /// Current size in whole bytes
+    [[nodiscard]] usize byteSize() const noexcept { return (m_bitPos + 7) >> 3; }
+
+    /// Discard everything written after @p bitPos
+    void rollback(usize bitPos) {
+        m_bitPos = bitPos;
+        m_buffer.resize((bitPos + 7) >> 3);
+        if (bitPos & 7) {
+            m_buffer.back() = static_cast<u8>(m_buffer.back() & ((1u << (bitPos & 7)) - 1));
+        }
+    }
+
+private:
+    std::vector<u8>& m_buffer;
+    usize m_bitPos = 0;
+};
+
+/**
+ * @brief Reads values written by BitWriter; reads past the end set an error flag
+ */
+class BitReader {
+public:
+    BitReader(const u8* data, usize size) : m_data(data), m_bitSize(size * 8) {}
+
+    /// Read @p bits bits (bits <= 32)
+    u32 read(u32 bits) {
+        if (m_bitPos + bits > m_bitSize) {
+            m_overflow = true;
+            m_bitPos = m_bitSize;
+            return 0;
+        }
+        u32 value = 0;
+        u32 written = 0;
+        while (written < bits) {
+            u32 shift = static_cast<u32>(m_bitPos & 7);
+            u32 count = std::min(8u - shift, bits - written);
+            u32 chunk = (static_cast<u32>(m_data[m_bitPos >> 3]) >> shift) & ((1u << count) - 1);
+            value |= chunk << written;
+            written += count;
+            m_bitPos += count;
+        }
+        return value;
+    }
+
+    bool readBool() { return read(1) != 0; }
+
+    u64 readVarint() {
+        u64 value = 0;
+        for (u32 shift = 0; shift < 64; shift += 7) {
+            value |= static_cast<u64>(read(7)) << shift;
+            if (!readBool()) {
+                return value;
+            }
+        }
+        m_overflow = true;
+        return value;
+    }
+
+    /// True once a read ran past the end of the data
+    [[nodiscard]] bool overflowed() const noexcept { return m_overflow; }
+
+    /// Bits left to read
+    [[nodiscard]] usize remainingBits() const noexcept { return m_bitSize - m_bitPos; }
+
+private:
+    const u8* m_data;
+    usize m_bitSize;
+    usize m_bitPos = 0;
+    bool m_overflow = false;
+};
+
+// ============================================================================
+// Replication Schema
+// ============================================================================
+
+/**
+ * @brief Wire encoding of a replicated field
+ */
+enum class FieldEncoding : u8 {
+    Float,      ///< Full 32-bit float
+    Quantized,  ///< Float mapped to [min, max] with N bits
+    Integer,    ///< Integer offset by min with N bits
+    Bool        ///< Single bit
+};
+
+/**
+ * @brief One scalar field of a replicated component
+ *
+ * Vector fields are described as one scalar field per element.
+ */
+struct ReplicatedField {
+    u32 offset = 0;                     ///< Byte offset within the component
+    FieldEncoding encoding = FieldEncoding::Float;
+    u8 bits = 32;                       ///< Encoded width in bits
+    f32 min = 0.0f;                     ///< Range minimum (Quantized/Integer)
+    f32 max = 0.0f;                     ///< Range maximum (Quantized)
+
+    /// Full precision float at @p offset
+    static ReplicatedField f32Full(usize offset) {
+        return {static_cast<u32>(offset), FieldEncoding::Float, 32, 0.0f, 0.0f};
+    }
+
+    /// Float quantized to @p bits over [min, max]
+    static ReplicatedField f32Quantized(usize offset, f32 minValue, f32 maxValue, u8 bits) {
+        return {static_cast<u32>(offset), FieldEncoding::Quantized, bits, minValue, maxValue};
+    }
+
+    /// 32-bit integer stored as (value - min) in @p bits
+    static ReplicatedField integer(usize offset, u8 bits, i32 minValue = 0) {
+        return {static_cast<u32>(offset), FieldEncoding::Integer, bits,
+                static_cast<f32>(minValue), 0.0f};
+    }
+
+    /// Boolean
+    static ReplicatedField boolean(usize offset) {
+        return {static_cast<u32>(offset), FieldEncoding::Bool, 1, 0.0f, 0.0f};
+    }
+};
+
+/**
+ * @brief Marks an entity for replication and carries its network identity
+ */
+struct Replicated {
+    NetworkId id;
+    ReplicationPriority priority = ReplicationPriority::Normal;
+};
+
+/**
+ * @brief Set of replicable component types shared by server and client
+ *
+ * Both sides must register the same components in the same order, since
+ * the registration index is the component's wire ID.
+ *
+ * @code
+ * registry.registerComponent<Transform>({
+ *     ReplicatedField::f32Quantized(offsetof(Transform, x), -2048.0f, 2048.0f, 20), ...
+ * }, 0);   // fields 0..2 hold the interest position
+ * @endcode
+ */
+class ReplicationRegistry {
+public:
+    /// Type-erased view of a registered component
+    struct ComponentDesc {
+        ecs::ComponentId componentId = ecs::INVALID_COMPONENT_ID;
+        std::vector<ReplicatedField> fields;
+        u32 valueOffset = 0;            ///< First value slot within an entity
+        const void* (*get)(ecs::World&, ecs::Entity) = nullptr;
+        void* (*getOrAdd)(ecs::World&, ecs::Entity) = nullptr;
+    };
+
+    /**
+     * @brief Register a replicable component type
+     * @param fields Fields to replicate, in wire order
+     * @param positionField Index of the first of three Float/Quantized fields
+     *        holding the entity's world position for interest management,
+     *        or -1 if this component does not carry it
+     * @return Wire index of the component, or an error when full
+     */
+    template<typename T>
+    Result<u32> registerComponent(std::vector<ReplicatedField> fields, i32 positionField = -1) {
+        static_assert(std::is_default_constructible_v<T>, "Replicated components need a default constructor");
+
+        ComponentDesc desc;
+        desc.componentId = ecs::componentId<T>();
+        desc.fields = std::move(fields);
+        desc.get = [](ecs::World& world, ecs::Entity entity) -> const void* {
+            return world.getComponent<T>(entity);
+        };
+        desc.getOrAdd = [](ecs::World& world, ecs::Entity entity) -> void* {
+            if (T* existing = world.getComponent<T>(entity)) {
+                return existing;
+            }
+            return &world.addComponent<T>(entity);
+        };
+        return addComponent(std::move(desc), positionField);
+    }
+
+    [[nodiscard]] const std::vector<ComponentDesc>& components() const noexcept { return m_components; }
+
+    /// Total value slots per entity across all components
+    [[nodiscard]] u32 valuesPerEntity() const noexcept { return m_valuesPerEntity; }
+
+    /// Component/field holding the interest position (component -1 if none)
+    [[nodiscard]] i32 positionComponent() const noexcept { return m_positionComponent; }
+    [[nodiscard]] u32 positionValueSlot() const noexcept { return m_positionSlot; }
+
+    /// Bits needed to encode a component mask
+    [[nodiscard]] u32 maskBits() const noexcept { return static_cast<u32>(m_components.size()); }
+
+    /// Quantize a field read from component memory
+    [[nodiscard]] static u32 encodeField(const ReplicatedField& field, const void* component);
+
+    /// Write a quantized value back into component memory
+    static void decodeField(const ReplicatedField& field, u32 value, void* component);
+
+    /// Reconstruct the float a quantized value represents
+    [[nodiscard]] static f32 dequantize(const ReplicatedField& field, u32 value);
+
+private:
+    std::vector<ComponentDesc> m_components;
+    u32 m_valuesPerEntity = 0;
+    i32 m_positionComponent = -1;
+    u32 m_positionSlot = 0;
+
+    Result<u32> addComponent(ComponentDesc desc, i32 positionField);
+};
+
+// ============================================================================
+// Snapshots
+// ============================================================================
+
+/**
+ * @brief Quantized state of all replicated entities at one tick
+ *
+ * Entries are sorted by network ID; each owns registry.valuesPerEntity()
+ * value slots starting at its valueOffset (absent components read as zero).
+ */
+struct ReplicationSnapshot {
+    struct Entry {
+        NetworkId id;
+        u32 valueOffset = 0;            ///< First slot in values
+        u32 componentMask = 0;
+        ReplicationPriority priority = ReplicationPriority::Normal;
+        Vec3 position;
+    };
+
+    u32 tick = 0;
+    bool valid = false;
+    std::vector<Entry> entries;
+    std::vector<u32> values;
+
+    /// Binary-search an entity; returns its entry index or -1
+    [[nodiscard]] i32 find(NetworkId id) const noexcept;
+
+    void clear() {
+        valid = false;
+        entries.clear();
+        values.clear();
+    }
+};
+
+/**
+ * @brief Uniform grid over the XZ plane for interest queries
+ *
+ * Rebuilt from each snapshot by sorting (cell, entry) pairs, so it
+ * allocates nothing once warmed up.
+ */
+class InterestGrid {
+public:
+    explicit InterestGrid(f32 cellSize = 64.0f) : m_cellSize(cellSize) {}
+
+    void setCellSize(f32 cellSize) { m_cellSize = cellSize; }
+    [[nodiscard]] f32 cellSize() const noexcept { return m_cellSize; }
+
+    /// Index every snapshot entry by position
+    void rebuild(const ReplicationSnapshot& snapshot);
+
+    /// Append entry indices whose cell overlaps the circle (center, radius)
+    void query(const Vec3& center, f32 radius, std::vector<u32>& out) const;
+
+private:
+    struct Cell {
+        u64 key;
+        u32 entry;
+    };
+
+    f32 m_cellSize;
+    std::vector<Cell> m_cells;
+
+    [[nodiscard]] i32 cellCoord(f32 v) const noexcept;
+    [[nodiscard]] static u64 cellKey(i32 x, i32 z) noexcept;
+};
+
+// ============================================================================
+// NetworkReplicator - Server side
+// ============================================================================
+
+/**
+ * @brief Per-client replication settings
+ */
+struct ReplicationClientConfig {
+    Vec3 viewPosition;                          ///< Center of interest
+    f32 interestRadius = 256.0f;                ///< Entities farther away are not sent
+    u32 budgetBytes = DEFAULT_REPLICATION_BUDGET; ///< Max update size per tick
+};
+
+/**
+ * @brief Replication statistics for the last update
+ */
+struct ReplicationStats {
+    u32 snapshotEntities = 0;       ///< Entities captured in the snapshot
+    u32 entitiesSent = 0;           ///< Entity records written to all clients
+    u32 deltaRecords = 0;           ///< Records encoded against a baseline
+    u32 fullRecords = 0;            ///< Records sent without a baseline
+    u32 removals = 0;               ///< Removal records written
+    u32 deferredByBudget = 0;       ///< Relevant entities left for later ticks
+    u64 bytesSent = 0;              ///< Total update bytes produced
+};
+
+/**
+ * @brief Server-side replication: snapshots an ECS world each tick and
+ *        builds per-client delta updates
+ *
+ * Typical loop:
+ * @code
+ * replicator.captureSnapshot(world, tick);
+ * replicator.sendUpdates(server);                  // or buildUpdate() per client
+ * // on receipt of a client's ack: replicator.acknowledge(clientId, tick);
+ * @endcode
+ */
+class NetworkReplicator {
+public:
+    explicit NetworkReplicator(const ReplicationRegistry& registry);
+
+    /// Add or update a client; new clients start without baselines
+    void setClient(u64 clientId, const ReplicationClientConfig& config);
+
+    /// Forget a client and its baselines
+    void removeClient(u64 clientId);
+
+    /// Check if a client is registered
+    [[nodiscard]] bool hasClient(u64 clientId) const { return m_clients.contains(clientId); }
+
+    /// Capture the replicated state of @p world for @p tick
+    void captureSnapshot(ecs::World& world, u32 tick);
+
+    /**
+     * @brief Encode the current snapshot for one client
+     * @param out Receives the bit-packed update (at most the client's budget)
+     * @return False if the client is unknown or no snapshot exists
+     */
+    bool buildUpdate(u64 clientId, std::vector<u8>& out);
+
+    /**
+     * @brief Build and send updates to every registered client
+     *
+     * Updates go out unreliably on ChannelType::Replication; lost updates
+     * are superseded by later ones since baselines only advance on ack.
+     */
+    void sendUpdates(NetworkServer& server);
+
+    /// Record that a client received the update for @p tick
+    void acknowledge(u64 clientId, u32 tick);
+
+    /// Grid used for interest queries
+    [[nodiscard]] InterestGrid& interestGrid() noexcept { return m_grid; }
+
+    [[nodiscard]] const ReplicationStats& getStats() const noexcept { return m_stats; }
+
+    /// Latest captured snapshot
+    [[nodiscard]] const ReplicationSnapshot& currentSnapshot() const noexcept {
+        return m_history[m_currentTick % REPLICATION_HISTORY];
+    }
+
+private:
+    /// What a client has acked for one entity
+    struct EntityBaseline {
+        u32 ackedTick = 0;          ///< Tick of the newest acked record
+        bool acked = false;         ///< Client is known to hold this entity
+        bool removed = false;       ///< Removal acked; drop once no longer needed
+        f32 priority = 0.0f;        ///< Accumulated send priority
+    };
+
+    /// Entities written into one unacked update
+    struct SentUpdate {
+        u32 tick = 0;
+        bool valid = false;
+        std::vector<NetworkId> updated;
+        std::vector<NetworkId> removed;
+    };
+
+    struct ClientState {
+        ReplicationClientConfig config;
+        std::unordered_map<u64, EntityBaseline> baselines;
+        std::array<SentUpdate, REPLICATION_HISTORY> sent;
+    };
+
+    struct Candidate {
+        u32 entry;
+        f32 priority;
+    };
+
+    const ReplicationRegistry& m_registry;
+    std::array<ReplicationSnapshot, REPLICATION_HISTORY> m_history;
+    u32 m_currentTick = 0;
+    bool m_hasSnapshot = false;
+    InterestGrid m_grid;
+    std::unordered_map<u64, ClientState> m_clients;
+    ReplicationStats m_stats;
+
+    // Scratch reused across clients
+    std::vector<u32> m_relevant;
+    std::vector<Candidate> m_candidates;
+    std::vector<u8> m_updateBuffer;
+
+    [[nodiscard]] const ReplicationSnapshot* baselineSnapshot(u32 tick) const noexcept;
+};
+
+// ============================================================================
+// ReplicationReceiver - Client side
+// ============================================================================
+
+/**
+ * @brief Client-side replication: applies server updates to a local world
+ */
+class ReplicationReceiver {
+public:
+    explicit ReplicationReceiver(const ReplicationRegistry& registry);
+
+    /**
+     * @brief Decode an update and apply it to @p world
+     *
+     * Entities are created on first sight and destroyed on removal records.
+     * Malformed updates, or deltas whose baseline is unknown, are rejected
+     * without side effects and must not be acknowledged.
+     *
+     * @return Tick of the applied update, to be acknowledged to the server
+     */
+    [[nodiscard]] Result<u32> applyUpdate(ecs::World& world, const u8* data, usize size);
+
+    /// Local entity for a network ID (invalid if unknown)
+    [[nodiscard]] ecs::Entity findEntity(NetworkId id) const;
+
+    /// Number of replicated entities currently mirrored
+    [[nodiscard]] usize entityCount() const noexcept { return m_entities.size(); }
+
+private:
+    const ReplicationRegistry& m_registry;
+    std::array<ReplicationSnapshot, REPLICATION_HISTORY> m_history;
+    std::unordered_map<u64, ecs::Entity> m_entities;
+    std::vector<NetworkId> m_pendingRemovals;
+    u32 m_latestTick = 0;
+    bool m_hasApplied = false;
+};
+
+} // namespace nova::network
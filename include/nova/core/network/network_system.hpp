@@ -149,9 +149,28 @@ public:
     
     /**
      * @brief Queue a packet for sending
+     * 
+     * The packet is queued as a single message and coalesced with other
+     * queued messages by flush().
      */
     [[nodiscard]] Result<void> sendPacket(const NetworkPacket& packet);
     
+    /**
+     * @brief Enter the Connecting state while a handshake challenge is outstanding
+     * @param challengeToken Token the peer must echo in its ConnectionResponse
+     */
+    void beginHandshake(u64 challengeToken);
+    
+    /// Check a handshake response against the challenge issued by beginHandshake()
+    [[nodiscard]] bool verifyChallenge(u64 challengeToken) const noexcept {
+        return m_state == ConnectionState::Connecting && challengeToken == m_challengeToken;
+    }
+    
+    /**
+     * @brief Mark the handshake as complete and enter the Connected state
+     */
+    void establish();
+    
     /**
      * @brief Disconnect this connection
      * @param graceful If true, send disconnect packet first
@@ -163,12 +182,41 @@ public:
      */
     void processPacket(const NetworkPacket& packet);
     
+    /**
+     * @brief Process a raw received datagram without copying its payload
+     * @return False if the datagram was malformed, stale or a duplicate
+     */
+    bool processDatagram(const u8* data, usize size);
+    
     /**
      * @brief Update connection (call each tick)
      * @param deltaTime Time since last update
      */
     void update(f32 deltaTime);
     
+    /**
+     * @brief Coalesce queued messages into MTU-sized datagrams and transmit them
+     * 
+     * Reliable messages whose resend timeout (derived from RTT) has expired
+     * are sent again. An ack-only datagram is emitted when packets were
+     * received but nothing else is queued.
+     * 
+     * @param sender Called once per datagram
+     * @return Number of datagrams produced
+     */
+    u32 flush(const DatagramSender& sender);
+    
+    /**
+     * @brief Flush queued messages to this connection's endpoint
+     */
+    u32 flush(NetworkSocket& socket);
+    
+    /// Get number of reliable messages awaiting acknowledgement
+    [[nodiscard]] u32 getPendingReliableCount() const noexcept { return m_pendingReliableCount; }
+    
+    /// Get current resend timeout in milliseconds
+    [[nodiscard]] f32 getResendTimeoutMs() const noexcept;
+    
     /// Set data received callback
     void setDataCallback(DataCallback callback) { m_dataCallback = std::move(callback); }
     
@@ -176,32 +224,65 @@ public:
     void setStateCallback(ConnectionCallback callback) { m_stateCallback = std::move(callback); }
     
 private:
+    /// Reliable message awaiting acknowledgement
+    struct PendingMessage {
+        MessageHeader header{};
+        std::vector<u8> payload;     ///< Capacity is reused across ring laps
+        f64 lastSendTime = -1.0;     ///< Connection time of last send (-1 = never)
+        u32 sendCount = 0;
+    };
+    
+    /// Bookkeeping for a transmitted datagram
+    struct SentDatagram {
+        f64 sendTime = 0.0;
+        bool acked = false;
+        u16 reliableCount = 0;
+        std::array<u16, MAX_RELIABLE_PER_DATAGRAM> messageIds{};
+    };
+    
     u64 m_id;
     NetworkEndpoint m_endpoint;
     ConnectionState m_state = ConnectionState::Disconnected;
     ConnectionStats m_stats;
+    u64 m_challengeToken = 0;
     
-    // Reliable packet handling
+    // Datagram sequencing and acks
     u16 m_localSequence = 0;
     u16 m_remoteSequence = 0;
-    u32 m_ackBitfield = 0;
+    bool m_ackPending = false;
+    SequenceBuffer<SentDatagram, SENT_PACKET_WINDOW> m_sentDatagrams;
+    SequenceBuffer<u8, SENT_PACKET_WINDOW> m_receivedDatagrams;
+    
+    // Reliable messages, indexed by message ID
+    u16 m_nextMessageId = 0;
+    u16 m_oldestUnackedId = 0;
+    u32 m_pendingReliableCount = 0;
+    SequenceBuffer<PendingMessage, MAX_RELIABLE_WINDOW> m_pendingMessages;
+    SequenceBuffer<u8, MAX_RELIABLE_WINDOW> m_receivedMessages;
+    
+    // Unreliable messages, pre-framed (MessageHeader + payload) back to back
+    std::vector<u8> m_unreliableQueue;
     
-    // Pending packets
-    std::vector<NetworkPacket> m_sendQueue;
-    std::vector<NetworkPacket> m_pendingAcks;
+    // Datagram assembly scratch
+    std::vector<u8> m_datagram;
     
     // Callbacks
     DataCallback m_dataCallback;
     ConnectionCallback m_stateCallback;
     
     // Timing
+    f64 m_time = 0.0;
     f32 m_timeSinceLastReceive = 0.0f;
     f32 m_timeSinceLastSend = 0.0f;
-    f32 m_heartbeatTimer = 0.0f;
+    bool m_hasRttSample = false;
     
     void setState(ConnectionState newState);
     void updateRtt(f32 rttSample);
-    bool processReliablePacket(const NetworkPacket& packet);
+    Result<void> queueMessage(PacketType type, ChannelType channel, bool reliable,
+                              const u8* data, usize size);
+    void processAcks(u16 ack, u32 ackBits);
+    void processMessage(const MessageHeader& header, const u8* data);
+    bool processDatagram(const PacketHeader& header, const u8* payload, usize payloadSize);
 };
 
 // ============================================================================
@@ -326,6 +407,7 @@ private:
     
     void processIncomingPackets();
     void handleConnectionRequest(const NetworkEndpoint& endpoint, const NetworkPacket& packet);
+    void handleConnectionResponse(const NetworkEndpoint& endpoint, const NetworkPacket& packet);
     void removeConnection(u64 connectionId);
 };
 
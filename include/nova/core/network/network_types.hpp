@@ -41,6 +41,7 @@ using nova::u32;
 using nova::u64;
 using nova::i32;
 using nova::f32;
+using nova::f64;
 using nova::usize;
 
 // ============================================================================
@@ -83,11 +84,27 @@ constexpr u32 HEARTBEAT_INTERVAL_MS = 1000;
 constexpr u32 MAX_PLAYERS_PER_SERVER = 10000;
 
 /// Protocol version for compatibility checking
-constexpr u32 PROTOCOL_VERSION = 1;
+constexpr u32 PROTOCOL_VERSION = 2;
 
 /// Magic number for packet validation
 constexpr u32 PACKET_MAGIC = 0x4E4F5641; // "NOVA"
 
+/// Number of sent datagrams remembered for ack/RTT tracking
+constexpr u16 SENT_PACKET_WINDOW = 256;
+
+/// Number of earlier sequences acknowledged by PacketHeader::ackBits
+constexpr u16 ACK_BITS_COUNT = 32;
+
+/// Maximum reliable messages carried by a single datagram
+constexpr u16 MAX_RELIABLE_PER_DATAGRAM = 32;
+
+/// Resend timeout bounds in milliseconds (RTO = rtt + 4 * variance)
+constexpr f32 RESEND_TIMEOUT_MIN_MS = 30.0f;
+constexpr f32 RESEND_TIMEOUT_MAX_MS = 1000.0f;
+
+/// Resend timeout used before the first RTT sample arrives
+constexpr f32 RESEND_TIMEOUT_INITIAL_MS = 200.0f;
+
 // ============================================================================
 // Network Enumerations
 // ============================================================================
@@ -185,6 +202,9 @@ enum class PacketType : u8 {
     RpcCall,
     RpcResponse,
     
+    // Transport
+    Coalesced,          ///< Datagram carrying several framed messages
+    
     // Custom
     UserDefined = 128
 };
@@ -340,7 +360,11 @@ struct NetworkEndpoint {
 // ============================================================================
 
 /**
- * @brief Packet header (12 bytes)
+ * @brief Packet header (20 bytes)
+ * 
+ * Every datagram piggybacks acknowledgement state: @c ack is the most recent
+ * remote sequence received and bit n of @c ackBits acknowledges
+ * (ack - 1 - n), so one header acks up to 33 datagrams.
  */
 struct PacketHeader {
     u32 magic = PACKET_MAGIC;       ///< Magic number for validation
@@ -350,6 +374,9 @@ struct PacketHeader {
     ChannelType channel;            ///< Channel
     u8 flags;                       ///< Packet flags
     u8 fragmentInfo;                ///< Fragment number / total
+    u16 ack;                        ///< Latest remote sequence received
+    u16 messageCount;               ///< Messages coalesced in the payload
+    u32 ackBits;                    ///< Received bitfield preceding ack
     
     /// Flag bits
     static constexpr u8 FLAG_RELIABLE = 0x01;
@@ -357,17 +384,153 @@ struct PacketHeader {
     static constexpr u8 FLAG_ENCRYPTED = 0x04;
     static constexpr u8 FLAG_FRAGMENTED = 0x08;
     static constexpr u8 FLAG_ACK_REQUESTED = 0x10;
+    static constexpr u8 FLAG_HAS_ACK = 0x20;
     
     [[nodiscard]] bool isReliable() const noexcept { return flags & FLAG_RELIABLE; }
     [[nodiscard]] bool isCompressed() const noexcept { return flags & FLAG_COMPRESSED; }
     [[nodiscard]] bool isEncrypted() const noexcept { return flags & FLAG_ENCRYPTED; }
     [[nodiscard]] bool isFragmented() const noexcept { return flags & FLAG_FRAGMENTED; }
     [[nodiscard]] bool ackRequested() const noexcept { return flags & FLAG_ACK_REQUESTED; }
+    [[nodiscard]] bool hasAck() const noexcept { return flags & FLAG_HAS_ACK; }
     
     [[nodiscard]] u8 fragmentNumber() const noexcept { return fragmentInfo >> 5; }
     [[nodiscard]] u8 fragmentTotal() const noexcept { return fragmentInfo & 0x1F; }
 };
 
+static_assert(sizeof(PacketHeader) == 20, "PacketHeader is sent as raw bytes");
+
+/**
+ * @brief Header of one message inside a coalesced datagram (8 bytes)
+ * 
+ * Reliable messages carry a per-connection message ID used for
+ * acknowledgement and duplicate suppression; it is ignored otherwise.
+ */
+struct MessageHeader {
+    PacketType type;                ///< Message type (data or control)
+    ChannelType channel;            ///< Channel
+    u8 flags;                       ///< PacketHeader::FLAG_* bits
+    u8 reserved;                    ///< Padding, must be zero
+    u16 messageId;                  ///< Reliable message ID
+    u16 size;                       ///< Payload size in bytes
+    
+    [[nodiscard]] bool isReliable() const noexcept { 
+        return flags & PacketHeader::FLAG_RELIABLE; 
+    }
+};
+
+static_assert(sizeof(MessageHeader) == 8, "MessageHeader is sent as raw bytes");
+
+/// Largest message payload that fits a single datagram
+constexpr usize MAX_MESSAGE_SIZE = DEFAULT_MTU - sizeof(PacketHeader) - sizeof(MessageHeader);
+
+/**
+ * @brief Wraparound-aware comparison of 16-bit sequence numbers
+ * @return True if @p a is more recent than @p b
+ */
+[[nodiscard]] constexpr bool sequenceGreaterThan(u16 a, u16 b) noexcept {
+    return ((a > b) && (a - b <= 0x8000)) || ((a < b) && (b - a > 0x8000));
+}
+
+/**
+ * @brief Fixed-size ring of entries indexed by 16-bit sequence number
+ * 
+ * Lookup, insert and remove are O(1). Each slot remembers which sequence
+ * it holds, so stale entries from an earlier lap never match. Inserting a
+ * newer sequence clears the slots it skipped over.
+ * 
+ * @tparam T Entry type (default constructible)
+ * @tparam N Capacity; must divide 65536 so slots survive wraparound
+ */
+template<typename T, u16 N>
+class SequenceBuffer {
+    static_assert(N > 0 && (65536 % N) == 0, "SequenceBuffer size must divide 65536");
+    
+public:
+    /**
+     * @brief Claim the slot for a sequence number
+     * 
+     * The slot's previous contents are left in place so entries owning
+     * buffers can reuse their capacity; the caller initialises the entry.
+     * 
+     * @return Entry pointer, or nullptr if the sequence is too old to store
+     */
+    T* insert(u16 sequence) {
+        if (m_empty) {
+            m_empty = false;
+            m_newest = sequence;
+        } else if (sequenceGreaterThan(sequence, m_newest)) {
+            u16 gap = static_cast<u16>(sequence - m_newest);
+            if (gap >= N) {
+                m_tags.fill(EMPTY);
+            } else {
+                for (u16 s = static_cast<u16>(m_newest + 1); s != sequence; ++s) {
+                    m_tags[s % N] = EMPTY;
+                }
+            }
+            m_newest = sequence;
+        } else if (static_cast<u16>(m_newest - sequence) >= N) {
+            return nullptr;
+        }
+        
+        usize slot = sequence % N;
+        m_tags[slot] = sequence;
+        return &m_entries[slot];
+    }
+    
+    /// Find the entry for a sequence, or nullptr if absent
+    [[nodiscard]] T* find(u16 sequence) noexcept {
+        usize slot = sequence % N;
+        return m_tags[slot] == sequence ? &m_entries[slot] : nullptr;
+    }
+    
+    [[nodiscard]] const T* find(u16 sequence) const noexcept {
+        usize slot = sequence % N;
+        return m_tags[slot] == sequence ? &m_entries[slot] : nullptr;
+    }
+    
+    /// Check whether a sequence is stored
+    [[nodiscard]] bool exists(u16 sequence) const noexcept {
+        return m_tags[sequence % N] == sequence;
+    }
+    
+    /// Drop the entry for a sequence (keeps the slot's storage)
+    void remove(u16 sequence) noexcept {
+        usize slot = sequence % N;
+        if (m_tags[slot] == sequence) {
+            m_tags[slot] = EMPTY;
+        }
+    }
+    
+    /// Most recent sequence inserted
+    [[nodiscard]] u16 newest() const noexcept { return m_newest; }
+    
+    /// Check if nothing has been inserted since construction/reset
+    [[nodiscard]] bool empty() const noexcept { return m_empty; }
+    
+    /// Clear all entries
+    void reset() noexcept {
+        m_tags.fill(EMPTY);
+        m_newest = 0;
+        m_empty = true;
+    }
+    
+    [[nodiscard]] static constexpr u16 capacity() noexcept { return N; }
+    
+private:
+    static constexpr u32 EMPTY = 0xFFFFFFFFu;
+    
+    std::array<T, N> m_entries{};
+    std::array<u32, N> m_tags = makeEmptyTags();
+    u16 m_newest = 0;
+    bool m_empty = true;
+    
+    static constexpr std::array<u32, N> makeEmptyTags() noexcept {
+        std::array<u32, N> tags{};
+        tags.fill(EMPTY);
+        return tags;
+    }
+};
+
 /**
  * @brief Network packet container
  */
@@ -674,6 +837,9 @@ using ConnectionCallback = std::function<void(u64 connectionId, ConnectionState
 using DataCallback = std::function<void(u64 connectionId, ChannelType channel, 
                                          const u8* data, usize size)>;
 
+/// Datagram transmit callback (used by NetworkConnection::flush)
+using DatagramSender = std::function<void(const u8* data, usize size)>;
+
 /// RPC callback
 using RpcCallback = std::function<void(const RpcCall& call)>;
 
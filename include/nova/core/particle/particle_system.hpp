@@ -15,6 +15,7 @@
 #include <nova/core/types/types.hpp>
 #include <nova/core/math/math.hpp>
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 #include <mutex>
@@ -119,9 +120,9 @@ private:
     
     // Internal methods
     void emitParticle();
-    void updateParticle(Particle& p, f32 dt, const std::vector<ForceField>& forces);
+    void updateParticle(Particle& p, f32 dt, std::span<const ForceField> forces);
     void applyModules(Particle& p, f32 dt);
-    void applyForces(Particle& p, f32 dt, const std::vector<ForceField>& forces);
+    void applyForces(Particle& p, f32 dt, std::span<const ForceField> forces);
     void checkCollisions(Particle& p, f32 dt);
     void removeDeadParticles();
     
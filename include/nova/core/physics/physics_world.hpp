@@ -18,6 +18,7 @@
 #include "collision_shape.hpp"
 #include "rigid_body.hpp"
 #include <memory>
+#include <span>
 #include <vector>
 #include <unordered_map>
 #include <functional>
@@ -562,14 +563,14 @@ public:
     /**
      * @brief Solve velocity constraints
      */
-    virtual void solveVelocities(std::vector<RigidBody*>& bodies, 
+    virtual void solveVelocities(std::span<RigidBody* const> bodies, 
                                   std::vector<ContactManifold>& contacts,
                                   f32 deltaTime) = 0;
     
     /**
      * @brief Solve position constraints
      */
-    virtual void solvePositions(std::vector<RigidBody*>& bodies,
+    virtual void solvePositions(std::span<RigidBody* const> bodies,
                                  std::vector<ContactManifold>& contacts,
                                  f32 deltaTime) = 0;
 };
@@ -581,11 +582,11 @@ class SequentialImpulseSolver : public ConstraintSolver {
 public:
     explicit SequentialImpulseSolver(u32 velocityIterations = 8, u32 positionIterations = 3);
     
-    void solveVelocities(std::vector<RigidBody*>& bodies,
+    void solveVelocities(std::span<RigidBody* const> bodies,
                          std::vector<ContactManifold>& contacts,
                          f32 deltaTime) override;
     
-    void solvePositions(std::vector<RigidBody*>& bodies,
+    void solvePositions(std::span<RigidBody* const> bodies,
                         std::vector<ContactManifold>& contacts,
                         f32 deltaTime) override;
     
@@ -596,7 +597,7 @@ private:
     u32 m_velocityIterations;
     u32 m_positionIterations;
     
-    void warmStart(std::vector<RigidBody*>& bodies, std::vector<ContactManifold>& contacts);
+    void warmStart(std::span<RigidBody* const> bodies, std::vector<ContactManifold>& contacts);
     void solveVelocityConstraint(RigidBody* bodyA, RigidBody* bodyB, ContactPoint& contact, 
                                   const Vec3& normal, f32 friction);
     void solvePositionConstraint(RigidBody* bodyA, RigidBody* bodyB, const ContactPoint& contact,
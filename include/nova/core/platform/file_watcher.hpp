@@ -0,0 +1,139 @@
+// =============================================================================
+// NovaCore Engine - File Watcher
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// One shared service that reports changed files under watched directories.
+// Characteristics:
+// - inotify on Linux: the kernel reports changes, nothing is rescanned
+// - Other platforms fall back to scanning modification times on the
+//   watcher thread, never on the caller's
+// - Bursts of events for one file (editors often write, truncate and
+//   rename in quick succession) are debounced into a single event
+// - Each subscriber drains its own events with poll(), typically once per
+//   frame from its update(), so no callback runs on the watcher thread
+// =============================================================================
+
+#pragma once
+
+#include "nova/core/types/types.hpp"
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::platform {
+
+/// @brief What happened to a file
+enum class FileChange : u8 {
+    Created,
+    Modified,
+    Removed
+};
+
+/// @brief A settled change to one file
+struct FileEvent {
+    std::string path;   ///< Absolute, lexically normal (see FileWatcher::normalizePath)
+    FileChange change;
+};
+
+/// @brief Shared directory watcher
+/// @note Thread-safe.
+class FileWatcher {
+public:
+    using WatchId = u32;
+
+    static constexpr WatchId INVALID_WATCH = 0;
+
+    /// Quiet time after a file's last event before it is reported
+    static constexpr f32 DEFAULT_DEBOUNCE = 0.1f;
+
+    /// Rescan interval of the portable fallback
+    static constexpr f32 FALLBACK_SCAN_INTERVAL = 0.5f;
+
+    /// @brief The process-wide watcher
+    [[nodiscard]] static FileWatcher& get();
+
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /// @brief Start watching a directory
+    /// @param recursive Also watch subdirectories, including ones created later
+    /// @return INVALID_WATCH if the directory does not exist or cannot be watched
+    [[nodiscard]] WatchId watch(const std::string& directory, bool recursive = true);
+
+    /// @brief Stop a watch and drop its undelivered events
+    void unwatch(WatchId id);
+
+    /// @brief Take the settled events of a watch
+    /// @note Events for the same file are merged, so the result has at most
+    ///       one event per file.
+    [[nodiscard]] std::vector<FileEvent> poll(WatchId id);
+
+    /// @brief Set the quiet time a file needs before its change is reported
+    void setDebounce(f32 seconds);
+
+    /// @brief Whether changes come from the OS instead of rescanning
+    [[nodiscard]] static bool isNative() noexcept;
+
+    /// @brief The form event paths are reported in
+    [[nodiscard]] static std::string normalizePath(const std::string& path);
+
+private:
+    FileWatcher() = default;
+
+    struct Subscription {
+        std::string root;
+        bool recursive = true;
+        std::vector<int> handles;                               ///< Watched directories (native)
+        std::unordered_map<std::string, i64> snapshot;          ///< Modification times (fallback)
+        std::unordered_map<std::string, FileChange> ready;      ///< Settled, not yet polled
+    };
+
+    struct PendingChange {
+        FileChange change;
+        i64 lastEventNs;
+    };
+
+    void start();
+    void run();
+    void waitForEvents(std::unique_lock<std::mutex>& lock);
+    void record(const std::string& path, FileChange change, i64 nowNs);
+    void deliverSettled(i64 nowNs);
+
+    // Native backend (m_mutex held)
+    bool addDirectory(Subscription& subscription, const std::string& directory);
+    void releaseHandles(Subscription& subscription);
+    void readNativeEvents(i64 nowNs);
+
+    // Fallback backend (m_mutex held)
+    void scan(Subscription& subscription, bool report, i64 nowNs);
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeCV;          ///< Fallback sleep and shutdown
+    std::thread m_thread;
+    bool m_running = false;
+    i64 m_debounceNs = static_cast<i64>(DEFAULT_DEBOUNCE * 1e9f);
+
+    WatchId m_nextId = 1;
+    std::unordered_map<WatchId, Subscription> m_subscriptions;
+    std::unordered_map<std::string, PendingChange> m_pending;
+
+    // Native backend
+    int m_notifyFd = -1;
+    int m_wakeFd = -1;
+    std::unordered_map<int, std::string> m_handlePaths;    ///< Watch descriptor -> directory
+    std::unordered_map<int, u32> m_handleRefs;
+};
+
+} // namespace nova::platform
+
+namespace nova {
+    using FileWatcher = platform::FileWatcher;
+}
@@ -0,0 +1,57 @@
+// =============================================================================
+// NovaCore Engine - Memory-Mapped Files
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Read-only views of whole files. Formats laid out for in-place use (resource
+// packs, cooked assets) are mapped and validated instead of being read into
+// buffers; pages are faulted in by the OS as they are touched.
+// =============================================================================
+
+#pragma once
+
+#include "nova/core/types/result.hpp"
+
+#include <span>
+#include <string>
+
+namespace nova::platform {
+
+/// @brief Read-only mapping of a whole file
+/// @note Move-only. The view stays valid until the mapping is destroyed,
+///       even if the file is deleted or replaced on disk.
+class MappedFile {
+public:
+    /// @brief Map a file
+    /// @return notFound if it cannot be opened, io if it is empty or cannot be mapped
+    [[nodiscard]] static Result<MappedFile> open(const std::string& path);
+
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    [[nodiscard]] const u8* data() const noexcept { return m_data; }
+    [[nodiscard]] usize size() const noexcept { return m_size; }
+    [[nodiscard]] std::span<const u8> bytes() const noexcept { return {m_data, m_size}; }
+    [[nodiscard]] bool isOpen() const noexcept { return m_data != nullptr; }
+
+private:
+    MappedFile(const u8* data, usize size) noexcept : m_data(data), m_size(size) {}
+
+    void release() noexcept;
+
+    const u8* m_data = nullptr;
+    usize m_size = 0;
+};
+
+} // namespace nova::platform
+
+namespace nova {
+    using MappedFile = platform::MappedFile;
+}
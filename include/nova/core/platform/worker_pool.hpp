@@ -0,0 +1,63 @@
+// =============================================================================
+// NovaCore Engine - Worker Pool
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+//
+// Persistent threads for fork-join work inside a frame: a system hands run()
+// a job count and a job, the caller works alongside the pool, and run()
+// returns once every job has finished. Jobs are claimed from an atomic
+// counter, so uneven jobs balance without a queue.
+// =============================================================================
+
+#pragma once
+
+#include "nova/core/types/types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace nova::platform {
+
+/// @brief Persistent threads that run indexed jobs alongside the caller
+/// @note run() is not reentrant; one thread drives a pool at a time. Systems
+///       that run concurrently should own separate pools.
+class WorkerPool {
+public:
+    /// @param threadCount Threads taking part in run(), including the caller
+    explicit WorkerPool(u32 threadCount);
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    [[nodiscard]] u32 getThreadCount() const noexcept { return static_cast<u32>(m_threads.size()) + 1; }
+
+    /// @brief Run job(0..jobCount-1) across the pool; returns when all are done
+    void run(u32 jobCount, const std::function<void(u32)>& job);
+
+private:
+    void drain();
+    void workerMain();
+
+    std::vector<std::thread> m_threads;
+    std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_done;
+    const std::function<void(u32)>* m_job = nullptr;
+    u32 m_jobCount = 0;
+    std::atomic<u32> m_nextJob{0};
+    u32 m_busy = 0;
+    u64 m_generation = 0;
+    bool m_stop = false;
+};
+
+} // namespace nova::platform
+
+namespace nova {
+    using WorkerPool = platform::WorkerPool;
+}
@@ -22,6 +22,7 @@
 #include "nova/core/math/vec4.hpp"
 #include "nova/core/math/mat4.hpp"
 
+#include <algorithm>
 #include <array>
 #include <vector>
 #include <queue>
@@ -29,7 +30,14 @@
 #include <functional>
 #include <string>
 #include <memory>
+#include <optional>
 #include <atomic>
+#include <bit>
+#include <span>
+
+namespace nova::platform {
+class WorkerPool;
+}
 
 namespace nova {
 
@@ -59,6 +67,10 @@ struct OcclusionConfig {
     /// Software rasterizer tile size
     static constexpr u32 SOFTWARE_TILE_SIZE = 64;
     
+    /// Default software depth buffer resolution
+    static constexpr u32 SOFTWARE_BUFFER_WIDTH = 320;
+    static constexpr u32 SOFTWARE_BUFFER_HEIGHT = 192;
+    
     /// Maximum portals
     static constexpr u32 MAX_PORTALS = 1024;
     
@@ -575,6 +587,120 @@ struct Frustum {
     }
 };
 
+// =============================================================================
+// Batch Frustum Culling
+// =============================================================================
+
+/**
+ * @brief Object bounds as structure-of-arrays, for culling 8 at a time
+ * 
+ * Centers and half-extents per axis. Arrays are padded to a multiple of 8
+ * so batch loads never run past the end; padding is never reported visible.
+ */
+class BoundsSoA {
+public:
+    /**
+     * @brief Remove all objects, keeping storage
+     */
+    void clear() noexcept {
+        m_count = 0;
+        for (auto& axis : m_centers) axis.clear();
+        for (auto& axis : m_extents) axis.clear();
+    }
+    
+    void reserve(u32 count) {
+        usize padded = paddedSize(count);
+        for (auto& axis : m_centers) axis.reserve(padded);
+        for (auto& axis : m_extents) axis.reserve(padded);
+    }
+    
+    /**
+     * @brief Append an object
+     * @return Its index
+     */
+    u32 add(const AABB& bounds) {
+        if (m_count == m_centers[0].size()) {
+            usize padded = paddedSize(m_count + 1);
+            for (auto& axis : m_centers) axis.resize(padded, 0.0f);
+            for (auto& axis : m_extents) axis.resize(padded, 0.0f);
+        }
+        set(m_count, bounds);
+        return m_count++;
+    }
+    
+    /**
+     * @brief Replace the bounds of an existing object
+     */
+    void set(u32 index, const AABB& bounds) noexcept {
+        Vec3 center = bounds.getCenter();
+        Vec3 extents = bounds.getHalfExtents();
+        m_centers[0][index] = center.x;
+        m_centers[1][index] = center.y;
+        m_centers[2][index] = center.z;
+        m_extents[0][index] = extents.x;
+        m_extents[1][index] = extents.y;
+        m_extents[2][index] = extents.z;
+    }
+    
+    [[nodiscard]] AABB get(u32 index) const noexcept {
+        return AABB::fromCenterHalfExtents(
+            Vec3{m_centers[0][index], m_centers[1][index], m_centers[2][index]},
+            Vec3{m_extents[0][index], m_extents[1][index], m_extents[2][index]});
+    }
+    
+    [[nodiscard]] u32 size() const noexcept { return m_count; }
+    [[nodiscard]] bool empty() const noexcept { return m_count == 0; }
+    
+    /// Center coordinates along an axis (0 = x, 1 = y, 2 = z), padded
+    [[nodiscard]] const f32* getCenters(u32 axis) const noexcept { return m_centers[axis].data(); }
+    
+    /// Half-extents along an axis, padded
+    [[nodiscard]] const f32* getExtents(u32 axis) const noexcept { return m_extents[axis].data(); }
+
+private:
+    static usize paddedSize(u32 count) noexcept { return (static_cast<usize>(count) + 7) & ~usize{7}; }
+    
+    std::array<std::vector<f32>, 3> m_centers;
+    std::array<std::vector<f32>, 3> m_extents;
+    u32 m_count = 0;
+};
+
+/**
+ * @brief Consecutive objects that share parent bounds
+ */
+struct CullingGroup {
+    /// First object index
+    u32 firstObject = 0;
+    
+    /// Number of objects
+    u32 objectCount = 0;
+};
+
+/**
+ * @brief Frustum test of many objects, 8 per iteration on AVX2 or NEON
+ * @param visibleBits Bit i set if object i is inside or intersecting;
+ *        needs (bounds.size() + 63) / 64 words
+ * @param pool Splits large batches across its threads when given
+ */
+void cullFrustum(const Frustum& frustum, const BoundsSoA& bounds, std::span<u64> visibleBits,
+                 platform::WorkerPool* pool = nullptr);
+
+/**
+ * @brief Two-level frustum test using parent bounds
+ * 
+ * Groups are tested first. Objects of a group that is fully inside or
+ * fully outside are set or cleared without being tested; only groups that
+ * straddle a plane test their objects. Objects outside every group are
+ * tested on their own.
+ * 
+ * @param groupBounds Bounds of each group, enclosing its objects
+ * @param groups Sorted by firstObject and not overlapping
+ * @param visibleBits As for cullFrustum(), over objectBounds
+ */
+void cullFrustumHierarchical(const Frustum& frustum, const BoundsSoA& groupBounds,
+                             std::span<const CullingGroup> groups, const BoundsSoA& objectBounds,
+                             std::span<u64> visibleBits, platform::WorkerPool* pool = nullptr);
+
 // =============================================================================
 // Occlusion Query
 // =============================================================================
@@ -758,6 +884,218 @@ struct CullingStats {
     }
 };
 
+// =============================================================================
+// Visibility Set
+// =============================================================================
+
+/**
+ * @brief Dense per-object flags indexed by object ID
+ * 
+ * One bit per object, grown on demand. Clearing keeps the storage, so a
+ * steady-state frame does not allocate.
+ */
+class VisibilityBitset {
+public:
+    /**
+     * @brief Make room for IDs below count
+     */
+    void reserve(u32 count) {
+        usize words = (static_cast<usize>(count) + 63) / 64;
+        if (words > m_words.size()) {
+            m_words.resize(words, 0);
+        }
+    }
+    
+    /**
+     * @brief Set or clear the flag of an object
+     */
+    void assign(u32 id, bool value) {
+        if (value) {
+            set(id);
+        } else if (id / 64 < m_words.size()) {
+            m_words[id / 64] &= ~(u64{1} << (id % 64));
+        }
+    }
+    
+    void set(u32 id) {
+        reserve(id + 1);
+        m_words[id / 64] |= u64{1} << (id % 64);
+    }
+    
+    /**
+     * @brief Flag of an object; IDs never set read as false
+     */
+    [[nodiscard]] bool test(u32 id) const noexcept {
+        return id / 64 < m_words.size() && (m_words[id / 64] >> (id % 64)) & 1;
+    }
+    
+    /**
+     * @brief Clear every flag
+     */
+    void clear() noexcept {
+        std::fill(m_words.begin(), m_words.end(), u64{0});
+    }
+    
+    /**
+     * @brief Number of set flags
+     */
+    [[nodiscard]] u32 count() const noexcept {
+        u32 total = 0;
+        for (u64 word : m_words) {
+            total += static_cast<u32>(std::popcount(word));
+        }
+        return total;
+    }
+    
+    [[nodiscard]] std::span<const u64> getWords() const noexcept { return m_words; }
+    
+    void swap(VisibilityBitset& other) noexcept { m_words.swap(other.m_words); }
+
+private:
+    std::vector<u64> m_words;
+};
+
+// =============================================================================
+// Software Occlusion Buffer
+// =============================================================================
+
+/**
+ * @brief Software occlusion buffer statistics (last rasterize)
+ */
+struct SoftwareOcclusionStats {
+    /// Occluder meshes added
+    u32 occluders = 0;
+    
+    /// Triangles set up for rasterization, after clipping
+    u32 triangles = 0;
+    
+    /// Triangles dropped as degenerate or off screen
+    u32 rejectedTriangles = 0;
+    
+    /// Triangle-tile pairs produced by binning
+    u32 binnedTriangles = 0;
+    
+    /// Binning and rasterization time (ms)
+    f32 rasterizeTimeMs = 0.0f;
+};
+
+/**
+ * @brief Low-resolution depth buffer rasterized on the CPU from occluders
+ * 
+ * Occluder meshes are transformed, clipped and binned into
+ * OcclusionConfig::SOFTWARE_TILE_SIZE tiles; tiles are rasterized 8 pixels
+ * at a time on AVX2 or NEON, in parallel across the worker threads. Each
+ * 8x8 block keeps its farthest depth, so most occludee pixels are never read.
+ * 
+ * Depth is stored as 1/w: larger is closer, 0 means nothing was drawn.
+ * Rasterization is conservative: occluder depth is pushed back by up to a
+ * pixel of slope, and any occludee that crosses the near plane is visible.
+ * 
+ * @code
+ *     buffer.setViewProjection(viewProj);
+ *     buffer.beginFrame();
+ *     buffer.addOccluder(wall.vertices, wall.indices, wallTransform);
+ *     buffer.rasterize();
+ *     bool visible = buffer.testAABB(bounds);
+ * @endcode
+ * 
+ * @note Expects perspective projections; an orthographic w is constant.
+ */
+class SoftwareOcclusionBuffer {
+public:
+    SoftwareOcclusionBuffer();
+    ~SoftwareOcclusionBuffer();
+    
+    SoftwareOcclusionBuffer(SoftwareOcclusionBuffer&&) noexcept;
+    SoftwareOcclusionBuffer& operator=(SoftwareOcclusionBuffer&&) noexcept;
+    
+    /**
+     * @brief Set the resolution, rounded up to a multiple of 8
+     */
+    void resize(u32 width, u32 height);
+    
+    /**
+     * @brief Threads used to rasterize and test, including the caller
+     */
+    void setThreadCount(u32 threadCount);
+    
+    /**
+     * @brief Set the camera; occluders added later use it
+     */
+    void setViewProjection(const Mat4& viewProjection) noexcept {
+        m_viewProjection = viewProjection;
+    }
+    
+    /**
+     * @brief Drop last frame's occluders and depth
+     */
+    void beginFrame();
+    
+    /**
+     * @brief Transform, clip and queue an indexed triangle mesh
+     * @return false once OcclusionConfig::MAX_SOFTWARE_OCCLUDERS are queued
+     */
+    bool addOccluder(std::span<const Vec3> vertices, std::span<const u32> indices, const Mat4& world);
+    
+    /**
+     * @brief Bin the queued triangles and rasterize every tile
+     */
+    void rasterize();
+    
+    /**
+     * @brief Whether any part of a world-space box may be visible
+     */
+    [[nodiscard]] bool testAABB(const AABB& bounds) const noexcept;
+    
+    /**
+     * @brief Test a batch of boxes
+     * @param visibleBits Bit i set if bounds[i] may be visible; needs
+     *        (bounds.size() + 63) / 64 words
+     */
+    void testAABBs(std::span<const AABB> bounds, std::span<u64> visibleBits) const;
+    
+    /**
+     * @brief Stored 1/w of a pixel, 0 if no occluder covers it
+     */
+    [[nodiscard]] f32 getDepth(u32 x, u32 y) const noexcept {
+        return m_depth[static_cast<usize>(y) * m_width + x];
+    }
+    
+    [[nodiscard]] u32 getWidth() const noexcept { return m_width; }
+    [[nodiscard]] u32 getHeight() const noexcept { return m_height; }
+    [[nodiscard]] u32 getThreadCount() const noexcept { return m_threadCount; }
+    [[nodiscard]] bool hasOccluders() const noexcept { return !m_triangles.empty(); }
+    [[nodiscard]] const SoftwareOcclusionStats& getStats() const noexcept { return m_stats; }
+
+private:
+    /// Screen-space triangle ready for edge-function rasterization
+    struct Triangle {
+        f32 edgeA[3], edgeB[3], edgeC[3];   ///< Inside where a*x + b*y + c >= 0 for all edges
+        f32 depthA, depthB, depthC;         ///< 1/w plane, biased away from the viewer
+        f32 depthMin;                       ///< Farthest vertex 1/w
+        i32 minX, minY, maxX, maxY;         ///< Covered pixels, clipped to the buffer
+    };
+    
+    void setupTriangle(const Vec4& v0, const Vec4& v1, const Vec4& v2);
+    void rasterizeTile(u32 tile);
+    
+    u32 m_width = 0;
+    u32 m_height = 0;
+    u32 m_tilesX = 0;
+    u32 m_tilesY = 0;
+    u32 m_threadCount = 1;
+    Mat4 m_viewProjection;
+    
+    std::vector<f32> m_depth;               ///< 1/w per pixel
+    std::vector<f32> m_blockMin;            ///< Farthest 1/w per 8x8 block
+    std::vector<Triangle> m_triangles;
+    std::vector<std::vector<u32>> m_bins;   ///< Triangle indices per tile
+    std::vector<Vec4> m_clipVertices;       ///< Scratch for addOccluder
+    
+    std::unique_ptr<platform::WorkerPool> m_pool;
+    SoftwareOcclusionStats m_stats;
+};
+
 // =============================================================================
 // Occlusion Culling Manager
 // =============================================================================
@@ -766,6 +1104,8 @@ struct CullingStats {
  * @brief Occlusion culling manager
  * 
  * Manages frustum and occlusion culling for visible determination.
+ * Per-object results are kept in dense bitsets indexed by object ID, so
+ * IDs should be small and reused (entity or instance indices).
  */
 class OcclusionCullingManager {
 public:
@@ -838,6 +1178,7 @@ public:
     void updateFrustum(const Mat4& viewProjection) noexcept {
         m_frustum.extractFromMatrix(viewProjection);
         m_viewProjection = viewProjection;
+        m_softwareBuffer.setViewProjection(viewProjection);
     }
     
     /**
@@ -867,6 +1208,14 @@ public:
         return VisibilityResult::Visible;
     }
     
+    /**
+     * @brief Frustum test of many objects at once
+     * @param visibleBits Bit i set if object i is inside or intersecting
+     * @param pool Splits large batches across its threads when given
+     */
+    void testFrustumBatch(const BoundsSoA& bounds, std::span<u64> visibleBits,
+                          platform::WorkerPool* pool = nullptr);
+    
     /**
      * @brief Test sphere visibility (frustum only)
      */
@@ -899,13 +1248,20 @@ public:
             return VisibilityResult::Visible;
         }
         
-        // Check temporal coherence (use last frame's result)
-        if (m_useTemporalCoherence) {
-            auto it = m_lastFrameResults.find(objectId);
-            if (it != m_lastFrameResults.end() && it->second == VisibilityResult::Occluded) {
+        // The software buffer is built this frame, so it needs no history
+        if (m_technique == OcclusionTechnique::SoftwareRaster) {
+            if (!m_softwareBuffer.testAABB(bounds)) {
                 m_stats.occlusionCulled++;
                 return VisibilityResult::Occluded;
             }
+            m_stats.occlusionPassed++;
+            return VisibilityResult::Visible;
+        }
+        
+        // Check temporal coherence (use last frame's result)
+        if (m_useTemporalCoherence && m_lastFrameOccluded.test(objectId)) {
+            m_stats.occlusionCulled++;
+            return VisibilityResult::Occluded;
         }
         
         // For now, assume visible (real implementation would query Hi-Z or hardware)
@@ -937,6 +1293,41 @@ public:
         return m_pendingQueries.size();
     }
     
+    /**
+     * @brief Cull a batch of objects and record the results
+     * 
+     * Runs the frustum test, then the occlusion test of the current
+     * technique; SoftwareRaster tests the survivors as one batch. Results
+     * are read back with isVisible().
+     */
+    void cullObjects(std::span<const u32> objectIds, std::span<const AABB> bounds);
+    
+    // -------------------------------------------------------------------------
+    // Software Occlusion
+    // -------------------------------------------------------------------------
+    
+    /**
+     * @brief Software depth buffer used by OcclusionTechnique::SoftwareRaster
+     */
+    [[nodiscard]] SoftwareOcclusionBuffer& getSoftwareBuffer() noexcept {
+        return m_softwareBuffer;
+    }
+    
+    /**
+     * @brief Queue an occluder mesh for this frame (after updateFrustum)
+     */
+    bool addOccluder(std::span<const Vec3> vertices, std::span<const u32> indices, const Mat4& world) {
+        return m_softwareBuffer.addOccluder(vertices, indices, world);
+    }
+    
+    /**
+     * @brief Rasterize this frame's occluders; call before testing objects
+     */
+    void rasterizeOccluders() {
+        m_softwareBuffer.rasterize();
+        m_stats.hiZBuildTimeMs += m_softwareBuffer.getStats().rasterizeTimeMs;
+    }
+    
     // -------------------------------------------------------------------------
     // Frame Operations
     // -------------------------------------------------------------------------
@@ -949,8 +1340,11 @@ public:
         m_stats.resetFrameStats();
         
         // Swap results for temporal coherence
-        m_lastFrameResults = std::move(m_currentFrameResults);
-        m_currentFrameResults.clear();
+        m_lastFrameOccluded.swap(m_currentFrameOccluded);
+        m_currentFrameOccluded.clear();
+        m_visible.clear();
+        
+        m_softwareBuffer.beginFrame();
     }
     
     /**
@@ -966,8 +1360,30 @@ public:
     /**
      * @brief Record visibility result for temporal coherence
      */
-    void recordResult(u32 objectId, VisibilityResult result) noexcept {
-        m_currentFrameResults[objectId] = result;
+    void recordResult(u32 objectId, VisibilityResult result) {
+        m_currentFrameOccluded.assign(objectId, result == VisibilityResult::Occluded);
+        m_visible.assign(objectId, result == VisibilityResult::Visible);
+    }
+    
+    /**
+     * @brief Whether an object was recorded visible this frame
+     */
+    [[nodiscard]] bool isVisible(u32 objectId) const noexcept {
+        return m_visible.test(objectId);
+    }
+    
+    /**
+     * @brief Whether an object was recorded occluded last frame
+     */
+    [[nodiscard]] bool wasOccluded(u32 objectId) const noexcept {
+        return m_lastFrameOccluded.test(objectId);
+    }
+    
+    /**
+     * @brief Objects recorded visible this frame, one bit per object ID
+     */
+    [[nodiscard]] const VisibilityBitset& getVisibleSet() const noexcept {
+        return m_visible;
     }
     
     // -------------------------------------------------------------------------
@@ -1002,9 +1418,16 @@ private:
     // Query management
     std::vector<OcclusionQueryRequest> m_pendingQueries;
     
-    // Temporal coherence
-    std::unordered_map<u32, VisibilityResult> m_lastFrameResults;
-    std::unordered_map<u32, VisibilityResult> m_currentFrameResults;
+    // Per-object results, indexed by object ID
+    VisibilityBitset m_lastFrameOccluded;
+    VisibilityBitset m_currentFrameOccluded;
+    VisibilityBitset m_visible;
+    
+    // Software occlusion
+    SoftwareOcclusionBuffer m_softwareBuffer;
+    std::vector<u32> m_batchIds;
+    std::vector<AABB> m_batchBounds;
+    std::vector<u64> m_batchVisible;
     
     // Frame state
     u32 m_currentFrame = 0;
@@ -1050,8 +1473,8 @@ private:
         f32 ndcY = clip.y * invW;
         
         // Convert to screen space
-        f32 screenX = (ndcX * 0.5f + 0.5f) * screenWidth;
-        f32 screenY = (1.0f - (ndcY * 0.5f + 0.5f)) * screenHeight;
+        f32 screenX = (ndcX * 0.5f + 0.5f) * static_cast<f32>(screenWidth);
+        f32 screenY = (1.0f - (ndcY * 0.5f + 0.5f)) * static_cast<f32>(screenHeight);
         
         minX = std::min(minX, screenX);
         minY = std::min(minY, screenY);
@@ -29,8 +29,13 @@
 #include <memory>
 #include <bitset>
 #include <optional>
+#include <span>
 #include <variant>
 
+namespace nova::platform {
+class WorkerPool;
+}
+
 namespace nova::render {
 
 // Forward declarations
@@ -38,6 +43,7 @@ class RenderGraph;
 class RenderGraphBuilder;
 class RenderGraphPass;
 class RenderGraphResource;
+class CommandBuffer;
 
 // ============================================================================
 // Render Graph Configuration
@@ -73,6 +79,12 @@ struct RenderGraphConfig {
     
     /// Enable resource aliasing for memory reuse
     static constexpr bool RESOURCE_ALIASING = true;
+    
+    /// Placement alignment of textures and render targets in transient heaps
+    static constexpr usize TEXTURE_HEAP_ALIGNMENT = 64 * 1024;
+    
+    /// Placement alignment of buffers in transient heaps
+    static constexpr usize BUFFER_HEAP_ALIGNMENT = 256;
 };
 
 // ============================================================================
@@ -119,11 +131,11 @@ enum class ResourceAccess : u16 {
 /**
  * @brief Bitwise operators for ResourceAccess
  */
-inline ResourceAccess operator|(ResourceAccess a, ResourceAccess b) {
+constexpr ResourceAccess operator|(ResourceAccess a, ResourceAccess b) {
     return static_cast<ResourceAccess>(static_cast<u16>(a) | static_cast<u16>(b));
 }
 
-inline ResourceAccess operator&(ResourceAccess a, ResourceAccess b) {
+constexpr ResourceAccess operator&(ResourceAccess a, ResourceAccess b) {
     return static_cast<ResourceAccess>(static_cast<u16>(a) & static_cast<u16>(b));
 }
 
@@ -348,6 +360,43 @@ struct RGResourceUsage {
     u32 arraySlice = 0;         ///< Array slice for texture arrays
 };
 
+// ============================================================================
+// Barriers
+// ============================================================================
+
+/**
+ * @brief Render graph barrier type
+ */
+enum class RGBarrierType : u8 {
+    Transition,     ///< Access/layout change of one resource
+    Aliasing        ///< Resource takes over memory of an earlier one
+};
+
+/**
+ * @brief Split barrier half
+ *
+ * A barrier whose producer finished more than one pass earlier is split:
+ * the Begin half is issued right after the producer and the End half right
+ * before the consumer, so the passes in between overlap the transition.
+ */
+enum class RGBarrierSplit : u8 {
+    None,           ///< Full barrier
+    Begin,
+    End
+};
+
+/**
+ * @brief Barrier issued before a pass executes
+ */
+struct RGBarrier {
+    u32 resource = ~0u;                             ///< Resource index
+    ResourceAccess before = ResourceAccess::None;   ///< None = contents undefined
+    ResourceAccess after = ResourceAccess::None;
+    RGBarrierType type = RGBarrierType::Transition;
+    RGBarrierSplit split = RGBarrierSplit::None;
+    u32 aliasedResource = ~0u;                      ///< Previous occupant (aliasing barriers)
+};
+
 // ============================================================================
 // Render Graph Pass
 // ============================================================================
@@ -380,6 +429,9 @@ struct RGPassData {
     std::vector<u32> dependencies;      ///< Pass indices this depends on
     std::vector<u32> dependents;        ///< Pass indices that depend on this
     
+    // Synchronization (filled by compile)
+    std::vector<RGBarrier> barriers;    ///< Issued before the pass, in order
+    
     /**
      * @brief Check if pass has color targets
      */
@@ -493,14 +545,18 @@ private:
 
 /**
  * @brief Context passed to pass execution callbacks
+ *
+ * With parallel recording, callbacks of different batches run concurrently;
+ * they should only record into their command list and read graph state.
  */
 class RenderGraphContext {
 public:
     /**
      * @brief Construct execution context
      */
-    RenderGraphContext(RenderGraph& graph, const RGPassData& pass)
-        : m_graph(graph), m_pass(pass) {}
+    RenderGraphContext(RenderGraph& graph, const RGPassData& pass,
+                       CommandBuffer* commandList = nullptr, u32 batch = 0)
+        : m_graph(graph), m_pass(pass), m_commandList(commandList), m_batch(batch) {}
     
     /**
      * @brief Get GPU texture for resource
@@ -531,10 +587,23 @@ public:
      * @brief Get scissor
      */
     [[nodiscard]] const Scissor& getScissor() const { return m_pass.scissor; }
+    
+    /**
+     * @brief Get the secondary command list this pass records into
+     * @return nullptr when executing without command lists
+     */
+    [[nodiscard]] CommandBuffer* getCommandList() const { return m_commandList; }
+    
+    /**
+     * @brief Get the recording batch, its position in submission order
+     */
+    [[nodiscard]] u32 getBatch() const { return m_batch; }
 
 private:
     RenderGraph& m_graph;
     const RGPassData& m_pass;
+    CommandBuffer* m_commandList;
+    u32 m_batch;
 };
 
 // ============================================================================
@@ -564,6 +633,12 @@ struct RGResourceData {
     bool isTransient = true;    ///< Transient (can be aliased)
     u32 refCount = 0;           ///< Reference count
     
+    // Transient memory placement (filled by compile)
+    u32 heapIndex = ~0u;        ///< Heap, ~0u if not allocated
+    usize heapOffset = 0;       ///< Byte offset in the heap
+    usize allocationSize = 0;   ///< Aligned size in the heap
+    u32 aliasedResource = ~0u;  ///< Latest earlier resource sharing this memory
+    
     /**
      * @brief Check if resource is texture
      */
@@ -589,6 +664,100 @@ struct RGResourceData {
     }
 };
 
+// ============================================================================
+// Transient Memory
+// ============================================================================
+
+/**
+ * @brief Transient heap type
+ *
+ * Kept apart as on hardware that cannot mix buffers, render targets and
+ * other textures in one heap.
+ */
+enum class RGHeapType : u8 {
+    Buffers,
+    Textures,
+    RenderTargets   ///< Color and depth attachments
+};
+
+/**
+ * @brief Get heap type name
+ */
+constexpr const char* getHeapTypeName(RGHeapType type) {
+    switch (type) {
+        case RGHeapType::Buffers: return "Buffers";
+        case RGHeapType::Textures: return "Textures";
+        case RGHeapType::RenderTargets: return "RenderTargets";
+    }
+    return "Unknown";
+}
+
+/**
+ * @brief Heap shared by transient resources with disjoint lifetimes
+ */
+struct RGHeap {
+    RGHeapType type = RGHeapType::Textures;
+    usize size = 0;             ///< Bytes, the highest end of any placement
+    u32 resourceCount = 0;
+};
+
+/**
+ * @brief Transient memory footprint of a compiled graph
+ */
+struct RGMemoryStats {
+    usize transientBytes = 0;   ///< Sum of all transient allocations
+    usize heapBytes = 0;        ///< Sum of heap sizes after aliasing
+    u32 transientResources = 0;
+    u32 aliasedResources = 0;   ///< Resources reusing memory of an earlier one
+    u32 barrierCount = 0;       ///< Full barriers plus split halves
+    u32 splitBarrierCount = 0;  ///< Begin/end pairs
+    
+    /**
+     * @brief Bytes saved by aliasing
+     */
+    [[nodiscard]] usize savedBytes() const { return transientBytes - heapBytes; }
+};
+
+// ============================================================================
+// Execution
+// ============================================================================
+
+/**
+ * @brief Options for recording a compiled graph
+ *
+ * Active passes are split into contiguous batches in execution order, one
+ * per recording thread. Each batch records into its own secondary command
+ * list and the lists are submitted in batch order, so the GPU sees passes
+ * in execution order with their barriers. Passes flagged ForceSerial get a
+ * batch of their own, recorded on the calling thread after the others.
+ */
+struct RGExecuteOptions {
+    /// Recording threads including the caller; 1 records serially
+    u32 threadCount = 1;
+    
+    /// Secondary command list for a batch; called on recording threads
+    std::function<CommandBuffer*(u32 batch)> acquireCommandList;
+    
+    /// Recorded lists in submission order; called on the calling thread
+    std::function<void(std::span<CommandBuffer* const> commandLists)> submit;
+};
+
+/**
+ * @brief Per-frame compile and record statistics
+ */
+struct RGFrameStats {
+    u64 structureHash = 0;      ///< Hash of passes, usages and resource descriptions
+    bool planReused = false;    ///< Compile reused the cached plan
+    f64 compileTimeMs = 0.0;
+    f64 recordTimeMs = 0.0;
+    u32 recordThreads = 0;      ///< Threads that recorded batches
+    u32 recordBatches = 0;      ///< Command lists submitted
+    
+    // Totals since construction
+    u64 planCacheHits = 0;
+    u64 planCacheMisses = 0;
+};
+
 // ============================================================================
 // Render Graph
 // ============================================================================
@@ -731,14 +900,23 @@ public:
      * 3. Resource lifetime analysis
      * 4. Memory aliasing
      * 5. Barrier computation
+     * 
+     * When the graph has the same structure as the last compiled one (same
+     * passes, usages and resource descriptions; names and imported handles
+     * may differ) the cached plan is applied instead.
      */
     void compile();
     
     /**
-     * @brief Execute all passes
+     * @brief Execute all passes serially on the calling thread
      */
     void execute();
     
+    /**
+     * @brief Record all passes, in parallel if requested
+     */
+    void execute(const RGExecuteOptions& options);
+    
     /**
      * @brief Reset for next frame
      */
@@ -778,6 +956,21 @@ public:
      */
     [[nodiscard]] RGTextureHandle getBackBuffer() const { return m_backBuffer; }
     
+    /**
+     * @brief Get transient heaps (after compile)
+     */
+    [[nodiscard]] const std::vector<RGHeap>& getHeaps() const { return m_heaps; }
+    
+    /**
+     * @brief Get transient memory and barrier statistics (after compile)
+     */
+    [[nodiscard]] const RGMemoryStats& getMemoryStats() const { return m_memoryStats; }
+    
+    /**
+     * @brief Get compile and record statistics of the current frame
+     */
+    [[nodiscard]] const RGFrameStats& getFrameStats() const { return m_frameStats; }
+    
     // ========================================================================
     // Debug
     // ========================================================================
@@ -793,6 +986,13 @@ public:
     [[nodiscard]] std::string exportGraphViz() const;
 
 private:
+    struct CompiledPlan;
+    
+    // Plan caching
+    void buildStructureKey();
+    bool applyCachedPlan();
+    void storePlan();
+    
     // Internal compilation steps
     void buildDependencies();
     void topologicalSort();
@@ -810,6 +1010,14 @@ private:
     std::vector<RGResourceData> m_resources;
     std::vector<ExecuteCallback> m_executeCallbacks;
     std::vector<u32> m_executionOrder;
+    std::vector<RGHeap> m_heaps;
+    RGMemoryStats m_memoryStats;
+    
+    // Compiled plan cache and recording threads, kept across frames
+    std::vector<u64> m_structureKey;
+    std::unique_ptr<CompiledPlan> m_plan;
+    std::unique_ptr<platform::WorkerPool> m_workers;
+    RGFrameStats m_frameStats;
     
     // Frame state
     RGTextureHandle m_backBuffer;
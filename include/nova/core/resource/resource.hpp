@@ -10,6 +10,7 @@
 
 #include "resource_types.hpp"
 #include "resource_manager.hpp"
+#include "resource_pack.hpp"
 
 namespace nova::resource {
 
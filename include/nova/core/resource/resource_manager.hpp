@@ -6,16 +6,21 @@
  * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
  * 
  * Central resource management system providing:
- * - Async and sync resource loading
+ * - Async and sync resource loading through a staged pipeline
  * - Resource caching and memory management
  * - Hot-reload support
  * - Dependency tracking
  * - Virtual file system
+ * - Memory-mapped resource packs
  */
 
 #pragma once
 
 #include "resource_types.hpp"
+#include "resource_pack.hpp"
+#include "resource_registry.hpp"
+
+#include <nova/core/platform/file_watcher.hpp>
 
 #include <unordered_map>
 #include <queue>
@@ -23,6 +28,7 @@
 #include <atomic>
 #include <thread>
 #include <condition_variable>
+#include <future>
 
 namespace nova::resource {
 
@@ -33,7 +39,16 @@ namespace nova::resource {
 /**
  * @brief Central resource management system
  * 
- * The ResourceManager handles all resource loading, caching, and lifecycle:
+ * The ResourceManager handles all resource loading, caching, and lifecycle.
+ * 
+ * Asynchronous loads pass through three stages:
+ * - An I/O thread takes requests in priority order and reads them in
+ *   batches (pack entries need no read)
+ * - Decode workers run the loaders, again in priority order
+ * - update() finalizes decoded resources on the calling thread within a
+ *   per-frame time budget, then fulfils futures and runs callbacks
+ * 
+ * Requests for a path that is already in flight join that load.
  * 
  * Usage:
  * @code
@@ -108,7 +123,8 @@ public:
      * @brief Load a resource asynchronously
      * @tparam T Resource type
      * @param path Resource path
-     * @param callback Called when load completes
+     * @param callback Called by update() when the load completes or fails
+     *        (immediately if the resource is already loaded)
      * @param priority Load priority
      * @param flags Load flags
      */
@@ -118,6 +134,24 @@ public:
                   LoadPriority priority = LoadPriority::Normal,
                   LoadFlags flags = LoadFlags::Async);
     
+    /// Result of an asynchronous load, shared by every request for the path
+    using LoadFuture = std::shared_future<ResourceHandle<>>;
+    
+    /**
+     * @brief Queue a load and get a future for it
+     * 
+     * Joining a load already in flight raises its priority if @p priority
+     * is higher. The future is fulfilled by update(), so the thread that
+     * calls update() must not wait on it; use load() to block instead.
+     * 
+     * @return Future of the handle (a Failed resource if loading failed,
+     *         an invalid handle if no loader handles the path)
+     */
+    LoadFuture requestLoad(const ResourcePath& path,
+                           LoadPriority priority = LoadPriority::Normal,
+                           LoadFlags flags = LoadFlags::Async,
+                           std::function<void(ResourceHandle<>)> callback = {});
+    
     /**
      * @brief Load multiple resources asynchronously
      */
@@ -263,6 +297,7 @@ public:
     
     /**
      * @brief Read raw file data
+     * @note Entries of loaded bundles are served before loose files.
      */
     std::vector<u8> readFile(const ResourcePath& path) const;
     
@@ -276,12 +311,19 @@ public:
     // ========================================================================
     
     /**
-     * @brief Load a resource bundle
+     * @brief Mount a resource pack as a bundle
+     * 
+     * The pack is memory-mapped; its entries take precedence over loose
+     * files and over bundles loaded earlier. Loading a bundle with the
+     * same name again replaces it.
+     * 
+     * @param bundlePath Pack file (virtual or physical path)
+     * @return false if the pack cannot be opened or is invalid
      */
     bool loadBundle(const ResourcePath& bundlePath);
     
     /**
-     * @brief Unload a resource bundle
+     * @brief Unload a resource bundle's resources and unmap its pack
      */
     void unloadBundle(const std::string& bundleName);
     
@@ -311,6 +353,10 @@ public:
     
     /**
      * @brief Add a directory to watch for changes
+     * 
+     * Changed files that back loaded resources are reloaded on the pipeline
+     * threads and swapped in by update(); resources that depend on them
+     * (see addDependency) are then notified in dependency order.
      */
     void watchDirectory(const std::string& path);
     
@@ -339,17 +385,37 @@ public:
     usize getCacheSize() const { return m_cacheSize; }
     
     /**
-     * @brief Get used cache memory
+     * @brief Get used cache memory (maintained incrementally, O(1))
      */
     usize getUsedMemory() const;
     
+    /**
+     * @brief Limit the memory of one resource type
+     * 
+     * Types over their budget are evicted from first, then the least
+     * recently used resources of any type until the cache size is met.
+     */
+    void setTypeBudget(ResourceType type, usize bytes);
+    
+    /**
+     * @brief Memory budget of a type (unlimited unless set)
+     */
+    usize getTypeBudget(ResourceType type) const;
+    
+    /**
+     * @brief Memory used by loaded resources of a type
+     */
+    usize getTypeMemory(ResourceType type) const;
+    
     /**
      * @brief Clear the cache
      */
     void clearCache();
     
     /**
-     * @brief Trim cache to fit size
+     * @brief Trim cache to fit size and type budgets, without a time limit
+     * @note Resources with handles outside the manager, and Persistent
+     *       resources, are never evicted.
      */
     void trimCache();
     
@@ -358,6 +424,18 @@ public:
      */
     void setUnloadDelay(f32 seconds);
     
+    /**
+     * @brief Set the time update() may spend finalizing loads
+     * @note At least one load is finalized per update() when any is ready.
+     */
+    void setFinalizeBudget(f32 seconds);
+    
+    /**
+     * @brief Set the time update() may spend evicting over-budget resources
+     * @note At least one resource is evicted per update() when over budget.
+     */
+    void setEvictionBudget(f32 seconds);
+    
     // ========================================================================
     // Statistics
     // ========================================================================
@@ -412,40 +490,109 @@ private:
     ResourceManager(const ResourceManager&) = delete;
     ResourceManager& operator=(const ResourceManager&) = delete;
     
+    // Load pipeline
+    enum class LoadStage : u8 {
+        Queued,     // Waiting for I/O
+        Reading,
+        Read,       // Waiting for a decode worker
+        Decoding,
+        Decoded,    // Waiting for finalize
+        Finalized
+    };
+    
+    struct PendingLoad;
+    
+    /// Queue entry; stale entries (stage already claimed) are skipped
+    struct QueuedLoad {
+        u8 priority;
+        u64 sequence;
+        std::shared_ptr<PendingLoad> load;
+        
+        bool operator<(const QueuedLoad& other) const {
+            return priority != other.priority ? priority < other.priority : sequence > other.sequence;
+        }
+    };
+    using LoadQueue = std::priority_queue<QueuedLoad>;
+    
     // Internal methods
     ResourceHandle<> loadInternal(const ResourcePath& path, LoadFlags flags);
-    void processLoadQueue();
+    std::shared_ptr<PendingLoad> joinOrCreateLoad(const ResourcePath& path, LoadFlags flags,
+                                                  LoadPriority priority, ResourceHandle<>& ready,
+                                                  bool& created);
+    void pushLoad(LoadQueue& queue, const std::shared_ptr<PendingLoad>& load);
+    void readStage(PendingLoad& load) const;
+    void decodeStage(PendingLoad& load) const;
+    void completeLoad(PendingLoad& load);
+    void finalizeLoad(const std::shared_ptr<PendingLoad>& load);
+    void finalizeLoads(f64 budgetSeconds);
+    void ioThread();
     void workerThread();
     void checkHotReload();
-    void evictLRU();
     
-    Resource* findResource(const ResourcePath& path) const;
-    Resource* findResource(ResourceId id) const;
+    // Hot reload
+    struct ReloadBatch;
+    void finalizeReload(PendingLoad& load);
+    void refinalizeDependents(const std::vector<ResourceId>& changed);
+    
+    // Cache accounting (m_cacheMutex held)
+    struct LruList {
+        Resource* head = nullptr;   // Most recently used
+        Resource* tail = nullptr;
+        usize size = 0;
+        
+        void pushFront(Resource* resource);
+        void remove(Resource* resource);
+    };
+    struct TypeCache {
+        usize used = 0;
+        usize budget = ~usize(0);
+        LruList lru;
+    };
+    void chargeLocked(Resource& resource);
+    void unchargeLocked(Resource& resource);
+    Resource* findVictimLocked(TypeCache& cache);
+    void unloadLocked(Resource& resource);
+    void evict(f64 budgetSeconds);
+    
+    std::shared_ptr<Resource> findResource(const ResourcePath& path) const;
+    std::shared_ptr<Resource> findResource(ResourceId id) const { return m_registry.find(id); }
+    
+    /// Pack entry of a path, keeping its pack mapped while in use
+    struct PackedFile {
+        std::shared_ptr<ResourcePack> pack;
+        const PackEntry* entry = nullptr;
+    };
+    PackedFile findPacked(const ResourcePath& path) const;
+    bool loadPacked(IResourceLoader& loader, Resource* resource, const PackedFile& file) const;
     
     // State
     bool m_initialized = false;
     std::atomic<bool> m_running{false};
     
-    // Resources
-    mutable std::mutex m_resourceMutex;
-    std::unordered_map<ResourceId, std::shared_ptr<Resource>> m_resources;
-    std::unordered_map<ResourcePath, ResourceId> m_pathToId;
+    // Resources, keyed by ResourceId::fromPath(); lookups only lock a registry shard
+    ResourceRegistry m_registry;
+    
+    // Registration and cache accounting
+    mutable std::mutex m_cacheMutex;
     
     // Loaders
     std::unordered_map<std::string, std::unique_ptr<IResourceLoader>> m_loaders;
     
-    // Load queue
-    std::mutex m_queueMutex;
-    std::condition_variable m_queueCV;
-    std::priority_queue<LoadRequest, std::vector<LoadRequest>,
-                       std::function<bool(const LoadRequest&, const LoadRequest&)>> m_loadQueue{
-        [](const LoadRequest& a, const LoadRequest& b) {
-            return a.priority < b.priority;
-        }
-    };
-    
-    // Worker threads
-    std::vector<std::thread> m_workers;
+    // Load pipeline (lock order: m_pipelineMutex, m_cacheMutex, registry shard)
+    mutable std::mutex m_pipelineMutex;
+    std::condition_variable m_ioCV;
+    std::condition_variable m_decodeCV;
+    std::condition_variable m_stageCV;      // Any stage change, for load() joining a request
+    LoadQueue m_ioQueue;
+    LoadQueue m_decodeQueue;
+    LoadQueue m_finalizeQueue;
+    std::unordered_map<ResourcePath, std::shared_ptr<PendingLoad>> m_inFlight;
+    u64 m_nextSequence = 0;
+    f32 m_finalizeBudget = ResourceConfig::DEFAULT_FINALIZE_BUDGET;
+    
+    // Pipeline threads
+    std::thread m_ioThread;
+    std::vector<std::thread> m_workers;  // Decode workers
     
     // Virtual file system
     struct MountPoint {
@@ -459,18 +606,35 @@ private:
     // Bundles
     std::unordered_map<std::string, ResourceBundle> m_bundles;
     
+    struct MountedPack {
+        std::string bundleName;
+        std::shared_ptr<ResourcePack> pack;
+    };
+    mutable std::mutex m_packMutex;
+    std::vector<MountedPack> m_packs;  // Newest first
+    
     // Hot reload
     bool m_hotReloadEnabled = true;
-    std::vector<std::string> m_watchDirectories;
+    struct WatchedDirectory {
+        std::string path;
+        platform::FileWatcher::WatchId watch;
+    };
+    std::vector<WatchedDirectory> m_watchDirectories;
+    std::unordered_map<std::string, ResourceId> m_fileToId;  // Normalized path of loose files, guarded by m_cacheMutex
     std::function<void(const ResourcePath&)> m_hotReloadCallback;
     
     // Cache
     usize m_cacheSize = ResourceConfig::DEFAULT_CACHE_SIZE;
     f32 m_unloadDelay = ResourceConfig::DEFAULT_UNLOAD_DELAY;
+    f32 m_evictionBudget = ResourceConfig::DEFAULT_EVICTION_BUDGET;
+    std::atomic<usize> m_usedMemory{0};                       // Written under m_cacheMutex
+    std::unordered_map<ResourceType, TypeCache> m_typeCaches; // Guarded by m_cacheMutex
     
     // Statistics
     mutable std::mutex m_statsMutex;
     CacheStats m_stats;
+    std::atomic<u32> m_cacheHits{0};    // Counted outside m_statsMutex
+    std::atomic<u32> m_cacheMisses{0};
     
     // Dependencies
     std::unordered_map<ResourceId, std::vector<ResourceId>> m_dependencies;
@@ -495,48 +659,19 @@ void ResourceManager::loadAsync(const ResourcePath& path,
                                 std::function<void(ResourceHandle<T>)> callback,
                                 LoadPriority priority,
                                 LoadFlags flags) {
-    LoadRequest request;
-    request.path = path;
-    request.priority = priority;
-    request.flags = flags | LoadFlags::Async;
-    request.onComplete = [callback](ResourceHandle<> handle) {
+    requestLoad(path, priority, flags | LoadFlags::Async, [callback](ResourceHandle<> handle) {
         callback(handle.cast<T>());
-    };
-    
-    {
-        std::lock_guard<std::mutex> lock(m_queueMutex);
-        m_loadQueue.push(request);
-    }
-    m_queueCV.notify_one();
+    });
 }
 
 template<typename T>
 ResourceHandle<T> ResourceManager::get(const ResourcePath& path) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_pathToId.find(path);
-    if (it == m_pathToId.end()) {
-        return ResourceHandle<T>();
-    }
-    
-    auto resIt = m_resources.find(it->second);
-    if (resIt == m_resources.end()) {
-        return ResourceHandle<T>();
-    }
-    
-    return ResourceHandle<T>(std::dynamic_pointer_cast<T>(resIt->second));
+    return ResourceHandle<>(findResource(path)).template cast<T>();
 }
 
 template<typename T>
 ResourceHandle<T> ResourceManager::get(ResourceId id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_resources.find(id);
-    if (it == m_resources.end()) {
-        return ResourceHandle<T>();
-    }
-    
-    return ResourceHandle<T>(std::dynamic_pointer_cast<T>(it->second));
+    return ResourceHandle<>(findResource(id)).template cast<T>();
 }
 
 template<typename T>
@@ -548,12 +683,17 @@ ResourceHandle<T> ResourceManager::registerResource(std::shared_ptr<T> resource,
     resource->m_id = id;
     resource->m_path = path;
     resource->m_name = path.getStem();
+    if constexpr (TaggedResource<T>) {
+        resource->m_type = T::RESOURCE_TYPE;
+    }
     resource->setState(ResourceState::Loaded);
     
     {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        m_resources[id] = resource;
-        m_pathToId[path] = id;
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        if (auto replaced = m_registry.insert(id, resource)) {
+            unchargeLocked(*replaced);
+        }
+        chargeLocked(*resource);
     }
     
     return ResourceHandle<T>(resource);
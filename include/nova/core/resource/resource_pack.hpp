@@ -0,0 +1,253 @@
+/**
+ * @file resource_pack.hpp
+ * @brief NovaCore Resource System™ - Memory-Mapped Resource Packs
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * A pack stores many resources in one file so a bundle is mounted with a
+ * single open and map instead of one open and read per asset:
+ * - Fixed header, dense entry table and a hashed index keyed by ResourceId
+ * - Entry data aligned for direct use from the mapping
+ * - Optional per-entry LZ4 (built in) or Zstandard (when available)
+ *   compression; uncompressed entries are served as zero-copy spans
+ *
+ * File layout (little-endian):
+ * @code
+ *     PackHeader
+ *     PackEntry[entryCount]          sorted by path
+ *     u32 index[indexSize]           entry + 1 per slot, 0 = empty
+ *     char names[namesSize]          entry paths, not terminated
+ *     entry data                     each aligned to dataAlignment
+ * @endcode
+ */
+
+#pragma once
+
+#include "resource_types.hpp"
+
+#include <nova/core/platform/mapped_file.hpp>
+#include <nova/core/types/result.hpp>
+
+#include <bit>
+#include <span>
+#include <string_view>
+#include <unordered_set>
+
+namespace nova::resource {
+
+static_assert(std::endian::native == std::endian::little,
+              "Resource packs are mapped in place and assume a little-endian host");
+
+// ============================================================================
+// Pack Format
+// ============================================================================
+
+/**
+ * @brief Per-entry compression codec
+ */
+enum class PackCompression : u16 {
+    None = 0,
+    LZ4 = 1,    ///< LZ4 block format
+    Zstd = 2    ///< Zstandard frame (requires NOVA_HAS_ZSTD to read or write)
+};
+
+namespace PackFormat {
+    constexpr u32 MAGIC = 0x4B50564E;           // "NVPK"
+    constexpr u32 VERSION = 1;
+    constexpr u32 DEFAULT_ALIGNMENT = 16;
+    constexpr u32 MAX_ALIGNMENT = 64 * 1024;
+    constexpr u64 MAX_ENTRY_SIZE = u64{1} << 30;   // Largest entry after decompression
+    constexpr u64 LZ4_MAX_RATIO = 255;             // Bytes one LZ4 byte can expand to
+}
+
+/**
+ * @brief Pack file header
+ */
+struct PackHeader {
+    u32 magic = PackFormat::MAGIC;
+    u32 version = PackFormat::VERSION;
+    u32 entryCount = 0;
+    u32 indexSize = 0;          ///< Index slots, a power of two
+    u64 entriesOffset = 0;
+    u64 indexOffset = 0;
+    u64 namesOffset = 0;
+    u64 namesSize = 0;
+    u64 dataOffset = 0;         ///< Start of the first entry's data
+    u64 fileSize = 0;
+    u32 dataAlignment = PackFormat::DEFAULT_ALIGNMENT;
+    u32 flags = 0;              ///< Reserved
+};
+
+/**
+ * @brief Table of contents entry
+ */
+struct PackEntry {
+    u64 id = 0;                 ///< ResourceId::fromPath() of the path
+    u64 offset = 0;             ///< Data offset from the start of the file
+    u64 storedSize = 0;         ///< Bytes in the file
+    u64 size = 0;               ///< Bytes after decompression
+    u32 nameOffset = 0;         ///< Path offset in the name table
+    u32 nameLength = 0;
+    ResourceType type = ResourceType::Unknown;
+    PackCompression compression = PackCompression::None;
+    u32 reserved = 0;
+
+    ResourceId getId() const { return ResourceId(id); }
+    bool isCompressed() const { return compression != PackCompression::None; }
+};
+
+static_assert(sizeof(PackHeader) == 72);
+static_assert(sizeof(PackEntry) == 48);
+
+// ============================================================================
+// Resource Pack
+// ============================================================================
+
+/**
+ * @brief Read-only view of a memory-mapped pack file
+ *
+ * Mounting opens and maps the file once and checks the table of contents
+ * in place; nothing is read into memory until an entry is used.
+ *
+ * Usage:
+ * @code
+ *     auto pack = ResourcePack::open("assets/level1.pak");
+ *     if (pack) {
+ *         if (const PackEntry* entry = (*pack)->find("textures/player.png")) {
+ *             std::span<const u8> bytes = (*pack)->view(*entry);  // if uncompressed
+ *         }
+ *     }
+ * @endcode
+ *
+ * @note Thread-safe: all methods are const and the mapping is immutable.
+ */
+class ResourcePack {
+public:
+    /**
+     * @brief Map and validate a pack file
+     */
+    static Result<std::shared_ptr<ResourcePack>> open(const std::string& filePath);
+
+    ResourcePack(const ResourcePack&) = delete;
+    ResourcePack& operator=(const ResourcePack&) = delete;
+
+    /**
+     * @brief Find an entry by path (hash lookup, then path compare)
+     */
+    const PackEntry* find(std::string_view path) const noexcept;
+
+    /**
+     * @brief Find an entry by ID
+     */
+    const PackEntry* find(ResourceId id) const noexcept;
+
+    /**
+     * @brief Stored bytes of an entry, in place in the mapping
+     * @note Compressed entries return their compressed bytes; use read().
+     *       The span is valid while the pack is alive.
+     */
+    std::span<const u8> view(const PackEntry& entry) const noexcept {
+        return {m_data + entry.offset, static_cast<usize>(entry.storedSize)};
+    }
+
+    /**
+     * @brief Copy an entry out, decompressing it if needed
+     */
+    Result<std::vector<u8>> read(const PackEntry& entry) const;
+
+    /**
+     * @brief Path an entry was packed under
+     */
+    std::string_view getPath(const PackEntry& entry) const noexcept {
+        return {m_names + entry.nameOffset, entry.nameLength};
+    }
+
+    /**
+     * @brief All entries, sorted by path
+     */
+    std::span<const PackEntry> getEntries() const noexcept { return m_entries; }
+
+    const PackHeader& getHeader() const noexcept { return *m_header; }
+    const std::string& getFilePath() const noexcept { return m_filePath; }
+    usize getFileSize() const noexcept { return m_size; }
+
+private:
+    ResourcePack(std::string filePath, platform::MappedFile file) noexcept;
+
+    Result<void> validate() const;
+
+    std::string m_filePath;
+    platform::MappedFile m_file;
+    const u8* m_data;
+    usize m_size;
+
+    const PackHeader* m_header;
+    std::span<const PackEntry> m_entries;
+    std::span<const u32> m_index;
+    const char* m_names = nullptr;
+};
+
+// ============================================================================
+// Pack Writer
+// ============================================================================
+
+/**
+ * @brief Builds pack files from in-memory resources
+ *
+ * @code
+ *     ResourcePackWriter writer;
+ *     writer.add("textures/player.png", pngBytes, ResourceType::Texture2D, PackCompression::LZ4);
+ *     writer.write("assets/level1.pak");
+ * @endcode
+ */
+class ResourcePackWriter {
+public:
+    /**
+     * @param dataAlignment Alignment of every entry's data (power of two)
+     */
+    explicit ResourcePackWriter(u32 dataAlignment = PackFormat::DEFAULT_ALIGNMENT);
+
+    /**
+     * @brief Add a resource
+     * @param compression Requested codec; the entry is stored uncompressed
+     *        when compression does not make it smaller
+     * @return false if the path is already in the pack, the codec is
+     *         unavailable or the data exceeds PackFormat::MAX_ENTRY_SIZE
+     */
+    bool add(const ResourcePath& path, std::span<const u8> data,
+             ResourceType type = ResourceType::Unknown,
+             PackCompression compression = PackCompression::None);
+
+    /**
+     * @brief Write the pack file
+     */
+    Result<void> write(const std::string& filePath) const;
+
+    usize getEntryCount() const { return m_entries.size(); }
+
+    void clear() {
+        m_entries.clear();
+        m_paths.clear();
+    }
+
+private:
+    struct PendingEntry {
+        std::string path;
+        ResourceType type;
+        PackCompression compression;
+        u64 size;
+        std::vector<u8> stored;
+    };
+
+    u32 m_dataAlignment;
+    std::vector<PendingEntry> m_entries;
+    std::unordered_set<std::string> m_paths;
+};
+
+/**
+ * @brief Whether a codec can be read and written in this build
+ */
+bool isPackCompressionSupported(PackCompression compression);
+
+} // namespace nova::resource
@@ -0,0 +1,145 @@
+/**
+ * @file resource_registry.hpp
+ * @brief NovaCore Resource System™ - Concurrent Resource Registry
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Resources keyed by ResourceId, split across shards that each have their
+ * own reader-writer lock:
+ * - Lookups take one shard's shared lock, so cache hits on different
+ *   resources never wait on each other and hits on one resource only share
+ *   a read lock
+ * - Registration and unload lock a single shard exclusively
+ * - Shards are cache-line aligned so lookups in neighbouring shards do not
+ *   false-share
+ */
+
+#pragma once
+
+#include "resource_types.hpp"
+
+#include <nova/core/memory/allocator.hpp>
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::resource {
+
+/**
+ * @brief Sharded map of registered resources
+ *
+ * @note Thread-safe. Callbacks passed to forEach() run under a shard's
+ *       shared lock and must not modify the registry.
+ */
+class ResourceRegistry {
+public:
+    static constexpr usize SHARD_BITS = 6;
+    static constexpr usize SHARD_COUNT = usize(1) << SHARD_BITS;
+
+    /**
+     * @brief Look up a resource
+     */
+    std::shared_ptr<Resource> find(ResourceId id) const {
+        const Shard& shard = shardOf(id);
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.resources.find(id);
+        return it != shard.resources.end() ? it->second : nullptr;
+    }
+
+    /**
+     * @brief Whether @p id maps to exactly @p resource
+     */
+    bool contains(ResourceId id, const Resource* resource) const {
+        const Shard& shard = shardOf(id);
+        std::shared_lock lock(shard.mutex);
+        auto it = shard.resources.find(id);
+        return it != shard.resources.end() && it->second.get() == resource;
+    }
+
+    /**
+     * @brief Register a resource
+     * @return The resource it replaced, if any
+     */
+    std::shared_ptr<Resource> insert(ResourceId id, std::shared_ptr<Resource> resource) {
+        Shard& shard = shardOf(id);
+        std::unique_lock lock(shard.mutex);
+        auto [it, inserted] = shard.resources.try_emplace(id);
+        if (inserted) {
+            m_size.fetch_add(1, std::memory_order_relaxed);
+        }
+        std::swap(it->second, resource);
+        return resource;
+    }
+
+    /**
+     * @brief Remove a resource
+     * @param expected Only remove @p id while it maps to this (any if null)
+     * @return The removed resource
+     */
+    std::shared_ptr<Resource> erase(ResourceId id, const Resource* expected = nullptr) {
+        Shard& shard = shardOf(id);
+        std::unique_lock lock(shard.mutex);
+        auto it = shard.resources.find(id);
+        if (it == shard.resources.end() || (expected && it->second.get() != expected)) {
+            return nullptr;
+        }
+        auto resource = std::move(it->second);
+        shard.resources.erase(it);
+        m_size.fetch_sub(1, std::memory_order_relaxed);
+        return resource;
+    }
+
+    /**
+     * @brief Visit every resource, one shard at a time
+     */
+    template<typename Fn>
+    void forEach(Fn&& fn) const {
+        for (const Shard& shard : m_shards) {
+            std::shared_lock lock(shard.mutex);
+            for (const auto& [id, resource] : shard.resources) {
+                fn(resource);
+            }
+        }
+    }
+
+    /**
+     * @brief Remove and return every resource
+     */
+    std::vector<std::shared_ptr<Resource>> takeAll() {
+        std::vector<std::shared_ptr<Resource>> resources;
+        for (Shard& shard : m_shards) {
+            std::unique_lock lock(shard.mutex);
+            for (auto& [id, resource] : shard.resources) {
+                resources.push_back(std::move(resource));
+            }
+            m_size.fetch_sub(shard.resources.size(), std::memory_order_relaxed);
+            shard.resources.clear();
+        }
+        return resources;
+    }
+
+    usize size() const { return m_size.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(memory::CACHE_LINE_SIZE) Shard {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<ResourceId, std::shared_ptr<Resource>> resources;
+    };
+
+    // IDs from sequential generation are spread by the multiplicative hash
+    static usize shardIndex(ResourceId id) {
+        return static_cast<usize>((id.value * 0x9E3779B97F4A7C15ULL) >> (64 - SHARD_BITS));
+    }
+    Shard& shardOf(ResourceId id) { return m_shards[shardIndex(id)]; }
+    const Shard& shardOf(ResourceId id) const { return m_shards[shardIndex(id)]; }
+
+    std::array<Shard, SHARD_COUNT> m_shards;
+    std::atomic<usize> m_size{0};
+};
+
+} // namespace nova::resource
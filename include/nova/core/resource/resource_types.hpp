@@ -16,11 +16,15 @@
 
 #include <nova/core/types/types.hpp>
 
+#include <atomic>
 #include <string>
 #include <vector>
 #include <memory>
 #include <functional>
 #include <chrono>
+#include <concepts>
+#include <span>
+#include <type_traits>
 
 namespace nova::resource {
 
@@ -36,6 +40,9 @@ namespace ResourceConfig {
     constexpr usize MAX_CONCURRENT_LOADS = 8;
     constexpr u32 MAX_RESOURCE_NAME_LENGTH = 256;
     constexpr f32 DEFAULT_UNLOAD_DELAY = 30.0f;  // Seconds
+    constexpr f32 DEFAULT_FINALIZE_BUDGET = 0.002f;  // Seconds per update()
+    constexpr f32 DEFAULT_EVICTION_BUDGET = 0.001f;  // Seconds per update()
+    constexpr u32 IO_BATCH_SIZE = 16;            // Reads issued together
     constexpr u32 RESOURCE_POOL_INITIAL_SIZE = 1024;
 }
 
@@ -153,6 +160,10 @@ inline LoadFlags operator&(LoadFlags a, LoadFlags b) {
     return static_cast<LoadFlags>(static_cast<u32>(a) & static_cast<u32>(b));
 }
 
+inline LoadFlags operator~(LoadFlags a) {
+    return static_cast<LoadFlags>(~static_cast<u32>(a));
+}
+
 inline bool hasFlag(LoadFlags flags, LoadFlags flag) {
     return (static_cast<u32>(flags) & static_cast<u32>(flag)) != 0;
 }
@@ -219,6 +230,18 @@ struct ResourcePath {
  */
 class Resource;
 
+/**
+ * @brief Resource class tagged with the ResourceType it is created for
+ * 
+ * Declaring `static constexpr ResourceType RESOURCE_TYPE` lets handles cast
+ * to the class with a type compare and a static cast instead of RTTI. A
+ * tagged class must be the only class whose resources report that type.
+ */
+template<typename T>
+concept TaggedResource = requires {
+    { T::RESOURCE_TYPE } -> std::convertible_to<ResourceType>;
+};
+
 /**
  * @brief Type-safe resource handle
  * 
@@ -253,7 +276,16 @@ public:
     // Conversion
     template<typename U>
     ResourceHandle<U> cast() const {
-        return ResourceHandle<U>(std::dynamic_pointer_cast<U>(m_resource));
+        if constexpr (std::is_base_of_v<U, T>) {
+            return ResourceHandle<U>(std::static_pointer_cast<U>(m_resource));
+        } else if constexpr (TaggedResource<U>) {
+            if (m_resource && m_resource->getType() == U::RESOURCE_TYPE) {
+                return ResourceHandle<U>(std::static_pointer_cast<U>(m_resource));
+            }
+            return ResourceHandle<U>();
+        } else {
+            return ResourceHandle<U>(std::dynamic_pointer_cast<U>(m_resource));
+        }
     }
     
     // Release
@@ -288,7 +320,7 @@ public:
     
     // Metadata
     usize getMemorySize() const { return m_memorySize; }
-    u64 getLastAccessTime() const { return m_lastAccessTime; }
+    u64 getLastAccessTime() const { return m_lastAccessTime.load(std::memory_order_relaxed); }
     u32 getReferenceCount() const { return m_refCount; }
     
     // Error info
@@ -307,6 +339,22 @@ protected:
     virtual void unload() = 0;
     virtual usize calculateMemorySize() const { return 0; }
     
+    /**
+     * @brief Take over the contents of a freshly decoded copy (hot reload)
+     * 
+     * Hot reload decodes a changed file into a new resource on a worker
+     * thread, then calls this on the main thread so existing handles see
+     * the new data. Return false to have the manager decode in place
+     * instead, from the bytes already read off-thread.
+     */
+    virtual bool adoptReload([[maybe_unused]] Resource& staged) { return false; }
+    
+    /**
+     * @brief Called on the main thread after resources this one depends on
+     *        were hot reloaded, dependencies before their dependents
+     */
+    virtual void onDependenciesReloaded() {}
+    
     void setState(ResourceState state);
     void setError(const std::string& message);
     void updateAccessTime();
@@ -315,17 +363,25 @@ protected:
     ResourcePath m_path;
     ResourceType m_type = ResourceType::Unknown;
     std::string m_name;
-    ResourceState m_state = ResourceState::Unloaded;
+    std::atomic<ResourceState> m_state{ResourceState::Unloaded};  // Set by loader threads
     LoadFlags m_flags = LoadFlags::None;
     LoadPriority m_priority = LoadPriority::Normal;
     
     usize m_memorySize = 0;
-    u64 m_lastAccessTime = 0;
+    std::atomic<u64> m_lastAccessTime{0};   // Updated by cache hits on any thread
     u32 m_refCount = 0;
     
     std::string m_errorMessage;
     std::vector<std::function<void(Resource*)>> m_loadedCallbacks;
     std::vector<std::function<void(Resource*, const std::string&)>> m_failedCallbacks;
+    
+    // Cache bookkeeping, guarded by the ResourceManager resource mutex
+    Resource* m_lruPrev = nullptr;
+    Resource* m_lruNext = nullptr;
+    u64 m_lruStamp = 0;         // Access time when last placed in the LRU list
+    usize m_chargedSize = 0;    // Bytes counted against the cache budgets
+    bool m_charged = false;
+    bool m_inLru = false;       // Linked into its type's LRU list (not Persistent)
 };
 
 // ============================================================================
@@ -479,6 +535,17 @@ public:
      */
     virtual bool load(Resource* resource, const std::vector<u8>& data) = 0;
     
+    /**
+     * @brief Load resource data borrowed for the duration of the call
+     * 
+     * Used for uncompressed entries of mounted resource packs, where @p data
+     * points into the pack mapping. Override to parse or upload without a
+     * copy; the default copies into a vector and calls load().
+     */
+    virtual bool loadFromMemory(Resource* resource, std::span<const u8> data) {
+        return load(resource, std::vector<u8>(data.begin(), data.end()));
+    }
+    
     /**
      * @brief Get loader name
      */
@@ -584,7 +651,7 @@ inline void Resource::setError(const std::string& message) {
 
 inline void Resource::updateAccessTime() {
     auto now = std::chrono::steady_clock::now();
-    m_lastAccessTime = static_cast<u64>(now.time_since_epoch().count());
+    m_lastAccessTime.store(static_cast<u64>(now.time_since_epoch().count()), std::memory_order_relaxed);
 }
 
 } // namespace nova::resource
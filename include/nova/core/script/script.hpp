@@ -9,6 +9,9 @@
 #pragma once
 
 #include "script_types.hpp"
+#include "script_value.hpp"
+#include "script_vm.hpp"
+#include "script_batch.hpp"
 #include "script_engine.hpp"
 
 namespace nova::script {
@@ -0,0 +1,188 @@
+/**
+ * @file script_batch.hpp
+ * @brief NovaCore Script System™ - Batched Script Instance Storage
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Script instances of one class live in a ScriptClassStorage: one
+ * contiguous PackedValue column per property plus instance ID and owner
+ * entity columns. A class's batch update hook receives the whole storage
+ * once per frame, so one native-to-script transition covers every instance.
+ */
+
+#pragma once
+
+#include "script_types.hpp"
+#include "script_value.hpp"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::script {
+
+/**
+ * @brief Identifier of a batched script instance (0 is invalid)
+ */
+using ScriptInstanceId = u64;
+
+constexpr ScriptInstanceId INVALID_SCRIPT_INSTANCE = 0;
+
+/**
+ * @brief ECS component linking an entity to its script instance
+ */
+struct ScriptComponent {
+    ScriptInstanceId instance = INVALID_SCRIPT_INSTANCE;
+};
+
+/**
+ * @brief Structure-of-arrays storage for all instances of one script class
+ *
+ * Rows are dense: destroying an instance moves the last row into its slot,
+ * so row indices are only stable between structural changes. Use instance
+ * IDs to refer to instances across frames.
+ */
+class ScriptClassStorage {
+public:
+    static constexpr u32 INVALID_PROPERTY = ~0u;
+    static constexpr u32 INVALID_ROW = ~0u;
+
+    explicit ScriptClassStorage(const ScriptClass& cls) { setClass(cls); }
+
+    /**
+     * @brief Adopt a (re-registered) class definition
+     *
+     * Properties kept by name retain their values; new ones are filled
+     * with their defaults and removed ones are dropped.
+     */
+    void setClass(const ScriptClass& cls) {
+        std::vector<std::vector<PackedValue>> columns;
+        std::vector<std::string> names;
+        std::vector<PackedValue> defaults;
+
+        for (const auto& prop : cls.properties) {
+            PackedValue def = PackedValue::from(prop.defaultValue);
+            u32 old = propertyIndex(prop.name);
+            if (old != INVALID_PROPERTY) {
+                columns.push_back(std::move(m_columns[old]));
+            } else {
+                columns.emplace_back(m_ids.size(), def);
+            }
+            names.push_back(prop.name);
+            defaults.push_back(def);
+        }
+
+        m_class = &cls;
+        m_columns = std::move(columns);
+        m_names = std::move(names);
+        m_defaults = std::move(defaults);
+
+        m_propertyIndices.clear();
+        for (u32 i = 0; i < m_names.size(); ++i) {
+            m_propertyIndices.emplace(m_names[i], i);
+        }
+    }
+
+    [[nodiscard]] const ScriptClass& scriptClass() const noexcept { return *m_class; }
+
+    /// Column index of a property, resolved once and reused per frame
+    [[nodiscard]] u32 propertyIndex(std::string_view name) const {
+        auto it = m_propertyIndices.find(std::string(name));
+        return it != m_propertyIndices.end() ? it->second : INVALID_PROPERTY;
+    }
+
+    [[nodiscard]] u32 propertyCount() const noexcept { return static_cast<u32>(m_columns.size()); }
+
+    /// Number of live instances
+    [[nodiscard]] u32 size() const noexcept { return static_cast<u32>(m_ids.size()); }
+    [[nodiscard]] bool empty() const noexcept { return m_ids.empty(); }
+
+    /**
+     * @brief Append an instance initialised with property defaults
+     * @return Row of the new instance, or INVALID_ROW if the ID is in use
+     */
+    u32 create(ScriptInstanceId id, ecs::Entity owner = ecs::Entity()) {
+        if (id == INVALID_SCRIPT_INSTANCE || m_rows.contains(id)) {
+            return INVALID_ROW;
+        }
+        u32 row = size();
+        m_ids.push_back(id);
+        m_owners.push_back(owner);
+        for (u32 p = 0; p < m_columns.size(); ++p) {
+            m_columns[p].push_back(m_defaults[p]);
+        }
+        m_rows.emplace(id, row);
+        return row;
+    }
+
+    /// Remove an instance by swapping the last row into its place
+    bool destroy(ScriptInstanceId id) {
+        auto it = m_rows.find(id);
+        if (it == m_rows.end()) {
+            return false;
+        }
+
+        u32 row = it->second;
+        u32 last = size() - 1;
+        m_rows.erase(it);
+
+        if (row != last) {
+            m_ids[row] = m_ids[last];
+            m_owners[row] = m_owners[last];
+            for (auto& column : m_columns) {
+                column[row] = column[last];
+            }
+            m_rows[m_ids[row]] = row;
+        }
+
+        m_ids.pop_back();
+        m_owners.pop_back();
+        for (auto& column : m_columns) {
+            column.pop_back();
+        }
+        return true;
+    }
+
+    [[nodiscard]] bool contains(ScriptInstanceId id) const { return m_rows.contains(id); }
+
+    /// Current row of an instance (INVALID_ROW if absent)
+    [[nodiscard]] u32 rowOf(ScriptInstanceId id) const {
+        auto it = m_rows.find(id);
+        return it != m_rows.end() ? it->second : INVALID_ROW;
+    }
+
+    /// All values of one property, indexed by row
+    [[nodiscard]] std::span<PackedValue> column(u32 property) { return m_columns[property]; }
+    [[nodiscard]] std::span<const PackedValue> column(u32 property) const { return m_columns[property]; }
+
+    [[nodiscard]] std::span<const ScriptInstanceId> ids() const noexcept { return m_ids; }
+    [[nodiscard]] std::span<const ecs::Entity> owners() const noexcept { return m_owners; }
+
+    [[nodiscard]] PackedValue& at(u32 row, u32 property) { return m_columns[property][row]; }
+    [[nodiscard]] const PackedValue& at(u32 row, u32 property) const { return m_columns[property][row]; }
+
+    void clear() {
+        m_ids.clear();
+        m_owners.clear();
+        m_rows.clear();
+        for (auto& column : m_columns) {
+            column.clear();
+        }
+    }
+
+private:
+    const ScriptClass* m_class = nullptr;
+    std::vector<std::vector<PackedValue>> m_columns;
+    std::vector<std::string> m_names;
+    std::vector<PackedValue> m_defaults;
+    std::unordered_map<std::string, u32> m_propertyIndices;
+
+    std::vector<ScriptInstanceId> m_ids;
+    std::vector<ecs::Entity> m_owners;
+    std::unordered_map<ScriptInstanceId, u32> m_rows;
+};
+
+} // namespace nova::script
@@ -16,11 +16,19 @@
 #pragma once
 
 #include "script_types.hpp"
+#include "script_vm.hpp"
+#include "script_batch.hpp"
+
+#include <nova/core/platform/file_watcher.hpp>
 
 #include <memory>
 #include <queue>
 #include <set>
 
+namespace nova::ecs {
+class World;
+}
+
 namespace nova::script {
 
 // ============================================================================
@@ -29,7 +37,6 @@ namespace nova::script {
 
 class ScriptCompiler;
 class ScriptVM;
-class ScriptDebugger;
 
 // ============================================================================
 // Script Engine
@@ -190,6 +197,56 @@ public:
      */
     std::vector<std::shared_ptr<ScriptObject>> getObjectsOfClass(const std::string& className) const;
     
+    // ========================================================================
+    // Batched Instances
+    // ========================================================================
+    
+    /**
+     * @brief Create a batched instance of a class
+     * 
+     * Batched instances keep their properties in the class's contiguous
+     * ScriptClassStorage and are ticked through ScriptClass::batchUpdate
+     * once per frame for the whole class. Instances created from a
+     * batchUpdate hook get their ID immediately but join their storage
+     * when tickInstances() finishes.
+     * 
+     * @param owner Entity the instance belongs to (optional)
+     * @return Instance ID, or INVALID_SCRIPT_INSTANCE on failure
+     */
+    ScriptInstanceId createInstance(const std::string& className, ecs::Entity owner = ecs::Entity());
+    
+    /**
+     * @brief Create a batched instance owned by an entity and add a
+     *        ScriptComponent referencing it
+     */
+    ScriptInstanceId attachInstance(ecs::World& world, ecs::Entity entity, const std::string& className);
+    
+    /**
+     * @brief Destroy a batched instance
+     * 
+     * Called from a batchUpdate hook, the row is removed once
+     * tickInstances() finishes so the storage being ticked keeps its layout.
+     */
+    bool destroyInstance(ScriptInstanceId instance);
+    
+    /**
+     * @brief Storage holding all instances of a class (null if none were created)
+     */
+    ScriptClassStorage* getClassStorage(const std::string& className);
+    
+    /**
+     * @brief Storage holding a specific instance (null if unknown)
+     */
+    ScriptClassStorage* getInstanceStorage(ScriptInstanceId instance);
+    
+    /**
+     * @brief Run batchUpdate for every class with live instances
+     * 
+     * Called by update(); exposed for callers that tick scripts at a
+     * different point in the frame.
+     */
+    void tickInstances(f32 deltaTime);
+    
     // ========================================================================
     // Function Execution
     // ========================================================================
@@ -229,6 +286,28 @@ public:
      */
     bool hasFunction(const std::string& name) const;
     
+    /**
+     * @brief Register a fast-path native function
+     * 
+     * Arguments arrive as a span of PackedValues, so calls through a
+     * FunctionHandle never allocate.
+     */
+    void registerNativeCall(const std::string& name, NativeCall call);
+    
+    /**
+     * @brief Intern a function name for repeated calls
+     * 
+     * The handle may be taken before the function is registered and stays
+     * valid across re-registration.
+     */
+    FunctionHandle getFunctionHandle(const std::string& name);
+    
+    /**
+     * @brief Call a function through its interned handle
+     * @return Return value (void if the handle is not bound)
+     */
+    PackedValue callFunction(FunctionHandle handle, std::span<const PackedValue> args = {});
+    
     // ========================================================================
     // Global Variables
     // ========================================================================
@@ -269,9 +348,27 @@ public:
     
     /**
      * @brief Execute a visual script graph
+     * 
+     * Compiles the graph on every call; graphs that run repeatedly should
+     * be compiled once with compileGraph() and run through the
+     * CompiledGraph overload.
      */
     ScriptValue executeGraph(const ScriptGraph& graph, const std::vector<ScriptValue>& args = {});
     
+    /**
+     * @brief Execute a precompiled visual script graph on the engine's VM
+     */
+    PackedValue executeGraph(const CompiledGraph& graph, std::span<const PackedValue> args = {});
+    
+    /**
+     * @brief Compile a visual script to register bytecode
+     * 
+     * FunctionCall nodes are resolved to function handles, so the result
+     * follows later re-registrations of the same names but must not outlive
+     * the engine.
+     */
+    Result<CompiledGraph> compileGraph(const ScriptGraph& graph) const;
+    
     /**
      * @brief Compile visual script to bytecode
      */
@@ -522,6 +619,15 @@ private:
     void checkFileChanges();
     void processReloadQueue();
     void reportError(const ScriptError& error);
+    void addInstance(ScriptInstanceId id, const ScriptClass& cls, ecs::Entity owner);
+    void applyDeferredInstances();
+    
+    // Built-in function registration
+    void registerBuiltinMathFunctions();
+    void registerBuiltinStringFunctions();
+    void registerBuiltinArrayFunctions();
+    void registerBuiltinConsoleFunctions();
+    void registerBuiltinVectorFunctions();
     
     // State
     bool m_initialized = false;
@@ -537,21 +643,38 @@ private:
     std::unordered_map<u64, std::shared_ptr<ScriptObject>> m_objects;
     u64 m_nextInstanceId = 1;
     
+    // Batched instances
+    std::unordered_map<std::string, std::unique_ptr<ScriptClassStorage>> m_classStorage;
+    std::unordered_map<ScriptInstanceId, ScriptClassStorage*> m_instanceStorage;
+    
+    // Structural changes requested while tickInstances() runs
+    struct DeferredInstance {
+        ScriptInstanceId id = INVALID_SCRIPT_INSTANCE;
+        std::string className;
+        ecs::Entity owner;
+    };
+    bool m_tickingInstances = false;
+    std::vector<DeferredInstance> m_deferredCreates;
+    std::vector<ScriptInstanceId> m_deferredDestroys;
+    
     // Functions
     std::unordered_map<std::string, NativeFunction> m_functions;
     std::unordered_map<std::string, FunctionSignature> m_functionSignatures;
+    NativeRegistry m_natives;
     
     // Globals
     std::unordered_map<std::string, ScriptValue> m_globals;
     
+    // Visual scripting
+    ScriptVM m_graphVM;
+    
     // Hot reload
     bool m_hotReloadEnabled = true;
-    std::vector<std::string> m_watchDirectories;
+    std::unordered_map<std::string, platform::FileWatcher::WatchId> m_watchDirectories;
     ReloadCallback m_reloadCallback;
     
     // Debugging
     bool m_debuggerEnabled = false;
-    std::unique_ptr<ScriptDebugger> m_debugger;
     bool m_isPaused = false;
     
     enum class StepMode { None, Over, Into, Out, Continue };
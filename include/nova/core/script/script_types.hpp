@@ -191,6 +191,13 @@ using NativeFunction = std::function<ScriptValue(const std::vector<ScriptValue>&
  */
 using NativeMethod = std::function<ScriptValue(void*, const std::vector<ScriptValue>&)>;
 
+class ScriptClassStorage;
+
+/**
+ * @brief Per-frame update of every instance of a class in one call
+ */
+using ScriptBatchUpdate = std::function<void(ScriptClassStorage& instances, f32 deltaTime)>;
+
 // ============================================================================
 // Script Class Types
 // ============================================================================
@@ -244,6 +251,7 @@ struct ScriptClass {
     NativeFunction constructor;
     NativeFunction destructor;
     std::unordered_map<std::string, NativeMethod> nativeMethods;
+    ScriptBatchUpdate batchUpdate;  // Ticks all batched instances once per frame
 };
 
 // ============================================================================
@@ -555,7 +563,7 @@ inline Vec3 ScriptValue::asVec3() const {
 }
 
 inline Vec4 ScriptValue::asVec4() const {
-    if (type == ScriptType::Vec4) return std::get<Vec4>(data);
+    if (type == ScriptType::Vec4 || type == ScriptType::Color) return std::get<Vec4>(data);
     return Vec4::zero();
 }
 
@@ -0,0 +1,279 @@
+/**
+ * @file script_value.hpp
+ * @brief NovaCore Script System™ - Packed Values and Interned Native Calls
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Hot-path counterparts of ScriptValue and NativeFunction:
+ * - PackedValue: trivially copyable 24-byte value with an inline payload for
+ *   bool/int/float/vector/quaternion/entity/handle and interned strings
+ * - FunctionHandle: a native function name interned once to a table index
+ * - NativeCall: native callback taking arguments as a span, so calls do not
+ *   build argument vectors
+ */
+
+#pragma once
+
+#include "script_types.hpp"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::script {
+
+// ============================================================================
+// String Interning
+// ============================================================================
+
+/**
+ * @brief Interned string identifier (0 is the empty string)
+ */
+using StringId = u32;
+
+/**
+ * @brief Intern a string; the same text always yields the same ID
+ *
+ * Interned strings live for the rest of the process. Thread-safe.
+ */
+[[nodiscard]] StringId internString(std::string_view text);
+
+/**
+ * @brief Text of an interned string (empty for unknown IDs). Thread-safe.
+ */
+[[nodiscard]] std::string_view internedString(StringId id);
+
+// ============================================================================
+// PackedValue
+// ============================================================================
+
+/**
+ * @brief Compact, trivially copyable script value
+ *
+ * Values are stored inline in a 16-byte payload tagged with their
+ * ScriptType, so copying never allocates. Strings are carried as interned
+ * IDs; Object/Array/Map/Function values carry an opaque 64-bit handle
+ * (e.g. a ScriptObject instance ID) instead of an owning pointer.
+ */
+class PackedValue {
+public:
+    constexpr PackedValue() noexcept = default;
+    constexpr PackedValue(bool v) noexcept : m_type(ScriptType::Bool) { m_payload.b = v; }
+    constexpr PackedValue(i64 v) noexcept : m_type(ScriptType::Int) { m_payload.i = v; }
+    constexpr PackedValue(i32 v) noexcept : m_type(ScriptType::Int) { m_payload.i = v; }
+    constexpr PackedValue(f64 v) noexcept : m_type(ScriptType::Float) { m_payload.f = v; }
+    constexpr PackedValue(f32 v) noexcept : m_type(ScriptType::Float) { m_payload.f = static_cast<f64>(v); }
+    PackedValue(const Vec2& v) noexcept : m_type(ScriptType::Vec2) { setFloats(v.x, v.y, 0.0f, 0.0f); }
+    PackedValue(const Vec3& v) noexcept : m_type(ScriptType::Vec3) { setFloats(v.x, v.y, v.z, 0.0f); }
+    PackedValue(const Vec4& v) noexcept : m_type(ScriptType::Vec4) { setFloats(v.x, v.y, v.z, v.w); }
+    PackedValue(const Quat& q) noexcept : m_type(ScriptType::Quat) { setFloats(q.x, q.y, q.z, q.w); }
+    constexpr PackedValue(ecs::Entity e) noexcept : m_type(ScriptType::Entity) { m_payload.u = e.id(); }
+
+    /// Interned string value
+    [[nodiscard]] static PackedValue string(StringId id) noexcept {
+        PackedValue value;
+        value.m_type = ScriptType::String;
+        value.m_payload.u = id;
+        return value;
+    }
+
+    /// Color value (stored like a Vec4 but keeps its tag)
+    [[nodiscard]] static PackedValue color(const Vec4& c) noexcept {
+        PackedValue value(c);
+        value.m_type = ScriptType::Color;
+        return value;
+    }
+
+    /// Opaque handle of a reference type (Object, Array, Map, Function)
+    [[nodiscard]] static PackedValue handle(ScriptType type, u64 handleValue) noexcept {
+        PackedValue value;
+        value.m_type = type;
+        value.m_payload.u = handleValue;
+        return value;
+    }
+
+    /// Convert from a ScriptValue (strings are interned; owning references become void)
+    [[nodiscard]] static PackedValue from(const ScriptValue& value);
+
+    /// Convert to a ScriptValue (handles convert to void)
+    [[nodiscard]] ScriptValue toScriptValue() const;
+
+    // Type checking
+    [[nodiscard]] constexpr ScriptType type() const noexcept { return m_type; }
+    [[nodiscard]] constexpr bool isVoid() const noexcept { return m_type == ScriptType::Void; }
+    [[nodiscard]] constexpr bool isBool() const noexcept { return m_type == ScriptType::Bool; }
+    [[nodiscard]] constexpr bool isInt() const noexcept { return m_type == ScriptType::Int; }
+    [[nodiscard]] constexpr bool isFloat() const noexcept { return m_type == ScriptType::Float; }
+    [[nodiscard]] constexpr bool isNumber() const noexcept { return isInt() || isFloat(); }
+    [[nodiscard]] constexpr bool isString() const noexcept { return m_type == ScriptType::String; }
+
+    // Value getters (same coercions as ScriptValue)
+    [[nodiscard]] constexpr bool asBool() const noexcept {
+        switch (m_type) {
+            case ScriptType::Bool:  return m_payload.b;
+            case ScriptType::Int:   return m_payload.i != 0;
+            case ScriptType::Float: return m_payload.f != 0.0;
+            default:                return false;
+        }
+    }
+
+    [[nodiscard]] constexpr i64 asInt() const noexcept {
+        switch (m_type) {
+            case ScriptType::Int:   return m_payload.i;
+            case ScriptType::Float: return static_cast<i64>(m_payload.f);
+            case ScriptType::Bool:  return m_payload.b ? 1 : 0;
+            default:                return 0;
+        }
+    }
+
+    [[nodiscard]] constexpr f64 asFloat() const noexcept {
+        switch (m_type) {
+            case ScriptType::Float: return m_payload.f;
+            case ScriptType::Int:   return static_cast<f64>(m_payload.i);
+            case ScriptType::Bool:  return m_payload.b ? 1.0 : 0.0;
+            default:                return 0.0;
+        }
+    }
+
+    [[nodiscard]] Vec2 asVec2() const noexcept {
+        return m_type == ScriptType::Vec2 ? Vec2(m_payload.v[0], m_payload.v[1]) : Vec2::zero();
+    }
+
+    [[nodiscard]] Vec3 asVec3() const noexcept {
+        return m_type == ScriptType::Vec3 ? Vec3(m_payload.v[0], m_payload.v[1], m_payload.v[2]) : Vec3::zero();
+    }
+
+    [[nodiscard]] Vec4 asVec4() const noexcept {
+        return m_type == ScriptType::Vec4 || m_type == ScriptType::Color
+            ? Vec4(m_payload.v[0], m_payload.v[1], m_payload.v[2], m_payload.v[3]) : Vec4::zero();
+    }
+
+    [[nodiscard]] Quat asQuat() const noexcept {
+        return m_type == ScriptType::Quat
+            ? Quat(m_payload.v[0], m_payload.v[1], m_payload.v[2], m_payload.v[3]) : Quat::identity();
+    }
+
+    [[nodiscard]] constexpr ecs::Entity asEntity() const noexcept {
+        return m_type == ScriptType::Entity ? ecs::Entity(m_payload.u) : ecs::Entity();
+    }
+
+    [[nodiscard]] constexpr StringId asStringId() const noexcept {
+        return m_type == ScriptType::String ? static_cast<StringId>(m_payload.u) : 0;
+    }
+
+    [[nodiscard]] std::string_view asString() const { return internedString(asStringId()); }
+
+    /// Raw handle of a reference type (0 for other types)
+    [[nodiscard]] constexpr u64 asHandle() const noexcept {
+        switch (m_type) {
+            case ScriptType::Object:
+            case ScriptType::Array:
+            case ScriptType::Map:
+            case ScriptType::Function:
+                return m_payload.u;
+            default:
+                return 0;
+        }
+    }
+
+    /// Same type and bitwise-equal payload
+    [[nodiscard]] bool operator==(const PackedValue& other) const noexcept;
+    [[nodiscard]] bool operator!=(const PackedValue& other) const noexcept { return !(*this == other); }
+
+private:
+    union Payload {
+        f64 f;
+        i64 i;
+        u64 u;
+        bool b;
+        f32 v[4];
+    };
+
+    Payload m_payload{.v = {0.0f, 0.0f, 0.0f, 0.0f}};
+    ScriptType m_type = ScriptType::Void;
+
+    void setFloats(f32 x, f32 y, f32 z, f32 w) noexcept {
+        m_payload.v[0] = x;
+        m_payload.v[1] = y;
+        m_payload.v[2] = z;
+        m_payload.v[3] = w;
+    }
+};
+
+static_assert(std::is_trivially_copyable_v<PackedValue>, "PackedValue must stay trivially copyable");
+static_assert(sizeof(PackedValue) == 24, "PackedValue should stay 24 bytes");
+
+// ============================================================================
+// Interned Native Calls
+// ============================================================================
+
+/**
+ * @brief Native callback on the fast path; arguments are borrowed
+ */
+using NativeCall = std::function<PackedValue(std::span<const PackedValue> args)>;
+
+/**
+ * @brief Interned function name; stays valid while its registry lives
+ */
+struct FunctionHandle {
+    static constexpr u32 INVALID = ~0u;
+
+    u32 index = INVALID;
+
+    [[nodiscard]] constexpr bool isValid() const noexcept { return index != INVALID; }
+    constexpr bool operator==(const FunctionHandle&) const noexcept = default;
+};
+
+/**
+ * @brief Table of native functions addressed by interned handle
+ *
+ * Names are interned on first use, so a handle can be taken before the
+ * function is bound and keeps working across re-registration. Calling an
+ * unbound handle returns void.
+ */
+class NativeRegistry {
+public:
+    /// Get or create the handle for a name
+    FunctionHandle intern(const std::string& name);
+
+    /// Look up an existing handle (invalid if the name was never interned)
+    [[nodiscard]] FunctionHandle find(const std::string& name) const;
+
+    /// Bind (or rebind) a callback to a name
+    FunctionHandle bind(const std::string& name, NativeCall call);
+
+    /// Remove the callback for a name; its handle stays reserved
+    void unbind(const std::string& name);
+
+    /// Check if a handle has a callback
+    [[nodiscard]] bool isBound(FunctionHandle handle) const noexcept {
+        return handle.index < m_calls.size() && static_cast<bool>(m_calls[handle.index]);
+    }
+
+    /// Name a handle was interned from
+    [[nodiscard]] const std::string& name(FunctionHandle handle) const;
+
+    /// Invoke a handle
+    PackedValue call(FunctionHandle handle, std::span<const PackedValue> args) const {
+        if (!isBound(handle)) {
+            return PackedValue();
+        }
+        return m_calls[handle.index](args);
+    }
+
+    [[nodiscard]] usize size() const noexcept { return m_calls.size(); }
+
+    /// Drop all names and callbacks; outstanding handles become invalid
+    void clear();
+
+private:
+    std::vector<NativeCall> m_calls;
+    std::vector<std::string> m_names;
+    std::unordered_map<std::string, u32> m_indices;
+};
+
+} // namespace nova::script
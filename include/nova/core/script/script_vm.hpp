@@ -0,0 +1,172 @@
+/**
+ * @file script_vm.hpp
+ * @brief NovaCore Script System™ - Graph Bytecode Compiler and Register VM
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Visual script graphs are compiled once into a flat, register-based
+ * bytecode:
+ * - Every pin value lives in a numbered register resolved at compile time
+ * - Math/compare ops are emitted as typed opcodes (no name lookups at runtime)
+ * - Native calls are resolved to interned function handles and receive
+ *   their arguments as a span over the register file
+ * - Registers are trivially copyable PackedValues
+ * - Exec flow becomes jumps, so the VM is a single dispatch loop
+ */
+
+#pragma once
+
+#include "script_types.hpp"
+#include "script_value.hpp"
+#include <nova/core/types/result.hpp>
+
+#include <span>
+#include <string>
+#include <vector>
+
+namespace nova::script {
+
+// ============================================================================
+// Bytecode
+// ============================================================================
+
+/**
+ * @brief VM opcodes
+ *
+ * Operand layout is noted per opcode; R[x] is register x.
+ */
+enum class OpCode : u8 {
+    // Data movement
+    Move,           ///< R[a] = R[b]
+
+    // Typed arithmetic: R[a] = R[b] op R[c]
+    AddI, SubI, MulI, DivI,
+    AddF, SubF, MulF, DivF,
+
+    // Typed comparisons: R[a] = R[b] op R[c] (bool)
+    LtI, LeI, GtI, GeI, EqI, NeI,
+    LtF, LeF, GtF, GeF, EqF, NeF,
+    Eq, Ne,         ///< Generic value equality
+
+    // Logic
+    And,            ///< R[a] = R[b] && R[c]
+    Or,             ///< R[a] = R[b] || R[c]
+    Not,            ///< R[a] = !R[b]
+
+    // Control flow
+    Jump,           ///< pc = a
+    JumpIfFalse,    ///< if (!R[b]) pc = a
+
+    // Calls
+    CallNative,     ///< R[a] = calls[b](R[c] .. R[c + argc - 1])
+
+    // Exit
+    Return,         ///< return R[a]
+    ReturnVoid      ///< return void
+};
+
+/**
+ * @brief One VM instruction (8 bytes)
+ */
+struct Instruction {
+    OpCode op = OpCode::ReturnVoid;
+    u8 argc = 0;        ///< Argument count (CallNative)
+    u16 a = 0;
+    u16 b = 0;
+    u16 c = 0;
+};
+
+static_assert(sizeof(Instruction) == 8, "Instruction must stay 8 bytes");
+
+/**
+ * @brief Executable form of a ScriptGraph
+ *
+ * On entry the register file is seeded from initialRegisters (constants,
+ * variable defaults, void temporaries), then arguments are copied to
+ * [argumentBase, argumentBase + argumentCount).
+ */
+struct CompiledGraph {
+    std::string name;
+    std::vector<Instruction> code;
+    std::vector<PackedValue> initialRegisters;  ///< Constants and variable defaults
+    std::vector<FunctionHandle> calls;          ///< Call targets, by CallNative operand
+    const NativeRegistry* natives = nullptr;    ///< Must outlive the compiled graph
+    u16 registerCount = 0;
+    u16 argumentBase = 0;                       ///< First argument register
+    u16 argumentCount = 0;
+
+    [[nodiscard]] bool empty() const noexcept { return code.empty(); }
+};
+
+// ============================================================================
+// Graph Compiler
+// ============================================================================
+
+/**
+ * @brief Compiles ScriptGraphs to register bytecode
+ *
+ * Supported nodes:
+ * - Entry: exec output 0; further data outputs are the graph arguments
+ * - Return: exec input 0, value input 1
+ * - Branch: exec input 0, Condition input 1; True/False exec outputs
+ * - Sequence: exec input 0; exec outputs run in order
+ * - ForLoop: exec 0, First 1, Last 2 (inclusive); outputs Body 0, Index 1, Completed 2
+ * - Constant: value is output pin 0's default
+ * - Variable: reads the graph variable named by the node; with an exec
+ *   input it becomes a setter (exec 0, Value 1 -> exec 0, Value 1)
+ * - MathOp: Add/Subtract/Multiply/Divide by node name
+ * - Compare: Less/LessEqual/Greater/GreaterEqual/Equal/NotEqual
+ * - Logic: And/Or/Not
+ * - FunctionCall: calls the native named by the node; exec 0 then data
+ *   inputs as arguments; outputs exec 0, Return 1
+ *
+ * Unconnected data inputs use the pin's default value. Pure data nodes are
+ * re-evaluated at each point of use, so values read inside loops stay live.
+ */
+class GraphCompiler {
+public:
+    /**
+     * @brief Compile a graph
+     * @param natives Functions FunctionCall nodes resolve against; calls go
+     *        through its handles, so later rebinds are picked up
+     */
+    [[nodiscard]] static Result<CompiledGraph> compile(const ScriptGraph& graph,
+                                                       const NativeRegistry& natives);
+};
+
+// ============================================================================
+// Register VM
+// ============================================================================
+
+/**
+ * @brief Executes CompiledGraphs
+ *
+ * A VM owns its register file, so repeated executions do not allocate
+ * once warmed up; native calls borrow their arguments from it.
+ * Not thread-safe; use one VM per thread.
+ */
+class ScriptVM {
+public:
+    /**
+     * @brief Run a compiled graph
+     * @param args Values for the Entry node's argument pins (missing ones are void)
+     * @return The value passed to Return, or an error
+     */
+    [[nodiscard]] Result<PackedValue> execute(const CompiledGraph& graph,
+                                              std::span<const PackedValue> args = {});
+
+    /// Abort executions that exceed this many instructions (0 = unlimited)
+    void setInstructionLimit(u64 limit) { m_instructionLimit = limit; }
+    [[nodiscard]] u64 getInstructionLimit() const noexcept { return m_instructionLimit; }
+
+    /// Instructions executed since construction
+    [[nodiscard]] u64 getInstructionsExecuted() const noexcept { return m_instructionsExecuted; }
+
+private:
+    std::vector<PackedValue> m_registers;
+    u64 m_instructionLimit = 100'000'000;
+    u64 m_instructionsExecuted = 0;
+};
+
+} // namespace nova::script
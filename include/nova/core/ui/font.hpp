@@ -0,0 +1,203 @@
+/**
+ * @file font.hpp
+ * @brief Nova UI™ - Font faces, glyph atlas and font registry
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * - FontFace: metrics, advances and CPU rasterization of one typeface
+ * - BuiltinFont: embedded 5x7 bitmap face, always available (headless
+ *   builds and tests need no font files)
+ * - GlyphAtlas: single R8 page packed with rasterized glyphs on demand;
+ *   it also reserves a white block so UI fills share the glyph texture
+ * - FontLibrary: family name -> FontId registry owning the atlas
+ *
+ * UI text is built on the main thread; none of these types lock.
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#pragma once
+
+#include "ui_types.hpp"
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::ui {
+
+/// Registered font handle
+using FontId = u32;
+
+/// The builtin face, registered as "default"
+inline constexpr FontId DEFAULT_FONT = 0;
+
+// ============================================================================
+// Font Faces
+// ============================================================================
+
+/**
+ * @brief Vertical metrics in em units (multiply by font size)
+ */
+struct FontMetrics {
+    f32 ascent = 0.8f;      ///< Baseline to top of the tallest glyph
+    f32 descent = 0.2f;     ///< Baseline to bottom (positive)
+    f32 lineGap = 0.0f;
+};
+
+/**
+ * @brief Coverage bitmap of one glyph
+ */
+struct GlyphBitmap {
+    u32 width = 0;
+    u32 height = 0;
+    f32 bearingX = 0.0f;    ///< Pen position to left edge (pixels)
+    f32 bearingY = 0.0f;    ///< Baseline to top edge (pixels, up is positive)
+    std::vector<u8> pixels; ///< width * height coverage values, row-major
+};
+
+/**
+ * @brief A typeface that can be measured and rasterized on the CPU
+ */
+class FontFace {
+public:
+    virtual ~FontFace() = default;
+
+    /// Vertical metrics (em units)
+    [[nodiscard]] virtual FontMetrics getMetrics() const = 0;
+
+    /// Horizontal advance of a codepoint (em units)
+    [[nodiscard]] virtual f32 getAdvance(u32 codepoint) const = 0;
+
+    /// Kerning adjustment between two codepoints (em units)
+    [[nodiscard]] virtual f32 getKerning(u32 /*left*/, u32 /*right*/) const { return 0.0f; }
+
+    /**
+     * @brief Rasterize a glyph at a pixel size
+     * @return False if the glyph has no visible pixels (e.g. space)
+     */
+    virtual bool rasterize(u32 codepoint, u32 pixelSize, GlyphBitmap& out) const = 0;
+};
+
+/**
+ * @brief Embedded monospace 5x7 bitmap face covering printable ASCII
+ *
+ * Advances are 0.6em, matching the placeholder metrics the UI used before
+ * real fonts. Other codepoints render as '?'.
+ */
+class BuiltinFont final : public FontFace {
+public:
+    [[nodiscard]] FontMetrics getMetrics() const override { return {}; }
+    [[nodiscard]] f32 getAdvance(u32 codepoint) const override;
+    bool rasterize(u32 codepoint, u32 pixelSize, GlyphBitmap& out) const override;
+};
+
+// ============================================================================
+// Glyph Atlas
+// ============================================================================
+
+/**
+ * @brief Placement of a glyph in the atlas
+ */
+struct AtlasGlyph {
+    Rect uv;                ///< Normalized texture rect
+    Vec2 offset;            ///< Pen position on the baseline to the quad's top-left (pixels)
+    Vec2 size;              ///< Quad size (pixels); zero for blank glyphs
+};
+
+/**
+ * @brief Single-page R8 glyph atlas with shelf packing
+ *
+ * Glyphs are rasterized and packed on first use. When the page fills it
+ * doubles (up to MAX_SIZE) and is repacked from scratch; at MAX_SIZE it is
+ * simply cleared. Either way getGeneration() changes, and anything holding
+ * UVs from an older generation must rebuild.
+ */
+class GlyphAtlas {
+public:
+    static constexpr u32 INITIAL_SIZE = 512;
+    static constexpr u32 MAX_SIZE = 4096;
+
+    GlyphAtlas();
+
+    /// Look up or rasterize a glyph
+    [[nodiscard]] AtlasGlyph getGlyph(FontId font, const FontFace& face, u32 codepoint, u32 pixelSize);
+
+    /// UV rect inside the reserved white block
+    [[nodiscard]] Rect getWhiteUV() const noexcept;
+
+    /// Changes whenever existing UVs are invalidated
+    [[nodiscard]] u32 getGeneration() const noexcept { return m_generation; }
+
+    /// Page width and height in pixels
+    [[nodiscard]] u32 getSize() const noexcept { return m_size; }
+
+    /// Coverage pixels (getSize() squared)
+    [[nodiscard]] const std::vector<u8>& getPixels() const noexcept { return m_pixels; }
+
+    /// Number of glyphs resident
+    [[nodiscard]] usize getGlyphCount() const noexcept { return m_glyphs.size(); }
+
+    /// Pixels changed since the last markUploaded()
+    [[nodiscard]] bool isDirty() const noexcept { return m_dirty; }
+    void markUploaded() noexcept { m_dirty = false; }
+
+    /// Drop all glyphs (bumps the generation)
+    void clear();
+
+private:
+    struct Shelf {
+        u32 y = 0;
+        u32 height = 0;
+        u32 x = 0;
+    };
+
+    /// Find room for a w x h block; false if the page is full
+    bool allocate(u32 width, u32 height, u32& x, u32& y);
+    void reset(u32 size);
+
+    u32 m_size = 0;
+    u32 m_generation = 0;
+    bool m_dirty = true;
+    std::vector<u8> m_pixels;
+    std::vector<Shelf> m_shelves;
+    u32 m_nextShelfY = 0;
+    std::unordered_map<u64, AtlasGlyph> m_glyphs;
+};
+
+// ============================================================================
+// Font Library
+// ============================================================================
+
+/**
+ * @brief Process-wide font registry and glyph atlas
+ */
+class FontLibrary {
+public:
+    [[nodiscard]] static FontLibrary& get();
+
+    /// Register a face under a family name (replaces an existing family)
+    FontId registerFont(const std::string& family, std::unique_ptr<FontFace> face);
+
+    /// Font for a family name; DEFAULT_FONT if unknown
+    [[nodiscard]] FontId findFont(std::string_view family) const;
+
+    /// Face of a registered font (the builtin face for invalid ids)
+    [[nodiscard]] const FontFace& getFace(FontId font) const;
+
+    [[nodiscard]] GlyphAtlas& getAtlas() noexcept { return m_atlas; }
+
+    FontLibrary(const FontLibrary&) = delete;
+    FontLibrary& operator=(const FontLibrary&) = delete;
+
+private:
+    FontLibrary();
+
+    std::vector<std::unique_ptr<FontFace>> m_faces;
+    std::unordered_map<std::string, FontId> m_families;
+    GlyphAtlas m_atlas;
+};
+
+} // namespace nova::ui
@@ -0,0 +1,156 @@
+/**
+ * @file text_layout.hpp
+ * @brief Nova UI™ - Text shaping cache and line breaking
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * Text is shaped once per (string, font, size) into a run of positioned
+ * glyphs and kept in an LRU cache, so layout and drawing of unchanged text
+ * never re-walk the string. Line breaking works on the run's cumulative
+ * glyph positions: each line is found with a binary search, so re-wrapping
+ * at a new width costs O(lines * log n) instead of a full scan.
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#pragma once
+
+#include "font.hpp"
+
+#include <list>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::ui {
+
+// ============================================================================
+// Shaped Text
+// ============================================================================
+
+/**
+ * @brief One positioned glyph of a shaped run
+ */
+struct ShapedGlyph {
+    u32 codepoint = 0;
+    u32 cluster = 0;        ///< Byte offset of the codepoint in the source text
+    f32 x = 0.0f;           ///< Pen position from the start of the run (pixels)
+    f32 advance = 0.0f;
+};
+
+/**
+ * @brief Immutable result of shaping a string with one font and size
+ */
+struct ShapedText {
+    std::string text;
+    FontId font = DEFAULT_FONT;
+    f32 fontSize = 0.0f;
+    std::vector<ShapedGlyph> glyphs;
+    std::vector<u32> newlines;      ///< Glyph indices of '\n'
+    std::vector<u32> spaces;        ///< Glyph indices of break opportunities
+    f32 advance = 0.0f;             ///< Total pen advance of the run
+
+    /// Width of glyphs [begin, end)
+    [[nodiscard]] f32 width(u32 begin, u32 end) const noexcept {
+        f32 endX = end < glyphs.size() ? glyphs[end].x : advance;
+        return begin < glyphs.size() ? endX - glyphs[begin].x : 0.0f;
+    }
+};
+
+/**
+ * @brief A line of a TextLayout (glyph range into the shaped run)
+ */
+struct TextLine {
+    u32 begin = 0;
+    u32 end = 0;
+    f32 width = 0.0f;
+};
+
+/**
+ * @brief Shaped text broken into lines for a width
+ */
+struct TextLayout {
+    std::shared_ptr<const ShapedText> shaped;
+    std::vector<TextLine> lines;    ///< At least one line, even for empty text
+    f32 lineHeight = 0.0f;
+    f32 ascent = 0.0f;              ///< Baseline offset inside a line (pixels)
+    Vec2 size;                      ///< Widest line x (lines * lineHeight)
+};
+
+/**
+ * @brief Break a shaped run into lines
+ *
+ * Breaks at '\n', then at the last space that keeps a line within
+ * @p maxWidth, falling back to a break between glyphs for long words.
+ *
+ * @param maxWidth Line width limit (<= 0 = unlimited)
+ * @param maxLines Line limit (0 = unlimited)
+ */
+void breakLines(const ShapedText& shaped, f32 maxWidth, u32 maxLines, std::vector<TextLine>& lines);
+
+// ============================================================================
+// Text Shaper
+// ============================================================================
+
+/**
+ * @brief Shaping cache statistics
+ */
+struct TextShaperStats {
+    u64 hits = 0;
+    u64 misses = 0;
+    usize entries = 0;
+};
+
+/**
+ * @brief Process-wide LRU cache of shaped runs
+ */
+class TextShaper {
+public:
+    static constexpr usize DEFAULT_CAPACITY = 4096;
+
+    [[nodiscard]] static TextShaper& get();
+
+    /// Shape text (cached)
+    [[nodiscard]] std::shared_ptr<const ShapedText> shape(std::string_view text, FontId font, f32 fontSize);
+
+    /**
+     * @brief Shape and break text for a style
+     * @param maxWidth Line width limit (<= 0 = unlimited)
+     * @param maxLines Line limit (0 = unlimited)
+     */
+    [[nodiscard]] TextLayout layout(std::string_view text, const TextStyle& style, f32 maxWidth, u32 maxLines = 0);
+
+    /// Maximum cached runs (least recently used are evicted)
+    void setCapacity(usize capacity);
+    [[nodiscard]] usize getCapacity() const noexcept { return m_capacity; }
+
+    [[nodiscard]] TextShaperStats getStats() const noexcept;
+
+    /// Drop all cached runs and reset statistics
+    void clear();
+
+    TextShaper(const TextShaper&) = delete;
+    TextShaper& operator=(const TextShaper&) = delete;
+
+private:
+    TextShaper() = default;
+
+    struct Entry {
+        u64 hash = 0;
+        std::shared_ptr<const ShapedText> shaped;
+    };
+
+    [[nodiscard]] static std::shared_ptr<const ShapedText> shapeUncached(std::string_view text, FontId font,
+                                                                         f32 fontSize);
+    void evict();
+
+    std::list<Entry> m_lru;         ///< Most recently used first
+    std::unordered_map<u64, std::list<Entry>::iterator> m_index;
+    usize m_capacity = DEFAULT_CAPACITY;
+    u64 m_hits = 0;
+    u64 m_misses = 0;
+};
+
+} // namespace nova::ui
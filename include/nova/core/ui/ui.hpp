@@ -11,6 +11,9 @@
 
 #include "ui_types.hpp"
 #include "widget.hpp"
+#include "font.hpp"
+#include "text_layout.hpp"
+#include "ui_draw_list.hpp"
 #include "ui_system.hpp"
 
 namespace nova::ui {
@@ -0,0 +1,206 @@
+/**
+ * @file ui_draw_list.hpp
+ * @brief Nova UI™ - Retained draw list builder
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * Turns the widget tree into renderer-ready geometry:
+ * - Widgets emit quads through UIPainter (Widget::paint)
+ * - Each widget's geometry is cached and rebuilt only when its paint
+ *   version, bounds or inherited opacity change
+ * - Vertices and indices live in persistent arrays that are reused frame
+ *   to frame and left untouched when nothing changed
+ * - Adjacent quads sharing a texture page and clip rect merge into one batch
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#pragma once
+
+#include "ui_types.hpp"
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace nova::ui {
+
+class Widget;
+class UIDrawList;
+struct TextLayout;
+
+// ============================================================================
+// Geometry Types
+// ============================================================================
+
+/// Texture page referenced by UI batches
+using UITextureId = u32;
+
+/**
+ * @brief Shared UI atlas page (FontLibrary::getAtlas())
+ *
+ * Holds the rasterized glyphs plus a white block that backs all fills, so
+ * backgrounds, borders and text land in the same batch. Image sources get
+ * their own pages starting at 1.
+ */
+inline constexpr UITextureId UI_TEXTURE_ATLAS = 0;
+
+/**
+ * @brief UI vertex (screen-space position, texture coordinate, RGBA8 color)
+ */
+struct UIVertex {
+    Vec2 position;
+    Vec2 uv;
+    u32 color = 0xFFFFFFFF;     ///< R in the low byte, opacity already applied
+};
+
+/**
+ * @brief Range of indices drawn with one texture and scissor rect
+ */
+struct UIDrawBatch {
+    UITextureId texture = UI_TEXTURE_ATLAS;
+    u32 indexOffset = 0;
+    u32 indexCount = 0;
+    Rect clip;
+};
+
+/**
+ * @brief Counters from the last UIDrawList::build()
+ */
+struct UIDrawStats {
+    u32 widgets = 0;            ///< Visible widgets visited
+    u32 widgetsRebuilt = 0;     ///< Widgets whose geometry was regenerated
+    u32 vertices = 0;
+    u32 indices = 0;
+    u32 batches = 0;
+    bool changed = false;       ///< Output arrays were rewritten
+};
+
+/**
+ * @brief Cached geometry of one widget
+ */
+struct UIWidgetGeometry {
+    /// Run of indices sharing a texture
+    struct Segment {
+        UITextureId texture = UI_TEXTURE_ATLAS;
+        u32 indexOffset = 0;
+        u32 indexCount = 0;
+    };
+
+    std::vector<UIVertex> vertices;
+    std::vector<u32> indices;           ///< Relative to vertices
+    std::vector<Segment> segments;
+
+    u32 paintVersion = 0;
+    Rect bounds;
+    f32 opacity = 1.0f;
+    u64 lastBuild = 0;
+    bool valid = false;
+};
+
+// ============================================================================
+// UIPainter
+// ============================================================================
+
+/**
+ * @brief Receives the quads a widget draws
+ *
+ * Handed to Widget::paint() while the widget's geometry is rebuilt.
+ * Colors are multiplied by the widget's inherited opacity.
+ */
+class UIPainter {
+public:
+    /// Solid rectangle
+    void fillRect(const Rect& rect, const Color& color);
+
+    /// Rectangle outline drawn inside @p rect
+    void strokeRect(const Rect& rect, f32 width, const Color& color);
+
+    /// Textured rectangle; @p source is registered with the draw list
+    void drawImage(const Rect& rect, const std::string& source, const Color& tint = Color::white());
+
+    /**
+     * @brief Text wrapped to @p rect's width (shaped runs come from TextShaper's cache)
+     * @param maxLines Line limit (0 = unlimited)
+     */
+    void drawText(const Rect& rect, std::string_view text, const TextStyle& style, u32 maxLines = 0);
+
+    /// Already laid out text; only color and alignment are taken from @p style
+    void drawText(const Rect& rect, const TextLayout& layout, const TextStyle& style);
+
+    /// Raw textured quad
+    void quad(const Rect& rect, const Rect& uv, UITextureId texture, const Color& color);
+
+private:
+    friend class UIDrawList;
+
+    UIPainter(UIDrawList& list, UIWidgetGeometry& geometry, f32 opacity) noexcept
+        : m_list(list), m_geometry(geometry), m_opacity(opacity) {}
+
+    UIDrawList& m_list;
+    UIWidgetGeometry& m_geometry;
+    f32 m_opacity;
+};
+
+// ============================================================================
+// UIDrawList
+// ============================================================================
+
+/**
+ * @brief Retained vertex/index/batch arrays for a widget tree
+ */
+class UIDrawList {
+public:
+    /**
+     * @brief Update geometry for @p root and its visible descendants
+     *
+     * Widgets are drawn in tree order (parents below children). Clipping
+     * follows Overflow: non-visible overflow clips descendants to the
+     * widget's bounds.
+     *
+     * @return True if vertices(), indices() or batches() changed
+     */
+    bool build(Widget* root);
+
+    /// Drop all cached geometry and output
+    void clear();
+
+    [[nodiscard]] const std::vector<UIVertex>& vertices() const noexcept { return m_vertices; }
+    [[nodiscard]] const std::vector<u32>& indices() const noexcept { return m_indices; }
+    [[nodiscard]] const std::vector<UIDrawBatch>& batches() const noexcept { return m_batches; }
+    [[nodiscard]] const UIDrawStats& stats() const noexcept { return m_stats; }
+
+    /// Texture page for an image source (registered on first use)
+    [[nodiscard]] UITextureId textureId(const std::string& source);
+
+    /// Image source of a texture page (empty for the atlas page)
+    [[nodiscard]] const std::string& textureSource(UITextureId id) const;
+
+private:
+    struct DrawItem {
+        const UIWidgetGeometry* geometry = nullptr;
+        Rect clip;
+
+        bool operator==(const DrawItem&) const noexcept = default;
+    };
+
+    void visit(Widget* widget, f32 opacity, const Rect& clip);
+    void assemble();
+
+    std::unordered_map<u64, UIWidgetGeometry> m_geometry;
+    std::vector<DrawItem> m_items;
+    std::vector<DrawItem> m_previousItems;
+    u64 m_buildIndex = 0;
+    u32 m_atlasGeneration = 0;
+
+    std::vector<UIVertex> m_vertices;
+    std::vector<u32> m_indices;
+    std::vector<UIDrawBatch> m_batches;
+    UIDrawStats m_stats;
+
+    std::unordered_map<std::string, UITextureId> m_textureIds;
+    std::vector<std::string> m_textureSources;
+};
+
+} // namespace nova::ui
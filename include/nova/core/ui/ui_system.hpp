@@ -11,6 +11,7 @@
 
 #include "widget.hpp"
 #include "ui_types.hpp"
+#include "ui_draw_list.hpp"
 
 #include <memory>
 #include <unordered_map>
@@ -156,6 +157,14 @@ public:
     // Rendering (called by renderer)
     // =========================================================================
     
+    /**
+     * @brief Update and return the retained draw list (call after update())
+     * 
+     * Only widgets whose appearance or bounds changed are re-tessellated;
+     * the arrays are unchanged when nothing in the tree changed.
+     */
+    const UIDrawList& buildDrawList();
+    
     /// Get widgets to render (in render order)
     [[nodiscard]] std::vector<Widget*> getWidgetsToRender() const;
     
@@ -194,6 +203,8 @@ private:
     // Widget registry for fast lookup
     std::unordered_map<u64, Widget*> m_widgetRegistry;
     
+    UIDrawList m_drawList;
+    
     // Statistics
     u32 m_widgetCount = 0;
     u32 m_visibleWidgetCount = 0;
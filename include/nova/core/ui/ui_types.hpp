@@ -230,6 +230,8 @@ struct Rect {
     [[nodiscard]] constexpr Rect expand(f32 l, f32 t, f32 r, f32 b) const noexcept {
         return Rect(x - l, y - t, width + l + r, height + t + b);
     }
+    
+    [[nodiscard]] constexpr bool operator==(const Rect& other) const noexcept = default;
 };
 
 /**
@@ -12,12 +12,15 @@
 #include "ui_types.hpp"
 #include "nova/core/types/result.hpp"
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <string>
 
 namespace nova::ui {
 
+class UIPainter;
+
 /**
  * @brief Base class for all UI widgets
  * 
@@ -115,13 +118,48 @@ public:
     /// Get content bounds (bounds minus padding)
     [[nodiscard]] Rect getContentBounds() const noexcept;
     
-    /// Mark layout as dirty (needs recalculation)
+    /**
+     * @brief Mark layout as dirty (needs recalculation)
+     * 
+     * Ancestors are marked dirty up to the nearest relayout boundary; above
+     * it they only record that a descendant needs layout, so a text change
+     * inside a fixed-size panel does not re-layout the rest of the tree.
+     */
     void markLayoutDirty();
     
     /// Check if layout is dirty
     [[nodiscard]] bool isLayoutDirty() const noexcept { return m_layoutDirty; }
     
-    /// Perform layout (called by layout system)
+    /**
+     * @brief Mark draw geometry as stale without affecting layout
+     * 
+     * Needed after editing visuals through getStyle() directly; setters
+     * and markLayoutDirty() do this already.
+     */
+    void markPaintDirty() noexcept { ++m_paintVersion; }
+    
+    /// Incremented whenever the widget's appearance changes
+    [[nodiscard]] u32 getPaintVersion() const noexcept { return m_paintVersion; }
+    
+    /// Check if this widget or any descendant needs layout
+    [[nodiscard]] bool needsLayout() const noexcept { return m_layoutDirty || m_childNeedsLayout; }
+    
+    /**
+     * @brief Check if this widget stops dirty propagation
+     * 
+     * True when both width and height are explicit: the widget's size then
+     * depends only on the space its parent gives it, never on its content.
+     */
+    [[nodiscard]] bool isRelayoutBoundary() const noexcept {
+        return !m_style.width.isAuto() && !m_style.height.isAuto();
+    }
+    
+    /**
+     * @brief Perform layout (called by layout system)
+     * 
+     * A clean widget given the same space as last time keeps its bounds and
+     * only descends into children that need layout.
+     */
     void layout(const Rect& availableSpace);
     
     // =========================================================================
@@ -236,6 +274,14 @@ public:
     /// Measure preferred content size (can be overridden)
     virtual Vec2 measureContent(f32 availableWidth, f32 availableHeight);
     
+    /**
+     * @brief Cached measureContent()
+     * 
+     * Results are kept per constraint until the widget is marked dirty, so
+     * repeated measuring during a pass and across passes is free.
+     */
+    Vec2 measure(f32 availableWidth, f32 availableHeight);
+    
 protected:
     // =========================================================================
     // Virtual Methods for Subclasses
@@ -250,6 +296,12 @@ protected:
     /// Called to layout children (for containers)
     virtual void layoutChildren();
     
+    /// Deepest child hit at point (default: children front to back)
+    virtual Widget* hitTestChildren(Vec2 point);
+    
+    /// Emit draw geometry for this widget (children are drawn separately)
+    virtual void paint(UIPainter& painter) const;
+    
     /// Called when pointer down occurs
     virtual bool onPointerDown(const PointerEvent& event);
     
@@ -297,11 +349,33 @@ protected:
     
 private:
     friend class UISystem;
+    friend class UIDrawList;
     
     WidgetHandle m_handle;
     std::string m_id;
     Widget* m_parent = nullptr;
     
+    // Incremental layout
+    struct MeasureCacheEntry {
+        f32 availableWidth = 0.0f;
+        f32 availableHeight = 0.0f;
+        Vec2 size;
+        bool valid = false;
+    };
+    
+    static constexpr usize MEASURE_CACHE_SIZE = 2;
+    
+    u32 m_paintVersion = 0;
+    bool m_childNeedsLayout = false;
+    bool m_hasLayout = false;
+    Rect m_lastAvailableSpace;
+    std::array<MeasureCacheEntry, MEASURE_CACHE_SIZE> m_measureCache{};
+    u32 m_measureCacheNext = 0;
+    
+    // Widget counts of this subtree (including this widget)
+    u32 m_subtreeWidgets = 1;
+    u32 m_subtreeVisible = 1;
+    
     // Callbacks
     PointerCallback m_onPointerDown;
     PointerCallback m_onPointerUp;
@@ -319,6 +393,11 @@ private:
     u64 m_nextAnimationId = 1;
     
     static u64 s_nextHandleId;
+    
+    void markChildNeedsLayout();
+    void layoutDirtyChildren();
+    void invalidateMeasureCache();
+    void adjustSubtreeCounts(i32 widgets, i32 visible);
 };
 
 // ============================================================================
@@ -362,6 +441,7 @@ public:
     
 protected:
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     std::string m_text;
@@ -393,6 +473,7 @@ protected:
     void onPointerEnter(const PointerEvent& event) override;
     void onPointerLeave(const PointerEvent& event) override;
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     std::string m_text;
@@ -422,11 +503,12 @@ public:
         None        ///< No scaling
     };
     
-    void setAspectRatio(AspectRatio mode) { m_aspectRatio = mode; }
+    void setAspectRatio(AspectRatio mode) { m_aspectRatio = mode; markPaintDirty(); }
     [[nodiscard]] AspectRatio getAspectRatio() const noexcept { return m_aspectRatio; }
     
 protected:
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     std::string m_source;
@@ -453,13 +535,13 @@ public:
     [[nodiscard]] const std::string& getPlaceholder() const noexcept { return m_placeholder; }
     
     /// Set placeholder text
-    void setPlaceholder(const std::string& placeholder) { m_placeholder = placeholder; }
+    void setPlaceholder(const std::string& placeholder) { m_placeholder = placeholder; markPaintDirty(); }
     
     /// Check if password mode
     [[nodiscard]] bool isPassword() const noexcept { return m_isPassword; }
     
     /// Set password mode
-    void setPassword(bool password) { m_isPassword = password; }
+    void setPassword(bool password) { m_isPassword = password; markPaintDirty(); }
     
     /// Check if multiline
     [[nodiscard]] bool isMultiline() const noexcept { return m_multiline; }
@@ -479,6 +561,7 @@ protected:
     void onFocus(const FocusEvent& event) override;
     void onBlur(const FocusEvent& event) override;
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     std::string m_value;
@@ -533,9 +616,10 @@ protected:
     bool onPointerMove(const PointerEvent& event) override;
     bool onPointerUp(const PointerEvent& event) override;
     
-private:
     Vec2 m_scrollOffset;
     Vec2 m_contentSize;
+    
+private:
     Vec2 m_velocity;
     bool m_horizontalEnabled = false;
     bool m_verticalEnabled = true;
@@ -545,6 +629,109 @@ private:
     Vec2 m_scrollStart;
 };
 
+/**
+ * @brief Virtualized vertical list driven by a data source
+ * 
+ * Only rows inside the viewport (plus overscan) exist as widgets. Rows come
+ * from a small recycled pool: the factory creates them and the binder fills
+ * one in for an item index whenever it scrolls into view. Row positions come
+ * from cumulative offsets, so scrolling, index lookup and hit testing never
+ * visit off-screen items.
+ * 
+ * @code
+ * auto list = std::make_unique<ListView>();
+ * list->setRowFactory([] { return std::make_unique<Label>(""); });
+ * list->setRowBinder([&](Widget& row, usize i) {
+ *     static_cast<Label&>(row).setText(entries[i].name);
+ * });
+ * list->setItemCount(entries.size());
+ * @endcode
+ */
+class ListView : public ScrollView {
+public:
+    using RowFactory = std::function<std::unique_ptr<Widget>()>;
+    using RowBinder = std::function<void(Widget& row, usize index)>;
+    using RowHeightProvider = std::function<f32(usize index)>;
+    
+    /// Index of a pooled row that is not bound to an item
+    static constexpr usize NO_ITEM = static_cast<usize>(-1);
+    
+    ListView() = default;
+    
+    [[nodiscard]] const char* getTypeName() const noexcept override { return "ListView"; }
+    
+    /// Set the row widget factory (clears the pool)
+    void setRowFactory(RowFactory factory);
+    
+    /// Set the callback that fills a row for an item
+    void setRowBinder(RowBinder binder) { m_binder = std::move(binder); invalidateRows(); }
+    
+    /// Get number of items
+    [[nodiscard]] usize getItemCount() const noexcept { return m_itemCount; }
+    
+    /// Set number of items (rebinds all visible rows)
+    void setItemCount(usize count);
+    
+    /// Set a uniform row height (default 40)
+    void setRowHeight(f32 height);
+    
+    /// Set per-item row heights (nullptr returns to uniform rows)
+    void setRowHeightProvider(RowHeightProvider provider);
+    
+    /// Rows laid out beyond each edge of the viewport
+    void setOverscan(u32 rows) { m_overscan = rows; markLayoutDirty(); }
+    [[nodiscard]] u32 getOverscan() const noexcept { return m_overscan; }
+    
+    /// Item data changed: rebind visible rows (and re-query row heights)
+    void notifyDataChanged();
+    
+    /// One item changed: rebind its row if it is visible
+    void notifyItemChanged(usize index);
+    
+    /// Top of an item in content coordinates
+    [[nodiscard]] f32 getItemOffset(usize index) const;
+    
+    /// Item at a content-space y coordinate, or NO_ITEM (O(log n))
+    [[nodiscard]] usize getItemAt(f32 contentY) const;
+    
+    /// First and one-past-last item currently bound to rows
+    [[nodiscard]] std::pair<usize, usize> getBoundRange() const noexcept { return {m_firstBound, m_endBound}; }
+    
+    /// Row widget showing an item, or nullptr if it is not instantiated
+    [[nodiscard]] Widget* getRowForItem(usize index) const;
+    
+    /// Number of row widgets in the pool
+    [[nodiscard]] usize getPoolSize() const noexcept { return m_children.size(); }
+    
+    /// Scroll so an item is fully visible
+    void scrollToItem(usize index, bool animated = true);
+    
+protected:
+    void layoutChildren() override;
+    Widget* hitTestChildren(Vec2 point) override;
+    Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    
+private:
+    void rebuildOffsets();
+    void invalidateRows();
+    [[nodiscard]] f32 getRowHeight(usize index) const;
+    
+    RowFactory m_factory;
+    RowBinder m_binder;
+    RowHeightProvider m_heightProvider;
+    usize m_itemCount = 0;
+    f32 m_rowHeight = 40.0f;
+    u32 m_overscan = 2;
+    
+    /// Prefix sums of row heights (variable heights only, size = items + 1)
+    std::vector<f32> m_offsets;
+    
+    /// Item bound to each pooled child (parallel to m_children)
+    std::vector<usize> m_rowItems;
+    usize m_firstBound = 0;
+    usize m_endBound = 0;
+};
+
 /**
  * @brief Checkbox widget
  */
@@ -576,6 +763,7 @@ protected:
     bool onPointerUp(const PointerEvent& event) override;
     bool onKeyDown(const KeyEvent& event) override;
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     bool m_checked = false;
@@ -624,6 +812,7 @@ protected:
     bool onPointerMove(const PointerEvent& event) override;
     bool onPointerUp(const PointerEvent& event) override;
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     f32 m_value = 0.0f;
@@ -655,10 +844,11 @@ public:
     [[nodiscard]] bool isIndeterminate() const noexcept { return m_indeterminate; }
     
     /// Set indeterminate mode
-    void setIndeterminate(bool indeterminate) { m_indeterminate = indeterminate; }
+    void setIndeterminate(bool indeterminate) { m_indeterminate = indeterminate; markPaintDirty(); }
     
 protected:
     Vec2 measureContent(f32 availableWidth, f32 availableHeight) override;
+    void paint(UIPainter& painter) const override;
     
 private:
     f32 m_progress = 0.0f;
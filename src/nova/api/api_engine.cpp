@@ -6,6 +6,7 @@
 // =============================================================================
 
 #include <nova/api/api_engine.hpp>
+#include <nova/core/logging/metrics.hpp>
 
 #include <chrono>
 #include <thread>
@@ -136,6 +137,14 @@ bool EngineApi::processFrame() {
     if (m_impl->deltaTime > 0.0f) {
         m_impl->fps = 1.0f / delta.count();
     }
+
+    // Frame-to-frame time; also rolls the metrics windows forward
+    static auto& frameTime = profiling::MetricsRegistry::get().histogram(
+        "frame.time", "Wall time between engine frames");
+    if (m_impl->frameNumber > 0) {
+        frameTime.record(delta);
+    }
+    profiling::MetricsRegistry::get().tick();
     
     // Call update callback
     if (m_impl->updateCallback) {
@@ -14,11 +14,13 @@
  */
 
 #include <nova/core/animation/animation_system.hpp>
+#include <nova/core/animation/cooked_animation.hpp>
 #include <nova/core/logging/logging.hpp>
+#include <nova/core/platform/mapped_file.hpp>
 
 #include <algorithm>
 #include <cmath>
-#include <fstream>
+#include <cstring>
 #include <chrono>
 
 namespace nova::animation {
@@ -1661,6 +1663,13 @@ void AnimationSystem::update(f32 deltaTime) {
     auto endTime = std::chrono::high_resolution_clock::now();
     m_stats.evaluationTimeMs = std::chrono::duration<f64, std::milli>(
         endTime - startTime).count();
+
+    static auto& evaluateTime = profiling::MetricsRegistry::get().histogram(
+        "animation.evaluate", "Animation sampler update duration per frame");
+    static auto& activeSamplers = profiling::MetricsRegistry::get().gauge(
+        "animation.samplers", "Active animation samplers");
+    evaluateTime.record(endTime - startTime);
+    activeSamplers.set(static_cast<f64>(m_stats.activeSamplers));
 }
 
 SkeletonHandle AnimationSystem::loadSkeleton(const std::string& path) {
@@ -1799,115 +1808,43 @@ void AnimationSystem::resetStats() {
 
 bool AnimationSystem::loadSkeletonFromFile(const std::string& path, 
                                             SkeletonData& outData) {
-    // NovaCore Binary Skeleton Format (.nvskel)
-    // Header: 
-    //   - Magic: "NVSK" (4 bytes)
-    //   - Version: u32 (4 bytes)
-    //   - BoneCount: u32 (4 bytes)
-    //   - NameLength: u32 (4 bytes)
-    //   - Name: char[NameLength]
-    // Per Bone:
-    //   - NameLength: u32 (4 bytes)
-    //   - Name: char[NameLength]
-    //   - ParentIndex: i32 (4 bytes)
-    //   - Position: f32[3] (12 bytes)
-    //   - Rotation: f32[4] (16 bytes) - as quaternion xyzw
-    //   - Scale: f32[3] (12 bytes)
-    //   - InverseBindMatrix: f32[16] (64 bytes) - column-major
-    
-    std::ifstream file(path, std::ios::binary);
+    // NovaCore skeletons (.nvskel): cooked blobs (version 2) are validated
+    // in place; streamed source files (version 1) are parsed
+    auto file = platform::MappedFile::open(path);
     if (!file) {
         NOVA_LOG_WARN(LogCategory::Core, "Failed to open skeleton file: {}", path);
         return false;
     }
     
-    // Read magic number
-    char magic[5] = {};
-    file.read(magic, 4);
+    auto bytes = file->bytes();
+    if (CookedSkeleton::isCooked(bytes)) {
+        auto skeleton = CookedSkeleton::view(bytes);
+        if (!skeleton) {
+            NOVA_LOG_WARN(LogCategory::Core, "{}: {}", path, skeleton.error().message());
+            return false;
+        }
+        outData = skeleton->unpack();
+        NOVA_LOG_INFO(LogCategory::Core, "Loaded cooked skeleton '{}' with {} bones",
+                     outData.name, outData.bones.size());
+        return true;
+    }
     
-    // Check if this is a NovaCore skeleton file
-    if (std::string(magic) == "NVSK") {
-        // Read version
-        u32 version = 0;
-        file.read(reinterpret_cast<char*>(&version), sizeof(version));
-        
-        if (version > 1) {
-            NOVA_LOG_WARN(LogCategory::Core, "Unsupported skeleton version: {}", version);
+    if (bytes.size() >= 4 && std::memcmp(bytes.data(), "NVSK", 4) == 0) {
+        auto skeleton = readSkeletonSource(bytes);
+        if (!skeleton) {
+            NOVA_LOG_WARN(LogCategory::Core, "{}: {}", path, skeleton.error().message());
             return false;
         }
-        
-        // Read bone count
-        u32 boneCount = 0;
-        file.read(reinterpret_cast<char*>(&boneCount), sizeof(boneCount));
-        
-        // Read skeleton name
-        u32 nameLength = 0;
-        file.read(reinterpret_cast<char*>(&nameLength), sizeof(nameLength));
-        
-        if (nameLength > 0 && nameLength < 256) {
-            std::string name(nameLength, '\0');
-            file.read(name.data(), nameLength);
-            outData.name = name;
-        } else {
-            // Extract name from path
+        outData = std::move(*skeleton);
+        if (outData.name.empty()) {
             std::string filename = path.substr(path.find_last_of("/\\") + 1);
             outData.name = filename.substr(0, filename.find_last_of('.'));
         }
-        
-        // Read bones
-        outData.bones.reserve(boneCount);
-        for (u32 i = 0; i < boneCount; ++i) {
-            BoneInfo bone;
-            
-            // Read bone name
-            u32 boneNameLen = 0;
-            file.read(reinterpret_cast<char*>(&boneNameLen), sizeof(boneNameLen));
-            if (boneNameLen > 0 && boneNameLen < 128) {
-                bone.name.resize(boneNameLen);
-                file.read(bone.name.data(), boneNameLen);
-            }
-            
-            // Read parent index
-            file.read(reinterpret_cast<char*>(&bone.parentIndex), sizeof(bone.parentIndex));
-            
-            // Read bind pose position
-            f32 pos[3];
-            file.read(reinterpret_cast<char*>(pos), sizeof(pos));
-            bone.bindPose.position = Vec3(pos[0], pos[1], pos[2]);
-            
-            // Read bind pose rotation (quaternion)
-            f32 rot[4];
-            file.read(reinterpret_cast<char*>(rot), sizeof(rot));
-            bone.bindPose.rotation = Quat(rot[0], rot[1], rot[2], rot[3]);
-            
-            // Read bind pose scale
-            f32 scl[3];
-            file.read(reinterpret_cast<char*>(scl), sizeof(scl));
-            bone.bindPose.scale = Vec3(scl[0], scl[1], scl[2]);
-            
-            // Read inverse bind matrix (column-major)
-            f32 ibm[16];
-            file.read(reinterpret_cast<char*>(ibm), sizeof(ibm));
-            bone.inverseBindMatrix = Mat4{
-                Vec4(ibm[0], ibm[1], ibm[2], ibm[3]),
-                Vec4(ibm[4], ibm[5], ibm[6], ibm[7]),
-                Vec4(ibm[8], ibm[9], ibm[10], ibm[11]),
-                Vec4(ibm[12], ibm[13], ibm[14], ibm[15])
-            };
-            
-            // Store bone and mapping
-            outData.boneNameToIndex[bone.name] = static_cast<i32>(outData.bones.size());
-            outData.bones.push_back(bone);
-        }
-        
         NOVA_LOG_INFO(LogCategory::Core, "Loaded skeleton '{}' with {} bones from NVSK format", 
                      outData.name, outData.bones.size());
         return true;
     }
     
-    // Not a NVSK file - try parsing as simple text format or create default skeleton
-    file.seekg(0, std::ios::beg);
-    
     // Check file extension for glTF support hint
     std::string ext = path.substr(path.find_last_of('.') + 1);
     
@@ -1987,15 +1924,24 @@ bool AnimationSystem::loadSkeletonFromFile(const std::string& path,
 
 bool AnimationSystem::loadClipFromFile(const std::string& path, 
                                         AnimationClipData& outData) {
-    // Simple binary format loader
-    // In production, this would load from glTF, FBX, or custom format
-    
-    std::ifstream file(path, std::ios::binary);
+    // Cooked clips (.nvanim) are validated in place
+    auto file = platform::MappedFile::open(path);
     if (!file) {
         NOVA_LOG_WARN(LogCategory::Core, "Failed to open animation file: {}", path);
         return false;
     }
     
+    if (CookedClip::isCooked(file->bytes())) {
+        auto clip = CookedClip::view(file->bytes());
+        if (!clip) {
+            NOVA_LOG_WARN(LogCategory::Core, "{}: {}", path, clip.error().message());
+            return false;
+        }
+        outData = clip->unpack();
+        return true;
+    }
+    
+    // Other formats (glTF, FBX) are not imported yet; use a placeholder idle
     // Extract name from path
     std::string filename = path.substr(path.find_last_of("/\\") + 1);
     std::string name = filename.substr(0, filename.find_last_of('.'));
@@ -0,0 +1,589 @@
+/**
+ * @file cooked_animation.cpp
+ * @brief NovaCore Animation System™ - Cooked Skeleton and Clip Formats
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include <nova/core/animation/cooked_animation.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace nova::animation {
+
+namespace {
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+[[nodiscard]] constexpr bool fits(u64 offset, u64 size, u64 total) noexcept {
+    return offset <= total && size <= total - offset;
+}
+
+template<typename T>
+[[nodiscard]] bool tableFits(u32 offset, u32 count, usize total) noexcept {
+    return offset % alignof(T) == 0 && fits(offset, u64{count} * sizeof(T), total);
+}
+
+template<typename Header>
+[[nodiscard]] bool startsWith(std::span<const u8> blob, u32 magic, u32 version) noexcept {
+    if (blob.size() < sizeof(Header)) {
+        return false;
+    }
+    u32 prefix[2];
+    std::memcpy(prefix, blob.data(), sizeof(prefix));
+    return prefix[0] == magic && prefix[1] == version;
+}
+
+void copy3(f32 (&out)[3], const Vec3& v) noexcept {
+    out[0] = v.x;
+    out[1] = v.y;
+    out[2] = v.z;
+}
+
+[[nodiscard]] Vec3 toVec3(const f32 (&v)[3]) noexcept {
+    return Vec3(v[0], v[1], v[2]);
+}
+
+/// Appends aligned tables and strings to a blob, addressed by offset
+class BlobWriter {
+public:
+    template<typename T>
+    u32 table(std::span<const T> items) {
+        align(CookedFormat::TABLE_ALIGNMENT);
+        u32 offset = size();
+        const auto* bytes = reinterpret_cast<const u8*>(items.data());
+        m_data.insert(m_data.end(), bytes, bytes + items.size_bytes());
+        return offset;
+    }
+
+    template<typename T>
+    u32 reserve() {
+        align(alignof(T));
+        u32 offset = size();
+        m_data.resize(m_data.size() + sizeof(T));
+        return offset;
+    }
+
+    template<typename T>
+    void patch(u32 offset, const T& value) {
+        std::memcpy(m_data.data() + offset, &value, sizeof(T));
+    }
+
+    u32 size() const { return static_cast<u32>(m_data.size()); }
+    std::vector<u8> take() { return std::move(m_data); }
+
+private:
+    void align(u32 alignment) {
+        m_data.resize((m_data.size() + alignment - 1) & ~usize(alignment - 1));
+    }
+
+    std::vector<u8> m_data;
+};
+
+/// String table built alongside the tables that reference it
+class NameTable {
+public:
+    void add(std::string_view name, u32& offset, u32& length) {
+        offset = static_cast<u32>(m_names.size());
+        length = static_cast<u32>(name.size());
+        m_names.append(name);
+    }
+
+    std::span<const char> chars() const { return m_names; }
+
+private:
+    std::string m_names;
+};
+
+constexpr u64 MAX_COOKED_SIZE = std::numeric_limits<u32>::max();
+
+} // namespace
+
+// ============================================================================
+// CookedSkeleton
+// ============================================================================
+
+bool CookedSkeleton::isCooked(std::span<const u8> blob) noexcept {
+    return startsWith<CookedSkeletonHeader>(blob, CookedFormat::SKELETON_MAGIC, CookedFormat::SKELETON_VERSION);
+}
+
+Result<CookedSkeleton> CookedSkeleton::view(std::span<const u8> blob) {
+    auto invalid = [](const char* reason) {
+        return std::unexpected(errors::parse(std::string("Invalid cooked skeleton: ") + reason));
+    };
+
+    if (!isCooked(blob)) {
+        return invalid("bad magic or version");
+    }
+    if (reinterpret_cast<uintptr_t>(blob.data()) % alignof(CookedSkeletonHeader) != 0) {
+        return invalid("misaligned blob");
+    }
+    const auto& header = *reinterpret_cast<const CookedSkeletonHeader*>(blob.data());
+    if (header.fileSize != blob.size()) {
+        return invalid("size mismatch");
+    }
+    if (!std::has_single_bit(header.indexSize) || header.indexSize <= header.boneCount) {
+        return invalid("bad index size");
+    }
+    if (!tableFits<CookedBone>(header.bonesOffset, header.boneCount, blob.size()) ||
+        !tableFits<u32>(header.indexOffset, header.indexSize, blob.size()) ||
+        !fits(header.namesOffset, header.namesSize, blob.size()) ||
+        !fits(header.nameOffset, header.nameLength, header.namesSize)) {
+        return invalid("table out of bounds");
+    }
+
+    CookedSkeleton skeleton;
+    skeleton.m_header = &header;
+    skeleton.m_bones = {reinterpret_cast<const CookedBone*>(blob.data() + header.bonesOffset), header.boneCount};
+    skeleton.m_index = {reinterpret_cast<const u32*>(blob.data() + header.indexOffset), header.indexSize};
+    skeleton.m_names = reinterpret_cast<const char*>(blob.data() + header.namesOffset);
+
+    // One pass so accessors and the pose pass need no checks
+    for (u32 i = 0; i < header.boneCount; ++i) {
+        const CookedBone& bone = skeleton.m_bones[i];
+        if (bone.parentIndex < -1 || bone.parentIndex >= static_cast<i32>(i)) {
+            return invalid("bone before its parent");
+        }
+        if (!fits(bone.nameOffset, bone.nameLength, header.namesSize)) {
+            return invalid("bone name out of bounds");
+        }
+    }
+    for (u32 slot : skeleton.m_index) {
+        if (slot > header.boneCount) {
+            return invalid("bad index entry");
+        }
+    }
+    return skeleton;
+}
+
+i32 CookedSkeleton::findBone(std::string_view boneName) const noexcept {
+    u32 hash = boneNameHash(boneName);
+    u32 mask = m_header->indexSize - 1;
+    for (u32 slot = hash & mask;; slot = (slot + 1) & mask) {
+        u32 entry = m_index[slot];
+        if (entry == 0) {
+            return -1;
+        }
+        const CookedBone& bone = m_bones[entry - 1];
+        if (bone.nameHash == hash && getBoneName(bone) == boneName) {
+            return static_cast<i32>(entry - 1);
+        }
+    }
+}
+
+SkeletonData CookedSkeleton::unpack() const {
+    SkeletonData data;
+    data.name = getName();
+    data.bones.resize(m_bones.size());
+    data.boneNameToIndex.reserve(m_bones.size());
+    for (usize i = 0; i < m_bones.size(); ++i) {
+        const CookedBone& cooked = m_bones[i];
+        BoneInfo& bone = data.bones[i];
+        bone.name = getBoneName(cooked);
+        bone.parentIndex = cooked.parentIndex;
+        bone.bindPose.position = toVec3(cooked.position);
+        bone.bindPose.rotation = Quat(cooked.rotation[0], cooked.rotation[1], cooked.rotation[2], cooked.rotation[3]);
+        bone.bindPose.scale = toVec3(cooked.scale);
+        std::memcpy(bone.inverseBindMatrix.data(), cooked.inverseBindMatrix, sizeof(cooked.inverseBindMatrix));
+        bone.minRotation = toVec3(cooked.minRotation);
+        bone.maxRotation = toVec3(cooked.maxRotation);
+        data.boneNameToIndex[bone.name] = static_cast<i32>(i);
+    }
+    return data;
+}
+
+Result<std::vector<u8>> cookSkeleton(const SkeletonData& skeleton) {
+    const usize boneCount = skeleton.bones.size();
+    if (boneCount > std::numeric_limits<i32>::max() / 2) {
+        return std::unexpected(errors::validation("Skeleton has too many bones"));
+    }
+
+    NameTable names;
+    CookedSkeletonHeader header;
+    names.add(skeleton.name, header.nameOffset, header.nameLength);
+
+    std::vector<CookedBone> bones(boneCount);
+    for (usize i = 0; i < boneCount; ++i) {
+        const BoneInfo& bone = skeleton.bones[i];
+        if (bone.parentIndex < -1 || bone.parentIndex >= static_cast<i32>(i)) {
+            return std::unexpected(errors::validation("Bone '" + bone.name + "' does not come after its parent"));
+        }
+
+        CookedBone& cooked = bones[i];
+        std::memcpy(cooked.inverseBindMatrix, bone.inverseBindMatrix.data(), sizeof(cooked.inverseBindMatrix));
+        copy3(cooked.position, bone.bindPose.position);
+        cooked.rotation[0] = bone.bindPose.rotation.x;
+        cooked.rotation[1] = bone.bindPose.rotation.y;
+        cooked.rotation[2] = bone.bindPose.rotation.z;
+        cooked.rotation[3] = bone.bindPose.rotation.w;
+        copy3(cooked.scale, bone.bindPose.scale);
+        copy3(cooked.minRotation, bone.minRotation);
+        copy3(cooked.maxRotation, bone.maxRotation);
+        cooked.parentIndex = bone.parentIndex;
+        cooked.nameHash = boneNameHash(bone.name);
+        names.add(bone.name, cooked.nameOffset, cooked.nameLength);
+    }
+
+    // Open addressing at load factor <= 0.5; a repeated name maps to its
+    // last bone, as in SkeletonData::boneNameToIndex
+    header.boneCount = static_cast<u32>(boneCount);
+    header.indexSize = std::bit_ceil(std::max<u32>(header.boneCount * 2, 1));
+    std::vector<u32> index(header.indexSize, 0);
+    const u32 mask = header.indexSize - 1;
+    for (u32 i = 0; i < header.boneCount; ++i) {
+        const BoneInfo& bone = skeleton.bones[i];
+        for (u32 slot = bones[i].nameHash & mask;; slot = (slot + 1) & mask) {
+            if (index[slot] == 0 || skeleton.bones[index[slot] - 1].name == bone.name) {
+                index[slot] = i + 1;
+                break;
+            }
+        }
+    }
+
+    BlobWriter writer;
+    u32 headerOffset = writer.reserve<CookedSkeletonHeader>();
+    header.bonesOffset = writer.table<CookedBone>(bones);
+    header.indexOffset = writer.table<u32>(index);
+    header.namesOffset = writer.table<char>(names.chars());
+    header.namesSize = static_cast<u32>(names.chars().size());
+    header.fileSize = writer.size();
+    if (header.fileSize > MAX_COOKED_SIZE) {
+        return std::unexpected(errors::validation("Cooked skeleton exceeds 4 GiB"));
+    }
+    writer.patch(headerOffset, header);
+    return writer.take();
+}
+
+// ============================================================================
+// CookedClip
+// ============================================================================
+
+bool CookedClip::isCooked(std::span<const u8> blob) noexcept {
+    return startsWith<CookedClipHeader>(blob, CookedFormat::CLIP_MAGIC, CookedFormat::CLIP_VERSION);
+}
+
+Result<CookedClip> CookedClip::view(std::span<const u8> blob) {
+    auto invalid = [](const char* reason) {
+        return std::unexpected(errors::parse(std::string("Invalid cooked clip: ") + reason));
+    };
+
+    if (!isCooked(blob)) {
+        return invalid("bad magic or version");
+    }
+    if (reinterpret_cast<uintptr_t>(blob.data()) % alignof(CookedClipHeader) != 0) {
+        return invalid("misaligned blob");
+    }
+    const auto& header = *reinterpret_cast<const CookedClipHeader*>(blob.data());
+    if (header.fileSize != blob.size()) {
+        return invalid("size mismatch");
+    }
+    if (!tableFits<CookedChannel>(header.channelsOffset, header.channelCount, blob.size()) ||
+        !tableFits<CookedVec3Key>(header.positionKeysOffset, header.positionKeyCount, blob.size()) ||
+        !tableFits<CookedQuatKey>(header.rotationKeysOffset, header.rotationKeyCount, blob.size()) ||
+        !tableFits<CookedVec3Key>(header.scaleKeysOffset, header.scaleKeyCount, blob.size()) ||
+        !tableFits<CookedEvent>(header.eventsOffset, header.eventCount, blob.size()) ||
+        !fits(header.namesOffset, header.namesSize, blob.size()) ||
+        !fits(header.nameOffset, header.nameLength, header.namesSize)) {
+        return invalid("table out of bounds");
+    }
+
+    CookedClip clip;
+    clip.m_header = &header;
+    clip.m_channels = {reinterpret_cast<const CookedChannel*>(blob.data() + header.channelsOffset), header.channelCount};
+    clip.m_positionKeys = {reinterpret_cast<const CookedVec3Key*>(blob.data() + header.positionKeysOffset), header.positionKeyCount};
+    clip.m_rotationKeys = {reinterpret_cast<const CookedQuatKey*>(blob.data() + header.rotationKeysOffset), header.rotationKeyCount};
+    clip.m_scaleKeys = {reinterpret_cast<const CookedVec3Key*>(blob.data() + header.scaleKeysOffset), header.scaleKeyCount};
+    clip.m_events = {reinterpret_cast<const CookedEvent*>(blob.data() + header.eventsOffset), header.eventCount};
+    clip.m_names = reinterpret_cast<const char*>(blob.data() + header.namesOffset);
+
+    for (const CookedChannel& channel : clip.m_channels) {
+        if (!fits(channel.nameOffset, channel.nameLength, header.namesSize) ||
+            !fits(channel.firstPositionKey, channel.positionKeyCount, header.positionKeyCount) ||
+            !fits(channel.firstRotationKey, channel.rotationKeyCount, header.rotationKeyCount) ||
+            !fits(channel.firstScaleKey, channel.scaleKeyCount, header.scaleKeyCount)) {
+            return invalid("channel out of bounds");
+        }
+    }
+    for (const CookedEvent& event : clip.m_events) {
+        if (!fits(event.nameOffset, event.nameLength, header.namesSize) ||
+            !fits(event.stringOffset, event.stringLength, header.namesSize)) {
+            return invalid("event name out of bounds");
+        }
+    }
+    return clip;
+}
+
+AnimationClipData CookedClip::unpack() const {
+    AnimationClipData data;
+    data.name = getName();
+    data.duration = m_header->duration;
+    data.framesPerSecond = m_header->framesPerSecond;
+    data.hasRootMotion = (m_header->flags & CookedClipHeader::ROOT_MOTION) != 0;
+    data.rootMotionPosition = toVec3(m_header->rootMotionPosition);
+    data.rootMotionRotation = m_header->rootMotionRotation;
+
+    data.channels.resize(m_channels.size());
+    for (usize i = 0; i < m_channels.size(); ++i) {
+        const CookedChannel& cooked = m_channels[i];
+        AnimationChannel& channel = data.channels[i];
+        channel.boneIndex = cooked.boneIndex;
+        channel.boneName = getBoneName(cooked);
+
+        auto positions = getPositionKeys(cooked);
+        channel.positionKeys.resize(positions.size());
+        for (usize k = 0; k < positions.size(); ++k) {
+            const CookedVec3Key& key = positions[k];
+            channel.positionKeys[k] = {key.time, toVec3(key.value), static_cast<InterpolationMode>(key.interpolation),
+                                       toVec3(key.inTangent), toVec3(key.outTangent)};
+        }
+        auto rotations = getRotationKeys(cooked);
+        channel.rotationKeys.resize(rotations.size());
+        for (usize k = 0; k < rotations.size(); ++k) {
+            const CookedQuatKey& key = rotations[k];
+            channel.rotationKeys[k] = {key.time, Quat(key.value[0], key.value[1], key.value[2], key.value[3]),
+                                       static_cast<InterpolationMode>(key.interpolation)};
+        }
+        auto scales = getScaleKeys(cooked);
+        channel.scaleKeys.resize(scales.size());
+        for (usize k = 0; k < scales.size(); ++k) {
+            const CookedVec3Key& key = scales[k];
+            channel.scaleKeys[k] = {key.time, toVec3(key.value), static_cast<InterpolationMode>(key.interpolation),
+                                    toVec3(key.inTangent), toVec3(key.outTangent)};
+        }
+    }
+
+    data.events.resize(m_events.size());
+    for (usize i = 0; i < m_events.size(); ++i) {
+        const CookedEvent& cooked = m_events[i];
+        AnimationEvent& event = data.events[i];
+        event.time = cooked.time;
+        event.type = static_cast<AnimationEventType>(cooked.type);
+        event.name = name(cooked.nameOffset, cooked.nameLength);
+        event.stringParam = name(cooked.stringOffset, cooked.stringLength);
+        event.intParam = cooked.intParam;
+        event.floatParam = cooked.floatParam;
+    }
+    return data;
+}
+
+Result<std::vector<u8>> cookClip(const AnimationClipData& clip) {
+    NameTable names;
+    CookedClipHeader header;
+    header.duration = clip.duration > 0.0f ? clip.duration : 0.0f;
+    header.framesPerSecond = clip.framesPerSecond;
+    header.flags = clip.hasRootMotion ? CookedClipHeader::ROOT_MOTION : 0;
+    copy3(header.rootMotionPosition, clip.rootMotionPosition);
+    header.rootMotionRotation = clip.rootMotionRotation;
+    names.add(clip.name, header.nameOffset, header.nameLength);
+
+    // Channels by bone so sampling walks the pose in order; unbound
+    // channels (boneIndex -1) go last
+    std::vector<const AnimationChannel*> order;
+    order.reserve(clip.channels.size());
+    for (const auto& channel : clip.channels) {
+        order.push_back(&channel);
+    }
+    std::stable_sort(order.begin(), order.end(), [](const AnimationChannel* a, const AnimationChannel* b) {
+        return static_cast<u32>(a->boneIndex) < static_cast<u32>(b->boneIndex);
+    });
+
+    auto byTime = [](const auto& a, const auto& b) { return a.time < b.time; };
+    auto vec3Key = [](f32 time, const Vec3& value, InterpolationMode interp, const Vec3& in, const Vec3& out) {
+        CookedVec3Key key{};
+        key.time = time;
+        copy3(key.value, value);
+        copy3(key.inTangent, in);
+        copy3(key.outTangent, out);
+        key.interpolation = static_cast<u32>(interp);
+        return key;
+    };
+
+    std::vector<CookedChannel> channels;
+    std::vector<CookedVec3Key> positionKeys;
+    std::vector<CookedQuatKey> rotationKeys;
+    std::vector<CookedVec3Key> scaleKeys;
+    channels.reserve(order.size());
+    for (const AnimationChannel* source : order) {
+        CookedChannel channel{};
+        channel.boneIndex = source->boneIndex;
+        channel.boneNameHash = boneNameHash(source->boneName);
+        names.add(source->boneName, channel.nameOffset, channel.nameLength);
+
+        channel.firstPositionKey = static_cast<u32>(positionKeys.size());
+        channel.positionKeyCount = static_cast<u32>(source->positionKeys.size());
+        for (const auto& key : source->positionKeys) {
+            positionKeys.push_back(vec3Key(key.time, key.position, key.interp, key.inTangent, key.outTangent));
+        }
+        std::stable_sort(positionKeys.begin() + channel.firstPositionKey, positionKeys.end(), byTime);
+
+        channel.firstRotationKey = static_cast<u32>(rotationKeys.size());
+        channel.rotationKeyCount = static_cast<u32>(source->rotationKeys.size());
+        for (const auto& key : source->rotationKeys) {
+            CookedQuatKey cooked{};
+            cooked.time = key.time;
+            cooked.value[0] = key.rotation.x;
+            cooked.value[1] = key.rotation.y;
+            cooked.value[2] = key.rotation.z;
+            cooked.value[3] = key.rotation.w;
+            cooked.interpolation = static_cast<u32>(key.interp);
+            rotationKeys.push_back(cooked);
+        }
+        std::stable_sort(rotationKeys.begin() + channel.firstRotationKey, rotationKeys.end(), byTime);
+
+        channel.firstScaleKey = static_cast<u32>(scaleKeys.size());
+        channel.scaleKeyCount = static_cast<u32>(source->scaleKeys.size());
+        for (const auto& key : source->scaleKeys) {
+            scaleKeys.push_back(vec3Key(key.time, key.scale, key.interp, key.inTangent, key.outTangent));
+        }
+        std::stable_sort(scaleKeys.begin() + channel.firstScaleKey, scaleKeys.end(), byTime);
+
+        channels.push_back(channel);
+    }
+
+    std::vector<CookedEvent> events;
+    events.reserve(clip.events.size());
+    for (const auto& source : clip.events) {
+        CookedEvent event{};
+        event.time = source.time;
+        event.type = static_cast<u32>(source.type);
+        event.intParam = source.intParam;
+        event.floatParam = source.floatParam;
+        names.add(source.name, event.nameOffset, event.nameLength);
+        names.add(source.stringParam, event.stringOffset, event.stringLength);
+        events.push_back(event);
+    }
+    std::stable_sort(events.begin(), events.end(), byTime);
+
+    // Clips without an authored duration end at their last key
+    if (header.duration <= 0.0f) {
+        for (const auto* keys : {&positionKeys, &scaleKeys}) {
+            for (const auto& key : *keys) {
+                header.duration = std::max(header.duration, key.time);
+            }
+        }
+        for (const auto& key : rotationKeys) {
+            header.duration = std::max(header.duration, key.time);
+        }
+    }
+
+    header.channelCount = static_cast<u32>(channels.size());
+    header.eventCount = static_cast<u32>(events.size());
+    header.positionKeyCount = static_cast<u32>(positionKeys.size());
+    header.rotationKeyCount = static_cast<u32>(rotationKeys.size());
+    header.scaleKeyCount = static_cast<u32>(scaleKeys.size());
+
+    BlobWriter writer;
+    u32 headerOffset = writer.reserve<CookedClipHeader>();
+    header.channelsOffset = writer.table<CookedChannel>(channels);
+    header.positionKeysOffset = writer.table<CookedVec3Key>(positionKeys);
+    header.rotationKeysOffset = writer.table<CookedQuatKey>(rotationKeys);
+    header.scaleKeysOffset = writer.table<CookedVec3Key>(scaleKeys);
+    header.eventsOffset = writer.table<CookedEvent>(events);
+    header.namesOffset = writer.table<char>(names.chars());
+    header.namesSize = static_cast<u32>(names.chars().size());
+    header.fileSize = writer.size();
+    if (header.fileSize > MAX_COOKED_SIZE) {
+        return std::unexpected(errors::validation("Cooked clip exceeds 4 GiB"));
+    }
+    writer.patch(headerOffset, header);
+    return writer.take();
+}
+
+// ============================================================================
+// Source Formats
+// ============================================================================
+
+namespace {
+
+/// Bounds-checked little-endian reader over a byte span
+class SourceReader {
+public:
+    explicit SourceReader(std::span<const u8> data) : m_data(data) {}
+
+    template<typename T>
+    bool read(T& value) {
+        if (m_data.size() - m_position < sizeof(T)) {
+            return false;
+        }
+        std::memcpy(&value, m_data.data() + m_position, sizeof(T));
+        m_position += sizeof(T);
+        return true;
+    }
+
+    bool readString(std::string& value, u32 length) {
+        if (m_data.size() - m_position < length) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(m_data.data() + m_position), length);
+        m_position += length;
+        return true;
+    }
+
+private:
+    std::span<const u8> m_data;
+    usize m_position = 0;
+};
+
+} // namespace
+
+Result<SkeletonData> readSkeletonSource(std::span<const u8> data) {
+    // Header: magic "NVSK", version, bone count, then a length-prefixed name.
+    // Per bone: length-prefixed name, parent index, position, rotation (xyzw),
+    // scale and a column-major inverse bind matrix.
+    auto truncated = [] {
+        return std::unexpected(errors::parse("Truncated skeleton source"));
+    };
+
+    SourceReader reader(data);
+    u32 magic = 0;
+    u32 version = 0;
+    u32 boneCount = 0;
+    u32 nameLength = 0;
+    if (!reader.read(magic) || !reader.read(version)) {
+        return truncated();
+    }
+    if (magic != CookedFormat::SKELETON_MAGIC) {
+        return std::unexpected(errors::parse("Not a skeleton source"));
+    }
+    if (version > 1) {
+        return std::unexpected(errors::parse("Unsupported skeleton source version " + std::to_string(version)));
+    }
+
+    SkeletonData skeleton;
+    if (!reader.read(boneCount) || !reader.read(nameLength) || !reader.readString(skeleton.name, nameLength)) {
+        return truncated();
+    }
+    // Every bone takes at least its fixed fields
+    constexpr usize MIN_BONE_SIZE = sizeof(u32) + sizeof(i32) + sizeof(f32) * (3 + 4 + 3 + 16);
+    if (boneCount > data.size() / MIN_BONE_SIZE) {
+        return truncated();
+    }
+
+    skeleton.bones.resize(boneCount);
+    for (u32 i = 0; i < boneCount; ++i) {
+        BoneInfo& bone = skeleton.bones[i];
+        u32 boneNameLength = 0;
+        f32 pos[3];
+        f32 rot[4];
+        f32 scl[3];
+        f32 ibm[16];
+        if (!reader.read(boneNameLength) || !reader.readString(bone.name, boneNameLength) ||
+            !reader.read(bone.parentIndex) || !reader.read(pos) || !reader.read(rot) || !reader.read(scl) ||
+            !reader.read(ibm)) {
+            return truncated();
+        }
+        bone.bindPose.position = Vec3(pos[0], pos[1], pos[2]);
+        bone.bindPose.rotation = Quat(rot[0], rot[1], rot[2], rot[3]);
+        bone.bindPose.scale = Vec3(scl[0], scl[1], scl[2]);
+        std::memcpy(bone.inverseBindMatrix.data(), ibm, sizeof(ibm));
+        skeleton.boneNameToIndex[bone.name] = static_cast<i32>(i);
+    }
+    return skeleton;
+}
+
+} // namespace nova::animation
@@ -7,9 +7,11 @@
 
 #include "nova/core/logging/logger.hpp"
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <ctime>
+#include <new>
 #include <thread>
 
 namespace nova::logging {
@@ -128,11 +130,37 @@ void ConsoleSink::flush() {
 // Logger Implementation
 // =============================================================================
 
+namespace {
+
+/// Short thread identifier used in log messages
+[[nodiscard]] u32 currentThreadId() noexcept {
+    std::hash<std::thread::id> hasher;
+    return static_cast<u32>(hasher(std::this_thread::get_id()) & 0xFFFF);
+}
+
+/// The calling thread's async ring buffer; retired when the thread exits
+struct ThreadBufferSlot {
+    std::shared_ptr<detail::LogThreadBuffer> buffer;
+    u64 generation = 0;
+    
+    ~ThreadBufferSlot() {
+        if (buffer) buffer->retired.store(true, std::memory_order_release);
+    }
+};
+
+thread_local ThreadBufferSlot t_bufferSlot;
+
+} // anonymous namespace
+
 Logger& Logger::instance() noexcept {
     static Logger s_instance;
     return s_instance;
 }
 
+Logger::~Logger() {
+    stopAsync();
+}
+
 void Logger::initialize() {
     if (m_initialized) return;
     
@@ -150,6 +178,7 @@ void Logger::shutdown() {
     if (!m_initialized) return;
     
     log(LogLevel::Info, LogCategory::Core, "NovaCore Logger shutting down");
+    stopAsync();
     flush();
     
     std::lock_guard lock(m_sinkMutex);
@@ -179,6 +208,19 @@ void Logger::log(LogLevel level, LogCategory category,
                  const std::source_location& loc) {
     if (!shouldLog(level, category)) return;
     
+    if (m_async.load(std::memory_order_acquire)) {
+        AsyncReservation slot = reserveAsync(level, category, message.size(),
+                                             loc.file_name(), loc.function_name(), loc.line());
+        if (slot.accepted) {
+            if (slot.header) {
+                slot.header->fmtSize = static_cast<u32>(message.size());
+                std::memcpy(slot.header + 1, message.data(), message.size());
+                commitAsync(slot, level);
+            }
+            return;
+        }
+    }
+    
     // Build log message
     LogMessage msg{};
     msg.level = level;
@@ -190,15 +232,12 @@ void Logger::log(LogLevel level, LogCategory category,
     msg.function = loc.function_name();
     
     // Get thread ID (simplified)
-    std::hash<std::thread::id> hasher;
-    msg.threadId = static_cast<u32>(hasher(std::this_thread::get_id()) & 0xFFFF);
+    msg.threadId = currentThreadId();
     
     // Write to all sinks
     {
         std::lock_guard lock(m_sinkMutex);
-        for (auto* sink : m_sinks) {
-            sink->write(msg);
-        }
+        writeToSinks(msg);
     }
     
     // Auto-flush for errors and fatal
@@ -208,10 +247,300 @@ void Logger::log(LogLevel level, LogCategory category,
 }
 
 void Logger::flush() {
+    if (m_async.load(std::memory_order_acquire) &&
+        std::this_thread::get_id() != m_asyncThread.get_id()) {
+        // The backend flushes the sinks once it has drained past this ticket
+        std::unique_lock lock(m_asyncMutex);
+        u64 ticket = ++m_flushRequested;
+        m_asyncWake.notify_one();
+        m_flushDone.wait(lock, [&] { return m_flushCompleted >= ticket; });
+        return;
+    }
+    
+    std::lock_guard lock(m_sinkMutex);
+    for (auto* sink : m_sinks) {
+        sink->flush();
+    }
+}
+
+void Logger::writeToSinks(const LogMessage& msg) {
+    // Caller holds m_sinkMutex
+    for (auto* sink : m_sinks) {
+        sink->write(msg);
+    }
+}
+
+// =============================================================================
+// Async Mode
+// =============================================================================
+
+void Logger::startAsync(const AsyncLogConfig& config) {
+    if (m_async.load(std::memory_order_acquire)) return;
+    
+    // Drop rings registered by threads that raced the last stopAsync
+    retireBuffers();
+    
+    m_asyncConfig = config;
+    m_asyncStop = false;
+    m_reportedDrops = getAsyncStats().dropped;
+    
+    // Writers may still be in reserveAsync, so they read these copies rather
+    // than m_asyncConfig; the generation bump publishes them
+    m_asyncBufferSize.store(config.bufferSize, std::memory_order_relaxed);
+    m_asyncOverflowPolicy.store(config.overflowPolicy, std::memory_order_relaxed);
+    
+    // Rings from an earlier async session are replaced on first use
+    m_bufferGeneration.fetch_add(1, std::memory_order_release);
+    
+    m_asyncThread = std::thread(&Logger::asyncThreadMain, this);
+    m_async.store(true, std::memory_order_release);
+}
+
+void Logger::stopAsync() {
+    if (!m_async.exchange(false)) return;
+    
+    // Let threads that already reserved a record publish it. The wait runs
+    // without m_bufferMutex: the backend needs it to drain rings that
+    // Block-policy writers are waiting on.
+    std::vector<std::shared_ptr<detail::LogThreadBuffer>> buffers;
+    {
+        std::lock_guard lock(m_bufferMutex);
+        buffers = m_buffers;
+    }
+    for (const auto& buffer : buffers) {
+        while (buffer->writing.load()) {
+            std::this_thread::yield();
+        }
+    }
+    
+    {
+        std::lock_guard lock(m_asyncMutex);
+        m_asyncStop = true;
+    }
+    m_asyncWake.notify_one();
+    m_asyncThread.join();
+    
+    {
+        std::lock_guard lock(m_asyncMutex);
+        m_flushCompleted = m_flushRequested;
+    }
+    m_flushDone.notify_all();
+    
+    retireBuffers();
+    m_drainList.clear();
+    
     std::lock_guard lock(m_sinkMutex);
     for (auto* sink : m_sinks) {
         sink->flush();
     }
 }
 
+void Logger::retireBuffers() {
+    std::lock_guard lock(m_bufferMutex);
+    for (const auto& buffer : m_buffers) {
+        m_retiredStats.enqueued += buffer->enqueued.load(std::memory_order_relaxed);
+        m_retiredStats.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        m_retiredStats.blocked += buffer->blocked.load(std::memory_order_relaxed);
+    }
+    m_buffers.clear();
+}
+
+AsyncLogStats Logger::getAsyncStats() const {
+    std::lock_guard lock(m_bufferMutex);
+    AsyncLogStats stats = m_retiredStats;
+    for (const auto& buffer : m_buffers) {
+        stats.enqueued += buffer->enqueued.load(std::memory_order_relaxed);
+        stats.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        stats.blocked += buffer->blocked.load(std::memory_order_relaxed);
+    }
+    stats.processed = m_processed.load(std::memory_order_relaxed);
+    stats.threads = static_cast<u32>(m_buffers.size());
+    return stats;
+}
+
+Logger::AsyncReservation Logger::reserveAsync(LogLevel level, LogCategory category, usize payloadSize,
+                                              const char* file, const char* function, u32 line) {
+    ThreadBufferSlot& slot = t_bufferSlot;
+    u64 generation = m_bufferGeneration.load(std::memory_order_acquire);
+    if (!slot.buffer || slot.generation != generation) {
+        if (slot.buffer) slot.buffer->retired.store(true, std::memory_order_release);
+        usize bufferSize = m_asyncBufferSize.load(std::memory_order_relaxed);
+        slot.buffer = std::make_shared<detail::LogThreadBuffer>(bufferSize, currentThreadId());
+        slot.generation = generation;
+        
+        std::lock_guard lock(m_bufferMutex);
+        m_buffers.push_back(slot.buffer);
+    }
+    
+    // Marking the ring as in use first lets stopAsync wait for in-flight records
+    detail::LogThreadBuffer* buffer = slot.buffer.get();
+    buffer->writing.store(true);
+    if (!m_async.load()) {
+        buffer->writing.store(false, std::memory_order_release);
+        return {};
+    }
+    
+    usize size = sizeof(detail::LogRecordHeader) + payloadSize;
+    std::byte* data = buffer->ring.tryReserve(size);
+    
+    if (!data) {
+        bool canWait = m_asyncOverflowPolicy.load(std::memory_order_relaxed) == LogOverflowPolicy::Block &&
+                       detail::LogRingBuffer::alignRecord(size) <= buffer->ring.capacity();
+        if (!canWait) {
+            buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+            buffer->writing.store(false, std::memory_order_release);
+            return {buffer, nullptr, true};
+        }
+        
+        buffer->blocked.fetch_add(1, std::memory_order_relaxed);
+        while (!(data = buffer->ring.tryReserve(size))) {
+            // stopAsync() is waiting for this thread; give up the record
+            if (!m_async.load(std::memory_order_acquire)) {
+                buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+                buffer->writing.store(false, std::memory_order_release);
+                return {buffer, nullptr, true};
+            }
+            m_asyncWake.notify_one();
+            std::this_thread::yield();
+        }
+    }
+    
+    auto* header = new (data) detail::LogRecordHeader{};
+    header->size = static_cast<u32>(detail::LogRingBuffer::alignRecord(size));
+    header->line = line;
+    header->level = level;
+    header->category = category;
+    header->timestampNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header->file = file;
+    header->function = function;
+    header->threadId = buffer->threadId;
+    return {buffer, header, true};
+}
+
+void Logger::commitAsync(const AsyncReservation& slot, LogLevel level) {
+    slot.buffer->ring.commit();
+    slot.buffer->enqueued.fetch_add(1, std::memory_order_relaxed);
+    slot.buffer->writing.store(false, std::memory_order_release);
+    
+    if (level >= LogLevel::Fatal) {
+        flush();
+    }
+}
+
+void Logger::asyncThreadMain() {
+    for (;;) {
+        u64 requested = 0;
+        bool stop = false;
+        {
+            std::lock_guard lock(m_asyncMutex);
+            requested = m_flushRequested;
+            stop = m_asyncStop;
+        }
+        
+        usize drained = drainAsync();
+        
+        if (requested != m_flushCompleted) {
+            {
+                std::lock_guard lock(m_sinkMutex);
+                for (auto* sink : m_sinks) {
+                    sink->flush();
+                }
+            }
+            std::lock_guard lock(m_asyncMutex);
+            m_flushCompleted = requested;
+            m_flushDone.notify_all();
+        }
+        
+        if (stop) break;
+        
+        if (drained == 0) {
+            std::unique_lock lock(m_asyncMutex);
+            m_asyncWake.wait_for(lock, m_asyncConfig.pollInterval, [this] {
+                return m_asyncStop || m_flushRequested != m_flushCompleted;
+            });
+        }
+    }
+}
+
+usize Logger::drainAsync() {
+    {
+        std::lock_guard lock(m_bufferMutex);
+        m_drainList.assign(m_buffers.begin(), m_buffers.end());
+    }
+    
+    usize drained = 0;
+    bool flushSinks = false;
+    LogMessage& msg = m_asyncMessage;
+    
+    std::lock_guard sinkLock(m_sinkMutex);
+    
+    for (const auto& buffer : m_drainList) {
+        while (const detail::LogRecordHeader* record = buffer->ring.peek()) {
+            msg.level = record->level;
+            msg.category = record->category;
+            msg.timestamp = Timestamp(std::chrono::duration_cast<Timestamp::duration>(
+                std::chrono::nanoseconds(record->timestampNs)));
+            msg.file = record->file ? record->file : "";
+            msg.line = record->line;
+            msg.function = record->function ? record->function : "";
+            msg.threadId = record->threadId;
+            
+            const auto* payload = reinterpret_cast<const std::byte*>(record + 1);
+            msg.message.clear();
+            if (record->format) {
+                // The format string was checked against the argument types at compile time
+                record->format(msg.message, std::string_view(record->fmt, record->fmtSize), payload);
+            } else {
+                msg.message.assign(reinterpret_cast<const char*>(payload), record->fmtSize);
+            }
+            
+            writeToSinks(msg);
+            flushSinks |= record->level >= LogLevel::Error;
+            buffer->ring.pop(record);
+            ++drained;
+        }
+    }
+    
+    // Report messages lost to full rings
+    if (m_asyncConfig.overflowPolicy == LogOverflowPolicy::Count) {
+        u64 dropped = getAsyncStats().dropped;
+        if (dropped > m_reportedDrops) {
+            LogMessage notice{};
+            notice.level = LogLevel::Warning;
+            notice.category = LogCategory::Core;
+            notice.timestamp = std::chrono::system_clock::now();
+            notice.message = std::format("Async logger dropped {} message(s): ring buffer full",
+                                         dropped - m_reportedDrops);
+            notice.threadId = currentThreadId();
+            writeToSinks(notice);
+            m_reportedDrops = dropped;
+        }
+    }
+    
+    if (flushSinks) {
+        for (auto* sink : m_sinks) {
+            sink->flush();
+        }
+    }
+    
+    if (drained > 0) {
+        m_processed.fetch_add(drained, std::memory_order_relaxed);
+    }
+    
+    // Forget rings of exited threads once they are empty
+    std::lock_guard lock(m_bufferMutex);
+    std::erase_if(m_buffers, [this](const std::shared_ptr<detail::LogThreadBuffer>& buffer) {
+        if (!buffer->retired.load(std::memory_order_acquire) || !buffer->ring.empty()) {
+            return false;
+        }
+        m_retiredStats.enqueued += buffer->enqueued.load(std::memory_order_relaxed);
+        m_retiredStats.dropped += buffer->dropped.load(std::memory_order_relaxed);
+        m_retiredStats.blocked += buffer->blocked.load(std::memory_order_relaxed);
+        return true;
+    });
+    
+    return drained;
+}
+
 } // namespace nova::logging
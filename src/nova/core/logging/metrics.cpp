@@ -0,0 +1,308 @@
+// =============================================================================
+// NovaCore Engine - Metrics Registry Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/logging/metrics.hpp"
+
+#include <algorithm>
+#include <cstdio>
+
+namespace nova::profiling {
+
+// =============================================================================
+// Histogram
+// =============================================================================
+
+u64 Histogram::percentile(f64 q) const noexcept {
+    std::array<u64, BUCKET_COUNT> merged{};
+    u64 total = 0;
+    for (const auto& window : m_buckets) {
+        for (u32 i = 0; i < BUCKET_COUNT; ++i) {
+            u64 n = window[i].load(std::memory_order_relaxed);
+            merged[i] += n;
+            total += n;
+        }
+    }
+    if (total == 0) {
+        return 0;
+    }
+
+    q = std::clamp(q, 0.0, 1.0);
+    u64 rank = std::max<u64>(1, static_cast<u64>(q * static_cast<f64>(total) + 0.5));
+    u64 seen = 0;
+    for (u32 i = 0; i < BUCKET_COUNT; ++i) {
+        seen += merged[i];
+        if (seen >= rank) {
+            return std::min(bucketUpperBound(i), m_max.load(std::memory_order_relaxed));
+        }
+    }
+    return m_max.load(std::memory_order_relaxed);
+}
+
+HistogramSnapshot Histogram::snapshot() const {
+    HistogramSnapshot result;
+
+    std::array<u64, BUCKET_COUNT> merged{};
+    for (const auto& window : m_buckets) {
+        for (u32 i = 0; i < BUCKET_COUNT; ++i) {
+            u64 n = window[i].load(std::memory_order_relaxed);
+            merged[i] += n;
+            result.windowCount += n;
+        }
+    }
+
+    result.count = m_count.load(std::memory_order_relaxed);
+    result.sum = m_sum.load(std::memory_order_relaxed);
+    result.max = m_max.load(std::memory_order_relaxed);
+    result.min = result.count > 0 ? m_min.load(std::memory_order_relaxed) : 0;
+
+    if (result.windowCount == 0) {
+        return result;
+    }
+
+    // One pass over the merged buckets resolves every quantile
+    const std::array<f64, 4> quantiles{0.5, 0.9, 0.99, 0.999};
+    std::array<u64*, 4> outputs{&result.p50, &result.p90, &result.p99, &result.p999};
+    usize next = 0;
+    u64 seen = 0;
+    for (u32 i = 0; i < BUCKET_COUNT && next < quantiles.size(); ++i) {
+        seen += merged[i];
+        while (next < quantiles.size()) {
+            u64 rank = std::max<u64>(1, static_cast<u64>(quantiles[next] * static_cast<f64>(result.windowCount) + 0.5));
+            if (seen < rank) {
+                break;
+            }
+            *outputs[next++] = std::min(bucketUpperBound(i), result.max);
+        }
+    }
+    return result;
+}
+
+void Histogram::rotate() noexcept {
+    // Clear the oldest window before publishing it, so writers that still
+    // hold the current index keep counting into a live window
+    u32 next = (m_window.load(std::memory_order_relaxed) + 1) % WINDOW_COUNT;
+    for (auto& bucket : m_buckets[next]) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    m_window.store(next, std::memory_order_release);
+}
+
+void Histogram::reset() noexcept {
+    for (auto& window : m_buckets) {
+        for (auto& bucket : window) {
+            bucket.store(0, std::memory_order_relaxed);
+        }
+    }
+    m_count.store(0, std::memory_order_relaxed);
+    m_sum.store(0, std::memory_order_relaxed);
+    m_min.store(~u64{0}, std::memory_order_relaxed);
+    m_max.store(0, std::memory_order_relaxed);
+}
+
+// =============================================================================
+// Snapshot Lookup
+// =============================================================================
+
+namespace {
+
+template<typename T>
+const T* findByName(const std::vector<T>& values, std::string_view name) {
+    auto it = std::lower_bound(values.begin(), values.end(), name,
+                               [](const T& v, std::string_view n) { return v.name < n; });
+    return (it != values.end() && it->name == name) ? &*it : nullptr;
+}
+
+[[nodiscard]] i64 steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// "physics.solver" -> "nova_physics_solver"
+[[nodiscard]] std::string exportName(std::string_view name) {
+    std::string out = "nova_";
+    for (char c : name) {
+        bool valid = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+        out += valid ? c : '_';
+    }
+    return out;
+}
+
+void appendNumber(std::string& out, f64 value) {
+    char buffer[32];
+    int length = std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+    out.append(buffer, static_cast<usize>(std::max(length, 0)));
+}
+
+} // namespace
+
+const MetricValue* MetricsSnapshot::findCounter(std::string_view name) const {
+    return findByName(counters, name);
+}
+
+const MetricValue* MetricsSnapshot::findGauge(std::string_view name) const {
+    return findByName(gauges, name);
+}
+
+const HistogramSnapshot* MetricsSnapshot::findHistogram(std::string_view name) const {
+    return findByName(histograms, name);
+}
+
+// =============================================================================
+// Registry
+// =============================================================================
+
+MetricsRegistry::MetricsRegistry() {
+    m_lastRotationNs.store(steadyNowNs(), std::memory_order_relaxed);
+}
+
+MetricsRegistry& MetricsRegistry::get() {
+    static MetricsRegistry registry;
+    return registry;
+}
+
+template<typename T>
+T& MetricsRegistry::findOrCreate(std::deque<Entry<T>>& entries, std::unordered_map<std::string, T*>& index,
+                                 std::string_view name, std::string_view help) {
+    std::lock_guard lock(m_mutex);
+    std::string key(name);
+    if (auto it = index.find(key); it != index.end()) {
+        return *it->second;
+    }
+    auto& entry = entries.emplace_back();
+    entry.name = key;
+    entry.help = help;
+    index.emplace(std::move(key), &entry.metric);
+    return entry.metric;
+}
+
+Counter& MetricsRegistry::counter(std::string_view name, std::string_view help) {
+    return findOrCreate(m_counters, m_counterIndex, name, help);
+}
+
+Gauge& MetricsRegistry::gauge(std::string_view name, std::string_view help) {
+    return findOrCreate(m_gauges, m_gaugeIndex, name, help);
+}
+
+Histogram& MetricsRegistry::histogram(std::string_view name, std::string_view help) {
+    return findOrCreate(m_histograms, m_histogramIndex, name, help);
+}
+
+void MetricsRegistry::tick() {
+    i64 now = steadyNowNs();
+    i64 last = m_lastRotationNs.load(std::memory_order_relaxed);
+    i64 window = m_windowNs.load(std::memory_order_relaxed);
+    if (now - last < window) {
+        return;
+    }
+    // Only one caller rotates per period
+    if (!m_lastRotationNs.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return;
+    }
+
+    std::lock_guard lock(m_mutex);
+    for (auto& entry : m_histograms) {
+        entry.metric.rotate();
+    }
+}
+
+void MetricsRegistry::setWindowDuration(std::chrono::milliseconds duration) {
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    m_windowNs.store(std::max<i64>(ns, 1), std::memory_order_relaxed);
+}
+
+std::chrono::milliseconds MetricsRegistry::windowDuration() const noexcept {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::nanoseconds(m_windowNs.load(std::memory_order_relaxed)));
+}
+
+MetricsSnapshot MetricsRegistry::snapshot() const {
+    MetricsSnapshot result;
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& entry : m_counters) {
+            result.counters.push_back({entry.name, static_cast<f64>(entry.metric.value())});
+        }
+        for (const auto& entry : m_gauges) {
+            result.gauges.push_back({entry.name, entry.metric.value()});
+        }
+        for (const auto& entry : m_histograms) {
+            result.histograms.push_back(entry.metric.snapshot());
+            result.histograms.back().name = entry.name;
+        }
+    }
+
+    auto byName = [](const auto& a, const auto& b) { return a.name < b.name; };
+    std::sort(result.counters.begin(), result.counters.end(), byName);
+    std::sort(result.gauges.begin(), result.gauges.end(), byName);
+    std::sort(result.histograms.begin(), result.histograms.end(), byName);
+    return result;
+}
+
+std::string MetricsRegistry::formatText() const {
+    MetricsSnapshot snap = snapshot();
+
+    std::unordered_map<std::string, std::string> help;
+    {
+        std::lock_guard lock(m_mutex);
+        for (const auto& entry : m_counters) help[entry.name] = entry.help;
+        for (const auto& entry : m_gauges) help[entry.name] = entry.help;
+        for (const auto& entry : m_histograms) help[entry.name] = entry.help;
+    }
+
+    std::string out;
+    auto header = [&](const std::string& name, const std::string& exported, const char* type) {
+        if (const auto& text = help[name]; !text.empty()) {
+            out += "# HELP " + exported + " " + text + "\n";
+        }
+        out += "# TYPE " + exported + " " + type + "\n";
+    };
+
+    for (const auto& value : snap.counters) {
+        std::string exported = exportName(value.name) + "_total";
+        header(value.name, exported, "counter");
+        out += exported + " ";
+        appendNumber(out, value.value);
+        out += "\n";
+    }
+
+    for (const auto& value : snap.gauges) {
+        std::string exported = exportName(value.name);
+        header(value.name, exported, "gauge");
+        out += exported + " ";
+        appendNumber(out, value.value);
+        out += "\n";
+    }
+
+    constexpr f64 NS_TO_S = 1.0e-9;
+    for (const auto& h : snap.histograms) {
+        std::string exported = exportName(h.name) + "_seconds";
+        header(h.name, exported, "summary");
+        const std::pair<const char*, u64> quantiles[] = {
+            {"0.5", h.p50}, {"0.9", h.p90}, {"0.99", h.p99}, {"0.999", h.p999}};
+        for (const auto& [q, v] : quantiles) {
+            out += exported + "{quantile=\"" + q + "\"} ";
+            appendNumber(out, static_cast<f64>(v) * NS_TO_S);
+            out += "\n";
+        }
+        out += exported + "_sum ";
+        appendNumber(out, static_cast<f64>(h.sum) * NS_TO_S);
+        out += "\n" + exported + "_count ";
+        appendNumber(out, static_cast<f64>(h.count));
+        out += "\n";
+    }
+    return out;
+}
+
+void MetricsRegistry::reset() {
+    std::lock_guard lock(m_mutex);
+    for (auto& entry : m_counters) entry.metric.reset();
+    for (auto& entry : m_gauges) entry.metric.reset();
+    for (auto& entry : m_histograms) entry.metric.reset();
+    m_lastRotationNs.store(steadyNowNs(), std::memory_order_relaxed);
+}
+
+} // namespace nova::profiling
@@ -0,0 +1,263 @@
+// =============================================================================
+// NovaCore Engine - Profiler Capture Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/logging/profiler.hpp"
+
+#include <fstream>
+#include <mutex>
+#include <ostream>
+#include <thread>
+#include <vector>
+
+namespace nova::profiling {
+
+// =============================================================================
+// Tick Calibration
+// =============================================================================
+
+f64 ticksPerSecond() noexcept {
+#if defined(__aarch64__) && !defined(_MSC_VER)
+    static const f64 s_frequency = [] {
+        u64 frequency;
+        asm volatile("mrs %0, cntfrq_el0" : "=r"(frequency));
+        return static_cast<f64>(frequency);
+    }();
+    return s_frequency;
+#elif defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    // Measure the TSC against the steady clock once
+    static const f64 s_frequency = [] {
+        using Clock = std::chrono::steady_clock;
+        auto clockStart = Clock::now();
+        u64 tickStart = ticks();
+        while (Clock::now() - clockStart < std::chrono::milliseconds(5)) {
+        }
+        u64 tickEnd = ticks();
+        f64 seconds = std::chrono::duration<f64>(Clock::now() - clockStart).count();
+        return static_cast<f64>(tickEnd - tickStart) / seconds;
+    }();
+    return s_frequency;
+#else
+    return 1e9;  // ticks() is the steady clock in nanoseconds
+#endif
+}
+
+// =============================================================================
+// Capture State
+// =============================================================================
+
+namespace {
+
+struct CaptureState {
+    std::mutex mutex;
+    ProfilerConfig config;
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> buffers;
+    std::vector<std::string> threadNames;               ///< By thread index
+    std::atomic<u64> frames{0};
+    u64 startTicks = 0;
+};
+
+CaptureState& captureState() {
+    static CaptureState s_state;
+    return s_state;
+}
+
+/// Keeps the calling thread's buffer alive; the hot path uses the raw pointer
+struct ThreadSlot {
+    std::shared_ptr<ProfileThreadBuffer> buffer;
+    std::string name;
+};
+
+thread_local ThreadSlot t_slot;
+
+void writeJsonString(std::ostream& out, std::string_view text) {
+    out << '"';
+    for (char c : text) {
+        switch (c) {
+            case '"':  out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    constexpr char hex[] = "0123456789abcdef";
+                    out << "\\u00" << hex[(c >> 4) & 0xF] << hex[c & 0xF];
+                } else {
+                    out << c;
+                }
+        }
+    }
+    out << '"';
+}
+
+} // anonymous namespace
+
+ProfileThreadBuffer* detail::registerProfilerThread() noexcept {
+    CaptureState& state = captureState();
+    ThreadSlot& slot = t_slot;
+    
+    // First event of this thread in the current capture
+    std::lock_guard lock(state.mutex);
+    auto index = static_cast<u32>(state.buffers.size());
+    slot.buffer = std::make_shared<ProfileThreadBuffer>(state.config.maxEventsPerThread, index);
+    state.buffers.push_back(slot.buffer);
+    state.threadNames.push_back(slot.name);
+    t_profilerBuffer = slot.buffer.get();
+    t_profilerGeneration = g_profilerGeneration.load(std::memory_order_relaxed);
+    return t_profilerBuffer;
+}
+
+// =============================================================================
+// Profiler
+// =============================================================================
+
+Profiler& Profiler::instance() noexcept {
+    static Profiler s_instance;
+    return s_instance;
+}
+
+void Profiler::startCapture(const ProfilerConfig& config) {
+    CaptureState& state = captureState();
+    std::lock_guard lock(state.mutex);
+    
+    detail::g_profilerCapturing.store(false, std::memory_order_relaxed);
+    
+    // Threads still holding old buffers re-register on their next event
+    state.buffers.clear();
+    state.threadNames.clear();
+    state.config = config;
+    state.frames.store(0, std::memory_order_relaxed);
+    state.startTicks = ticks();
+    detail::g_profilerGeneration.fetch_add(1, std::memory_order_release);
+    
+    detail::g_profilerCapturing.store(true, std::memory_order_release);
+}
+
+void Profiler::stopCapture() {
+    detail::g_profilerCapturing.store(false, std::memory_order_release);
+}
+
+void Profiler::frameMark(std::string_view name) noexcept {
+    if (!isCapturing()) return;
+    ProfileEvent event{name.data(), static_cast<u32>(name.size()), ProfileEventType::FrameMark, {}, ticks(), {}};
+    event.frame = captureState().frames.fetch_add(1, std::memory_order_relaxed);
+    record(event);
+}
+
+void Profiler::setThreadName(std::string_view name) {
+    ThreadSlot& slot = t_slot;
+    slot.name = std::string(name);
+    
+    CaptureState& state = captureState();
+    std::lock_guard lock(state.mutex);
+    if (slot.buffer && detail::t_profilerGeneration == detail::g_profilerGeneration.load(std::memory_order_relaxed)) {
+        state.threadNames[slot.buffer->threadIndex()] = slot.name;
+    }
+}
+
+ProfilerStats Profiler::getStats() const {
+    CaptureState& state = captureState();
+    std::lock_guard lock(state.mutex);
+    
+    ProfilerStats stats;
+    for (const auto& buffer : state.buffers) {
+        stats.events += buffer->size();
+        stats.dropped += buffer->dropped();
+    }
+    stats.frames = state.frames.load(std::memory_order_relaxed);
+    stats.threads = static_cast<u32>(state.buffers.size());
+    return stats;
+}
+
+void Profiler::exportChromeTrace(std::ostream& out) const {
+    CaptureState& state = captureState();
+    
+    std::vector<std::shared_ptr<ProfileThreadBuffer>> buffers;
+    std::vector<std::string> names;
+    u64 startTicks = 0;
+    {
+        std::lock_guard lock(state.mutex);
+        buffers = state.buffers;
+        names = state.threadNames;
+        startTicks = state.startTicks;
+    }
+    
+    const f64 usPerTick = 1e6 / ticksPerSecond();
+    auto toUs = [&](u64 t) {
+        return static_cast<f64>(static_cast<i64>(t - startTicks)) * usPerTick;
+    };
+    
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    auto beginEvent = [&] {
+        if (!first) out << ",";
+        first = false;
+        out << "\n{";
+    };
+    
+    out.precision(3);
+    out << std::fixed;
+    
+    for (const auto& buffer : buffers) {
+        const u32 tid = buffer->threadIndex();
+        
+        beginEvent();
+        out << "\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid << ",\"args\":{\"name\":";
+        writeJsonString(out, names[tid].empty() ? "Thread " + std::to_string(tid) : names[tid]);
+        out << "}}";
+        
+        buffer->forEach([&](const ProfileEvent& event) {
+            std::string_view name(event.name, event.nameLength);
+            beginEvent();
+            out << "\"name\":";
+            writeJsonString(out, name);
+            out << ",\"pid\":1,\"tid\":" << tid << ",\"ts\":" << toUs(event.start);
+            
+            switch (event.type) {
+                case ProfileEventType::Zone: {
+                    char color[8];
+                    constexpr char hex[] = "0123456789abcdef";
+                    color[0] = '#';
+                    color[1] = hex[event.color.r >> 4]; color[2] = hex[event.color.r & 0xF];
+                    color[3] = hex[event.color.g >> 4]; color[4] = hex[event.color.g & 0xF];
+                    color[5] = hex[event.color.b >> 4]; color[6] = hex[event.color.b & 0xF];
+                    color[7] = '\0';
+                    out << ",\"ph\":\"X\",\"cat\":\"zone\",\"dur\":"
+                        << static_cast<f64>(event.end - event.start) * usPerTick
+                        << ",\"args\":{\"color\":\"" << color << "\"}}";
+                    break;
+                }
+                case ProfileEventType::Counter:
+                    out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.counter << "}}";
+                    break;
+                case ProfileEventType::Plot:
+                    out << ",\"ph\":\"C\",\"args\":{\"value\":" << event.plot << "}}";
+                    break;
+                case ProfileEventType::FrameMark:
+                    out << ",\"ph\":\"i\",\"s\":\"g\",\"args\":{\"frame\":" << event.frame << "}}";
+                    break;
+            }
+        });
+    }
+    
+    out << "\n]}\n";
+}
+
+Result<void> Profiler::exportChromeTrace(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        return std::unexpected(errors::io("Cannot open trace file: " + path));
+    }
+    
+    exportChromeTrace(file);
+    file.flush();
+    if (!file) {
+        return std::unexpected(errors::io("Failed to write trace file: " + path));
+    }
+    return {};
+}
+
+} // namespace nova::profiling
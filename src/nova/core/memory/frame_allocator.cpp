@@ -0,0 +1,219 @@
+// =============================================================================
+// NovaCore Engine - Frame Allocator Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/memory/frame_allocator.hpp"
+#include "nova/core/memory/memory.hpp"
+
+#include <memory>
+#include <mutex>
+
+namespace nova::memory {
+
+namespace {
+
+/// Spilled blocks per slot that fit without growing its list
+constexpr usize INITIAL_OVERFLOW_CAPACITY = 64;
+
+} // namespace
+
+// =============================================================================
+// FrameAllocator
+// =============================================================================
+
+FrameAllocator::FrameAllocator(usize capacityPerFrame, u32 framesInFlight, const char* name)
+    : m_capacityPerFrame(alignUp(capacityPerFrame, CACHE_LINE_SIZE))
+    , m_name(name)
+{
+    framesInFlight = std::clamp(framesInFlight, 1u, MAX_FRAMES_IN_FLIGHT);
+    m_buffer = static_cast<u8*>(alignedAlloc(m_capacityPerFrame * framesInFlight, CACHE_LINE_SIZE));
+    if (!m_buffer) {
+        // Without a ring every allocation spills to the general allocator
+        m_capacityPerFrame = 0;
+    }
+
+    for (u32 i = 0; i < framesInFlight; ++i) {
+        m_slots.emplace_back(m_buffer + i * m_capacityPerFrame, m_capacityPerFrame, name);
+        m_slots.back().overflow.reserve(INITIAL_OVERFLOW_CAPACITY);
+    }
+    m_slot = &m_slots.front();
+}
+
+FrameAllocator::~FrameAllocator() {
+    for (auto& slot : m_slots) {
+        releaseOverflow(slot, 0);
+    }
+    alignedFree(m_buffer);
+}
+
+void FrameAllocator::beginFrame(u64 frame) noexcept {
+    if (frame == m_current.frame) {
+        return;
+    }
+
+    m_lastFrame.store(m_current.frame, std::memory_order_relaxed);
+    m_lastPeakBytes.store(m_current.peakBytes, std::memory_order_relaxed);
+    m_lastOverflowBytes.store(m_current.overflowBytes, std::memory_order_relaxed);
+    m_lastAllocationCount.store(m_current.allocationCount, std::memory_order_relaxed);
+    if (m_current.peakBytes > m_maxPeakBytes.load(std::memory_order_relaxed)) {
+        m_maxPeakBytes.store(m_current.peakBytes, std::memory_order_relaxed);
+    }
+
+    // The slot's previous contents belong to a frame at least framesInFlight ago
+    m_slot = &m_slots[frame % m_slots.size()];
+    m_slot->linear.reset();
+    releaseOverflow(*m_slot, 0);
+
+    m_current = {};
+    m_current.frame = frame;
+}
+
+void FrameAllocator::resetToMarker(const Marker& marker) noexcept {
+    if (marker.frame != m_current.frame) {
+        return;
+    }
+    m_slot->linear.resetToMarker(marker.offset);
+    releaseOverflow(*m_slot, marker.overflowCount);
+}
+
+void* FrameAllocator::allocateOverflow(usize size, usize alignment) noexcept {
+    void* ptr = generalAllocator().allocate(size, alignment);
+    if (!ptr) {
+        return nullptr;
+    }
+    m_slot->overflow.push_back(ptr);
+
+    m_current.allocationCount++;
+    m_current.overflowBytes += size;
+    m_totalOverflowCount++;
+    return ptr;
+}
+
+void FrameAllocator::releaseOverflow(Slot& slot, usize keep) noexcept {
+    while (slot.overflow.size() > keep) {
+        generalAllocator().deallocate(slot.overflow.back());
+        slot.overflow.pop_back();
+    }
+}
+
+FrameMemoryStats FrameAllocator::getLastFrameStats() const noexcept {
+    FrameMemoryStats stats;
+    stats.frame = m_lastFrame.load(std::memory_order_relaxed);
+    stats.peakBytes = m_lastPeakBytes.load(std::memory_order_relaxed);
+    stats.overflowBytes = m_lastOverflowBytes.load(std::memory_order_relaxed);
+    stats.allocationCount = m_lastAllocationCount.load(std::memory_order_relaxed);
+    return stats;
+}
+
+AllocationStats FrameAllocator::getStats() const noexcept {
+    AllocationStats stats{};
+    for (const auto& slot : m_slots) {
+        AllocationStats slotStats = slot.linear.getStats();
+        stats.totalAllocated += slotStats.totalAllocated;
+        stats.totalFreed += slotStats.totalFreed;
+        stats.allocationCount += slotStats.allocationCount + slot.overflow.size();
+        stats.totalAllocationCount += slotStats.totalAllocationCount;
+        stats.totalFreeCount += slotStats.totalFreeCount;
+    }
+    stats.totalAllocationCount += m_totalOverflowCount;
+    stats.peakAllocated = std::max(getMaxFramePeak(), m_current.peakBytes);
+    return stats;
+}
+
+// =============================================================================
+// FrameMemory
+// =============================================================================
+
+namespace {
+
+struct FrameMemoryState {
+    std::atomic<u64> frame{0};
+    std::atomic<usize> capacityPerFrame{FrameMemory::DEFAULT_CAPACITY_PER_FRAME};
+    std::atomic<u32> framesInFlight{FrameAllocator::DEFAULT_FRAMES_IN_FLIGHT};
+
+    std::mutex mutex;                       ///< Guards threadAllocators
+    std::vector<FrameAllocator*> threadAllocators;
+};
+
+FrameMemoryState& frameMemoryState() {
+    // Leaked: threads may exit after static destruction
+    static auto* state = new FrameMemoryState();
+    return *state;
+}
+
+/// Owns the calling thread's ring and unregisters it at thread exit
+struct ThreadFrameAllocator {
+    std::unique_ptr<FrameAllocator> allocator;
+
+    ~ThreadFrameAllocator() {
+        if (!allocator) {
+            return;
+        }
+        auto& state = frameMemoryState();
+        std::lock_guard lock(state.mutex);
+        std::erase(state.threadAllocators, allocator.get());
+    }
+};
+
+thread_local ThreadFrameAllocator t_frameAllocator;
+
+} // namespace
+
+void FrameMemory::configure(usize capacityPerFrame, u32 framesInFlight) noexcept {
+    auto& state = frameMemoryState();
+    state.capacityPerFrame.store(capacityPerFrame, std::memory_order_relaxed);
+    state.framesInFlight.store(framesInFlight, std::memory_order_relaxed);
+}
+
+void FrameMemory::endFrame() noexcept {
+    frameMemoryState().frame.fetch_add(1, std::memory_order_release);
+}
+
+u64 FrameMemory::getFrame() noexcept {
+    return frameMemoryState().frame.load(std::memory_order_acquire);
+}
+
+FrameAllocator& FrameMemory::threadAllocator() {
+    auto& state = frameMemoryState();
+    auto& local = t_frameAllocator;
+    if (!local.allocator) {
+        auto allocator = std::make_unique<FrameAllocator>(state.capacityPerFrame.load(std::memory_order_relaxed),
+                                                          state.framesInFlight.load(std::memory_order_relaxed),
+                                                          "ThreadFrameAllocator");
+        std::lock_guard lock(state.mutex);
+        state.threadAllocators.push_back(allocator.get());
+        local.allocator = std::move(allocator);
+    }
+
+    local.allocator->beginFrame(getFrame());
+    return *local.allocator;
+}
+
+FrameMemoryStats FrameMemory::getLastFrameStats() {
+    auto& state = frameMemoryState();
+    FrameMemoryStats total;
+    std::lock_guard lock(state.mutex);
+    for (const FrameAllocator* allocator : state.threadAllocators) {
+        FrameMemoryStats stats = allocator->getLastFrameStats();
+        total.frame = std::max(total.frame, stats.frame);
+        total.peakBytes += stats.peakBytes;
+        total.overflowBytes += stats.overflowBytes;
+        total.allocationCount += stats.allocationCount;
+    }
+    return total;
+}
+
+usize FrameMemory::getMaxFramePeak() {
+    auto& state = frameMemoryState();
+    usize peak = 0;
+    std::lock_guard lock(state.mutex);
+    for (const FrameAllocator* allocator : state.threadAllocators) {
+        peak = std::max(peak, allocator->getMaxFramePeak());
+    }
+    return peak;
+}
+
+} // namespace nova::memory
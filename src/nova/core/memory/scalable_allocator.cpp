@@ -0,0 +1,619 @@
+// =============================================================================
+// NovaCore Engine - Scalable Allocator Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/memory/scalable_allocator.hpp"
+#include "nova/core/memory/memory.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace nova::memory {
+
+namespace {
+
+/// Classes below this size are spaced 16 bytes apart, then 4 per doubling
+constexpr usize LINEAR_CLASS_LIMIT = 128;
+constexpr u32 LINEAR_CLASS_COUNT = 8;
+
+[[nodiscard]] constexpr std::array<usize, ScalableAllocator::SIZE_CLASS_COUNT> makeSizeClasses() noexcept {
+    std::array<usize, ScalableAllocator::SIZE_CLASS_COUNT> sizes{};
+    u32 index = 0;
+    for (u32 i = 1; i <= LINEAR_CLASS_COUNT; ++i) {
+        sizes[index++] = i * 16;
+    }
+    for (u32 k = 7; index < sizes.size(); ++k) {
+        for (u32 j = 1; j <= 4; ++j) {
+            sizes[index++] = (usize{1} << k) + j * (usize{1} << (k - 2));
+        }
+    }
+    return sizes;
+}
+
+constexpr auto SIZE_CLASSES = makeSizeClasses();
+static_assert(SIZE_CLASSES[LINEAR_CLASS_COUNT - 1] == LINEAR_CLASS_LIMIT);
+static_assert(SIZE_CLASSES.back() == ScalableAllocator::MAX_SMALL_SIZE);
+
+enum class PageKind : u8 {
+    Small,
+    Large
+};
+
+/// Intrusive link stored in a free block
+struct FreeBlock {
+    FreeBlock* next;
+};
+
+[[nodiscard]] constexpr usize alignUp(usize value, usize alignment) noexcept {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+/// Counters are written only by the heap's owning thread; getStats() reads
+/// them from other threads, hence atomics without read-modify-write.
+void addRelaxed(std::atomic<u64>& counter, u64 amount) noexcept {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+}
+
+/// Live allocators by id, so exiting threads never touch a destroyed one
+struct AllocatorRegistry {
+    std::mutex mutex;
+    std::unordered_map<u64, ScalableAllocator*> live;
+    u64 nextId = 1;
+};
+
+AllocatorRegistry& registry() {
+    // Leaked: thread-exit handlers may run after static destruction
+    static auto* instance = new AllocatorRegistry();
+    return *instance;
+}
+
+} // namespace
+
+// =============================================================================
+// Pages and Heaps
+// =============================================================================
+
+/// Header at the start of every page and large block
+struct ScalableAllocator::Page {
+    PageKind kind = PageKind::Small;
+    u32 sizeClass = 0;
+    usize blockSize = 0;                    ///< Class size, or the large request size
+    usize dataOffset = 0;                   ///< First block from the page base
+    usize reservedSize = 0;                 ///< Bytes taken from the system
+    Heap* heap = nullptr;                   ///< Owning heap (null for large blocks)
+    FreeBlock* localFree = nullptr;         ///< Owner-only free list
+    std::atomic<FreeBlock*> remoteFree{nullptr};
+    u32 used = 0;                           ///< Blocks handed out (excluding remote frees not yet drained)
+    u32 capacity = 0;
+    u32 bumped = 0;                         ///< Blocks carved so far
+    u32 queueIndex = 0;                     ///< Position in the heap's class queue
+};
+
+/// Per-thread state; only its owning thread touches the queues
+struct ScalableAllocator::Heap {
+    struct ClassQueue {
+        std::vector<Page*> pages;
+        Page* current = nullptr;
+        usize cursor = 0;                   ///< Where the next search for free space starts
+    };
+
+    std::array<ClassQueue, SIZE_CLASS_COUNT> classes;
+    std::array<std::atomic<u64>, SIZE_CLASS_COUNT> allocs{};
+    std::array<std::atomic<u64>, SIZE_CLASS_COUNT> frees{};
+    std::atomic<u64> largeAllocs{0};
+    std::atomic<u64> largeFrees{0};
+    std::atomic<u64> largeAllocatedBytes{0};
+    std::atomic<u64> largeFreedBytes{0};
+};
+
+/// Thread-local map of allocator id -> heap
+struct ThreadHeapCache {
+    std::vector<std::pair<u64, ScalableAllocator::Heap*>> heaps;
+    u64 lastId = 0;
+    ScalableAllocator::Heap* lastHeap = nullptr;
+
+    ~ThreadHeapCache();
+};
+
+namespace {
+
+thread_local ThreadHeapCache t_heapCache;
+
+/// Set once the cache is destroyed; later calls on this thread bypass it
+thread_local bool t_heapCacheDestroyed = false;
+
+} // namespace
+
+ThreadHeapCache::~ThreadHeapCache() {
+    t_heapCacheDestroyed = true;
+    for (auto& [id, heap] : heaps) {
+        ScalableAllocator::abandonHeap(id, heap);
+    }
+}
+
+// =============================================================================
+// Construction
+// =============================================================================
+
+ScalableAllocator::ScalableAllocator(const char* name)
+    : m_name(name) {
+    m_freePages.reserve(MAX_CACHED_PAGES);
+
+    auto& reg = registry();
+    std::lock_guard lock(reg.mutex);
+    m_id = reg.nextId++;
+    reg.live.emplace(m_id, this);
+}
+
+ScalableAllocator::~ScalableAllocator() {
+    {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        reg.live.erase(m_id);
+    }
+
+    std::lock_guard lock(m_mutex);
+    for (uintptr_t block : m_blocks) {
+        alignedFree(reinterpret_cast<void*>(block));
+    }
+    for (Heap* heap : m_heaps) {
+        delete heap;
+    }
+}
+
+ScalableAllocator& generalAllocator() noexcept {
+    // Leaked so blocks freed during static destruction stay valid
+    static auto* instance = new ScalableAllocator("GeneralAllocator");
+    return *instance;
+}
+
+// =============================================================================
+// Thread Heaps
+// =============================================================================
+
+ScalableAllocator::Heap* ScalableAllocator::threadHeap() noexcept {
+    if (t_heapCacheDestroyed) {
+        return nullptr;
+    }
+
+    auto& cache = t_heapCache;
+    if (cache.lastId == m_id) {
+        return cache.lastHeap;
+    }
+    for (auto& [id, heap] : cache.heaps) {
+        if (id == m_id) {
+            cache.lastId = id;
+            cache.lastHeap = heap;
+            return heap;
+        }
+    }
+
+    Heap* heap = createHeap();
+    if (heap == nullptr) {
+        return nullptr;
+    }
+    cache.heaps.emplace_back(m_id, heap);
+    cache.lastId = m_id;
+    cache.lastHeap = heap;
+    return heap;
+}
+
+ScalableAllocator::Heap* ScalableAllocator::createHeap() noexcept {
+    std::lock_guard lock(m_mutex);
+    if (!m_abandonedHeaps.empty()) {
+        Heap* heap = m_abandonedHeaps.back();
+        m_abandonedHeaps.pop_back();
+        return heap;
+    }
+
+    auto* heap = new (std::nothrow) Heap();
+    if (heap == nullptr) {
+        return nullptr;
+    }
+    // Room for every heap to be abandoned, so thread exit never grows the list
+    m_abandonedHeaps.reserve(m_heaps.size() + 1);
+    m_heaps.push_back(heap);
+    return heap;
+}
+
+void ScalableAllocator::abandonHeap(u64 allocatorId, Heap* heap) noexcept {
+    auto& reg = registry();
+    std::lock_guard registryLock(reg.mutex);
+    auto it = reg.live.find(allocatorId);
+    if (it == reg.live.end()) {
+        return;
+    }
+
+    // Capacity was reserved in createHeap(), so this cannot throw
+    ScalableAllocator& allocator = *it->second;
+    std::lock_guard lock(allocator.m_mutex);
+    allocator.m_abandonedHeaps.push_back(heap);
+}
+
+usize ScalableAllocator::getHeapCount() const noexcept {
+    std::lock_guard lock(m_mutex);
+    return m_heaps.size();
+}
+
+// =============================================================================
+// Size Classes
+// =============================================================================
+
+usize ScalableAllocator::getSizeClassSize(u32 sizeClass) noexcept {
+    return sizeClass < SIZE_CLASS_COUNT ? SIZE_CLASSES[sizeClass] : 0;
+}
+
+u32 ScalableAllocator::getSizeClass(usize size) noexcept {
+    if (size <= LINEAR_CLASS_LIMIT) {
+        return size == 0 ? 0 : static_cast<u32>((size + 15) / 16 - 1);
+    }
+    if (size > MAX_SMALL_SIZE) {
+        return SIZE_CLASS_COUNT;
+    }
+
+    // Four classes between 2^k (exclusive) and 2^(k+1) (inclusive)
+    auto k = static_cast<u32>(std::bit_width(size - 1) - 1);
+    usize step = usize{1} << (k - 2);
+    usize slot = (size - (usize{1} << k) + step - 1) / step;
+    return LINEAR_CLASS_COUNT + (k - 7) * 4 + static_cast<u32>(slot) - 1;
+}
+
+// =============================================================================
+// Allocation
+// =============================================================================
+
+ScalableAllocator::Page* ScalableAllocator::pageOf(const void* ptr) noexcept {
+    return reinterpret_cast<Page*>(reinterpret_cast<uintptr_t>(ptr) & ~(PAGE_SIZE - 1));
+}
+
+void* ScalableAllocator::popBlock(Page& page) noexcept {
+    if (page.localFree == nullptr) {
+        // Take everything other threads have freed in one exchange
+        FreeBlock* remote = page.remoteFree.exchange(nullptr, std::memory_order_acquire);
+        if (remote != nullptr) {
+            u32 count = 0;
+            for (FreeBlock* block = remote; block; block = block->next) {
+                ++count;
+            }
+            page.used -= count;
+            page.localFree = remote;
+        }
+    }
+
+    if (FreeBlock* block = page.localFree) {
+        page.localFree = block->next;
+        ++page.used;
+        return block;
+    }
+
+    if (page.bumped < page.capacity) {
+        auto* base = reinterpret_cast<u8*>(&page);
+        void* block = base + page.dataOffset + static_cast<usize>(page.bumped) * page.blockSize;
+        ++page.bumped;
+        ++page.used;
+        return block;
+    }
+    return nullptr;
+}
+
+void* ScalableAllocator::allocate(usize size, usize alignment) noexcept {
+    if (alignment == 0) {
+        alignment = DEFAULT_ALIGNMENT;
+    }
+    if (!std::has_single_bit(alignment)) {
+        return nullptr;
+    }
+
+    Heap* heap = threadHeap();
+    if (heap != nullptr && size <= MAX_SMALL_SIZE && alignment <= MAX_SMALL_ALIGNMENT) {
+        // Blocks sit at multiples of their size from an aligned page offset,
+        // so step up to the first class the alignment divides
+        u32 sizeClass = getSizeClass(size);
+        while (sizeClass < SIZE_CLASS_COUNT && SIZE_CLASSES[sizeClass] % alignment != 0) {
+            ++sizeClass;
+        }
+        if (sizeClass < SIZE_CLASS_COUNT) {
+            return allocateSmall(*heap, sizeClass);
+        }
+    }
+    return allocateLarge(heap, size, alignment);
+}
+
+void* ScalableAllocator::allocateSmall(Heap& heap, u32 sizeClass) noexcept {
+    auto& queue = heap.classes[sizeClass];
+    void* block = queue.current ? popBlock(*queue.current) : nullptr;
+    if (block == nullptr) {
+        Page* page = findPage(heap, sizeClass);
+        if (page == nullptr) {
+            return nullptr;
+        }
+        queue.current = page;
+        block = popBlock(*page);
+    }
+
+    addRelaxed(heap.allocs[sizeClass], 1);
+    return block;
+}
+
+ScalableAllocator::Page* ScalableAllocator::findPage(Heap& heap, u32 sizeClass) noexcept {
+    auto& queue = heap.classes[sizeClass];
+    usize count = queue.pages.size();
+    for (usize i = 0; i < count; ++i) {
+        usize index = (queue.cursor + i) % count;
+        Page* page = queue.pages[index];
+        if (page == queue.current) {
+            continue;
+        }
+        if (page->localFree || page->bumped < page->capacity ||
+            page->remoteFree.load(std::memory_order_relaxed)) {
+            queue.cursor = index;
+            return page;
+        }
+    }
+    return acquirePage(heap, sizeClass);
+}
+
+ScalableAllocator::Page* ScalableAllocator::acquirePage(Heap& heap, u32 sizeClass) noexcept {
+    auto& queue = heap.classes[sizeClass];
+
+    void* memory = nullptr;
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_freePages.empty()) {
+            memory = m_freePages.back();
+            m_freePages.pop_back();
+        }
+    }
+    if (memory == nullptr) {
+        memory = alignedAlloc(PAGE_SIZE, PAGE_SIZE);
+        if (memory == nullptr) {
+            return nullptr;
+        }
+
+        std::lock_guard lock(m_mutex);
+        m_blocks.insert(reinterpret_cast<uintptr_t>(memory));
+        m_reservedBytes += PAGE_SIZE;
+        m_peakReservedBytes = std::max(m_peakReservedBytes, m_reservedBytes);
+    }
+
+    usize blockSize = SIZE_CLASSES[sizeClass];
+    usize dataAlignment = std::min(usize{1} << std::countr_zero(blockSize), MAX_SMALL_ALIGNMENT);
+
+    auto* page = new (memory) Page();
+    page->kind = PageKind::Small;
+    page->sizeClass = sizeClass;
+    page->blockSize = blockSize;
+    page->dataOffset = alignUp(sizeof(Page), dataAlignment);
+    page->reservedSize = PAGE_SIZE;
+    page->heap = &heap;
+    page->capacity = static_cast<u32>((PAGE_SIZE - page->dataOffset) / blockSize);
+    page->queueIndex = static_cast<u32>(queue.pages.size());
+    queue.pages.push_back(page);
+
+    std::lock_guard lock(m_mutex);
+    m_classPages[sizeClass] += 1;
+    m_classPeakPages[sizeClass] = std::max(m_classPeakPages[sizeClass], m_classPages[sizeClass]);
+    return page;
+}
+
+void* ScalableAllocator::allocateLarge(Heap* heap, usize size, usize alignment) noexcept {
+    usize offset = alignUp(sizeof(Page), std::max(alignment, DEFAULT_ALIGNMENT));
+    if (offset >= PAGE_SIZE || size > std::numeric_limits<usize>::max() - offset) {
+        return nullptr;
+    }
+
+    // Page-aligned so pageOf() finds the header from the returned pointer
+    usize total = offset + std::max<usize>(size, 1);
+    void* memory = alignedAlloc(total, PAGE_SIZE);
+    if (memory == nullptr) {
+        return nullptr;
+    }
+
+    auto* page = new (memory) Page();
+    page->kind = PageKind::Large;
+    page->blockSize = size;
+    page->dataOffset = offset;
+    page->reservedSize = total;
+
+    {
+        std::lock_guard lock(m_mutex);
+        m_blocks.insert(reinterpret_cast<uintptr_t>(memory));
+        m_reservedBytes += total;
+        m_peakReservedBytes = std::max(m_peakReservedBytes, m_reservedBytes);
+    }
+
+    if (heap != nullptr) {
+        addRelaxed(heap->largeAllocs, 1);
+        addRelaxed(heap->largeAllocatedBytes, size);
+    }
+    return static_cast<u8*>(memory) + offset;
+}
+
+// =============================================================================
+// Deallocation
+// =============================================================================
+
+void ScalableAllocator::deallocate(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+
+    Page* page = pageOf(ptr);
+    Heap* heap = threadHeap();
+
+    if (page->kind == PageKind::Large) {
+        if (heap != nullptr) {
+            addRelaxed(heap->largeFrees, 1);
+            addRelaxed(heap->largeFreedBytes, page->blockSize);
+        }
+        releaseLarge(page);
+        return;
+    }
+
+    u32 sizeClass = page->sizeClass;
+    if (heap != nullptr) {
+        addRelaxed(heap->frees[sizeClass], 1);
+    }
+
+    auto* block = static_cast<FreeBlock*>(ptr);
+    if (page->heap == heap) {
+        block->next = page->localFree;
+        page->localFree = block;
+        if (--page->used == 0 && page != heap->classes[sizeClass].current) {
+            retirePage(*heap, page);
+        }
+        return;
+    }
+
+    // Another thread's page: the owner drains this queue in popBlock()
+    FreeBlock* head = page->remoteFree.load(std::memory_order_relaxed);
+    do {
+        block->next = head;
+    } while (!page->remoteFree.compare_exchange_weak(head, block, std::memory_order_release,
+                                                     std::memory_order_relaxed));
+}
+
+void ScalableAllocator::retirePage(Heap& heap, Page* page) noexcept {
+    auto& queue = heap.classes[page->sizeClass];
+    Page* last = queue.pages.back();
+    queue.pages[page->queueIndex] = last;
+    last->queueIndex = page->queueIndex;
+    queue.pages.pop_back();
+    if (queue.cursor >= queue.pages.size()) {
+        queue.cursor = 0;
+    }
+
+    bool release = false;
+    {
+        std::lock_guard lock(m_mutex);
+        m_classPages[page->sizeClass] -= 1;
+        if (m_freePages.size() < MAX_CACHED_PAGES) {
+            m_freePages.push_back(page);
+        } else {
+            m_blocks.erase(reinterpret_cast<uintptr_t>(page));
+            m_reservedBytes -= PAGE_SIZE;
+            release = true;
+        }
+    }
+    if (release) {
+        alignedFree(page);
+    }
+}
+
+void ScalableAllocator::releaseLarge(Page* page) noexcept {
+    {
+        std::lock_guard lock(m_mutex);
+        m_blocks.erase(reinterpret_cast<uintptr_t>(page));
+        m_reservedBytes -= page->reservedSize;
+    }
+    alignedFree(page);
+}
+
+void* ScalableAllocator::reallocate(void* ptr, usize newSize, usize alignment) noexcept {
+    if (ptr == nullptr) {
+        return allocate(newSize, alignment);
+    }
+    if (newSize == 0) {
+        deallocate(ptr);
+        return nullptr;
+    }
+
+    // Keep the block if it fits and would not waste more than half of it
+    usize oldSize = usableSize(ptr);
+    bool aligned = alignment == 0 || reinterpret_cast<uintptr_t>(ptr) % alignment == 0;
+    if (aligned && newSize <= oldSize && newSize > oldSize / 2) {
+        return ptr;
+    }
+
+    void* newPtr = allocate(newSize, alignment);
+    if (newPtr != nullptr) {
+        std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+        deallocate(ptr);
+    }
+    return newPtr;
+}
+
+// =============================================================================
+// Queries
+// =============================================================================
+
+usize ScalableAllocator::usableSize(const void* ptr) const noexcept {
+    return ptr ? pageOf(ptr)->blockSize : 0;
+}
+
+bool ScalableAllocator::owns(const void* ptr) const noexcept {
+    if (ptr == nullptr) {
+        return false;
+    }
+    std::lock_guard lock(m_mutex);
+    return m_blocks.contains(reinterpret_cast<uintptr_t>(pageOf(ptr)));
+}
+
+usize ScalableAllocator::getAllocatedSize() const noexcept {
+    return getStats().totalAllocated;
+}
+
+AllocationStats ScalableAllocator::getStats() const noexcept {
+    AllocationStats stats{};
+    std::lock_guard lock(m_mutex);
+
+    u64 allocs = 0;
+    u64 frees = 0;
+    u64 allocatedBytes = 0;
+    u64 freedBytes = 0;
+    for (const Heap* heap : m_heaps) {
+        for (u32 c = 0; c < SIZE_CLASS_COUNT; ++c) {
+            u64 a = heap->allocs[c].load(std::memory_order_relaxed);
+            u64 f = heap->frees[c].load(std::memory_order_relaxed);
+            allocs += a;
+            frees += f;
+            allocatedBytes += a * SIZE_CLASSES[c];
+            freedBytes += f * SIZE_CLASSES[c];
+        }
+        allocs += heap->largeAllocs.load(std::memory_order_relaxed);
+        frees += heap->largeFrees.load(std::memory_order_relaxed);
+        allocatedBytes += heap->largeAllocatedBytes.load(std::memory_order_relaxed);
+        freedBytes += heap->largeFreedBytes.load(std::memory_order_relaxed);
+    }
+
+    // Counters of different threads are read at slightly different times
+    stats.totalAllocated = allocatedBytes > freedBytes ? allocatedBytes - freedBytes : 0;
+    stats.totalFreed = freedBytes;
+    stats.peakAllocated = m_peakReservedBytes;
+    stats.allocationCount = allocs > frees ? allocs - frees : 0;
+    stats.totalAllocationCount = allocs;
+    stats.totalFreeCount = frees;
+    return stats;
+}
+
+AllocationStats ScalableAllocator::getSizeClassStats(u32 sizeClass) const noexcept {
+    AllocationStats stats{};
+    if (sizeClass >= SIZE_CLASS_COUNT) {
+        return stats;
+    }
+
+    std::lock_guard lock(m_mutex);
+    u64 allocs = 0;
+    u64 frees = 0;
+    for (const Heap* heap : m_heaps) {
+        allocs += heap->allocs[sizeClass].load(std::memory_order_relaxed);
+        frees += heap->frees[sizeClass].load(std::memory_order_relaxed);
+    }
+
+    usize blockSize = SIZE_CLASSES[sizeClass];
+    stats.allocationCount = allocs > frees ? allocs - frees : 0;
+    stats.totalAllocationCount = allocs;
+    stats.totalFreeCount = frees;
+    stats.totalAllocated = stats.allocationCount * blockSize;
+    stats.totalFreed = frees * blockSize;
+    stats.peakAllocated = m_classPeakPages[sizeClass] * PAGE_SIZE;
+    return stats;
+}
+
+} // namespace nova::memory
@@ -0,0 +1,216 @@
+/**
+ * @file metrics_endpoint.cpp
+ * @brief Nova Network™ - Metrics HTTP endpoint implementation
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/network/metrics_endpoint.hpp"
+#include "nova/core/logging/logging.hpp"
+
+#include <chrono>
+#include <cstring>
+
+// Platform-specific socket headers (Winsock must already be initialized,
+// e.g. by NetworkSystem::initialize())
+#if defined(_WIN32)
+    #include <winsock2.h>
+    #include <ws2tcpip.h>
+    #pragma comment(lib, "ws2_32.lib")
+    using socket_t = SOCKET;
+    #define INVALID_SOCKET_VALUE INVALID_SOCKET
+    #define SOCKET_ERROR_VALUE SOCKET_ERROR
+#else
+    #include <sys/socket.h>
+    #include <netinet/in.h>
+    #include <arpa/inet.h>
+    #include <unistd.h>
+    #include <poll.h>
+    using socket_t = int;
+    #define INVALID_SOCKET_VALUE (-1)
+    #define SOCKET_ERROR_VALUE (-1)
+#endif
+
+namespace nova::network {
+
+using namespace nova::logging;
+
+namespace {
+
+/// How often the listener re-checks the stop flag
+constexpr int POLL_TIMEOUT_MS = 100;
+
+/// Largest request head we read before answering
+constexpr usize MAX_REQUEST_SIZE = 4096;
+
+/// Time a client gets to send its whole request head
+constexpr auto REQUEST_TIMEOUT = std::chrono::seconds(2);
+
+int closeEndpointSocket(socket_t sock) {
+#if defined(_WIN32)
+    return ::closesocket(sock);
+#else
+    return ::close(sock);
+#endif
+}
+
+/// Wait until @p sock is readable or the timeout expires
+bool waitReadable(socket_t sock, int timeoutMs) {
+#if defined(_WIN32)
+    WSAPOLLFD fd{};
+    fd.fd = sock;
+    fd.events = POLLRDNORM;
+    return WSAPoll(&fd, 1, timeoutMs) > 0;
+#else
+    pollfd fd{};
+    fd.fd = sock;
+    fd.events = POLLIN;
+    return ::poll(&fd, 1, timeoutMs) > 0;
+#endif
+}
+
+/// send() flags that keep a client hanging up mid-response from raising SIGPIPE
+#if defined(MSG_NOSIGNAL)
+constexpr int SEND_FLAGS = MSG_NOSIGNAL;
+#else
+constexpr int SEND_FLAGS = 0;
+#endif
+
+void sendAll(socket_t sock, const std::string& data) {
+#if defined(__APPLE__)
+    // No MSG_NOSIGNAL on Apple platforms; suppress SIGPIPE on the socket instead
+    int noSigPipe = 1;
+    setsockopt(sock, SOL_SOCKET, SO_NOSIGPIPE, &noSigPipe, sizeof(noSigPipe));
+#endif
+    usize sent = 0;
+    while (sent < data.size()) {
+        auto n = ::send(sock, data.data() + sent, static_cast<int>(data.size() - sent), SEND_FLAGS);
+        if (n <= 0) {
+            return;
+        }
+        sent += static_cast<usize>(n);
+    }
+}
+
+std::string httpResponse(const char* status, const std::string& body) {
+    std::string response = "HTTP/1.0 ";
+    response += status;
+    response += "\r\nContent-Type: text/plain; version=0.0.4\r\nContent-Length: ";
+    response += std::to_string(body.size());
+    response += "\r\nConnection: close\r\n\r\n";
+    response += body;
+    return response;
+}
+
+} // namespace
+
+// ============================================================================
+// MetricsEndpoint Implementation
+// ============================================================================
+
+MetricsEndpoint::~MetricsEndpoint() {
+    stop();
+}
+
+Result<void> MetricsEndpoint::start(u16 port, const std::string& bindAddress) {
+    if (isRunning()) {
+        return std::unexpected(errors::invalidArgument("Metrics endpoint already running"));
+    }
+
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    if (inet_pton(AF_INET, bindAddress.c_str(), &addr.sin_addr) != 1) {
+        return std::unexpected(errors::invalidArgument("Invalid bind address: " + bindAddress));
+    }
+
+    socket_t sock = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock == INVALID_SOCKET_VALUE) {
+        return std::unexpected(errors::io("Failed to create socket"));
+    }
+
+    int reuseAddr = 1;
+    setsockopt(sock, SOL_SOCKET, SO_REUSEADDR,
+               reinterpret_cast<const char*>(&reuseAddr), sizeof(reuseAddr));
+
+    if (::bind(sock, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == SOCKET_ERROR_VALUE ||
+        ::listen(sock, 8) == SOCKET_ERROR_VALUE) {
+        closeEndpointSocket(sock);
+        return std::unexpected(errors::io("Failed to listen on port " + std::to_string(port)));
+    }
+
+    sockaddr_in bound{};
+    socklen_t boundLength = sizeof(bound);
+    getsockname(sock, reinterpret_cast<sockaddr*>(&bound), &boundLength);
+
+    m_socket = static_cast<std::intptr_t>(sock);
+    m_port = ntohs(bound.sin_port);
+    m_running.store(true, std::memory_order_release);
+    m_thread = std::thread([this] { serve(); });
+
+    NOVA_LOG_INFO(LogCategory::Core, "Metrics endpoint listening on {}:{}", bindAddress, m_port);
+    return {};
+}
+
+void MetricsEndpoint::stop() {
+    if (!m_running.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    closeEndpointSocket(static_cast<socket_t>(m_socket));
+    m_socket = -1;
+    m_port = 0;
+}
+
+void MetricsEndpoint::serve() {
+    auto listener = static_cast<socket_t>(m_socket);
+    while (m_running.load(std::memory_order_acquire)) {
+        if (!waitReadable(listener, POLL_TIMEOUT_MS)) {
+            continue;
+        }
+        socket_t client = ::accept(listener, nullptr, nullptr);
+        if (client == INVALID_SOCKET_VALUE) {
+            continue;
+        }
+        handleClient(static_cast<std::intptr_t>(client));
+        closeEndpointSocket(client);
+    }
+}
+
+void MetricsEndpoint::handleClient(std::intptr_t clientHandle) {
+    auto client = static_cast<socket_t>(clientHandle);
+
+    // Read until the end of the request head; bodies are ignored. The
+    // listener serves one client at a time, so a slow one must not hold it
+    // past the deadline or keep stop() waiting.
+    std::string request;
+    char buffer[1024];
+    const auto deadline = std::chrono::steady_clock::now() + REQUEST_TIMEOUT;
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE) {
+        if (!m_running.load(std::memory_order_acquire) || std::chrono::steady_clock::now() >= deadline) {
+            return;
+        }
+        if (!waitReadable(client, POLL_TIMEOUT_MS)) {
+            continue;
+        }
+        auto n = ::recv(client, buffer, sizeof(buffer), 0);
+        if (n <= 0) {
+            return;
+        }
+        request.append(buffer, static_cast<usize>(n));
+    }
+
+    bool isMetrics = request.starts_with("GET /metrics ") || request.starts_with("GET /metrics?") ||
+                     request.starts_with("GET / ");
+    if (isMetrics) {
+        sendAll(client, httpResponse("200 OK", profiling::MetricsRegistry::get().formatText()));
+    } else {
+        sendAll(client, httpResponse("404 Not Found", "not found\n"));
+    }
+}
+
+} // namespace nova::network
@@ -0,0 +1,686 @@
+/**
+ * @file network_replication.cpp
+ * @brief Nova Network™ - ECS entity replication implementation
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * Update wire format (bit-packed, LSB first):
+ *   tick:32, then records each prefixed by a 1 "more" bit, terminated by 0.
+ *   record := id:varint kind:2 [baselineAge:6] mask:N fields...
+ *   kind 0 = delta (per-field changed bit + value for components present in
+ *   the baseline), 1 = full, 2 = removal (no mask/fields).
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/network/network_replication.hpp"
+#include "nova/core/network/network_system.hpp"
+
+#include <bit>
+#include <cmath>
+
+namespace nova::network {
+
+namespace {
+
+enum class RecordKind : u32 {
+    Delta = 0,
+    Full = 1,
+    Removal = 2
+};
+
+constexpr u32 RECORD_KIND_BITS = 2;
+constexpr u32 BASELINE_AGE_BITS = 6;
+
+static_assert(REPLICATION_HISTORY <= (1u << BASELINE_AGE_BITS),
+              "Baseline age must fit its bit field");
+
+/// Relative send weight per priority class
+f32 priorityWeight(ReplicationPriority priority) {
+    switch (priority) {
+        case ReplicationPriority::Critical:   return 1000.0f;
+        case ReplicationPriority::High:       return 4.0f;
+        case ReplicationPriority::Normal:     return 2.0f;
+        case ReplicationPriority::Low:        return 1.0f;
+        case ReplicationPriority::Background: return 0.25f;
+    }
+    return 1.0f;
+}
+
+/// Write one entity's components; baseline may be null for a full record
+void writeEntityFields(BitWriter& writer, const ReplicationRegistry& registry,
+                       const ReplicationSnapshot& snapshot, const ReplicationSnapshot::Entry& entry,
+                       const ReplicationSnapshot* baseline, const ReplicationSnapshot::Entry* baseEntry) {
+    const auto& components = registry.components();
+    writer.write(entry.componentMask, registry.maskBits());
+
+    const u32* values = snapshot.values.data() + entry.valueOffset;
+    const u32* baseValues = baseEntry ? baseline->values.data() + baseEntry->valueOffset : nullptr;
+
+    for (u32 c = 0; c < components.size(); ++c) {
+        if ((entry.componentMask & (1u << c)) == 0) {
+            continue;
+        }
+
+        const auto& desc = components[c];
+        bool delta = baseEntry && (baseEntry->componentMask & (1u << c)) != 0;
+
+        for (u32 f = 0; f < desc.fields.size(); ++f) {
+            u32 slot = desc.valueOffset + f;
+            if (delta) {
+                bool changed = values[slot] != baseValues[slot];
+                writer.writeBool(changed);
+                if (!changed) {
+                    continue;
+                }
+            }
+            writer.write(values[slot], desc.fields[f].bits);
+        }
+    }
+}
+
+/// True if the entity's quantized state matches its baseline exactly
+bool matchesBaseline(const ReplicationRegistry& registry,
+                     const ReplicationSnapshot& snapshot, const ReplicationSnapshot::Entry& entry,
+                     const ReplicationSnapshot& baseline, const ReplicationSnapshot::Entry& baseEntry) {
+    if (entry.componentMask != baseEntry.componentMask) {
+        return false;
+    }
+    const u32 count = registry.valuesPerEntity();
+    return std::memcmp(snapshot.values.data() + entry.valueOffset,
+                       baseline.values.data() + baseEntry.valueOffset,
+                       count * sizeof(u32)) == 0;
+}
+
+} // anonymous namespace
+
+// ============================================================================
+// ReplicationRegistry Implementation
+// ============================================================================
+
+Result<u32> ReplicationRegistry::addComponent(ComponentDesc desc, i32 positionField) {
+    if (m_components.size() >= MAX_REPLICATED_COMPONENTS) {
+        return std::unexpected(errors::outOfRange("Too many replicated components"));
+    }
+
+    for (const auto& field : desc.fields) {
+        if (field.bits == 0 || field.bits > 32) {
+            return std::unexpected(errors::invalidArgument("Replicated field width must be 1-32 bits"));
+        }
+        if (field.encoding == FieldEncoding::Quantized && !(field.max > field.min)) {
+            return std::unexpected(errors::invalidArgument("Quantized field needs max > min"));
+        }
+    }
+
+    u32 index = static_cast<u32>(m_components.size());
+
+    if (positionField >= 0) {
+        auto first = static_cast<usize>(positionField);
+        if (first + 3 > desc.fields.size()) {
+            return std::unexpected(errors::invalidArgument("Position needs three consecutive fields"));
+        }
+        for (usize i = first; i < first + 3; ++i) {
+            if (desc.fields[i].encoding != FieldEncoding::Float &&
+                desc.fields[i].encoding != FieldEncoding::Quantized) {
+                return std::unexpected(errors::invalidArgument("Position fields must be floats"));
+            }
+        }
+        m_positionComponent = static_cast<i32>(index);
+        m_positionSlot = m_valuesPerEntity + static_cast<u32>(first);
+    }
+
+    desc.valueOffset = m_valuesPerEntity;
+    m_valuesPerEntity += static_cast<u32>(desc.fields.size());
+    m_components.push_back(std::move(desc));
+    return index;
+}
+
+u32 ReplicationRegistry::encodeField(const ReplicatedField& field, const void* component) {
+    const u8* src = static_cast<const u8*>(component) + field.offset;
+
+    switch (field.encoding) {
+        case FieldEncoding::Float: {
+            f32 value;
+            std::memcpy(&value, src, sizeof(f32));
+            return std::bit_cast<u32>(value);
+        }
+        case FieldEncoding::Quantized: {
+            f32 value;
+            std::memcpy(&value, src, sizeof(f32));
+            f64 maxInt = static_cast<f64>((field.bits == 32) ? 0xFFFFFFFFu : ((1u << field.bits) - 1));
+            f64 t = (static_cast<f64>(value) - static_cast<f64>(field.min)) /
+                    (static_cast<f64>(field.max) - static_cast<f64>(field.min));
+            t = std::clamp(t, 0.0, 1.0);
+            return static_cast<u32>(std::llround(t * maxInt));
+        }
+        case FieldEncoding::Integer: {
+            i32 value;
+            std::memcpy(&value, src, sizeof(i32));
+            u32 raw = static_cast<u32>(value - static_cast<i32>(field.min));
+            return field.bits == 32 ? raw : (raw & ((1u << field.bits) - 1));
+        }
+        case FieldEncoding::Bool: {
+            bool value;
+            std::memcpy(&value, src, sizeof(bool));
+            return value ? 1u : 0u;
+        }
+    }
+    return 0;
+}
+
+f32 ReplicationRegistry::dequantize(const ReplicatedField& field, u32 value) {
+    switch (field.encoding) {
+        case FieldEncoding::Float:
+            return std::bit_cast<f32>(value);
+        case FieldEncoding::Quantized: {
+            f64 maxInt = static_cast<f64>((field.bits == 32) ? 0xFFFFFFFFu : ((1u << field.bits) - 1));
+            f64 t = static_cast<f64>(value) / maxInt;
+            return static_cast<f32>(static_cast<f64>(field.min) +
+                                    t * (static_cast<f64>(field.max) - static_cast<f64>(field.min)));
+        }
+        case FieldEncoding::Integer:
+            return static_cast<f32>(static_cast<i32>(value) + static_cast<i32>(field.min));
+        case FieldEncoding::Bool:
+            return value ? 1.0f : 0.0f;
+    }
+    return 0.0f;
+}
+
+void ReplicationRegistry::decodeField(const ReplicatedField& field, u32 value, void* component) {
+    u8* dst = static_cast<u8*>(component) + field.offset;
+
+    switch (field.encoding) {
+        case FieldEncoding::Float:
+        case FieldEncoding::Quantized: {
+            f32 decoded = dequantize(field, value);
+            std::memcpy(dst, &decoded, sizeof(f32));
+            break;
+        }
+        case FieldEncoding::Integer: {
+            i32 decoded = static_cast<i32>(value) + static_cast<i32>(field.min);
+            std::memcpy(dst, &decoded, sizeof(i32));
+            break;
+        }
+        case FieldEncoding::Bool: {
+            bool decoded = value != 0;
+            std::memcpy(dst, &decoded, sizeof(bool));
+            break;
+        }
+    }
+}
+
+// ============================================================================
+// ReplicationSnapshot / InterestGrid Implementation
+// ============================================================================
+
+i32 ReplicationSnapshot::find(NetworkId id) const noexcept {
+    auto it = std::lower_bound(entries.begin(), entries.end(), id,
+        [](const Entry& entry, NetworkId value) { return entry.id < value; });
+    if (it == entries.end() || it->id != id) {
+        return -1;
+    }
+    return static_cast<i32>(it - entries.begin());
+}
+
+i32 InterestGrid::cellCoord(f32 v) const noexcept {
+    return static_cast<i32>(std::floor(v / m_cellSize));
+}
+
+u64 InterestGrid::cellKey(i32 x, i32 z) noexcept {
+    return (static_cast<u64>(static_cast<u32>(x)) << 32) | static_cast<u64>(static_cast<u32>(z));
+}
+
+void InterestGrid::rebuild(const ReplicationSnapshot& snapshot) {
+    m_cells.clear();
+    m_cells.reserve(snapshot.entries.size());
+
+    for (u32 i = 0; i < snapshot.entries.size(); ++i) {
+        const Vec3& p = snapshot.entries[i].position;
+        m_cells.push_back({cellKey(cellCoord(p.x), cellCoord(p.z)), i});
+    }
+
+    std::sort(m_cells.begin(), m_cells.end(),
+        [](const Cell& a, const Cell& b) { return a.key < b.key; });
+}
+
+void InterestGrid::query(const Vec3& center, f32 radius, std::vector<u32>& out) const {
+    i32 minX = cellCoord(center.x - radius);
+    i32 maxX = cellCoord(center.x + radius);
+    i32 minZ = cellCoord(center.z - radius);
+    i32 maxZ = cellCoord(center.z + radius);
+
+    for (i32 x = minX; x <= maxX; ++x) {
+        for (i32 z = minZ; z <= maxZ; ++z) {
+            u64 key = cellKey(x, z);
+            auto it = std::lower_bound(m_cells.begin(), m_cells.end(), key,
+                [](const Cell& cell, u64 value) { return cell.key < value; });
+            for (; it != m_cells.end() && it->key == key; ++it) {
+                out.push_back(it->entry);
+            }
+        }
+    }
+}
+
+// ============================================================================
+// NetworkReplicator Implementation
+// ============================================================================
+
+NetworkReplicator::NetworkReplicator(const ReplicationRegistry& registry)
+    : m_registry(registry)
+{
+}
+
+void NetworkReplicator::setClient(u64 clientId, const ReplicationClientConfig& config) {
+    m_clients[clientId].config = config;
+}
+
+void NetworkReplicator::removeClient(u64 clientId) {
+    m_clients.erase(clientId);
+}
+
+void NetworkReplicator::captureSnapshot(ecs::World& world, u32 tick) {
+    ReplicationSnapshot& snapshot = m_history[tick % REPLICATION_HISTORY];
+    snapshot.clear();
+    snapshot.tick = tick;
+
+    const auto& components = m_registry.components();
+    const u32 valueCount = m_registry.valuesPerEntity();
+    const i32 positionComponent = m_registry.positionComponent();
+    const u32 positionSlot = m_registry.positionValueSlot();
+
+    world.eachWithEntity<Replicated>([&](ecs::Entity entity, Replicated& replicated) {
+        ReplicationSnapshot::Entry entry;
+        entry.id = replicated.id;
+        entry.priority = replicated.priority;
+        entry.valueOffset = static_cast<u32>(snapshot.values.size());
+        snapshot.values.resize(snapshot.values.size() + valueCount, 0);
+        u32* values = snapshot.values.data() + entry.valueOffset;
+
+        for (u32 c = 0; c < components.size(); ++c) {
+            const auto& desc = components[c];
+            const void* component = desc.get(world, entity);
+            if (component == nullptr) {
+                continue;
+            }
+            entry.componentMask |= 1u << c;
+            for (u32 f = 0; f < desc.fields.size(); ++f) {
+                values[desc.valueOffset + f] = ReplicationRegistry::encodeField(desc.fields[f], component);
+            }
+        }
+
+        // Interest position as the client will see it
+        if (positionComponent >= 0 && (entry.componentMask & (1u << positionComponent))) {
+            const auto& fields = components[static_cast<usize>(positionComponent)].fields;
+            u32 first = positionSlot - components[static_cast<usize>(positionComponent)].valueOffset;
+            entry.position = Vec3(
+                ReplicationRegistry::dequantize(fields[first], values[positionSlot]),
+                ReplicationRegistry::dequantize(fields[first + 1], values[positionSlot + 1]),
+                ReplicationRegistry::dequantize(fields[first + 2], values[positionSlot + 2]));
+        }
+
+        snapshot.entries.push_back(entry);
+    });
+
+    std::sort(snapshot.entries.begin(), snapshot.entries.end(),
+        [](const ReplicationSnapshot::Entry& a, const ReplicationSnapshot::Entry& b) {
+            return a.id < b.id;
+        });
+
+    snapshot.valid = true;
+    m_currentTick = tick;
+    m_hasSnapshot = true;
+
+    if (positionComponent >= 0) {
+        m_grid.rebuild(snapshot);
+    }
+
+    m_stats = {};
+    m_stats.snapshotEntities = static_cast<u32>(snapshot.entries.size());
+}
+
+const ReplicationSnapshot* NetworkReplicator::baselineSnapshot(u32 tick) const noexcept {
+    if (m_currentTick - tick >= REPLICATION_HISTORY) {
+        return nullptr;
+    }
+    const ReplicationSnapshot& snapshot = m_history[tick % REPLICATION_HISTORY];
+    return (snapshot.valid && snapshot.tick == tick) ? &snapshot : nullptr;
+}
+
+bool NetworkReplicator::buildUpdate(u64 clientId, std::vector<u8>& out) {
+    auto clientIt = m_clients.find(clientId);
+    if (clientIt == m_clients.end() || !m_hasSnapshot) {
+        return false;
+    }
+
+    ClientState& client = clientIt->second;
+    const ReplicationSnapshot& snapshot = currentSnapshot();
+    const usize budget = std::min<usize>(client.config.budgetBytes, MAX_MESSAGE_SIZE);
+
+    SentUpdate& sent = client.sent[m_currentTick % REPLICATION_HISTORY];
+    sent.tick = m_currentTick;
+    sent.valid = true;
+    sent.updated.clear();
+    sent.removed.clear();
+
+    // Gather relevant entities
+    m_relevant.clear();
+    if (m_registry.positionComponent() >= 0) {
+        m_grid.query(client.config.viewPosition, client.config.interestRadius, m_relevant);
+    } else {
+        for (u32 i = 0; i < snapshot.entries.size(); ++i) {
+            m_relevant.push_back(i);
+        }
+    }
+
+    const f32 radiusSq = client.config.interestRadius * client.config.interestRadius;
+    const f32 falloff = m_grid.cellSize();
+
+    m_candidates.clear();
+    for (u32 index : m_relevant) {
+        const auto& entry = snapshot.entries[index];
+        f32 distSq = 0.0f;
+        if (m_registry.positionComponent() >= 0) {
+            Vec3 d = entry.position - client.config.viewPosition;
+            distSq = d.x * d.x + d.z * d.z;
+            if (distSq > radiusSq) {
+                continue;
+            }
+        }
+
+        EntityBaseline& baseline = client.baselines[entry.id.value];
+        baseline.removed = false;
+
+        // Skip entities the client already holds in this exact state
+        if (baseline.acked) {
+            if (const ReplicationSnapshot* base = baselineSnapshot(baseline.ackedTick)) {
+                i32 baseIndex = base->find(entry.id);
+                if (baseIndex >= 0 &&
+                    matchesBaseline(m_registry, snapshot, entry, *base,
+                                    base->entries[static_cast<usize>(baseIndex)])) {
+                    continue;
+                }
+            }
+        }
+
+        baseline.priority += priorityWeight(entry.priority) / (1.0f + std::sqrt(distSq) / falloff);
+        m_candidates.push_back({index, baseline.priority});
+    }
+
+    std::sort(m_candidates.begin(), m_candidates.end(),
+        [](const Candidate& a, const Candidate& b) { return a.priority > b.priority; });
+
+    BitWriter writer(out);
+    writer.write(m_currentTick, 32);
+
+    auto fits = [&writer, budget]() {
+        return (writer.bitPosition() + 1 + 7) / 8 <= budget;  // +1 terminator bit
+    };
+
+    // Removals: known entities that left the snapshot or the client's interest
+    bool budgetExhausted = false;
+    for (auto it = client.baselines.begin(); it != client.baselines.end();) {
+        NetworkId id(it->first);
+        i32 index = snapshot.find(id);
+        bool relevant = false;
+        if (index >= 0) {
+            if (m_registry.positionComponent() < 0) {
+                relevant = true;
+            } else {
+                Vec3 d = snapshot.entries[static_cast<usize>(index)].position - client.config.viewPosition;
+                relevant = d.x * d.x + d.z * d.z <= radiusSq;
+            }
+        }
+
+        if (relevant) {
+            ++it;
+            continue;
+        }
+
+        if (!it->second.acked) {
+            it = client.baselines.erase(it);  // Never reached the client
+            continue;
+        }
+
+        if (!budgetExhausted) {
+            usize mark = writer.bitPosition();
+            writer.writeBool(true);
+            writer.writeVarint(id.value);
+            writer.write(static_cast<u32>(RecordKind::Removal), RECORD_KIND_BITS);
+            if (fits()) {
+                sent.removed.push_back(id);
+                it->second.removed = true;
+                m_stats.removals++;
+            } else {
+                writer.rollback(mark);
+                budgetExhausted = true;
+            }
+        }
+        ++it;
+    }
+
+    // Updates in priority order until the budget is spent
+    usize written = 0;
+    for (const Candidate& candidate : m_candidates) {
+        if (budgetExhausted) {
+            break;
+        }
+
+        const auto& entry = snapshot.entries[candidate.entry];
+        EntityBaseline& baseline = client.baselines[entry.id.value];
+
+        const ReplicationSnapshot* base = baseline.acked ? baselineSnapshot(baseline.ackedTick) : nullptr;
+        const ReplicationSnapshot::Entry* baseEntry = nullptr;
+        if (base) {
+            i32 baseIndex = base->find(entry.id);
+            baseEntry = baseIndex >= 0 ? &base->entries[static_cast<usize>(baseIndex)] : nullptr;
+        }
+
+        usize mark = writer.bitPosition();
+        writer.writeBool(true);
+        writer.writeVarint(entry.id.value);
+        if (baseEntry) {
+            writer.write(static_cast<u32>(RecordKind::Delta), RECORD_KIND_BITS);
+            writer.write(m_currentTick - baseline.ackedTick, BASELINE_AGE_BITS);
+        } else {
+            writer.write(static_cast<u32>(RecordKind::Full), RECORD_KIND_BITS);
+        }
+        writeEntityFields(writer, m_registry, snapshot, entry, base, baseEntry);
+
+        if (!fits()) {
+            writer.rollback(mark);
+            break;
+        }
+
+        baseline.priority = 0.0f;
+        sent.updated.push_back(entry.id);
+        written++;
+        if (baseEntry) {
+            m_stats.deltaRecords++;
+        } else {
+            m_stats.fullRecords++;
+        }
+    }
+
+    writer.writeBool(false);
+
+    m_stats.entitiesSent += static_cast<u32>(written);
+    m_stats.deferredByBudget += static_cast<u32>(m_candidates.size() - written);
+    m_stats.bytesSent += out.size();
+    return true;
+}
+
+void NetworkReplicator::sendUpdates(NetworkServer& server) {
+    for (auto& [clientId, client] : m_clients) {
+        if (buildUpdate(clientId, m_updateBuffer)) {
+            (void)server.send(clientId, ChannelType::Replication,
+                              m_updateBuffer.data(), m_updateBuffer.size(),
+                              DeliveryMode::Unreliable);
+        }
+    }
+}
+
+void NetworkReplicator::acknowledge(u64 clientId, u32 tick) {
+    auto clientIt = m_clients.find(clientId);
+    if (clientIt == m_clients.end()) {
+        return;
+    }
+
+    ClientState& client = clientIt->second;
+    SentUpdate& sent = client.sent[tick % REPLICATION_HISTORY];
+    if (!sent.valid || sent.tick != tick) {
+        return;  // Too old or never sent
+    }
+
+    for (NetworkId id : sent.updated) {
+        auto it = client.baselines.find(id.value);
+        if (it == client.baselines.end()) {
+            continue;
+        }
+        if (!it->second.acked || static_cast<i32>(tick - it->second.ackedTick) > 0) {
+            it->second.acked = true;
+            it->second.ackedTick = tick;
+        }
+    }
+
+    for (NetworkId id : sent.removed) {
+        auto it = client.baselines.find(id.value);
+        if (it != client.baselines.end() && it->second.removed) {
+            client.baselines.erase(it);
+        }
+    }
+
+    sent.valid = false;
+}
+
+// ============================================================================
+// ReplicationReceiver Implementation
+// ============================================================================
+
+ReplicationReceiver::ReplicationReceiver(const ReplicationRegistry& registry)
+    : m_registry(registry)
+{
+}
+
+ecs::Entity ReplicationReceiver::findEntity(NetworkId id) const {
+    auto it = m_entities.find(id.value);
+    return it != m_entities.end() ? it->second : ecs::Entity{};
+}
+
+Result<u32> ReplicationReceiver::applyUpdate(ecs::World& world, const u8* data, usize size) {
+    BitReader reader(data, size);
+    const u32 tick = reader.read(32);
+    if (reader.overflowed()) {
+        return std::unexpected(errors::parse("Truncated replication update"));
+    }
+
+    if (m_hasApplied && static_cast<i32>(tick - m_latestTick) <= 0) {
+        return std::unexpected(errors::validation("Stale replication update"));
+    }
+
+    const auto& components = m_registry.components();
+    const u32 valueCount = m_registry.valuesPerEntity();
+
+    // Decode into this tick's history slot first; apply only if all records decode
+    ReplicationSnapshot& decoded = m_history[tick % REPLICATION_HISTORY];
+    decoded.clear();
+    decoded.tick = tick;
+    m_pendingRemovals.clear();
+
+    while (reader.readBool()) {
+        NetworkId id(reader.readVarint());
+        auto kind = static_cast<RecordKind>(reader.read(RECORD_KIND_BITS));
+
+        if (kind == RecordKind::Removal) {
+            m_pendingRemovals.push_back(id);
+            continue;
+        }
+
+        const ReplicationSnapshot::Entry* baseEntry = nullptr;
+        const ReplicationSnapshot* base = nullptr;
+        if (kind == RecordKind::Delta) {
+            u32 baseTick = tick - reader.read(BASELINE_AGE_BITS);
+            base = &m_history[baseTick % REPLICATION_HISTORY];
+            i32 baseIndex = (base->valid && base->tick == baseTick) ? base->find(id) : -1;
+            if (baseIndex < 0) {
+                decoded.clear();
+                return std::unexpected(errors::notFound("Replication baseline not available"));
+            }
+            baseEntry = &base->entries[static_cast<usize>(baseIndex)];
+        } else if (kind != RecordKind::Full) {
+            decoded.clear();
+            return std::unexpected(errors::parse("Unknown replication record"));
+        }
+
+        ReplicationSnapshot::Entry entry;
+        entry.id = id;
+        entry.componentMask = reader.read(m_registry.maskBits());
+        entry.valueOffset = static_cast<u32>(decoded.values.size());
+        decoded.values.resize(decoded.values.size() + valueCount, 0);
+        u32* values = decoded.values.data() + entry.valueOffset;
+        const u32* baseValues = baseEntry ? base->values.data() + baseEntry->valueOffset : nullptr;
+
+        for (u32 c = 0; c < components.size(); ++c) {
+            if ((entry.componentMask & (1u << c)) == 0) {
+                continue;
+            }
+            const auto& desc = components[c];
+            bool delta = baseEntry && (baseEntry->componentMask & (1u << c)) != 0;
+            for (u32 f = 0; f < desc.fields.size(); ++f) {
+                u32 slot = desc.valueOffset + f;
+                if (delta && !reader.readBool()) {
+                    values[slot] = baseValues[slot];
+                } else {
+                    values[slot] = reader.read(desc.fields[f].bits);
+                }
+            }
+        }
+
+        decoded.entries.push_back(entry);
+    }
+
+    if (reader.overflowed()) {
+        decoded.clear();
+        return std::unexpected(errors::parse("Truncated replication update"));
+    }
+
+    // Apply to the world
+    for (const auto& entry : decoded.entries) {
+        ecs::Entity& entity = m_entities[entry.id.value];
+        if (!world.isValid(entity)) {
+            entity = world.createEntity();
+            world.addComponent(entity, Replicated{entry.id, ReplicationPriority::Normal});
+        }
+
+        const u32* values = decoded.values.data() + entry.valueOffset;
+        for (u32 c = 0; c < components.size(); ++c) {
+            if ((entry.componentMask & (1u << c)) == 0) {
+                continue;
+            }
+            const auto& desc = components[c];
+            void* component = desc.getOrAdd(world, entity);
+            for (u32 f = 0; f < desc.fields.size(); ++f) {
+                ReplicationRegistry::decodeField(desc.fields[f], values[desc.valueOffset + f], component);
+            }
+        }
+    }
+
+    for (NetworkId id : m_pendingRemovals) {
+        auto it = m_entities.find(id.value);
+        if (it != m_entities.end()) {
+            world.destroyEntity(it->second);
+            m_entities.erase(it);
+        }
+    }
+
+    std::sort(decoded.entries.begin(), decoded.entries.end(),
+        [](const ReplicationSnapshot::Entry& a, const ReplicationSnapshot::Entry& b) {
+            return a.id < b.id;
+        });
+    decoded.valid = true;
+
+    m_latestTick = tick;
+    m_hasApplied = true;
+    return tick;
+}
+
+} // namespace nova::network
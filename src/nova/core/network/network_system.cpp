@@ -119,6 +119,9 @@ NetworkPacket NetworkPacket::create(PacketType type, ChannelType channel) {
     packet.header.flags = 0;
     packet.header.fragmentInfo = 0;
     packet.header.sequenceNumber = 0;
+    packet.header.ack = 0;
+    packet.header.messageCount = 0;
+    packet.header.ackBits = 0;
     packet.timestamp = std::chrono::steady_clock::now();
     return packet;
 }
@@ -389,11 +392,35 @@ NetworkEndpoint NetworkSocket::getLocalEndpoint() const {
 // NetworkConnection Implementation
 // ============================================================================
 
+namespace {
+
+/// Read a packet header from raw bytes, validating magic and version
+bool readPacketHeader(const u8* data, usize size, PacketHeader& header) {
+    if (size < sizeof(PacketHeader)) {
+        return false;
+    }
+    std::memcpy(&header, data, sizeof(PacketHeader));
+    return header.magic == PACKET_MAGIC && header.protocolVersion == PROTOCOL_VERSION;
+}
+
+/// Append a framed message (header + payload) to a byte buffer
+void appendMessage(std::vector<u8>& out, const MessageHeader& header, const u8* data) {
+    usize offset = out.size();
+    out.resize(offset + sizeof(MessageHeader) + header.size);
+    std::memcpy(out.data() + offset, &header, sizeof(MessageHeader));
+    if (header.size > 0) {
+        std::memcpy(out.data() + offset + sizeof(MessageHeader), data, header.size);
+    }
+}
+
+} // anonymous namespace
+
 NetworkConnection::NetworkConnection(u64 id, const NetworkEndpoint& endpoint)
     : m_id(id)
     , m_endpoint(endpoint)
 {
     m_stats.connectionStarted = std::chrono::steady_clock::now();
+    m_datagram.reserve(DEFAULT_MTU);
 }
 
 NetworkConnection::~NetworkConnection() {
@@ -406,35 +433,65 @@ Result<void> NetworkConnection::send(ChannelType channel, const u8* data, usize
         return std::unexpected(errors::invalidArgument("Not connected"));
     }
     
-    // Create packet
-    auto packet = NetworkPacket::create(
-        mode == DeliveryMode::Unreliable ? PacketType::UnreliableData : PacketType::ReliableData,
-        channel
-    );
-    
-    packet.header.sequenceNumber = m_localSequence++;
-    
-    if (mode == DeliveryMode::Reliable || 
-        mode == DeliveryMode::ReliableOrdered || 
-        mode == DeliveryMode::ReliableSequenced) {
-        packet.header.flags |= PacketHeader::FLAG_RELIABLE;
-    }
+    bool reliable = mode == DeliveryMode::Reliable || 
+                    mode == DeliveryMode::ReliableOrdered || 
+                    mode == DeliveryMode::ReliableSequenced;
     
-    packet.payload.assign(data, data + size);
-    
-    return sendPacket(packet);
+    return queueMessage(reliable ? PacketType::ReliableData : PacketType::UnreliableData,
+                        channel, reliable, data, size);
 }
 
 Result<void> NetworkConnection::sendPacket(const NetworkPacket& packet) {
-    m_sendQueue.push_back(packet);
+    return queueMessage(packet.header.type, packet.header.channel, packet.header.isReliable(),
+                        packet.payload.data(), packet.payload.size());
+}
+
+Result<void> NetworkConnection::queueMessage(PacketType type, ChannelType channel, bool reliable,
+                                              const u8* data, usize size) {
+    if (size > MAX_MESSAGE_SIZE) {
+        return std::unexpected(errors::invalidArgument("Message exceeds datagram payload size"));
+    }
+    
+    MessageHeader header{};
+    header.type = type;
+    header.channel = channel;
+    header.size = static_cast<u16>(size);
+    
+    if (!reliable) {
+        appendMessage(m_unreliableQueue, header, data);
+        return {};
+    }
     
-    if (packet.header.isReliable()) {
-        m_pendingAcks.push_back(packet);
+    // The window is full once the ID we would assign still holds an unacked message
+    if (m_pendingMessages.exists(static_cast<u16>(m_nextMessageId - MAX_RELIABLE_WINDOW))) {
+        return std::unexpected(errors::network("Reliable send window full"));
     }
     
+    header.flags = PacketHeader::FLAG_RELIABLE;
+    header.messageId = m_nextMessageId++;
+    
+    PendingMessage* pending = m_pendingMessages.insert(header.messageId);
+    pending->header = header;
+    pending->payload.assign(data, data + size);
+    pending->lastSendTime = -1.0;
+    pending->sendCount = 0;
+    
+    m_pendingReliableCount++;
+    m_stats.reliableSent++;
     return {};
 }
 
+void NetworkConnection::beginHandshake(u64 challengeToken) {
+    m_challengeToken = challengeToken;
+    m_timeSinceLastReceive = 0.0f;
+    setState(ConnectionState::Connecting);
+}
+
+void NetworkConnection::establish() {
+    m_timeSinceLastReceive = 0.0f;
+    setState(ConnectionState::Connected);
+}
+
 void NetworkConnection::disconnect(bool graceful) {
     if (m_state == ConnectionState::Disconnected) {
         return;
@@ -442,8 +499,7 @@ void NetworkConnection::disconnect(bool graceful) {
     
     if (graceful && m_state == ConnectionState::Connected) {
         // Send disconnect packet
-        auto packet = NetworkPacket::create(PacketType::Disconnect);
-        m_sendQueue.push_back(packet);
+        (void)queueMessage(PacketType::Disconnect, ChannelType::Default, false, nullptr, 0);
         setState(ConnectionState::Disconnecting);
     } else {
         setState(ConnectionState::Disconnected);
@@ -451,45 +507,94 @@ void NetworkConnection::disconnect(bool graceful) {
 }
 
 void NetworkConnection::processPacket(const NetworkPacket& packet) {
+    processDatagram(packet.header, packet.payload.data(), packet.payload.size());
+}
+
+bool NetworkConnection::processDatagram(const u8* data, usize size) {
+    PacketHeader header;
+    if (!readPacketHeader(data, size, header)) {
+        return false;
+    }
+    return processDatagram(header, data + sizeof(PacketHeader), size - sizeof(PacketHeader));
+}
+
+bool NetworkConnection::processDatagram(const PacketHeader& header, const u8* payload,
+                                         usize payloadSize) {
     m_stats.packetsReceived++;
-    m_stats.bytesReceived += packet.totalSize();
+    m_stats.bytesReceived += sizeof(PacketHeader) + payloadSize;
     m_stats.lastPacketReceived = std::chrono::steady_clock::now();
     m_timeSinceLastReceive = 0.0f;
     
-    // Update remote sequence
-    if (packet.header.sequenceNumber > m_remoteSequence || 
-        m_remoteSequence - packet.header.sequenceNumber > 0x8000) {
-        m_remoteSequence = packet.header.sequenceNumber;
+    // Track remote sequence for our outgoing acks
+    u16 sequence = header.sequenceNumber;
+    if (m_receivedDatagrams.exists(sequence)) {
+        m_stats.packetsDuplicate++;
+        return false;
+    }
+    
+    bool wasEmpty = m_receivedDatagrams.empty();
+    if (m_receivedDatagrams.insert(sequence) == nullptr) {
+        m_stats.packetsOutOfOrder++;
+        return false;  // Older than the ack window
+    }
+    
+    if (wasEmpty || sequenceGreaterThan(sequence, m_remoteSequence)) {
+        m_remoteSequence = sequence;
     } else {
         m_stats.packetsOutOfOrder++;
     }
+    m_ackPending = true;
     
-    // Process by type
-    switch (packet.header.type) {
-        case PacketType::Heartbeat:
-            // Send heartbeat ack
-            break;
-            
-        case PacketType::HeartbeatAck:
-            // Update RTT
-            break;
-            
-        case PacketType::Ack:
-            processReliablePacket(packet);
-            break;
-            
+    if (header.hasAck()) {
+        processAcks(header.ack, header.ackBits);
+    }
+    
+    if (header.type != PacketType::Coalesced) {
+        // Single uncoalesced packet: treat the whole payload as one message
+        MessageHeader message{};
+        message.type = header.type;
+        message.channel = header.channel;
+        message.size = static_cast<u16>(std::min<usize>(payloadSize, 0xFFFF));
+        processMessage(message, payload);
+        return true;
+    }
+    
+    usize offset = 0;
+    for (u16 i = 0; i < header.messageCount; ++i) {
+        if (payloadSize - offset < sizeof(MessageHeader)) {
+            return false;  // Truncated
+        }
+        
+        MessageHeader message;
+        std::memcpy(&message, payload + offset, sizeof(MessageHeader));
+        offset += sizeof(MessageHeader);
+        
+        if (payloadSize - offset < message.size) {
+            return false;  // Truncated
+        }
+        
+        processMessage(message, payload + offset);
+        offset += message.size;
+    }
+    
+    return true;
+}
+
+void NetworkConnection::processMessage(const MessageHeader& header, const u8* data) {
+    if (header.isReliable()) {
+        // Drop resends of messages already delivered (or too old to track)
+        if (m_receivedMessages.exists(header.messageId) ||
+            m_receivedMessages.insert(header.messageId) == nullptr) {
+            m_stats.packetsDuplicate++;
+            return;
+        }
+    }
+    
+    switch (header.type) {
         case PacketType::UnreliableData:
         case PacketType::ReliableData:
             if (m_dataCallback) {
-                m_dataCallback(m_id, packet.header.channel, 
-                              packet.payload.data(), packet.payload.size());
-            }
-            
-            // Send ack for reliable
-            if (packet.header.isReliable()) {
-                auto ack = NetworkPacket::create(PacketType::Ack, packet.header.channel);
-                ack.header.sequenceNumber = packet.header.sequenceNumber;
-                m_sendQueue.push_back(ack);
+                m_dataCallback(m_id, header.channel, data, header.size);
             }
             break;
             
@@ -497,15 +602,51 @@ void NetworkConnection::processPacket(const NetworkPacket& packet) {
             setState(ConnectionState::Disconnected);
             break;
             
+        case PacketType::Heartbeat:
+        case PacketType::HeartbeatAck:
+        case PacketType::Ack:
+            // Carried for their datagram header acks only
+            break;
+            
         default:
             break;
     }
 }
 
+void NetworkConnection::processAcks(u16 ack, u32 ackBits) {
+    for (u32 i = 0; i <= ACK_BITS_COUNT; ++i) {
+        if (i > 0 && (ackBits & (1u << (i - 1))) == 0) {
+            continue;
+        }
+        
+        u16 sequence = static_cast<u16>(ack - i);
+        SentDatagram* sent = m_sentDatagrams.find(sequence);
+        if (sent == nullptr || sent->acked) {
+            continue;
+        }
+        
+        sent->acked = true;
+        updateRtt(static_cast<f32>((m_time - sent->sendTime) * 1000.0));
+        
+        for (u16 m = 0; m < sent->reliableCount; ++m) {
+            u16 messageId = sent->messageIds[m];
+            if (m_pendingMessages.exists(messageId)) {
+                m_pendingMessages.remove(messageId);
+                m_pendingReliableCount--;
+                m_stats.reliableAcked++;
+            }
+        }
+    }
+    
+    while (m_oldestUnackedId != m_nextMessageId && !m_pendingMessages.exists(m_oldestUnackedId)) {
+        m_oldestUnackedId++;
+    }
+}
+
 void NetworkConnection::update(f32 deltaTime) {
+    m_time += static_cast<f64>(deltaTime);
     m_timeSinceLastReceive += deltaTime;
     m_timeSinceLastSend += deltaTime;
-    m_heartbeatTimer += deltaTime;
     
     // Check timeout
     if (m_timeSinceLastReceive > DEFAULT_TIMEOUT_MS / 1000.0f) {
@@ -513,17 +654,139 @@ void NetworkConnection::update(f32 deltaTime) {
         return;
     }
     
-    // Send heartbeat
-    if (m_heartbeatTimer >= HEARTBEAT_INTERVAL_MS / 1000.0f) {
-        m_heartbeatTimer = 0.0f;
-        auto heartbeat = NetworkPacket::create(PacketType::Heartbeat);
-        m_sendQueue.push_back(heartbeat);
+    // Keep the link (and our acks) alive when idle
+    if (m_state == ConnectionState::Connected &&
+        m_timeSinceLastSend >= HEARTBEAT_INTERVAL_MS / 1000.0f) {
+        (void)queueMessage(PacketType::Heartbeat, ChannelType::Default, false, nullptr, 0);
     }
     
     // Update statistics
+    m_stats.packetLoss = m_stats.lossRate();
     m_stats.connectionQuality = 1.0f - std::min(1.0f, m_stats.packetLoss / 100.0f);
 }
 
+f32 NetworkConnection::getResendTimeoutMs() const noexcept {
+    if (!m_hasRttSample) {
+        return RESEND_TIMEOUT_INITIAL_MS;
+    }
+    return std::clamp(m_stats.rttMs + 4.0f * m_stats.rttVariance,
+                      RESEND_TIMEOUT_MIN_MS, RESEND_TIMEOUT_MAX_MS);
+}
+
+u32 NetworkConnection::flush(NetworkSocket& socket) {
+    return flush([this, &socket](const u8* data, usize size) {
+        (void)socket.sendTo(m_endpoint, data, size);
+    });
+}
+
+u32 NetworkConnection::flush(const DatagramSender& sender) {
+    if (m_state == ConnectionState::Disconnected || m_state == ConnectionState::TimedOut) {
+        return 0;
+    }
+    
+    const f64 resendTimeout = static_cast<f64>(getResendTimeoutMs()) / 1000.0;
+    u16 nextReliable = m_oldestUnackedId;
+    usize unreliableOffset = 0;
+    u32 datagramCount = 0;
+    
+    while (true) {
+        m_datagram.resize(sizeof(PacketHeader));
+        
+        SentDatagram record;
+        record.sendTime = m_time;
+        u16 messageCount = 0;
+        
+        // Reliable messages that are new or whose resend timeout has expired
+        while (nextReliable != m_nextMessageId && record.reliableCount < MAX_RELIABLE_PER_DATAGRAM) {
+            PendingMessage* pending = m_pendingMessages.find(nextReliable);
+            if (pending == nullptr ||
+                (pending->lastSendTime >= 0.0 && m_time - pending->lastSendTime < resendTimeout)) {
+                nextReliable++;
+                continue;
+            }
+            
+            if (m_datagram.size() + sizeof(MessageHeader) + pending->header.size > DEFAULT_MTU) {
+                break;
+            }
+            
+            appendMessage(m_datagram, pending->header, pending->payload.data());
+            if (pending->sendCount++ > 0) {
+                m_stats.reliableResent++;
+            }
+            pending->lastSendTime = m_time;
+            record.messageIds[record.reliableCount++] = nextReliable;
+            messageCount++;
+            nextReliable++;
+        }
+        
+        // Pre-framed unreliable messages
+        while (unreliableOffset < m_unreliableQueue.size()) {
+            MessageHeader header;
+            std::memcpy(&header, m_unreliableQueue.data() + unreliableOffset, sizeof(MessageHeader));
+            usize framedSize = sizeof(MessageHeader) + header.size;
+            
+            if (m_datagram.size() + framedSize > DEFAULT_MTU) {
+                break;
+            }
+            
+            const u8* framed = m_unreliableQueue.data() + unreliableOffset;
+            m_datagram.insert(m_datagram.end(), framed, framed + framedSize);
+            unreliableOffset += framedSize;
+            messageCount++;
+        }
+        
+        if (messageCount == 0 && !m_ackPending) {
+            break;
+        }
+        
+        // Header carries the current ack state
+        PacketHeader header{};
+        header.magic = PACKET_MAGIC;
+        header.protocolVersion = static_cast<u16>(PROTOCOL_VERSION);
+        header.sequenceNumber = m_localSequence;
+        header.type = messageCount > 0 ? PacketType::Coalesced : PacketType::Ack;
+        header.channel = ChannelType::Default;
+        header.messageCount = messageCount;
+        
+        if (!m_receivedDatagrams.empty()) {
+            header.flags |= PacketHeader::FLAG_HAS_ACK;
+            header.ack = m_remoteSequence;
+            for (u32 i = 0; i < ACK_BITS_COUNT; ++i) {
+                if (m_receivedDatagrams.exists(static_cast<u16>(m_remoteSequence - 1 - i))) {
+                    header.ackBits |= 1u << i;
+                }
+            }
+        }
+        std::memcpy(m_datagram.data(), &header, sizeof(PacketHeader));
+        
+        // A slot still holding an unacked datagram from the previous lap counts as lost
+        u16 evicted = static_cast<u16>(m_localSequence - SENT_PACKET_WINDOW);
+        if (const SentDatagram* old = m_sentDatagrams.find(evicted); old && !old->acked) {
+            m_stats.packetsDropped++;
+        }
+        *m_sentDatagrams.insert(m_localSequence) = record;
+        m_localSequence++;
+        
+        sender(m_datagram.data(), m_datagram.size());
+        
+        m_stats.packetsSent++;
+        m_stats.bytesSent += m_datagram.size();
+        m_stats.lastPacketSent = std::chrono::steady_clock::now();
+        m_timeSinceLastSend = 0.0f;
+        m_ackPending = false;
+        datagramCount++;
+    }
+    
+    m_unreliableQueue.clear();
+    
+    // A graceful disconnect completes once its packet has gone out
+    if (m_state == ConnectionState::Disconnecting) {
+        setState(ConnectionState::Disconnected);
+    }
+    
+    return datagramCount;
+}
+
 void NetworkConnection::setState(ConnectionState newState) {
     if (m_state != newState) {
 #if NOVA_LOG_LEVEL_DEBUG_ENABLED
@@ -541,6 +804,14 @@ void NetworkConnection::setState(ConnectionState newState) {
 }
 
 void NetworkConnection::updateRtt(f32 rttSample) {
+    // First sample seeds the estimate (RFC 6298)
+    if (!m_hasRttSample) {
+        m_hasRttSample = true;
+        m_stats.rttMs = rttSample;
+        m_stats.rttVariance = rttSample * 0.5f;
+        return;
+    }
+    
     // Exponential moving average for RTT
     constexpr f32 alpha = 0.125f;
     m_stats.rttMs = (1.0f - alpha) * m_stats.rttMs + alpha * rttSample;
@@ -550,22 +821,6 @@ void NetworkConnection::updateRtt(f32 rttSample) {
     m_stats.rttVariance = (1.0f - alpha) * m_stats.rttVariance + alpha * rttDiff;
 }
 
-bool NetworkConnection::processReliablePacket(const NetworkPacket& packet) {
-    // Remove acknowledged packets from pending
-    u16 ackSeq = packet.header.sequenceNumber;
-    
-    m_pendingAcks.erase(
-        std::remove_if(m_pendingAcks.begin(), m_pendingAcks.end(),
-            [ackSeq](const NetworkPacket& p) {
-                return p.header.sequenceNumber == ackSeq;
-            }),
-        m_pendingAcks.end()
-    );
-    
-    m_stats.reliableAcked++;
-    return true;
-}
-
 // ============================================================================
 // NetworkServer Implementation
 // ============================================================================
@@ -648,14 +903,16 @@ void NetworkServer::update(f32 deltaTime) {
     for (auto& [id, conn] : m_connections) {
         conn->update(deltaTime);
         
+        // Coalesce and transmit queued messages, resends and acks
+        u64 bytesBefore = conn->getStats().bytesSent;
+        m_stats.totalPacketsSent += conn->flush(*m_socket);
+        m_stats.totalBytesSent += conn->getStats().bytesSent - bytesBefore;
+        
         // Check for disconnected/timed out connections
         if (conn->getState() == ConnectionState::Disconnected ||
             conn->getState() == ConnectionState::TimedOut) {
             toRemove.push_back(id);
         }
-        
-        // Send pending packets
-        // Note: In production, this would be optimized with a proper send queue
     }
     
     // Remove disconnected connections
@@ -758,26 +1015,36 @@ void NetworkServer::processIncomingPackets() {
             break;
         }
         
-        auto packet = NetworkPacket::deserialize(m_receiveBuffer.data(), *result);
-        if (!packet) {
+        PacketHeader header;
+        if (!readPacketHeader(m_receiveBuffer.data(), *result, header)) {
             continue;  // Invalid packet
         }
         
-        packet->source = source;
-        
-        // Handle connection requests
-        if (packet->header.type == PacketType::ConnectionRequest) {
-            handleConnectionRequest(source, *packet);
+        // Handshake packets are rare; everything else is parsed in place
+        if (header.type == PacketType::ConnectionRequest ||
+            header.type == PacketType::ConnectionResponse) {
+            auto packet = NetworkPacket::deserialize(m_receiveBuffer.data(), *result);
+            if (!packet) {
+                continue;
+            }
+            packet->source = source;
+            
+            if (header.type == PacketType::ConnectionRequest) {
+                handleConnectionRequest(source, *packet);
+            } else {
+                handleConnectionResponse(source, *packet);
+            }
             continue;
         }
         
-        // Find existing connection
+        // Find existing connection; until the challenge is answered the source
+        // may be spoofed, so its data must not be delivered or keep it alive
         std::lock_guard<std::mutex> lock(m_mutex);
         auto epIt = m_endpointToConnection.find(source);
         if (epIt != m_endpointToConnection.end()) {
             auto connIt = m_connections.find(epIt->second);
-            if (connIt != m_connections.end()) {
-                connIt->second->processPacket(*packet);
+            if (connIt != m_connections.end() && connIt->second->isConnected()) {
+                connIt->second->processDatagram(m_receiveBuffer.data(), *result);
             }
         }
         
@@ -816,16 +1083,19 @@ void NetworkServer::handleConnectionRequest(const NetworkEndpoint& endpoint,
         }
     });
     
+    // The connection stays Connecting until the response echoes this token;
+    // abandoned handshakes are dropped by the connection timeout
+    std::random_device rd;
+    std::mt19937_64 gen(rd());
+    ConnectionChallenge challengeData;
+    challengeData.challengeToken = gen();
+    conn->beginHandshake(challengeData.challengeToken);
+    
     m_endpointToConnection[endpoint] = connId;
     m_connections[connId] = std::move(conn);
     
     // Send challenge
     auto challenge = NetworkPacket::create(PacketType::ConnectionChallenge);
-    
-    std::random_device rd;
-    std::mt19937_64 gen(rd());
-    ConnectionChallenge challengeData;
-    challengeData.challengeToken = gen();
     challengeData.serverTime = static_cast<u32>(
         std::chrono::duration_cast<std::chrono::milliseconds>(
             std::chrono::system_clock::now().time_since_epoch()
@@ -843,6 +1113,51 @@ void NetworkServer::handleConnectionRequest(const NetworkEndpoint& endpoint,
     NOVA_LOG_INFO(LogCategory::Core, "New connection {} from {}", connId, endpoint.toString());
 }
 
+void NetworkServer::handleConnectionResponse(const NetworkEndpoint& endpoint,
+                                              const NetworkPacket& packet) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    
+    auto epIt = m_endpointToConnection.find(endpoint);
+    if (epIt == m_endpointToConnection.end()) {
+        return;  // No pending handshake for this endpoint
+    }
+    
+    auto connIt = m_connections.find(epIt->second);
+    if (connIt == m_connections.end() || connIt->second->isConnected() ||
+        packet.payload.size() < sizeof(ConnectionResponse)) {
+        return;
+    }
+    
+    ConnectionResponse response;
+    std::memcpy(&response, packet.payload.data(), sizeof(ConnectionResponse));
+    if (!connIt->second->verifyChallenge(response.challengeToken)) {
+        NOVA_LOG_WARN(LogCategory::Core, "Rejected handshake response with a bad challenge from {}",
+                      endpoint.toString());
+        return;
+    }
+    
+    connIt->second->establish();
+    
+    auto accepted = NetworkPacket::create(PacketType::ConnectionAccepted);
+    
+    ConnectionAccepted acceptedData{};
+    acceptedData.connectionId = epIt->second;
+    acceptedData.playerId = static_cast<u32>(epIt->second);
+    acceptedData.serverTime = static_cast<u32>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::system_clock::now().time_since_epoch()
+        ).count()
+    );
+    acceptedData.tickRate = static_cast<f32>(m_config.tickRateHz);
+    acceptedData.assignedPort = m_config.port;
+    
+    accepted.payload.resize(sizeof(ConnectionAccepted));
+    std::memcpy(accepted.payload.data(), &acceptedData, sizeof(ConnectionAccepted));
+    
+    auto serialized = accepted.serialize();
+    (void)m_socket->sendTo(endpoint, serialized.data(), serialized.size());
+}
+
 void NetworkServer::removeConnection(u64 connectionId) {
     auto it = m_connections.find(connectionId);
     if (it != m_connections.end()) {
@@ -983,6 +1298,11 @@ void NetworkClient::update(f32 deltaTime) {
             // Check timeout handled by connection
         }
     }
+    
+    // Coalesce and transmit queued messages, resends and acks
+    if (m_connection && m_socket) {
+        (void)m_connection->flush(*m_socket);
+    }
 }
 
 Result<void> NetworkClient::send(ChannelType channel, const u8* data, usize size,
@@ -1016,14 +1336,14 @@ void NetworkClient::discoverLAN(DiscoveryCallback callback, u32 timeoutMs) {
 void NetworkClient::processIncomingPackets() {
     NetworkEndpoint source;
     
-    while (true) {
+    while (m_socket) {
         auto result = m_socket->receiveFrom(source, m_receiveBuffer.data(), m_receiveBuffer.size());
         if (!result || *result == 0) {
             break;
         }
         
-        auto packet = NetworkPacket::deserialize(m_receiveBuffer.data(), *result);
-        if (!packet) {
+        PacketHeader header;
+        if (!readPacketHeader(m_receiveBuffer.data(), *result, header)) {
             continue;
         }
         
@@ -1032,25 +1352,30 @@ void NetworkClient::processIncomingPackets() {
             continue;
         }
         
-        packet->source = source;
-        
         // Handle handshake packets
-        switch (packet->header.type) {
+        switch (header.type) {
             case PacketType::ConnectionChallenge:
-                handleConnectionChallenge(*packet);
-                break;
-                
             case PacketType::ConnectionAccepted:
-                handleConnectionAccepted(*packet);
-                break;
+            case PacketType::ConnectionRejected: {
+                auto packet = NetworkPacket::deserialize(m_receiveBuffer.data(), *result);
+                if (!packet) {
+                    break;
+                }
+                packet->source = source;
                 
-            case PacketType::ConnectionRejected:
-                handleConnectionRejected(*packet);
+                if (header.type == PacketType::ConnectionChallenge) {
+                    handleConnectionChallenge(*packet);
+                } else if (header.type == PacketType::ConnectionAccepted) {
+                    handleConnectionAccepted(*packet);
+                } else {
+                    handleConnectionRejected(*packet);
+                }
                 break;
+            }
                 
             default:
                 if (m_connection) {
-                    m_connection->processPacket(*packet);
+                    m_connection->processDatagram(m_receiveBuffer.data(), *result);
                 }
                 break;
         }
@@ -1101,6 +1426,10 @@ void NetworkClient::handleConnectionAccepted(const NetworkPacket& packet) {
     
     m_connectionId = accepted.connectionId;
     
+    if (m_connection) {
+        m_connection->establish();
+    }
+    
     setState(ConnectionState::Connected);
     
     NOVA_LOG_INFO(LogCategory::Core, "Connection accepted, ID: {}", m_connectionId);
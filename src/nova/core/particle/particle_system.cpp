@@ -14,6 +14,7 @@
 
 #include <nova/core/particle/particle_system.hpp>
 #include <nova/core/logging/logging.hpp>
+#include <nova/core/memory/memory.hpp>
 
 #include <algorithm>
 #include <cmath>
@@ -424,8 +425,10 @@ void ParticleEmitter::update(f32 deltaTime, const std::vector<ForceField>& globa
         }
     }
     
-    // Combine global forces with emitter forces
-    std::vector<ForceField> allForces = globalForces;
+    // Combine global forces with emitter forces in frame scratch memory
+    memory::FrameScope scratch;
+    auto allForces = scratch.makeVector<ForceField>(globalForces.size() + m_data.forces.size());
+    allForces.insert(allForces.end(), globalForces.begin(), globalForces.end());
     allForces.insert(allForces.end(), m_data.forces.begin(), m_data.forces.end());
     
     // Update particles
@@ -530,7 +533,7 @@ void ParticleEmitter::emitParticle() {
     m_particles.push_back(p);
 }
 
-void ParticleEmitter::updateParticle(Particle& p, f32 dt, const std::vector<ForceField>& forces) {
+void ParticleEmitter::updateParticle(Particle& p, f32 dt, std::span<const ForceField> forces) {
     // Update lifetime
     p.lifetime += dt;
     
@@ -618,7 +621,7 @@ void ParticleEmitter::applyModules(Particle& p, [[maybe_unused]] f32 dt) {
     }
 }
 
-void ParticleEmitter::applyForces(Particle& p, f32 dt, const std::vector<ForceField>& forces) {
+void ParticleEmitter::applyForces(Particle& p, f32 dt, std::span<const ForceField> forces) {
     // Gravity
     p.velocity.y -= m_data.main.gravityModifier * 9.81f * dt;
     
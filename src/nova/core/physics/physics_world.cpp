@@ -6,12 +6,44 @@
  */
 
 #include "nova/core/physics/physics_world.hpp"
+#include "nova/core/logging/metrics.hpp"
+#include "nova/core/memory/memory.hpp"
 #include <chrono>
 #include <algorithm>
 #include <limits>
 
 namespace nova::physics {
 
+namespace {
+
+/// Initial BVH traversal stack (grows in frame memory if the tree is deeper)
+constexpr usize TRAVERSAL_STACK_RESERVE = 64;
+
+/// Physics telemetry, resolved once and shared by all worlds
+struct PhysicsMetrics {
+    profiling::Histogram& step;
+    profiling::Histogram& broadPhase;
+    profiling::Histogram& narrowPhase;
+    profiling::Histogram& solver;
+    profiling::Gauge& contacts;
+    profiling::Gauge& activeBodies;
+
+    static PhysicsMetrics& get() {
+        auto& registry = profiling::MetricsRegistry::get();
+        static PhysicsMetrics metrics{
+            registry.histogram("physics.step", "Physics step duration per frame"),
+            registry.histogram("physics.broadphase", "Broad phase duration per substep"),
+            registry.histogram("physics.narrowphase", "Narrow phase duration per substep"),
+            registry.histogram("physics.solver", "Constraint solver duration per substep"),
+            registry.gauge("physics.contacts", "Contacts in the last substep"),
+            registry.gauge("physics.active_bodies", "Awake dynamic bodies"),
+        };
+        return metrics;
+    }
+};
+
+} // namespace
+
 // Helper for safe ray-AABB intersection that handles zero direction components
 static bool rayIntersectsAABB(const Ray& ray, const AABB& bounds, f32& outNear, f32& outFar) {
     outNear = 0.0f;
@@ -106,6 +138,7 @@ void PhysicsWorld::step(f32 deltaTime) {
     
     auto endTime = std::chrono::high_resolution_clock::now();
     m_stats.totalTime = std::chrono::duration<f32, std::milli>(endTime - startTime).count();
+    PhysicsMetrics::get().step.record(endTime - startTime);
 }
 
 void PhysicsWorld::stepFixed(f32 fixedDeltaTime) {
@@ -133,6 +166,13 @@ void PhysicsWorld::stepFixed(f32 fixedDeltaTime) {
     
     // Phase 6: Handle collision callbacks
     handleCallbacks();
+
+    auto& metrics = PhysicsMetrics::get();
+    metrics.broadPhase.recordMs(m_stats.broadPhaseTime);
+    metrics.narrowPhase.recordMs(m_stats.narrowPhaseTime);
+    metrics.solver.recordMs(m_stats.solverTime);
+    metrics.contacts.set(static_cast<f64>(m_stats.contactCount));
+    metrics.activeBodies.set(static_cast<f64>(m_stats.activeBodies));
 }
 
 void PhysicsWorld::broadPhase() {
@@ -211,8 +251,9 @@ void PhysicsWorld::integrate(f32 deltaTime) {
 void PhysicsWorld::solveConstraints(f32 deltaTime) {
     auto startTime = std::chrono::high_resolution_clock::now();
     
-    // Collect active bodies
-    std::vector<RigidBody*> activeBodies;
+    // Collect active bodies into frame scratch memory
+    memory::FrameScope scratch;
+    auto activeBodies = scratch.makeVector<RigidBody*>(m_bodies.size());
     for (auto& [id, body] : m_bodies) {
         if (body->isActive()) {
             activeBodies.push_back(body.get());
@@ -257,8 +298,10 @@ void PhysicsWorld::handleCallbacks() {
         return;
     }
     
+    memory::FrameScope scratch;
+    
     // Build set of current contact pairs
-    std::vector<std::pair<BodyId, BodyId>> currentPairs;
+    auto currentPairs = scratch.makeVector<std::pair<BodyId, BodyId>>(m_contacts.size());
     for (const auto& contact : m_contacts) {
         currentPairs.emplace_back(
             std::min(contact.bodyA, contact.bodyB),
@@ -267,7 +310,7 @@ void PhysicsWorld::handleCallbacks() {
     }
     
     // Build set of previous contact pairs
-    std::vector<std::pair<BodyId, BodyId>> previousPairs;
+    auto previousPairs = scratch.makeVector<std::pair<BodyId, BodyId>>(m_previousContacts.size());
     for (const auto& contact : m_previousContacts) {
         previousPairs.emplace_back(
             std::min(contact.bodyA, contact.bodyB),
@@ -765,8 +808,9 @@ void BVHBroadPhase::findPairs(std::vector<std::pair<BodyId, BodyId>>& outPairs)
     if (m_root < 0) return;
     
     // Collect all leaves
-    std::vector<i32> leaves;
-    std::vector<i32> stack;
+    memory::FrameScope scratch;
+    auto leaves = scratch.makeVector<i32>(m_nodes.size() / 2 + 1);
+    auto stack = scratch.makeVector<i32>(TRAVERSAL_STACK_RESERVE);
     stack.push_back(m_root);
     
     while (!stack.empty()) {
@@ -817,7 +861,8 @@ void BVHBroadPhase::queryRay(const Ray& ray, std::vector<BodyId>& outBodies) {
     
     if (m_root < 0) return;
     
-    std::vector<i32> stack;
+    memory::FrameScope scratch;
+    auto stack = scratch.makeVector<i32>(TRAVERSAL_STACK_RESERVE);
     stack.push_back(m_root);
     
     while (!stack.empty()) {
@@ -1082,7 +1127,7 @@ SequentialImpulseSolver::SequentialImpulseSolver(u32 velocityIterations, u32 pos
 {
 }
 
-void SequentialImpulseSolver::solveVelocities(std::vector<RigidBody*>& bodies,
+void SequentialImpulseSolver::solveVelocities(std::span<RigidBody* const> bodies,
                                                std::vector<ContactManifold>& contacts,
                                                f32 deltaTime) {
     // Warm start
@@ -1111,7 +1156,7 @@ void SequentialImpulseSolver::solveVelocities(std::vector<RigidBody*>& bodies,
     }
 }
 
-void SequentialImpulseSolver::warmStart(std::vector<RigidBody*>& bodies,
+void SequentialImpulseSolver::warmStart(std::span<RigidBody* const> bodies,
                                          std::vector<ContactManifold>& contacts) {
     for (auto& contact : contacts) {
         if (contact.isSensor) continue;
@@ -1240,7 +1285,7 @@ void SequentialImpulseSolver::solveVelocityConstraint(RigidBody* bodyA, RigidBod
     }
 }
 
-void SequentialImpulseSolver::solvePositions(std::vector<RigidBody*>& bodies,
+void SequentialImpulseSolver::solvePositions(std::span<RigidBody* const> bodies,
                                               std::vector<ContactManifold>& contacts,
                                               f32 deltaTime) {
     (void)deltaTime; // Unused but part of interface
@@ -0,0 +1,424 @@
+// =============================================================================
+// NovaCore Engine - File Watcher Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/platform/file_watcher.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+
+#if defined(__linux__)
+    #include <poll.h>
+    #include <sys/eventfd.h>
+    #include <sys/inotify.h>
+    #include <unistd.h>
+    #define NOVA_FILE_WATCHER_INOTIFY 1
+#endif
+
+namespace nova::platform {
+
+namespace fs = std::filesystem;
+
+namespace {
+
+i64 steadyNowNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/// Combine two changes to the same file into the one a reader should see
+FileChange mergeChange(FileChange previous, FileChange next) {
+    if (previous == FileChange::Created && next == FileChange::Modified) {
+        return FileChange::Created;
+    }
+    if (previous == FileChange::Removed && next == FileChange::Created) {
+        return FileChange::Modified;    // Replaced, e.g. by a save through a temporary file
+    }
+    return next;
+}
+
+/// Whether a subscription rooted at @p root sees @p path
+bool covers(const std::string& root, bool recursive, const std::string& path) {
+    if (path.size() <= root.size() || !path.starts_with(root) || path[root.size()] != '/') {
+        return false;
+    }
+    return recursive || path.find('/', root.size() + 1) == std::string::npos;
+}
+
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+// Files are reported once written and closed, not on every write
+constexpr u32 WATCH_MASK = IN_CREATE | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_ONLYDIR;
+#endif
+
+} // namespace
+
+// =============================================================================
+// Lifetime
+// =============================================================================
+
+FileWatcher& FileWatcher::get() {
+    static FileWatcher instance;
+    return instance;
+}
+
+FileWatcher::~FileWatcher() {
+    {
+        std::lock_guard lock(m_mutex);
+        m_running = false;
+    }
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+    if (m_wakeFd >= 0) {
+        u64 one = 1;
+        [[maybe_unused]] auto written = ::write(m_wakeFd, &one, sizeof(one));
+    }
+#endif
+    m_wakeCV.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+    if (m_notifyFd >= 0) {
+        ::close(m_notifyFd);
+    }
+    if (m_wakeFd >= 0) {
+        ::close(m_wakeFd);
+    }
+#endif
+}
+
+bool FileWatcher::isNative() noexcept {
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+    return true;
+#else
+    return false;
+#endif
+}
+
+std::string FileWatcher::normalizePath(const std::string& path) {
+    std::error_code ec;
+    fs::path absolute = fs::absolute(path, ec);
+    std::string result = (ec ? fs::path(path) : absolute).lexically_normal().generic_string();
+    if (result.size() > 1 && result.back() == '/') {
+        result.pop_back();
+    }
+    return result;
+}
+
+void FileWatcher::start() {
+    if (m_running) {
+        return;
+    }
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+    m_notifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    m_wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (m_notifyFd < 0 || m_wakeFd < 0) {
+        return;
+    }
+#endif
+    m_running = true;
+    m_thread = std::thread(&FileWatcher::run, this);
+}
+
+// =============================================================================
+// Subscriptions
+// =============================================================================
+
+FileWatcher::WatchId FileWatcher::watch(const std::string& directory, bool recursive) {
+    std::string root = normalizePath(directory);
+    std::error_code ec;
+    if (!fs::is_directory(root, ec)) {
+        return INVALID_WATCH;
+    }
+
+    std::lock_guard lock(m_mutex);
+    start();
+    if (!m_running) {
+        return INVALID_WATCH;
+    }
+
+    WatchId id = m_nextId++;
+    Subscription& subscription = m_subscriptions[id];
+    subscription.root = root;
+    subscription.recursive = recursive;
+
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+    if (!addDirectory(subscription, root)) {
+        m_subscriptions.erase(id);
+        return INVALID_WATCH;
+    }
+    if (recursive) {
+        for (fs::recursive_directory_iterator it(root, fs::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            if (it->is_directory(ec)) {
+                addDirectory(subscription, normalizePath(it->path().string()));
+            }
+        }
+    }
+#else
+    scan(subscription, false, steadyNowNs());
+#endif
+    return id;
+}
+
+void FileWatcher::unwatch(WatchId id) {
+    std::lock_guard lock(m_mutex);
+    auto it = m_subscriptions.find(id);
+    if (it == m_subscriptions.end()) {
+        return;
+    }
+    releaseHandles(it->second);
+    m_subscriptions.erase(it);
+}
+
+std::vector<FileEvent> FileWatcher::poll(WatchId id) {
+    std::vector<FileEvent> events;
+    std::lock_guard lock(m_mutex);
+    auto it = m_subscriptions.find(id);
+    if (it == m_subscriptions.end() || it->second.ready.empty()) {
+        return events;
+    }
+    events.reserve(it->second.ready.size());
+    for (auto& [path, change] : it->second.ready) {
+        events.push_back({path, change});
+    }
+    it->second.ready.clear();
+    return events;
+}
+
+void FileWatcher::setDebounce(f32 seconds) {
+    std::lock_guard lock(m_mutex);
+    m_debounceNs = static_cast<i64>(std::max(seconds, 0.0f) * 1e9f);
+}
+
+// =============================================================================
+// Watcher Thread
+// =============================================================================
+
+void FileWatcher::run() {
+    std::unique_lock lock(m_mutex);
+    while (m_running) {
+        waitForEvents(lock);
+        deliverSettled(steadyNowNs());
+    }
+}
+
+void FileWatcher::record(const std::string& path, FileChange change, i64 nowNs) {
+    auto [it, inserted] = m_pending.try_emplace(path, PendingChange{change, nowNs});
+    if (!inserted) {
+        it->second.change = mergeChange(it->second.change, change);
+        it->second.lastEventNs = nowNs;
+    }
+}
+
+void FileWatcher::deliverSettled(i64 nowNs) {
+    for (auto it = m_pending.begin(); it != m_pending.end();) {
+        if (nowNs - it->second.lastEventNs < m_debounceNs) {
+            ++it;
+            continue;
+        }
+        for (auto& [id, subscription] : m_subscriptions) {
+            if (!covers(subscription.root, subscription.recursive, it->first)) {
+                continue;
+            }
+            auto [ready, inserted] = subscription.ready.try_emplace(it->first, it->second.change);
+            if (!inserted) {
+                ready->second = mergeChange(ready->second, it->second.change);
+            }
+        }
+        it = m_pending.erase(it);
+    }
+}
+
+#if defined(NOVA_FILE_WATCHER_INOTIFY)
+
+void FileWatcher::waitForEvents(std::unique_lock<std::mutex>& lock) {
+    // Sleep until the kernel has events, or until pending ones settle
+    int timeoutMs = m_pending.empty() ? -1 : static_cast<int>(std::max<i64>(m_debounceNs / 1000000, 1));
+    pollfd fds[2] = {{m_notifyFd, POLLIN, 0}, {m_wakeFd, POLLIN, 0}};
+
+    lock.unlock();
+    int ready = ::poll(fds, 2, timeoutMs);
+    if (ready > 0 && (fds[1].revents & POLLIN)) {
+        u64 value;
+        [[maybe_unused]] auto consumed = ::read(m_wakeFd, &value, sizeof(value));
+    }
+    lock.lock();
+
+    if (ready > 0 && (fds[0].revents & POLLIN)) {
+        readNativeEvents(steadyNowNs());
+    }
+}
+
+bool FileWatcher::addDirectory(Subscription& subscription, const std::string& directory) {
+    int handle = inotify_add_watch(m_notifyFd, directory.c_str(), WATCH_MASK);
+    if (handle < 0) {
+        return false;
+    }
+    m_handlePaths.try_emplace(handle, directory);
+    m_handleRefs[handle]++;
+    subscription.handles.push_back(handle);
+    return true;
+}
+
+void FileWatcher::releaseHandles(Subscription& subscription) {
+    for (int handle : subscription.handles) {
+        auto it = m_handleRefs.find(handle);
+        if (it == m_handleRefs.end() || --it->second > 0) {
+            continue;
+        }
+        inotify_rm_watch(m_notifyFd, handle);
+        m_handleRefs.erase(it);
+        m_handlePaths.erase(handle);
+    }
+    subscription.handles.clear();
+}
+
+void FileWatcher::readNativeEvents(i64 nowNs) {
+    alignas(inotify_event) char buffer[16 * 1024];
+    for (;;) {
+        ssize_t length = ::read(m_notifyFd, buffer, sizeof(buffer));
+        if (length <= 0) {
+            return;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+
+            auto dir = m_handlePaths.find(event->wd);
+            if (dir == m_handlePaths.end()) {
+                continue;
+            }
+            if (event->mask & IN_IGNORED) {
+                // The directory is gone; the descriptor may be reused
+                for (auto& [id, subscription] : m_subscriptions) {
+                    std::erase(subscription.handles, event->wd);
+                }
+                m_handleRefs.erase(event->wd);
+                m_handlePaths.erase(dir);
+                continue;
+            }
+            if (event->len == 0) {
+                continue;
+            }
+
+            std::string path = dir->second + '/' + event->name;
+            if (event->mask & IN_ISDIR) {
+                if (!(event->mask & (IN_CREATE | IN_MOVED_TO))) {
+                    continue;
+                }
+                // Watch the new directory, and report what was written into
+                // it before the watch was in place
+                for (auto& [id, subscription] : m_subscriptions) {
+                    if (!subscription.recursive || !covers(subscription.root, true, path)) {
+                        continue;
+                    }
+                    addDirectory(subscription, path);
+                    std::error_code ec;
+                    for (fs::recursive_directory_iterator it(path, fs::directory_options::skip_permission_denied, ec), end;
+                         !ec && it != end; it.increment(ec)) {
+                        std::string child = normalizePath(it->path().string());
+                        if (it->is_directory(ec)) {
+                            addDirectory(subscription, child);
+                        } else {
+                            record(child, FileChange::Created, nowNs);
+                        }
+                    }
+                }
+                continue;
+            }
+
+            if (event->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                record(path, FileChange::Removed, nowNs);
+            } else if (event->mask & IN_CREATE) {
+                record(path, FileChange::Created, nowNs);
+            } else {
+                record(path, FileChange::Modified, nowNs);
+            }
+        }
+    }
+}
+
+void FileWatcher::scan(Subscription&, bool, i64) {}
+
+#else // Portable fallback
+
+void FileWatcher::waitForEvents(std::unique_lock<std::mutex>& lock) {
+    i64 intervalNs = static_cast<i64>(FALLBACK_SCAN_INTERVAL * 1e9f);
+    if (!m_pending.empty()) {
+        intervalNs = std::min(intervalNs, std::max<i64>(m_debounceNs, 1000000));
+    }
+    m_wakeCV.wait_for(lock, std::chrono::nanoseconds(intervalNs));
+    if (!m_running) {
+        return;
+    }
+
+    i64 now = steadyNowNs();
+    for (auto& [id, subscription] : m_subscriptions) {
+        scan(subscription, true, now);
+    }
+}
+
+bool FileWatcher::addDirectory(Subscription&, const std::string&) {
+    return true;
+}
+
+void FileWatcher::releaseHandles(Subscription&) {}
+
+void FileWatcher::readNativeEvents(i64) {}
+
+void FileWatcher::scan(Subscription& subscription, bool report, i64 nowNs) {
+    std::unordered_map<std::string, i64> current;
+    current.reserve(subscription.snapshot.size());
+
+    auto visit = [&](const fs::directory_entry& entry) {
+        std::error_code ec;
+        if (!entry.is_regular_file(ec)) {
+            return;
+        }
+        auto time = entry.last_write_time(ec);
+        if (ec) {
+            return;
+        }
+        std::string path = normalizePath(entry.path().string());
+        i64 stamp = static_cast<i64>(time.time_since_epoch().count());
+        if (report) {
+            auto it = subscription.snapshot.find(path);
+            if (it == subscription.snapshot.end()) {
+                record(path, FileChange::Created, nowNs);
+            } else if (it->second != stamp) {
+                record(path, FileChange::Modified, nowNs);
+            }
+        }
+        current.emplace(std::move(path), stamp);
+    };
+
+    std::error_code ec;
+    if (subscription.recursive) {
+        for (fs::recursive_directory_iterator it(subscription.root, fs::directory_options::skip_permission_denied, ec), end;
+             !ec && it != end; it.increment(ec)) {
+            visit(*it);
+        }
+    } else {
+        for (fs::directory_iterator it(subscription.root, ec), end; !ec && it != end; it.increment(ec)) {
+            visit(*it);
+        }
+    }
+
+    if (report) {
+        for (const auto& [path, stamp] : subscription.snapshot) {
+            if (!current.contains(path)) {
+                record(path, FileChange::Removed, nowNs);
+            }
+        }
+    }
+    subscription.snapshot = std::move(current);
+}
+
+#endif
+
+} // namespace nova::platform
@@ -0,0 +1,78 @@
+// =============================================================================
+// NovaCore Engine - Worker Pool Implementation
+// =============================================================================
+// Platform: NovaForge | Engine: NovaCore
+// Company: WeNova Interactive (operating as Kayden Shawn Massengill)
+// =============================================================================
+
+#include "nova/core/platform/worker_pool.hpp"
+
+namespace nova::platform {
+
+WorkerPool::WorkerPool(u32 threadCount) {
+    for (u32 i = 1; i < threadCount; ++i) {
+        m_threads.emplace_back([this] { workerMain(); });
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::run(u32 jobCount, const std::function<void(u32)>& job) {
+    if (m_threads.empty() || jobCount <= 1) {
+        for (u32 i = 0; i < jobCount; ++i) {
+            job(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_jobCount = jobCount;
+        m_nextJob.store(0, std::memory_order_relaxed);
+        m_busy = static_cast<u32>(m_threads.size());
+        ++m_generation;
+    }
+    m_wake.notify_all();
+
+    drain();
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [this] { return m_busy == 0; });
+    m_job = nullptr;
+}
+
+void WorkerPool::drain() {
+    for (u32 i; (i = m_nextJob.fetch_add(1, std::memory_order_relaxed)) < m_jobCount;) {
+        (*m_job)(i);
+    }
+}
+
+void WorkerPool::workerMain() {
+    u64 seen = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [&] { return m_stop || m_generation != seen; });
+        if (m_stop) return;
+        seen = m_generation;
+
+        lock.unlock();
+        drain();
+        lock.lock();
+
+        if (--m_busy == 0) {
+            m_done.notify_one();
+        }
+    }
+}
+
+} // namespace nova::platform
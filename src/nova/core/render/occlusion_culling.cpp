@@ -0,0 +1,746 @@
+/**
+ * @file occlusion_culling.cpp
+ * @brief Software occlusion rasterizer and batch culling
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/render/occlusion_culling.hpp"
+#include "nova/core/math/math_common.hpp"
+#include "nova/core/platform/worker_pool.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <functional>
+
+namespace nova {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+f32 elapsedMs(Clock::time_point start) {
+    return std::chrono::duration<f32, std::milli>(Clock::now() - start).count();
+}
+
+/// Occluders are clipped here and occludees crossing it are visible
+constexpr f32 NEAR_CLIP_W = 1e-3f;
+
+/// Occluders are clipped to this multiple of the screen in NDC, which keeps
+/// edge functions well inside float precision
+constexpr f32 GUARD_BAND = 2.0f;
+
+/// Boxes per job when testing in parallel; a multiple of 64 so jobs never
+/// share an output word
+constexpr u32 TEST_BATCH_SIZE = 256;
+
+/// Objects per job when frustum culling in parallel; also a multiple of 64
+constexpr u32 CULL_BATCH_SIZE = 8192;
+
+constexpr u32 BLOCK_SIZE = 8;
+
+// ============================================================================
+// 8-Wide Float Helpers
+// ============================================================================
+
+#if NOVA_SIMD_AVX2
+
+using Float8 = __m256;
+using Mask8 = __m256;
+
+NOVA_FORCE_INLINE Float8 splat8(f32 v) { return _mm256_set1_ps(v); }
+NOVA_FORCE_INLINE Float8 load8(const f32* p) { return _mm256_loadu_ps(p); }
+NOVA_FORCE_INLINE void store8(f32* p, Float8 v) { _mm256_storeu_ps(p, v); }
+NOVA_FORCE_INLINE Float8 add8(Float8 a, Float8 b) { return _mm256_add_ps(a, b); }
+NOVA_FORCE_INLINE Float8 sub8(Float8 a, Float8 b) { return _mm256_sub_ps(a, b); }
+NOVA_FORCE_INLINE Float8 mul8(Float8 a, Float8 b) { return _mm256_mul_ps(a, b); }
+NOVA_FORCE_INLINE Float8 min8(Float8 a, Float8 b) { return _mm256_min_ps(a, b); }
+NOVA_FORCE_INLINE Float8 max8(Float8 a, Float8 b) { return _mm256_max_ps(a, b); }
+NOVA_FORCE_INLINE Mask8 ge8(Float8 a, Float8 b) { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+NOVA_FORCE_INLINE Mask8 and8(Mask8 a, Mask8 b) { return _mm256_and_ps(a, b); }
+NOVA_FORCE_INLINE Float8 select8(Mask8 m, Float8 a, Float8 b) { return _mm256_blendv_ps(b, a, m); }
+NOVA_FORCE_INLINE bool any8(Mask8 m) { return _mm256_movemask_ps(m) != 0; }
+NOVA_FORCE_INLINE u32 bits8(Mask8 m) { return static_cast<u32>(_mm256_movemask_ps(m)); }
+
+#elif NOVA_SIMD_NEON
+
+struct Float8 { float32x4_t lo, hi; };
+struct Mask8 { uint32x4_t lo, hi; };
+
+NOVA_FORCE_INLINE Float8 splat8(f32 v) { return {vdupq_n_f32(v), vdupq_n_f32(v)}; }
+NOVA_FORCE_INLINE Float8 load8(const f32* p) { return {vld1q_f32(p), vld1q_f32(p + 4)}; }
+NOVA_FORCE_INLINE void store8(f32* p, Float8 v) { vst1q_f32(p, v.lo); vst1q_f32(p + 4, v.hi); }
+NOVA_FORCE_INLINE Float8 add8(Float8 a, Float8 b) { return {vaddq_f32(a.lo, b.lo), vaddq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Float8 sub8(Float8 a, Float8 b) { return {vsubq_f32(a.lo, b.lo), vsubq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Float8 mul8(Float8 a, Float8 b) { return {vmulq_f32(a.lo, b.lo), vmulq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Float8 min8(Float8 a, Float8 b) { return {vminq_f32(a.lo, b.lo), vminq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Float8 max8(Float8 a, Float8 b) { return {vmaxq_f32(a.lo, b.lo), vmaxq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Mask8 ge8(Float8 a, Float8 b) { return {vcgeq_f32(a.lo, b.lo), vcgeq_f32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Mask8 and8(Mask8 a, Mask8 b) { return {vandq_u32(a.lo, b.lo), vandq_u32(a.hi, b.hi)}; }
+NOVA_FORCE_INLINE Float8 select8(Mask8 m, Float8 a, Float8 b) {
+    return {vbslq_f32(m.lo, a.lo, b.lo), vbslq_f32(m.hi, a.hi, b.hi)};
+}
+NOVA_FORCE_INLINE bool any8(Mask8 m) { return vmaxvq_u32(vorrq_u32(m.lo, m.hi)) != 0; }
+NOVA_FORCE_INLINE u32 bits8(Mask8 m) {
+    const uint32x4_t weights = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(m.lo, weights)) | (vaddvq_u32(vandq_u32(m.hi, weights)) << 4);
+}
+
+#else
+
+struct Float8 { f32 v[8]; };
+struct Mask8 { bool v[8]; };
+
+template<typename Op>
+NOVA_FORCE_INLINE Float8 map8(Float8 a, Float8 b, Op op) {
+    Float8 r;
+    for (u32 i = 0; i < 8; ++i) r.v[i] = op(a.v[i], b.v[i]);
+    return r;
+}
+
+NOVA_FORCE_INLINE Float8 splat8(f32 v) { return {{v, v, v, v, v, v, v, v}}; }
+NOVA_FORCE_INLINE Float8 load8(const f32* p) {
+    Float8 r;
+    for (u32 i = 0; i < 8; ++i) r.v[i] = p[i];
+    return r;
+}
+NOVA_FORCE_INLINE void store8(f32* p, Float8 v) {
+    for (u32 i = 0; i < 8; ++i) p[i] = v.v[i];
+}
+NOVA_FORCE_INLINE Float8 add8(Float8 a, Float8 b) { return map8(a, b, [](f32 x, f32 y) { return x + y; }); }
+NOVA_FORCE_INLINE Float8 sub8(Float8 a, Float8 b) { return map8(a, b, [](f32 x, f32 y) { return x - y; }); }
+NOVA_FORCE_INLINE Float8 mul8(Float8 a, Float8 b) { return map8(a, b, [](f32 x, f32 y) { return x * y; }); }
+NOVA_FORCE_INLINE Float8 min8(Float8 a, Float8 b) { return map8(a, b, [](f32 x, f32 y) { return std::min(x, y); }); }
+NOVA_FORCE_INLINE Float8 max8(Float8 a, Float8 b) { return map8(a, b, [](f32 x, f32 y) { return std::max(x, y); }); }
+NOVA_FORCE_INLINE Mask8 ge8(Float8 a, Float8 b) {
+    Mask8 r;
+    for (u32 i = 0; i < 8; ++i) r.v[i] = a.v[i] >= b.v[i];
+    return r;
+}
+NOVA_FORCE_INLINE Mask8 and8(Mask8 a, Mask8 b) {
+    Mask8 r;
+    for (u32 i = 0; i < 8; ++i) r.v[i] = a.v[i] && b.v[i];
+    return r;
+}
+NOVA_FORCE_INLINE Float8 select8(Mask8 m, Float8 a, Float8 b) {
+    Float8 r;
+    for (u32 i = 0; i < 8; ++i) r.v[i] = m.v[i] ? a.v[i] : b.v[i];
+    return r;
+}
+NOVA_FORCE_INLINE bool any8(Mask8 m) {
+    for (u32 i = 0; i < 8; ++i) {
+        if (m.v[i]) return true;
+    }
+    return false;
+}
+NOVA_FORCE_INLINE u32 bits8(Mask8 m) {
+    u32 bits = 0;
+    for (u32 i = 0; i < 8; ++i) bits |= static_cast<u32>(m.v[i]) << i;
+    return bits;
+}
+
+#endif
+
+alignas(32) constexpr f32 LANE_OFFSETS[8] = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+
+f32 reduceMin8(Float8 v) {
+    alignas(32) f32 lanes[8];
+    store8(lanes, v);
+    return *std::min_element(lanes, lanes + 8);
+}
+
+// ============================================================================
+// Clipping
+// ============================================================================
+
+/// Signed distance of a clip-space vertex to the near plane and guard band
+f32 clipDistance(const Vec4& v, u32 plane) {
+    switch (plane) {
+        case 0: return v.w - NEAR_CLIP_W;
+        case 1: return GUARD_BAND * v.w - v.x;
+        case 2: return GUARD_BAND * v.w + v.x;
+        case 3: return GUARD_BAND * v.w - v.y;
+        default: return GUARD_BAND * v.w + v.y;
+    }
+}
+
+constexpr u32 CLIP_PLANE_COUNT = 5;
+
+/// Clip a convex polygon against one plane; returns the new vertex count
+u32 clipPolygon(const Vec4* in, u32 count, Vec4* out, u32 plane) {
+    u32 outCount = 0;
+    for (u32 i = 0; i < count; ++i) {
+        const Vec4& a = in[i];
+        const Vec4& b = in[(i + 1) % count];
+        f32 da = clipDistance(a, plane);
+        f32 db = clipDistance(b, plane);
+        if (da >= 0.0f) {
+            out[outCount++] = a;
+        }
+        if ((da >= 0.0f) != (db >= 0.0f)) {
+            out[outCount++] = a + (b - a) * (da / (da - db));
+        }
+    }
+    return outCount;
+}
+
+} // namespace
+
+// ============================================================================
+// SoftwareOcclusionBuffer
+// ============================================================================
+
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer() {
+    resize(OcclusionConfig::SOFTWARE_BUFFER_WIDTH, OcclusionConfig::SOFTWARE_BUFFER_HEIGHT);
+}
+
+SoftwareOcclusionBuffer::~SoftwareOcclusionBuffer() = default;
+SoftwareOcclusionBuffer::SoftwareOcclusionBuffer(SoftwareOcclusionBuffer&&) noexcept = default;
+SoftwareOcclusionBuffer& SoftwareOcclusionBuffer::operator=(SoftwareOcclusionBuffer&&) noexcept = default;
+
+void SoftwareOcclusionBuffer::resize(u32 width, u32 height) {
+    m_width = std::max(BLOCK_SIZE, (width + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1));
+    m_height = std::max(BLOCK_SIZE, (height + BLOCK_SIZE - 1) & ~(BLOCK_SIZE - 1));
+    m_tilesX = (m_width + OcclusionConfig::SOFTWARE_TILE_SIZE - 1) / OcclusionConfig::SOFTWARE_TILE_SIZE;
+    m_tilesY = (m_height + OcclusionConfig::SOFTWARE_TILE_SIZE - 1) / OcclusionConfig::SOFTWARE_TILE_SIZE;
+
+    m_depth.assign(static_cast<usize>(m_width) * m_height, 0.0f);
+    m_blockMin.assign(static_cast<usize>(m_width / BLOCK_SIZE) * (m_height / BLOCK_SIZE), 0.0f);
+    m_bins.assign(static_cast<usize>(m_tilesX) * m_tilesY, {});
+    m_triangles.clear();
+}
+
+void SoftwareOcclusionBuffer::setThreadCount(u32 threadCount) {
+    m_threadCount = std::max(1u, threadCount);
+    if (m_threadCount == 1) {
+        m_pool.reset();
+    } else if (!m_pool || m_pool->getThreadCount() != m_threadCount) {
+        m_pool = std::make_unique<platform::WorkerPool>(m_threadCount);
+    }
+}
+
+void SoftwareOcclusionBuffer::beginFrame() {
+    m_triangles.clear();
+    m_stats = {};
+    std::fill(m_depth.begin(), m_depth.end(), 0.0f);
+    std::fill(m_blockMin.begin(), m_blockMin.end(), 0.0f);
+}
+
+bool SoftwareOcclusionBuffer::addOccluder(std::span<const Vec3> vertices, std::span<const u32> indices,
+                                          const Mat4& world) {
+    if (m_stats.occluders >= OcclusionConfig::MAX_SOFTWARE_OCCLUDERS) {
+        return false;
+    }
+    m_stats.occluders++;
+
+    Mat4 transform = m_viewProjection * world;
+    m_clipVertices.resize(vertices.size());
+    for (usize i = 0; i < vertices.size(); ++i) {
+        const Vec3& v = vertices[i];
+        m_clipVertices[i] = transform * Vec4{v.x, v.y, v.z, 1.0f};
+    }
+
+    for (usize i = 0; i + 2 < indices.size(); i += 3) {
+        u32 i0 = indices[i], i1 = indices[i + 1], i2 = indices[i + 2];
+        if (i0 >= vertices.size() || i1 >= vertices.size() || i2 >= vertices.size()) {
+            m_stats.rejectedTriangles++;
+            continue;
+        }
+
+        // Triangles fully inside need no clipping, which is the common case
+        std::array<Vec4, 3 + CLIP_PLANE_COUNT> polygon = {m_clipVertices[i0], m_clipVertices[i1], m_clipVertices[i2]};
+        std::array<Vec4, 3 + CLIP_PLANE_COUNT> scratch;
+        u32 count = 3;
+        for (u32 plane = 0; plane < CLIP_PLANE_COUNT && count >= 3; ++plane) {
+            bool inside = true;
+            for (u32 v = 0; v < count; ++v) {
+                inside &= clipDistance(polygon[v], plane) >= 0.0f;
+            }
+            if (!inside) {
+                count = clipPolygon(polygon.data(), count, scratch.data(), plane);
+                polygon = scratch;
+            }
+        }
+        if (count < 3) {
+            m_stats.rejectedTriangles++;
+            continue;
+        }
+
+        for (u32 v = 1; v + 1 < count; ++v) {
+            setupTriangle(polygon[0], polygon[v], polygon[v + 1]);
+        }
+    }
+    return true;
+}
+
+void SoftwareOcclusionBuffer::setupTriangle(const Vec4& v0, const Vec4& v1, const Vec4& v2) {
+    f32 x[3], y[3], z[3];
+    const Vec4* clip[3] = {&v0, &v1, &v2};
+    for (u32 i = 0; i < 3; ++i) {
+        f32 invW = 1.0f / clip[i]->w;
+        x[i] = (clip[i]->x * invW * 0.5f + 0.5f) * static_cast<f32>(m_width);
+        y[i] = (0.5f - clip[i]->y * invW * 0.5f) * static_cast<f32>(m_height);
+        z[i] = invW;
+    }
+
+    // Occluders are two-sided: orient every triangle counter-clockwise
+    f32 area = (x[1] - x[0]) * (y[2] - y[0]) - (x[2] - x[0]) * (y[1] - y[0]);
+    if (std::abs(area) < 1e-6f) {
+        m_stats.rejectedTriangles++;
+        return;
+    }
+    if (area < 0.0f) {
+        std::swap(x[1], x[2]);
+        std::swap(y[1], y[2]);
+        std::swap(z[1], z[2]);
+        area = -area;
+    }
+
+    // Pixels whose centers can be covered
+    Triangle tri;
+    tri.minX = std::max(0, static_cast<i32>(std::ceil(std::min({x[0], x[1], x[2]}) - 0.5f)));
+    tri.minY = std::max(0, static_cast<i32>(std::ceil(std::min({y[0], y[1], y[2]}) - 0.5f)));
+    tri.maxX = std::min(static_cast<i32>(m_width) - 1, static_cast<i32>(std::floor(std::max({x[0], x[1], x[2]}) - 0.5f)));
+    tri.maxY = std::min(static_cast<i32>(m_height) - 1, static_cast<i32>(std::floor(std::max({y[0], y[1], y[2]}) - 0.5f)));
+    if (tri.minX > tri.maxX || tri.minY > tri.maxY) {
+        m_stats.rejectedTriangles++;
+        return;
+    }
+
+    // Edge k is opposite vertex k, so its value over the area is that
+    // vertex's barycentric weight
+    constexpr u32 EDGE_START[3] = {1, 2, 0};
+    constexpr u32 EDGE_END[3] = {2, 0, 1};
+    f32 invArea = 1.0f / area;
+    tri.depthA = tri.depthB = tri.depthC = 0.0f;
+    for (u32 k = 0; k < 3; ++k) {
+        u32 i = EDGE_START[k], j = EDGE_END[k];
+        tri.edgeA[k] = y[i] - y[j];
+        tri.edgeB[k] = x[j] - x[i];
+        tri.edgeC[k] = -(tri.edgeA[k] * x[i] + tri.edgeB[k] * y[i]);
+        tri.depthA += tri.edgeA[k] * z[k] * invArea;
+        tri.depthB += tri.edgeB[k] * z[k] * invArea;
+        tri.depthC += tri.edgeC[k] * z[k] * invArea;
+    }
+
+    // Push the plane back by its largest change within a pixel, but never
+    // behind the farthest vertex
+    tri.depthC -= 0.5f * (std::abs(tri.depthA) + std::abs(tri.depthB));
+    tri.depthMin = std::min({z[0], z[1], z[2]});
+
+    m_triangles.push_back(tri);
+    m_stats.triangles++;
+}
+
+void SoftwareOcclusionBuffer::rasterize() {
+    auto start = Clock::now();
+
+    std::fill(m_depth.begin(), m_depth.end(), 0.0f);
+    std::fill(m_blockMin.begin(), m_blockMin.end(), 0.0f);
+    for (auto& bin : m_bins) {
+        bin.clear();
+    }
+
+    constexpr u32 TILE = OcclusionConfig::SOFTWARE_TILE_SIZE;
+    m_stats.binnedTriangles = 0;
+    for (u32 t = 0; t < m_triangles.size(); ++t) {
+        const Triangle& tri = m_triangles[t];
+        for (u32 ty = static_cast<u32>(tri.minY) / TILE; ty <= static_cast<u32>(tri.maxY) / TILE; ++ty) {
+            for (u32 tx = static_cast<u32>(tri.minX) / TILE; tx <= static_cast<u32>(tri.maxX) / TILE; ++tx) {
+                m_bins[ty * m_tilesX + tx].push_back(t);
+                m_stats.binnedTriangles++;
+            }
+        }
+    }
+
+    // Tiles own disjoint pixels and blocks, so they rasterize independently
+    u32 tileCount = m_tilesX * m_tilesY;
+    if (m_pool) {
+        std::function<void(u32)> job = [this](u32 tile) { rasterizeTile(tile); };
+        m_pool->run(tileCount, job);
+    } else {
+        for (u32 tile = 0; tile < tileCount; ++tile) {
+            rasterizeTile(tile);
+        }
+    }
+
+    m_stats.rasterizeTimeMs = elapsedMs(start);
+}
+
+void SoftwareOcclusionBuffer::rasterizeTile(u32 tile) {
+    if (m_bins[tile].empty()) {
+        return;
+    }
+
+    constexpr i32 TILE = static_cast<i32>(OcclusionConfig::SOFTWARE_TILE_SIZE);
+    const i32 tileX0 = static_cast<i32>(tile % m_tilesX) * TILE;
+    const i32 tileY0 = static_cast<i32>(tile / m_tilesX) * TILE;
+    const i32 tileX1 = std::min(tileX0 + TILE, static_cast<i32>(m_width)) - 1;
+    const i32 tileY1 = std::min(tileY0 + TILE, static_cast<i32>(m_height)) - 1;
+
+    const Float8 laneCenters = add8(load8(LANE_OFFSETS), splat8(0.5f));
+    const Float8 zero = splat8(0.0f);
+
+    for (u32 index : m_bins[tile]) {
+        const Triangle& tri = m_triangles[index];
+        // Rows start on an 8-pixel boundary; lanes outside the triangle fail
+        // the edge tests
+        const i32 minX = std::max(tri.minX, tileX0) & ~static_cast<i32>(BLOCK_SIZE - 1);
+        const i32 maxX = std::min(tri.maxX, tileX1);
+        const i32 minY = std::max(tri.minY, tileY0);
+        const i32 maxY = std::min(tri.maxY, tileY1);
+
+        const Float8 a0 = splat8(tri.edgeA[0]), a1 = splat8(tri.edgeA[1]), a2 = splat8(tri.edgeA[2]);
+        const Float8 depthA = splat8(tri.depthA);
+        const Float8 depthMin = splat8(tri.depthMin);
+
+        for (i32 y = minY; y <= maxY; ++y) {
+            const f32 py = static_cast<f32>(y) + 0.5f;
+            const Float8 row0 = splat8(tri.edgeB[0] * py + tri.edgeC[0]);
+            const Float8 row1 = splat8(tri.edgeB[1] * py + tri.edgeC[1]);
+            const Float8 row2 = splat8(tri.edgeB[2] * py + tri.edgeC[2]);
+            const Float8 rowDepth = splat8(tri.depthB * py + tri.depthC);
+            f32* depthRow = m_depth.data() + static_cast<usize>(y) * m_width;
+
+            for (i32 x = minX; x <= maxX; x += static_cast<i32>(BLOCK_SIZE)) {
+                const Float8 px = add8(splat8(static_cast<f32>(x)), laneCenters);
+                Mask8 inside = and8(and8(ge8(add8(mul8(a0, px), row0), zero),
+                                         ge8(add8(mul8(a1, px), row1), zero)),
+                                    ge8(add8(mul8(a2, px), row2), zero));
+                if (!any8(inside)) continue;
+
+                Float8 depth = max8(add8(mul8(depthA, px), rowDepth), depthMin);
+                Float8 stored = load8(depthRow + x);
+                store8(depthRow + x, select8(inside, max8(stored, depth), stored));
+            }
+        }
+    }
+
+    // Farthest depth per block, for the occludee early-out
+    const u32 blocksX = m_width / BLOCK_SIZE;
+    for (i32 by = tileY0; by <= tileY1; by += static_cast<i32>(BLOCK_SIZE)) {
+        for (i32 bx = tileX0; bx <= tileX1; bx += static_cast<i32>(BLOCK_SIZE)) {
+            const f32* base = m_depth.data() + static_cast<usize>(by) * m_width + bx;
+            Float8 farthest = load8(base);
+            for (u32 r = 1; r < BLOCK_SIZE; ++r) {
+                farthest = min8(farthest, load8(base + r * m_width));
+            }
+            m_blockMin[(by / BLOCK_SIZE) * blocksX + bx / BLOCK_SIZE] = reduceMin8(farthest);
+        }
+    }
+}
+
+bool SoftwareOcclusionBuffer::testAABB(const AABB& bounds) const noexcept {
+    if (m_triangles.empty()) {
+        return true;
+    }
+
+    f32 minX = std::numeric_limits<f32>::max();
+    f32 minY = std::numeric_limits<f32>::max();
+    f32 maxX = std::numeric_limits<f32>::lowest();
+    f32 maxY = std::numeric_limits<f32>::lowest();
+    f32 nearest = 0.0f;
+
+    for (const Vec3& corner : bounds.getCorners()) {
+        Vec4 clip = m_viewProjection * Vec4{corner.x, corner.y, corner.z, 1.0f};
+        if (clip.w <= NEAR_CLIP_W) {
+            return true;
+        }
+        f32 invW = 1.0f / clip.w;
+        f32 sx = (clip.x * invW * 0.5f + 0.5f) * static_cast<f32>(m_width);
+        f32 sy = (0.5f - clip.y * invW * 0.5f) * static_cast<f32>(m_height);
+        minX = std::min(minX, sx);
+        minY = std::min(minY, sy);
+        maxX = std::max(maxX, sx);
+        maxY = std::max(maxY, sy);
+        nearest = std::max(nearest, invW);
+    }
+
+    // Every pixel the screen rectangle touches
+    const f32 width = static_cast<f32>(m_width);
+    const f32 height = static_cast<f32>(m_height);
+    const i32 x0 = static_cast<i32>(std::clamp(std::floor(minX), 0.0f, width));
+    const i32 y0 = static_cast<i32>(std::clamp(std::floor(minY), 0.0f, height));
+    const i32 x1 = static_cast<i32>(std::clamp(std::floor(maxX), -1.0f, width - 1.0f));
+    const i32 y1 = static_cast<i32>(std::clamp(std::floor(maxY), -1.0f, height - 1.0f));
+    if (x0 > x1 || y0 > y1) {
+        return true;
+    }
+
+    const u32 blocksX = m_width / BLOCK_SIZE;
+    const Float8 boxDepth = splat8(nearest);
+    const Float8 lanes = load8(LANE_OFFSETS);
+    const Float8 first = splat8(static_cast<f32>(x0));
+    const Float8 last = splat8(static_cast<f32>(x1));
+
+    for (i32 by = y0 / static_cast<i32>(BLOCK_SIZE); by <= y1 / static_cast<i32>(BLOCK_SIZE); ++by) {
+        for (i32 bx = x0 / static_cast<i32>(BLOCK_SIZE); bx <= x1 / static_cast<i32>(BLOCK_SIZE); ++bx) {
+            // Entirely behind everything drawn in this block
+            if (nearest < m_blockMin[by * blocksX + bx]) continue;
+
+            const i32 px = bx * static_cast<i32>(BLOCK_SIZE);
+            const Float8 laneX = add8(lanes, splat8(static_cast<f32>(px)));
+            const Mask8 covered = and8(ge8(laneX, first), ge8(last, laneX));
+            const i32 rowBegin = std::max(y0, by * static_cast<i32>(BLOCK_SIZE));
+            const i32 rowEnd = std::min(y1, by * static_cast<i32>(BLOCK_SIZE) + static_cast<i32>(BLOCK_SIZE) - 1);
+            for (i32 y = rowBegin; y <= rowEnd; ++y) {
+                Float8 stored = load8(m_depth.data() + static_cast<usize>(y) * m_width + px);
+                if (any8(and8(ge8(boxDepth, stored), covered))) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+void SoftwareOcclusionBuffer::testAABBs(std::span<const AABB> bounds, std::span<u64> visibleBits) const {
+    const u32 count = static_cast<u32>(std::min(bounds.size(), visibleBits.size() * 64));
+    const u32 jobCount = (count + TEST_BATCH_SIZE - 1) / TEST_BATCH_SIZE;
+
+    std::function<void(u32)> job = [&](u32 j) {
+        const u32 begin = j * TEST_BATCH_SIZE;
+        const u32 end = std::min(count, begin + TEST_BATCH_SIZE);
+        for (u32 word = begin / 64; word * 64 < end; ++word) {
+            u64 bits = 0;
+            for (u32 i = word * 64; i < std::min(end, word * 64 + 64); ++i) {
+                bits |= static_cast<u64>(testAABB(bounds[i])) << (i % 64);
+            }
+            visibleBits[word] = bits;
+        }
+    };
+
+    if (m_pool) {
+        m_pool->run(jobCount, job);
+    } else {
+        for (u32 j = 0; j < jobCount; ++j) {
+            job(j);
+        }
+    }
+}
+
+// ============================================================================
+// Batch Frustum Culling
+// ============================================================================
+
+namespace {
+
+constexpr u32 PLANE_COUNT = OcclusionConfig::FRUSTUM_PLANE_COUNT;
+
+/// Frustum planes splatted across lanes, with absolute normals for the
+/// projected box radius
+struct FrustumPlanes8 {
+    Float8 nx[PLANE_COUNT], ny[PLANE_COUNT], nz[PLANE_COUNT], distance[PLANE_COUNT];
+    Float8 ax[PLANE_COUNT], ay[PLANE_COUNT], az[PLANE_COUNT];
+
+    explicit FrustumPlanes8(const Frustum& frustum) {
+        for (u32 i = 0; i < PLANE_COUNT; ++i) {
+            const Plane& plane = frustum.planes[i];
+            nx[i] = splat8(plane.normal.x);
+            ny[i] = splat8(plane.normal.y);
+            nz[i] = splat8(plane.normal.z);
+            distance[i] = splat8(plane.distance);
+            ax[i] = splat8(std::abs(plane.normal.x));
+            ay[i] = splat8(std::abs(plane.normal.y));
+            az[i] = splat8(std::abs(plane.normal.z));
+        }
+    }
+};
+
+/// Test objects [base, base + 8); bit i of each mask is object base + i.
+/// Matches Frustum::testAABB: outside when the center is farther behind a
+/// plane than the box reaches, inside when it is in front of all of them.
+NOVA_FORCE_INLINE void testBounds8(const FrustumPlanes8& planes, const BoundsSoA& bounds, u32 base,
+                                   u32& visible, u32& inside) {
+    const Float8 cx = load8(bounds.getCenters(0) + base);
+    const Float8 cy = load8(bounds.getCenters(1) + base);
+    const Float8 cz = load8(bounds.getCenters(2) + base);
+    const Float8 ex = load8(bounds.getExtents(0) + base);
+    const Float8 ey = load8(bounds.getExtents(1) + base);
+    const Float8 ez = load8(bounds.getExtents(2) + base);
+    const Float8 zero = splat8(0.0f);
+
+    Mask8 visibleMask{};
+    Mask8 insideMask{};
+    for (u32 i = 0; i < PLANE_COUNT; ++i) {
+        Float8 dist = add8(add8(mul8(planes.nx[i], cx), mul8(planes.ny[i], cy)),
+                           add8(mul8(planes.nz[i], cz), planes.distance[i]));
+        Float8 radius = add8(add8(mul8(planes.ax[i], ex), mul8(planes.ay[i], ey)), mul8(planes.az[i], ez));
+        Mask8 front = ge8(add8(dist, radius), zero);
+        Mask8 fully = ge8(sub8(dist, radius), zero);
+        visibleMask = i == 0 ? front : and8(visibleMask, front);
+        insideMask = i == 0 ? fully : and8(insideMask, fully);
+    }
+    visible = bits8(visibleMask);
+    inside = bits8(insideMask);
+}
+
+/// OR the results for objects [begin, end) into the bitsets
+void cullRange(const FrustumPlanes8& planes, const BoundsSoA& bounds, u32 begin, u32 end,
+               u64* visibleBits, u64* insideBits) {
+    for (u32 base = begin & ~7u; base < end; base += 8) {
+        u32 visible = 0;
+        u32 inside = 0;
+        testBounds8(planes, bounds, base, visible, inside);
+
+        // Lanes outside [begin, end), including padding
+        u32 first = std::max(begin, base) - base;
+        u32 last = std::min(end, base + 8) - base;
+        u32 lanes = ((1u << last) - 1) & ~((1u << first) - 1);
+
+        visibleBits[base / 64] |= static_cast<u64>(visible & lanes) << (base % 64);
+        if (insideBits) {
+            insideBits[base / 64] |= static_cast<u64>(inside & lanes) << (base % 64);
+        }
+    }
+}
+
+/// Set bits [begin, end)
+void setBits(u64* bits, u32 begin, u32 end) {
+    for (u32 i = begin; i < end;) {
+        u32 shift = i % 64;
+        u32 n = std::min(64 - shift, end - i);
+        bits[i / 64] |= (n == 64 ? ~u64{0} : ((u64{1} << n) - 1)) << shift;
+        i += n;
+    }
+}
+
+/// Run job(begin, end) over [0, count) in CULL_BATCH_SIZE chunks. Chunks
+/// start on a word boundary, so each owns its words of the output.
+void forEachChunk(u32 count, platform::WorkerPool* pool, const std::function<void(u32, u32)>& job) {
+    const u32 chunkCount = (count + CULL_BATCH_SIZE - 1) / CULL_BATCH_SIZE;
+    std::function<void(u32)> chunk = [&](u32 c) {
+        job(c * CULL_BATCH_SIZE, std::min(count, (c + 1) * CULL_BATCH_SIZE));
+    };
+    if (pool) {
+        pool->run(chunkCount, chunk);
+    } else {
+        for (u32 c = 0; c < chunkCount; ++c) {
+            chunk(c);
+        }
+    }
+}
+
+void clearWords(u64* bits, u32 begin, u32 end) {
+    std::fill(bits + begin / 64, bits + (end + 63) / 64, u64{0});
+}
+
+} // namespace
+
+void cullFrustum(const Frustum& frustum, const BoundsSoA& bounds, std::span<u64> visibleBits,
+                 platform::WorkerPool* pool) {
+    const u32 count = static_cast<u32>(std::min<usize>(bounds.size(), visibleBits.size() * 64));
+    const FrustumPlanes8 planes(frustum);
+
+    forEachChunk(count, pool, [&](u32 begin, u32 end) {
+        clearWords(visibleBits.data(), begin, end);
+        cullRange(planes, bounds, begin, end, visibleBits.data(), nullptr);
+    });
+}
+
+void cullFrustumHierarchical(const Frustum& frustum, const BoundsSoA& groupBounds,
+                             std::span<const CullingGroup> groups, const BoundsSoA& objectBounds,
+                             std::span<u64> visibleBits, platform::WorkerPool* pool) {
+    const u32 groupCount = static_cast<u32>(std::min<usize>(groups.size(), groupBounds.size()));
+    const u32 count = static_cast<u32>(std::min<usize>(objectBounds.size(), visibleBits.size() * 64));
+    const FrustumPlanes8 planes(frustum);
+
+    std::vector<u64> groupVisible((groupCount + 63) / 64, 0);
+    std::vector<u64> groupInside((groupCount + 63) / 64, 0);
+    forEachChunk(groupCount, pool, [&](u32 begin, u32 end) {
+        cullRange(planes, groupBounds, begin, end, groupVisible.data(), groupInside.data());
+    });
+
+    const auto groupsEnd = groups.begin() + groupCount;
+    forEachChunk(count, pool, [&](u32 begin, u32 end) {
+        u64* bits = visibleBits.data();
+        clearWords(bits, begin, end);
+
+        auto group = std::partition_point(groups.begin(), groupsEnd, [&](const CullingGroup& g) {
+            return g.firstObject + g.objectCount <= begin;
+        });
+        u32 cursor = begin;
+        for (; group != groupsEnd && group->firstObject < end; ++group) {
+            const u32 groupBegin = std::max(group->firstObject, cursor);
+            const u32 groupEnd = std::min(group->firstObject + group->objectCount, end);
+            if (cursor < groupBegin) {
+                cullRange(planes, objectBounds, cursor, groupBegin, bits, nullptr);
+            }
+            if (groupBegin < groupEnd) {
+                const auto g = static_cast<u32>(group - groups.begin());
+                if ((groupInside[g / 64] >> (g % 64)) & 1) {
+                    setBits(bits, groupBegin, groupEnd);
+                } else if ((groupVisible[g / 64] >> (g % 64)) & 1) {
+                    cullRange(planes, objectBounds, groupBegin, groupEnd, bits, nullptr);
+                }
+            }
+            cursor = std::max(cursor, groupEnd);
+        }
+        if (cursor < end) {
+            cullRange(planes, objectBounds, cursor, end, bits, nullptr);
+        }
+    });
+}
+
+// ============================================================================
+// OcclusionCullingManager
+// ============================================================================
+
+void OcclusionCullingManager::testFrustumBatch(const BoundsSoA& bounds, std::span<u64> visibleBits,
+                                               platform::WorkerPool* pool) {
+    auto start = Clock::now();
+    cullFrustum(m_frustum, bounds, visibleBits, pool);
+
+    const u32 count = static_cast<u32>(std::min<usize>(bounds.size(), visibleBits.size() * 64));
+    u32 passed = 0;
+    for (u32 word = 0; word < (count + 63) / 64; ++word) {
+        passed += static_cast<u32>(std::popcount(visibleBits[word]));
+    }
+    m_stats.totalObjects += count;
+    m_stats.frustumPassed += passed;
+    m_stats.frustumCulled += count - passed;
+    m_stats.frustumTimeMs += elapsedMs(start);
+}
+
+void OcclusionCullingManager::cullObjects(std::span<const u32> objectIds, std::span<const AABB> bounds) {
+    const usize count = std::min(objectIds.size(), bounds.size());
+    const bool software = m_technique == OcclusionTechnique::SoftwareRaster;
+
+    auto start = Clock::now();
+    m_batchIds.clear();
+    m_batchBounds.clear();
+    for (usize i = 0; i < count; ++i) {
+        if (!software) {
+            recordResult(objectIds[i], testVisibility(objectIds[i], bounds[i]));
+            continue;
+        }
+        VisibilityResult result = testFrustum(bounds[i]);
+        if (result != VisibilityResult::Visible) {
+            recordResult(objectIds[i], result);
+            continue;
+        }
+        m_batchIds.push_back(objectIds[i]);
+        m_batchBounds.push_back(bounds[i]);
+    }
+    m_stats.frustumTimeMs += elapsedMs(start);
+
+    if (m_batchIds.empty()) {
+        return;
+    }
+
+    start = Clock::now();
+    m_batchVisible.assign((m_batchIds.size() + 63) / 64, 0);
+    m_softwareBuffer.testAABBs(m_batchBounds, m_batchVisible);
+    for (usize i = 0; i < m_batchIds.size(); ++i) {
+        bool visible = (m_batchVisible[i / 64] >> (i % 64)) & 1;
+        if (visible) {
+            m_stats.occlusionPassed++;
+        } else {
+            m_stats.occlusionCulled++;
+        }
+        recordResult(m_batchIds[i], visible ? VisibilityResult::Visible : VisibilityResult::Occluded);
+    }
+    m_stats.occlusionTimeMs += elapsedMs(start);
+}
+
+} // namespace nova
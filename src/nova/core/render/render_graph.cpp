@@ -6,13 +6,127 @@
  */
 
 #include "nova/core/render/render_graph.hpp"
+#include "nova/core/platform/worker_pool.hpp"
 #include <algorithm>
+#include <chrono>
+#include <functional>
 #include <queue>
 #include <sstream>
 #include <stack>
 
 namespace nova::render {
 
+namespace {
+
+/// Access bits that select an image layout; changing them needs a barrier
+/// even between two reads
+constexpr ResourceAccess LAYOUT_ACCESS = ResourceAccess::ColorAttachment | ResourceAccess::DepthAttachment |
+                                         ResourceAccess::InputAttachment | ResourceAccess::Transfer;
+
+bool isTextureResource(const RGResourceData& res) {
+    return std::holds_alternative<RGTextureDesc>(res.desc);
+}
+
+RGHeapType getHeapType(const RGResourceData& res) {
+    if (!isTextureResource(res)) {
+        return RGHeapType::Buffers;
+    }
+    const auto& desc = res.getTextureDesc();
+    return desc.isRenderTarget || desc.isDepthStencil ? RGHeapType::RenderTargets : RGHeapType::Textures;
+}
+
+usize getHeapAlignment(RGHeapType type) {
+    return type == RGHeapType::Buffers ? RenderGraphConfig::BUFFER_HEAP_ALIGNMENT
+                                       : RenderGraphConfig::TEXTURE_HEAP_ALIGNMENT;
+}
+
+bool lifetimesOverlap(const RGResourceData& a, const RGResourceData& b) {
+    return a.firstPassUsage <= b.lastPassUsage && b.firstPassUsage <= a.lastPassUsage;
+}
+
+bool memoryOverlaps(const RGResourceData& a, const RGResourceData& b) {
+    return a.heapIndex == b.heapIndex &&
+           a.heapOffset < b.heapOffset + b.allocationSize && b.heapOffset < a.heapOffset + a.allocationSize;
+}
+
+std::string formatAccess(ResourceAccess access) {
+    static constexpr std::pair<ResourceAccess, const char*> names[] = {
+        {ResourceAccess::Read, "Read"},
+        {ResourceAccess::Write, "Write"},
+        {ResourceAccess::VertexShader, "VertexShader"},
+        {ResourceAccess::FragmentShader, "FragmentShader"},
+        {ResourceAccess::ComputeShader, "ComputeShader"},
+        {ResourceAccess::Transfer, "Transfer"},
+        {ResourceAccess::ColorAttachment, "ColorAttachment"},
+        {ResourceAccess::DepthAttachment, "DepthAttachment"},
+        {ResourceAccess::InputAttachment, "InputAttachment"},
+        {ResourceAccess::VertexBuffer, "VertexBuffer"},
+        {ResourceAccess::IndexBuffer, "IndexBuffer"},
+        {ResourceAccess::UniformBuffer, "UniformBuffer"},
+        {ResourceAccess::StorageBuffer, "StorageBuffer"},
+        {ResourceAccess::IndirectBuffer, "IndirectBuffer"},
+    };
+    std::string result;
+    for (const auto& [flag, name] : names) {
+        if (hasAccess(access, flag)) {
+            if (!result.empty()) result += '|';
+            result += name;
+        }
+    }
+    return result.empty() ? "Undefined" : result;
+}
+
+const char* getSplitSuffix(RGBarrierSplit split) {
+    switch (split) {
+        case RGBarrierSplit::Begin: return " (begin)";
+        case RGBarrierSplit::End: return " (end)";
+        case RGBarrierSplit::None: break;
+    }
+    return "";
+}
+
+f64 millisecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<f64, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+// ============================================================================
+// Compiled Plan
+// ============================================================================
+
+/**
+ * @brief Everything compile derives from the graph structure
+ */
+struct RenderGraph::CompiledPlan {
+    struct Pass {
+        std::vector<u32> dependencies;
+        std::vector<u32> dependents;
+        std::vector<RGBarrier> barriers;
+        i32 executionOrder = -1;
+        bool culled = false;
+    };
+    
+    struct Resource {
+        u32 firstPassUsage = ~0u;
+        u32 lastPassUsage = 0;
+        ResourceAccess currentState = ResourceAccess::None;
+        u32 heapIndex = ~0u;
+        usize heapOffset = 0;
+        usize allocationSize = 0;
+        u32 aliasedResource = ~0u;
+        std::variant<TextureHandle, BufferHandle> physicalResource;
+    };
+    
+    u64 hash = 0;
+    std::vector<u64> key;
+    std::vector<Pass> passes;
+    std::vector<Resource> resources;
+    std::vector<u32> executionOrder;
+    std::vector<RGHeap> heaps;
+    RGMemoryStats memoryStats;
+};
+
 // ============================================================================
 // RenderGraph Implementation
 // ============================================================================
@@ -132,6 +246,19 @@ const RGPassData& RenderGraph::getPass(u32 index) const {
 void RenderGraph::compile() {
     if (m_compiled) return;
     
+    auto start = std::chrono::steady_clock::now();
+    
+    buildStructureKey();
+    m_frameStats.structureHash = fnv1aHash(m_structureKey.data(), m_structureKey.size() * sizeof(u64));
+    m_frameStats.planReused = applyCachedPlan();
+    if (m_frameStats.planReused) {
+        m_frameStats.planCacheHits++;
+        m_frameStats.compileTimeMs = millisecondsSince(start);
+        m_compiled = true;
+        return;
+    }
+    m_frameStats.planCacheMisses++;
+    
     // Step 1: Build dependency graph
     buildDependencies();
     
@@ -154,9 +281,125 @@ void RenderGraph::compile() {
         computeBarriers();
     }
     
+    storePlan();
+    
+    m_frameStats.compileTimeMs = millisecondsSince(start);
     m_compiled = true;
 }
 
+void RenderGraph::buildStructureKey() {
+    // Everything compile reads, and nothing it doesn't: names, clear values
+    // and imported handles may change between frames without a recompile
+    m_structureKey.clear();
+    m_structureKey.push_back(m_passes.size());
+    m_structureKey.push_back(m_resources.size());
+    m_structureKey.push_back(m_backBuffer.index);
+    
+    for (const auto& res : m_resources) {
+        m_structureKey.push_back(static_cast<u64>(res.type) | (static_cast<u64>(res.isImported) << 8) |
+                                 (static_cast<u64>(res.isTransient) << 9));
+        if (isTextureResource(res)) {
+            const auto& desc = res.getTextureDesc();
+            m_structureKey.push_back((static_cast<u64>(desc.width) << 32) | desc.height);
+            m_structureKey.push_back((static_cast<u64>(desc.depth) << 32) | desc.mipLevels);
+            m_structureKey.push_back((static_cast<u64>(desc.arrayLayers) << 32) |
+                                     (static_cast<u64>(desc.format) << 2) |
+                                     (static_cast<u64>(desc.isRenderTarget) << 1) | desc.isDepthStencil);
+        } else {
+            const auto& desc = res.getBufferDesc();
+            m_structureKey.push_back(desc.size);
+            m_structureKey.push_back((static_cast<u64>(desc.usage) << 1) | desc.cpuReadable);
+        }
+    }
+    
+    auto addUsages = [this](const std::vector<RGResourceUsage>& usages) {
+        m_structureKey.push_back(usages.size());
+        for (const auto& usage : usages) {
+            m_structureKey.push_back((static_cast<u64>(usage.handle.index) << 32) | static_cast<u16>(usage.access));
+            m_structureKey.push_back((static_cast<u64>(usage.mipLevel) << 32) | usage.arraySlice);
+        }
+    };
+    for (const auto& pass : m_passes) {
+        m_structureKey.push_back(static_cast<u64>(pass.type) | (static_cast<u64>(pass.flags) << 8));
+        addUsages(pass.reads);
+        addUsages(pass.writes);
+        m_structureKey.push_back(pass.colorTargets.size());
+        for (const auto& target : pass.colorTargets) {
+            m_structureKey.push_back(target.index);
+        }
+        m_structureKey.push_back(pass.depthTarget.index);
+    }
+}
+
+bool RenderGraph::applyCachedPlan() {
+    if (!m_plan || m_plan->hash != m_frameStats.structureHash || m_plan->key != m_structureKey) {
+        return false;
+    }
+    
+    for (u32 i = 0; i < m_passes.size(); ++i) {
+        auto& pass = m_passes[i];
+        const auto& cached = m_plan->passes[i];
+        pass.dependencies = cached.dependencies;
+        pass.dependents = cached.dependents;
+        pass.barriers = cached.barriers;
+        pass.executionOrder = cached.executionOrder;
+        pass.culled = cached.culled;
+    }
+    for (u32 i = 0; i < m_resources.size(); ++i) {
+        auto& res = m_resources[i];
+        const auto& cached = m_plan->resources[i];
+        res.firstPassUsage = cached.firstPassUsage;
+        res.lastPassUsage = cached.lastPassUsage;
+        res.currentState = cached.currentState;
+        res.heapIndex = cached.heapIndex;
+        res.heapOffset = cached.heapOffset;
+        res.allocationSize = cached.allocationSize;
+        res.aliasedResource = cached.aliasedResource;
+        if (!res.isImported) {
+            res.physicalResource = cached.physicalResource;
+        }
+    }
+    m_executionOrder = m_plan->executionOrder;
+    m_heaps = m_plan->heaps;
+    m_memoryStats = m_plan->memoryStats;
+    return true;
+}
+
+void RenderGraph::storePlan() {
+    if (!m_plan) {
+        m_plan = std::make_unique<CompiledPlan>();
+    }
+    m_plan->hash = m_frameStats.structureHash;
+    m_plan->key = m_structureKey;
+    
+    m_plan->passes.resize(m_passes.size());
+    for (u32 i = 0; i < m_passes.size(); ++i) {
+        const auto& pass = m_passes[i];
+        auto& cached = m_plan->passes[i];
+        cached.dependencies = pass.dependencies;
+        cached.dependents = pass.dependents;
+        cached.barriers = pass.barriers;
+        cached.executionOrder = pass.executionOrder;
+        cached.culled = pass.culled;
+    }
+    m_plan->resources.resize(m_resources.size());
+    for (u32 i = 0; i < m_resources.size(); ++i) {
+        const auto& res = m_resources[i];
+        auto& cached = m_plan->resources[i];
+        cached.firstPassUsage = res.firstPassUsage;
+        cached.lastPassUsage = res.lastPassUsage;
+        cached.currentState = res.currentState;
+        cached.heapIndex = res.heapIndex;
+        cached.heapOffset = res.heapOffset;
+        cached.allocationSize = res.allocationSize;
+        cached.aliasedResource = res.aliasedResource;
+        cached.physicalResource = res.physicalResource;
+    }
+    m_plan->executionOrder = m_executionOrder;
+    m_plan->heaps = m_heaps;
+    m_plan->memoryStats = m_memoryStats;
+}
+
 void RenderGraph::buildDependencies() {
     // For each pass, find dependencies based on resource reads/writes
     for (u32 passIdx = 0; passIdx < m_passes.size(); ++passIdx) {
@@ -195,8 +438,10 @@ void RenderGraph::topologicalSort() {
         inDegree[i] = static_cast<u32>(m_passes[i].dependencies.size());
     }
     
-    // Start with passes that have no dependencies
-    std::queue<u32> ready;
+    // Start with passes that have no dependencies. Lowest index first keeps
+    // declaration order among independent passes, which also orders the
+    // write-after-read and write-after-write hazards dependencies don't track.
+    std::priority_queue<u32, std::vector<u32>, std::greater<u32>> ready;
     for (u32 i = 0; i < m_passes.size(); ++i) {
         if (inDegree[i] == 0) {
             ready.push(i);
@@ -206,7 +451,7 @@ void RenderGraph::topologicalSort() {
     // Process passes in topological order
     i32 executionOrder = 0;
     while (!ready.empty()) {
-        u32 passIdx = ready.front();
+        u32 passIdx = ready.top();
         ready.pop();
         
         m_executionOrder.push_back(passIdx);
@@ -328,46 +573,184 @@ void RenderGraph::computeResourceLifetimes() {
 }
 
 void RenderGraph::allocateResources() {
-    // For now, allocate each transient resource individually
-    // Future: implement memory aliasing based on lifetimes
+    // Transient resources are placed in one heap per type. Resources whose
+    // lifetimes (in execution order) do not overlap may share memory, so
+    // placement is interval-graph packing: largest first, each at the lowest
+    // offset clear of every placed resource that is alive at the same time.
+    m_heaps.clear();
+    m_memoryStats = {};
     
-    for (auto& res : m_resources) {
-        if (res.isImported) continue;  // Already has physical resource
+    std::vector<u32> candidates[3];
+    for (u32 i = 0; i < m_resources.size(); ++i) {
+        auto& res = m_resources[i];
+        res.heapIndex = ~0u;
+        res.heapOffset = 0;
+        res.allocationSize = 0;
+        res.aliasedResource = ~0u;
+        
+        // Imported resources already have memory; unused ones need none
+        if (res.isImported || !res.isTransient || res.firstPassUsage == ~0u) continue;
         
-        // Create physical resource based on type
+        RGHeapType heapType = getHeapType(res);
+        usize size = isTextureResource(res) ? res.getTextureDesc().computeSizeBytes() : res.getBufferDesc().size;
+        usize alignment = getHeapAlignment(heapType);
+        res.allocationSize = (std::max<usize>(size, 1) + alignment - 1) / alignment * alignment;
+        candidates[static_cast<u8>(heapType)].push_back(i);
+        
+        m_memoryStats.transientBytes += res.allocationSize;
+        m_memoryStats.transientResources++;
+        
+        // In a real implementation, this would create a placed resource at
+        // (heap, offset) through the render device
         if (res.isTexture()) {
-            // In a real implementation, this would call the render device
-            // to allocate the actual GPU texture
-            res.physicalResource = TextureHandle(res.firstPassUsage + 1);
-        } else if (res.isBuffer()) {
-            res.physicalResource = BufferHandle(res.firstPassUsage + 1);
+            res.physicalResource = TextureHandle(i + 1);
+        } else {
+            res.physicalResource = BufferHandle(i + 1);
         }
     }
+    
+    std::vector<std::pair<usize, usize>> conflicts;
+    for (u8 type = 0; type < 3; ++type) {
+        auto& placed = candidates[type];
+        if (placed.empty()) continue;
+        
+        u32 heapIndex = static_cast<u32>(m_heaps.size());
+        RGHeap& heap = m_heaps.emplace_back();
+        heap.type = static_cast<RGHeapType>(type);
+        
+        std::sort(placed.begin(), placed.end(), [this](u32 a, u32 b) {
+            const auto& ra = m_resources[a];
+            const auto& rb = m_resources[b];
+            if (ra.allocationSize != rb.allocationSize) return ra.allocationSize > rb.allocationSize;
+            if (ra.firstPassUsage != rb.firstPassUsage) return ra.firstPassUsage < rb.firstPassUsage;
+            return a < b;
+        });
+        
+        for (usize n = 0; n < placed.size(); ++n) {
+            auto& res = m_resources[placed[n]];
+            
+            // Memory ranges that are in use while this resource is alive
+            conflicts.clear();
+            for (usize p = 0; p < n; ++p) {
+                const auto& other = m_resources[placed[p]];
+                if (!RenderGraphConfig::RESOURCE_ALIASING || lifetimesOverlap(res, other)) {
+                    conflicts.emplace_back(other.heapOffset, other.heapOffset + other.allocationSize);
+                }
+            }
+            std::sort(conflicts.begin(), conflicts.end());
+            
+            // First gap large enough; offsets and sizes share the alignment
+            usize offset = 0;
+            for (const auto& [begin, end] : conflicts) {
+                if (offset + res.allocationSize <= begin) break;
+                offset = std::max(offset, end);
+            }
+            
+            res.heapIndex = heapIndex;
+            res.heapOffset = offset;
+            heap.size = std::max(heap.size, offset + res.allocationSize);
+            heap.resourceCount++;
+        }
+        
+        // Record the resource each one takes memory over from, for its
+        // aliasing barrier
+        for (u32 index : placed) {
+            auto& res = m_resources[index];
+            for (u32 otherIndex : placed) {
+                const auto& other = m_resources[otherIndex];
+                if (other.lastPassUsage >= res.firstPassUsage || !memoryOverlaps(res, other)) continue;
+                if (res.aliasedResource == ~0u ||
+                    other.lastPassUsage > m_resources[res.aliasedResource].lastPassUsage) {
+                    res.aliasedResource = otherIndex;
+                }
+            }
+            if (res.aliasedResource != ~0u) {
+                m_memoryStats.aliasedResources++;
+            }
+        }
+        
+        m_memoryStats.heapBytes += heap.size;
+    }
 }
 
 void RenderGraph::computeBarriers() {
-    // Track resource states and insert barriers as needed
-    // This is a simplified implementation - a full implementation would
-    // track pipeline stages and access masks more precisely
+    // Walks the execution order tracking each resource's last access and the
+    // position of the pass that made it. A barrier is needed when either side
+    // writes or the image layout changes; reads in the same layout only merge
+    // their stages so a later writer waits for all of them. When passes run
+    // between producer and consumer the barrier is split around them.
+    for (auto& pass : m_passes) {
+        pass.barriers.clear();
+    }
+    for (auto& res : m_resources) {
+        res.currentState = ResourceAccess::None;
+    }
+    m_memoryStats.barrierCount = 0;
+    m_memoryStats.splitBarrierCount = 0;
+    
+    std::vector<u32> lastAccess(m_resources.size(), ~0u);
+    std::vector<std::pair<u32, ResourceAccess>> passAccess;
+    auto emit = [this](RGPassData& target, const RGBarrier& barrier) {
+        target.barriers.push_back(barrier);
+        m_memoryStats.barrierCount++;
+    };
     
     for (u32 orderIdx = 0; orderIdx < m_executionOrder.size(); ++orderIdx) {
-        u32 passIdx = m_executionOrder[orderIdx];
-        const auto& pass = m_passes[passIdx];
+        auto& pass = m_passes[m_executionOrder[orderIdx]];
         
-        // Check reads - need barrier if previous state was write
-        for (const auto& usage : pass.reads) {
-            auto& res = m_resources[usage.handle.index];
-            if (hasAccess(res.currentState, ResourceAccess::Write)) {
-                // Would insert read barrier here
+        // Combine all usages of each resource within the pass
+        passAccess.clear();
+        auto addAccess = [&passAccess](const RGResourceUsage& usage) {
+            for (auto& [index, access] : passAccess) {
+                if (index == usage.handle.index) {
+                    access |= usage.access;
+                    return;
+                }
             }
-            res.currentState = usage.access;
-        }
+            passAccess.emplace_back(usage.handle.index, usage.access);
+        };
+        for (const auto& usage : pass.reads) addAccess(usage);
+        for (const auto& usage : pass.writes) addAccess(usage);
         
-        // Check writes
-        for (const auto& usage : pass.writes) {
-            auto& res = m_resources[usage.handle.index];
-            // Would insert write barrier here if needed
-            res.currentState = usage.access;
+        for (const auto& [index, access] : passAccess) {
+            auto& res = m_resources[index];
+            RGBarrier barrier;
+            barrier.resource = index;
+            barrier.before = res.currentState;
+            barrier.after = access;
+            
+            if (lastAccess[index] == ~0u) {
+                // First use: contents are undefined. Aliased memory needs an
+                // aliasing barrier; textures need their initial layout.
+                if (res.aliasedResource != ~0u) {
+                    barrier.type = RGBarrierType::Aliasing;
+                    barrier.aliasedResource = res.aliasedResource;
+                    emit(pass, barrier);
+                } else if (isTextureResource(res)) {
+                    emit(pass, barrier);
+                }
+            } else {
+                bool hazard = hasAccess(res.currentState, ResourceAccess::Write) ||
+                              hasAccess(access, ResourceAccess::Write) ||
+                              (res.currentState & LAYOUT_ACCESS) != (access & LAYOUT_ACCESS);
+                if (!hazard) {
+                    res.currentState |= access;
+                    lastAccess[index] = orderIdx;
+                    continue;
+                }
+                
+                if (lastAccess[index] + 1 < orderIdx) {
+                    auto& producerNext = m_passes[m_executionOrder[lastAccess[index] + 1]];
+                    barrier.split = RGBarrierSplit::Begin;
+                    emit(producerNext, barrier);
+                    barrier.split = RGBarrierSplit::End;
+                    m_memoryStats.splitBarrierCount++;
+                }
+                emit(pass, barrier);
+            }
+            
+            res.currentState = access;
+            lastAccess[index] = orderIdx;
         }
     }
 }
@@ -382,24 +765,88 @@ bool RenderGraph::isResourceUsedAfter(RGResourceHandle handle, u32 passIndex) co
 // ============================================================================
 
 void RenderGraph::execute() {
+    execute(RGExecuteOptions{});
+}
+
+void RenderGraph::execute(const RGExecuteOptions& options) {
     if (!m_compiled) {
         compile();
     }
     
-    // Execute passes in order
-    for (u32 orderIdx : m_executionOrder) {
-        const auto& pass = m_passes[orderIdx];
-        
-        if (pass.culled) continue;
-        
-        // Create execution context
-        RenderGraphContext ctx(*this, pass);
+    auto start = std::chrono::steady_clock::now();
+    
+    // Split the execution order into contiguous batches, one per thread;
+    // serial passes are cut out into batches of their own
+    struct Batch {
+        u32 begin;
+        u32 end;
+        bool serial;
+    };
+    std::vector<Batch> batches;
+    u32 threadCount = std::max(1u, options.threadCount);
+    u32 passCount = static_cast<u32>(m_executionOrder.size());
+    u32 batchSize = std::max(1u, (passCount + threadCount - 1) / threadCount);
+    u32 begin = 0;
+    for (u32 i = 0; i < passCount; ++i) {
+        bool serial = hasFlag(m_passes[m_executionOrder[i]].flags, RGPassFlags::ForceSerial);
+        if (serial || i - begin == batchSize) {
+            if (i > begin) batches.push_back({begin, i, false});
+            begin = i;
+        }
+        if (serial) {
+            batches.push_back({i, i + 1, true});
+            begin = i + 1;
+        }
+    }
+    if (begin < passCount) {
+        batches.push_back({begin, passCount, false});
+    }
+    
+    std::vector<CommandBuffer*> commandLists(batches.size(), nullptr);
+    auto record = [&](u32 batchIndex) {
+        const Batch& batch = batches[batchIndex];
+        CommandBuffer* commandList = options.acquireCommandList ? options.acquireCommandList(batchIndex) : nullptr;
+        commandLists[batchIndex] = commandList;
         
-        // Execute the pass
-        if (orderIdx < m_executeCallbacks.size() && m_executeCallbacks[orderIdx]) {
-            m_executeCallbacks[orderIdx](ctx);
+        for (u32 i = batch.begin; i < batch.end; ++i) {
+            u32 passIdx = m_executionOrder[i];
+            const auto& pass = m_passes[passIdx];
+            if (pass.culled) continue;
+            
+            RenderGraphContext ctx(*this, pass, commandList, batchIndex);
+            if (passIdx < m_executeCallbacks.size() && m_executeCallbacks[passIdx]) {
+                m_executeCallbacks[passIdx](ctx);
+            }
+        }
+    };
+    
+    std::vector<u32> parallelBatches;
+    for (u32 b = 0; b < batches.size(); ++b) {
+        if (!batches[b].serial) parallelBatches.push_back(b);
+    }
+    
+    u32 threadsUsed = batches.empty() ? 0 : 1;
+    if (threadCount > 1 && parallelBatches.size() > 1) {
+        if (!m_workers || m_workers->getThreadCount() != threadCount) {
+            m_workers = std::make_unique<platform::WorkerPool>(threadCount);
         }
+        std::function<void(u32)> job = [&](u32 n) { record(parallelBatches[n]); };
+        m_workers->run(static_cast<u32>(parallelBatches.size()), job);
+        threadsUsed = std::min(threadCount, static_cast<u32>(parallelBatches.size()));
+    } else {
+        for (u32 b : parallelBatches) record(b);
+    }
+    for (u32 b = 0; b < batches.size(); ++b) {
+        if (batches[b].serial) record(b);
+    }
+    
+    if (options.submit) {
+        options.submit(commandLists);
     }
+    
+    m_frameStats.recordTimeMs = millisecondsSince(start);
+    m_frameStats.recordThreads = threadsUsed;
+    m_frameStats.recordBatches = static_cast<u32>(batches.size());
 }
 
 void RenderGraph::reset() {
@@ -407,8 +854,18 @@ void RenderGraph::reset() {
     m_resources.clear();
     m_executeCallbacks.clear();
     m_executionOrder.clear();
+    m_heaps.clear();
+    m_memoryStats = {};
     m_backBuffer = RGTextureHandle::invalid();
     m_compiled = false;
+    
+    // The compiled plan and totals carry over to the next frame
+    m_frameStats.structureHash = 0;
+    m_frameStats.planReused = false;
+    m_frameStats.compileTimeMs = 0.0;
+    m_frameStats.recordTimeMs = 0.0;
+    m_frameStats.recordThreads = 0;
+    m_frameStats.recordBatches = 0;
 }
 
 // ============================================================================
@@ -457,6 +914,15 @@ std::string RenderGraph::dump() const {
             }
             ss << "\n";
         }
+        
+        for (const auto& barrier : pass.barriers) {
+            ss << "  Barrier: " << m_resources[barrier.resource].name << " ";
+            if (barrier.type == RGBarrierType::Aliasing) {
+                ss << "alias of " << m_resources[barrier.aliasedResource].name << ", ";
+            }
+            ss << formatAccess(barrier.before) << " -> " << formatAccess(barrier.after);
+            ss << getSplitSuffix(barrier.split) << "\n";
+        }
     }
     
     ss << "\n--- Resources ---\n";
@@ -465,15 +931,45 @@ std::string RenderGraph::dump() const {
         ss << "[" << i << "] " << res.name;
         ss << " (lifetime: " << res.firstPassUsage << "-" << res.lastPassUsage << ")";
         if (res.isImported) ss << " [IMPORTED]";
+        if (res.heapIndex != ~0u) {
+            ss << " heap " << res.heapIndex << " @ " << res.heapOffset << " size " << res.allocationSize;
+        }
+        if (res.aliasedResource != ~0u) {
+            ss << " [ALIASES " << m_resources[res.aliasedResource].name << "]";
+        }
         ss << "\n";
     }
     
+    if (!m_heaps.empty()) {
+        ss << "\n--- Memory ---\n";
+        for (u32 i = 0; i < m_heaps.size(); ++i) {
+            const auto& heap = m_heaps[i];
+            ss << "Heap " << i << " (" << getHeapTypeName(heap.type) << "): " << heap.size
+               << " bytes, " << heap.resourceCount << " resources\n";
+        }
+        ss << "Transient: " << m_memoryStats.transientBytes << " bytes in "
+           << m_memoryStats.transientResources << " resources\n";
+        ss << "Heaps: " << m_memoryStats.heapBytes << " bytes (" << m_memoryStats.aliasedResources
+           << " aliased, " << m_memoryStats.savedBytes() << " bytes saved)\n";
+        ss << "Barriers: " << m_memoryStats.barrierCount << " (" << m_memoryStats.splitBarrierCount
+           << " split)\n";
+    }
+    
     ss << "\n--- Execution Order ---\n";
     for (u32 orderIdx : m_executionOrder) {
         ss << m_passes[orderIdx].name << " -> ";
     }
     ss << "END\n";
     
+    if (m_compiled) {
+        ss << "\n--- Frame ---\n";
+        ss << "Plan: " << std::hex << m_frameStats.structureHash << std::dec
+           << (m_frameStats.planReused ? " (reused)" : " (compiled)") << ", "
+           << m_frameStats.compileTimeMs << " ms\n";
+        ss << "Record: " << m_frameStats.recordTimeMs << " ms, " << m_frameStats.recordBatches
+           << " batches on " << m_frameStats.recordThreads << " threads\n";
+    }
+    
     return ss.str();
 }
 
@@ -506,8 +1002,11 @@ std::string RenderGraph::exportGraphViz() const {
     // Resources as nodes (different shape)
     for (u32 i = 0; i < m_resources.size(); ++i) {
         const auto& res = m_resources[i];
-        ss << "  res" << i << " [label=\"" << res.name << "\"";
-        ss << ", shape=ellipse";
+        ss << "  res" << i << " [label=\"" << res.name;
+        if (res.heapIndex != ~0u) {
+            ss << "\\nheap " << res.heapIndex << " @ " << res.heapOffset;
+        }
+        ss << "\", shape=ellipse";
         if (res.isImported) {
             ss << ", style=filled, fillcolor=lightgray";
         }
@@ -524,6 +1023,23 @@ std::string RenderGraph::exportGraphViz() const {
         }
     }
     
+    // Barriers, from the resource into the pass that issues them
+    for (u32 i = 0; i < m_passes.size(); ++i) {
+        for (const auto& barrier : m_passes[i].barriers) {
+            ss << "  res" << barrier.resource << " -> pass" << i << " [style=dashed, label=\"";
+            ss << (barrier.type == RGBarrierType::Aliasing ? "alias" : formatAccess(barrier.after));
+            ss << getSplitSuffix(barrier.split) << "\"];\n";
+        }
+    }
+    
+    // Memory reuse between aliased resources
+    for (u32 i = 0; i < m_resources.size(); ++i) {
+        if (m_resources[i].aliasedResource != ~0u) {
+            ss << "  res" << m_resources[i].aliasedResource << " -> res" << i
+               << " [style=dotted, label=\"aliased\"];\n";
+        }
+    }
+    
     ss << "}\n";
     
     return ss.str();
@@ -7,16 +7,141 @@
  */
 
 #include <nova/core/resource/resource_manager.hpp>
+#include <nova/core/logging/metrics.hpp>
 
 #include <algorithm>
 #include <fstream>
 #include <filesystem>
 #include <chrono>
+#include <limits>
+#include <unordered_set>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
 
 namespace nova::resource {
 
 namespace fs = std::filesystem;
 
+namespace {
+
+/// Resource telemetry, resolved once and shared by all managers
+struct ResourceMetrics {
+    profiling::Counter& cacheHits;
+    profiling::Counter& cacheMisses;
+    profiling::Counter& packReads;
+    profiling::Counter& coalescedLoads;
+    profiling::Counter& evictions;
+    profiling::Histogram& loadTime;
+
+    static ResourceMetrics& get() {
+        auto& registry = profiling::MetricsRegistry::get();
+        static ResourceMetrics metrics{
+            registry.counter("resource.cache_hits", "Loads served from the resource cache"),
+            registry.counter("resource.cache_misses", "Loads that had to read from disk"),
+            registry.counter("resource.pack_reads", "Loads served from mounted resource packs"),
+            registry.counter("resource.coalesced_loads", "Load requests that joined a load already in flight"),
+            registry.counter("resource.evictions", "Resources unloaded to fit the cache budgets"),
+            registry.histogram("resource.load", "Resource load duration from request to finalize"),
+        };
+        return metrics;
+    }
+};
+
+/// Read whole files, hinting all of them to the kernel first so their
+/// reads overlap instead of running one after another
+void readFiles(const std::vector<std::string>& paths, std::vector<std::vector<u8>>& out) {
+    out.resize(paths.size());
+#if defined(_WIN32)
+    for (usize i = 0; i < paths.size(); ++i) {
+        std::ifstream file(paths[i], std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            continue;
+        }
+        out[i].resize(static_cast<usize>(file.tellg()));
+        file.seekg(0, std::ios::beg);
+        if (!file.read(reinterpret_cast<char*>(out[i].data()), static_cast<std::streamsize>(out[i].size()))) {
+            out[i].clear();
+        }
+    }
+#else
+    std::vector<int> files(paths.size(), -1);
+    for (usize i = 0; i < paths.size(); ++i) {
+        files[i] = ::open(paths[i].c_str(), O_RDONLY | O_CLOEXEC);
+#if defined(POSIX_FADV_WILLNEED)
+        if (files[i] >= 0) {
+            ::posix_fadvise(files[i], 0, 0, POSIX_FADV_WILLNEED);
+        }
+#endif
+    }
+    
+    for (usize i = 0; i < paths.size(); ++i) {
+        int fd = files[i];
+        struct stat info{};
+        if (fd < 0 || ::fstat(fd, &info) != 0) {
+            if (fd >= 0) ::close(fd);
+            continue;
+        }
+        
+        out[i].resize(static_cast<usize>(info.st_size));
+        usize done = 0;
+        while (done < out[i].size()) {
+            ssize_t n = ::pread(fd, out[i].data() + done, out[i].size() - done, static_cast<off_t>(done));
+            if (n <= 0) {
+                out[i].clear();
+                break;
+            }
+            done += static_cast<usize>(n);
+        }
+        ::close(fd);
+    }
+#endif
+}
+
+} // namespace
+
+// ============================================================================
+// Load Pipeline State
+// ============================================================================
+
+/// One load moving through the pipeline; each stage is claimed by
+/// advancing `stage`, so whoever claims it owns the fields it writes
+struct ResourceManager::PendingLoad {
+    ResourcePath path;
+    std::shared_ptr<Resource> resource;
+    IResourceLoader* loader = nullptr;
+    std::atomic<LoadStage> stage{LoadStage::Queued};
+    std::atomic<u8> priority{0};
+    std::chrono::steady_clock::time_point requestTime;
+    
+    // Hot reload: `resource` is a staging copy that `target` adopts
+    std::shared_ptr<Resource> target;
+    std::shared_ptr<ReloadBatch> batch;
+    
+    // Written by the read stage
+    PackedFile packed;
+    std::string filePath;   // Normalized path of a loose file
+    std::vector<u8> data;
+    
+    // Written by the decode stage
+    bool succeeded = false;
+    
+    std::promise<ResourceHandle<>> promise;
+    LoadFuture future;
+    std::vector<std::function<void(ResourceHandle<>)>> callbacks;  // Guarded by m_pipelineMutex
+};
+
+/// Files that changed together; dependents are notified once all of them
+/// have been swapped in. Touched by update() only.
+struct ResourceManager::ReloadBatch {
+    std::vector<ResourceId> changed;
+    std::vector<ResourceId> reloaded;
+    usize remaining = 0;
+};
+
 // ============================================================================
 // ResourceId Implementation
 // ============================================================================
@@ -57,8 +182,9 @@ bool ResourceManager::initialize(usize cacheSize, u32 numWorkers) {
     m_cacheSize = cacheSize;
     m_running = true;
     
-    // Start worker threads
-    for (u32 i = 0; i < numWorkers; ++i) {
+    // Start the I/O thread and decode workers
+    m_ioThread = std::thread(&ResourceManager::ioThread, this);
+    for (u32 i = 0; i < std::max(numWorkers, 1u); ++i) {
         m_workers.emplace_back(&ResourceManager::workerThread, this);
     }
     
@@ -75,10 +201,17 @@ void ResourceManager::shutdown() {
         return;
     }
     
-    // Stop workers
-    m_running = false;
-    m_queueCV.notify_all();
+    // Stop the pipeline
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        m_running = false;
+    }
+    m_ioCV.notify_all();
+    m_decodeCV.notify_all();
     
+    if (m_ioThread.joinable()) {
+        m_ioThread.join();
+    }
     for (auto& worker : m_workers) {
         if (worker.joinable()) {
             worker.join();
@@ -86,17 +219,45 @@ void ResourceManager::shutdown() {
     }
     m_workers.clear();
     
+    // Finish decoded loads and fail the rest so no future is left pending
+    std::vector<std::shared_ptr<PendingLoad>> pending;
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        for (auto& [path, load] : m_inFlight) {
+            pending.push_back(load);
+        }
+        m_ioQueue = {};
+        m_decodeQueue = {};
+        m_finalizeQueue = {};
+    }
+    for (auto& load : pending) {
+        LoadStage stage = load->stage.load(std::memory_order_acquire);
+        if (stage != LoadStage::Decoded && stage != LoadStage::Finalized) {
+            load->succeeded = false;
+            load->stage.store(LoadStage::Decoded, std::memory_order_release);
+        }
+        finalizeLoad(load);
+    }
+    
     // Unload all resources
     unloadAll();
     
     // Clear loaders
     m_loaders.clear();
     
-    // Clear mount points
+    // Clear mount points and watches
     m_mountPoints.clear();
+    for (const auto& dir : m_watchDirectories) {
+        platform::FileWatcher::get().unwatch(dir.watch);
+    }
+    m_watchDirectories.clear();
     
     // Clear bundles
     m_bundles.clear();
+    {
+        std::lock_guard<std::mutex> lock(m_packMutex);
+        m_packs.clear();
+    }
     
     m_initialized = false;
 }
@@ -106,16 +267,16 @@ void ResourceManager::update(f32 deltaTime) {
         return;
     }
     
+    // Finish decoded loads
+    finalizeLoads(m_finalizeBudget);
+    
     // Check for hot reload
     if (m_hotReloadEnabled) {
         checkHotReload();
     }
     
     // Trim cache if needed
-    usize usedMemory = getUsedMemory();
-    if (usedMemory > m_cacheSize) {
-        evictLRU();
-    }
+    evict(m_evictionBudget);
 }
 
 // ============================================================================
@@ -123,94 +284,308 @@ void ResourceManager::update(f32 deltaTime) {
 // ============================================================================
 
 ResourceHandle<> ResourceManager::loadInternal(const ResourcePath& path, LoadFlags flags) {
-    // Check if already loaded
+    // Check if already loaded; a hit only locks one registry shard
+    if (auto resource = findResource(path); resource && resource->isLoaded()) {
+        m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+        ResourceMetrics::get().cacheHits.add();
+        resource->updateAccessTime();
+        return ResourceHandle<>(std::move(resource));
+    }
+    
+    bool async = hasFlag(flags, LoadFlags::Async);
+    ResourceHandle<> ready;
+    bool created = false;
+    std::shared_ptr<PendingLoad> load;
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        load = joinOrCreateLoad(path, flags, async ? LoadPriority::Normal : LoadPriority::Immediate,
+                                ready, created);
+        if (load && created && async) {
+            pushLoad(m_ioQueue, load);
+        }
+    }
+    if (!load) {
+        return ready;
+    }
+    
+    if (async) {
+        m_ioCV.notify_one();
+    } else {
+        // Runs the remaining stages here, or waits for the thread running them
+        completeLoad(*load);
+        finalizeLoad(load);
+        
+        // update() may have claimed the finalize; wait until it is done
+        load->future.wait();
+    }
+    return ResourceHandle<>(load->resource);
+}
+
+ResourceManager::LoadFuture ResourceManager::requestLoad(const ResourcePath& path,
+                                                         LoadPriority priority,
+                                                         LoadFlags flags,
+                                                         std::function<void(ResourceHandle<>)> callback) {
+    ResourceHandle<> ready;
+    bool created = false;
+    std::shared_ptr<PendingLoad> load;
     {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        auto it = m_pathToId.find(path);
-        if (it != m_pathToId.end()) {
-            auto resIt = m_resources.find(it->second);
-            if (resIt != m_resources.end() && resIt->second->isLoaded()) {
-                m_stats.cacheHits++;
-                resIt->second->updateAccessTime();
-                return ResourceHandle<>(resIt->second);
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        load = joinOrCreateLoad(path, flags | LoadFlags::Async, priority, ready, created);
+        if (load) {
+            if (callback) {
+                load->callbacks.push_back(std::move(callback));
+            }
+            if (created) {
+                pushLoad(m_ioQueue, load);
             }
         }
     }
     
-    m_stats.cacheMisses++;
+    if (!load) {
+        if (callback) {
+            callback(ready);
+        }
+        std::promise<ResourceHandle<>> promise;
+        promise.set_value(ready);
+        return promise.get_future().share();
+    }
     
-    // Find loader
-    IResourceLoader* loader = getLoader(path);
-    if (!loader) {
-        return ResourceHandle<>();
+    if (created) {
+        m_ioCV.notify_one();
+    }
+    return load->future;
+}
+
+std::shared_ptr<ResourceManager::PendingLoad> ResourceManager::joinOrCreateLoad(
+    const ResourcePath& path, LoadFlags flags, LoadPriority priority, ResourceHandle<>& ready, bool& created) {
+    // Join a load in flight, moving it forward if this request is more urgent
+    if (auto it = m_inFlight.find(path); it != m_inFlight.end()) {
+        auto& load = it->second;
+        ResourceMetrics::get().coalescedLoads.add();
+        
+        auto level = static_cast<u8>(priority);
+        if (level > load->priority.load(std::memory_order_relaxed)) {
+            load->priority.store(level, std::memory_order_relaxed);
+            switch (load->stage.load(std::memory_order_acquire)) {
+                case LoadStage::Queued:
+                    pushLoad(m_ioQueue, load);
+                    m_ioCV.notify_one();
+                    break;
+                case LoadStage::Read:
+                    pushLoad(m_decodeQueue, load);
+                    m_decodeCV.notify_one();
+                    break;
+                case LoadStage::Decoded:
+                    pushLoad(m_finalizeQueue, load);
+                    break;
+                default:
+                    break;  // The stage in progress queues it with the new priority
+            }
+        }
+        return load;
     }
     
-    // Read file data
-    std::vector<u8> data = readFile(path);
-    if (data.empty()) {
-        return ResourceHandle<>();
+    // The load may have finished since the caller checked the cache
+    ResourceId id = ResourceId::fromPath(path.path);
+    if (auto resource = findResource(path); resource && resource->isLoaded()) {
+        resource->updateAccessTime();
+        ready = ResourceHandle<>(std::move(resource));
+        return nullptr;
     }
     
-    // Create resource
+    m_cacheMisses.fetch_add(1, std::memory_order_relaxed);
+    ResourceMetrics::get().cacheMisses.add();
+    
+    IResourceLoader* loader = getLoader(path);
+    if (!loader) {
+        return nullptr;
+    }
     auto resource = loader->createResource();
     if (!resource) {
-        return ResourceHandle<>();
+        return nullptr;
     }
     
-    ResourceId id = ResourceId::fromPath(path.path);
     resource->m_id = id;
     resource->m_path = path;
     resource->m_name = path.getStem();
     resource->m_type = loader->getResourceType();
     resource->m_flags = flags;
+    resource->m_priority = priority;
+    resource->setState(ResourceState::Queued);
+    
+    auto load = std::make_shared<PendingLoad>();
+    load->path = path;
+    load->resource = resource;
+    load->loader = loader;
+    load->priority.store(static_cast<u8>(priority), std::memory_order_relaxed);
+    load->requestTime = std::chrono::steady_clock::now();
+    load->future = load->promise.get_future().share();
+    m_inFlight.emplace(path, load);
     
-    // Load synchronously or queue async
-    if (hasFlag(flags, LoadFlags::Async)) {
-        resource->setState(ResourceState::Queued);
-        
-        LoadRequest request;
-        request.id = id;
-        request.path = path;
-        request.type = loader->getResourceType();
-        request.flags = flags;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        if (auto replaced = m_registry.insert(id, resource)) {
+            unchargeLocked(*replaced);
+        }
+    }
+    
+    created = true;
+    return load;
+}
+
+void ResourceManager::pushLoad(LoadQueue& queue, const std::shared_ptr<PendingLoad>& load) {
+    queue.push({load->priority.load(std::memory_order_relaxed), m_nextSequence++, load});
+}
+
+void ResourceManager::readStage(PendingLoad& load) const {
+    // Pack entries are decoded straight from the mapping; reloads always
+    // read the changed file
+    if (!load.target) {
+        load.packed = findPacked(load.path);
+    }
+    if (load.packed.entry) {
+        return;
+    }
+    
+    std::string physPath = getPhysicalPath(load.path);
+    if (!physPath.empty()) {
+        std::vector<std::vector<u8>> contents;
+        readFiles({physPath}, contents);
+        load.data = std::move(contents[0]);
+        load.filePath = platform::FileWatcher::normalizePath(physPath);
+    }
+}
+
+void ResourceManager::decodeStage(PendingLoad& load) const {
+    Resource* resource = load.resource.get();
+    resource->setState(ResourceState::Loading);
+    
+    if (load.packed.entry) {
+        load.succeeded = loadPacked(*load.loader, resource, load.packed);
+    } else {
+        load.succeeded = !load.data.empty() && load.loader->load(resource, load.data);
+    }
+    
+    // Reloads keep the bytes in case the target cannot adopt the staging copy
+    if (!load.target) {
+        load.data = {};
+    }
+    load.packed = {};
+}
+
+void ResourceManager::completeLoad(PendingLoad& load) {
+    for (;;) {
+        LoadStage stage = load.stage.load(std::memory_order_acquire);
+        if (stage == LoadStage::Queued &&
+            load.stage.compare_exchange_strong(stage, LoadStage::Reading, std::memory_order_acq_rel)) {
+            readStage(load);
+            {
+                std::lock_guard<std::mutex> lock(m_pipelineMutex);
+                load.stage.store(LoadStage::Read, std::memory_order_release);
+            }
+            m_stageCV.notify_all();
+            stage = LoadStage::Read;
+        }
+        if (stage == LoadStage::Read &&
+            load.stage.compare_exchange_strong(stage, LoadStage::Decoding, std::memory_order_acq_rel)) {
+            decodeStage(load);
+            {
+                std::lock_guard<std::mutex> lock(m_pipelineMutex);
+                load.stage.store(LoadStage::Decoded, std::memory_order_release);
+            }
+            m_stageCV.notify_all();
+            return;
+        }
+        if (stage == LoadStage::Decoded || stage == LoadStage::Finalized) {
+            return;
+        }
         
+        // Another thread is reading or decoding it
+        std::unique_lock<std::mutex> lock(m_pipelineMutex);
+        m_stageCV.wait(lock, [&] {
+            LoadStage current = load.stage.load(std::memory_order_acquire);
+            return current != LoadStage::Reading && current != LoadStage::Decoding;
+        });
+    }
+}
+
+void ResourceManager::finalizeLoad(const std::shared_ptr<PendingLoad>& load) {
+    LoadStage expected = LoadStage::Decoded;
+    if (!load->stage.compare_exchange_strong(expected, LoadStage::Finalized, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (load->target) {
+        finalizeReload(*load);
+        return;
+    }
+    
+    auto elapsed = std::chrono::steady_clock::now() - load->requestTime;
+    if (load->succeeded) {
+        load->resource->setState(ResourceState::Loaded);
         {
-            std::lock_guard<std::mutex> lock(m_queueMutex);
-            m_loadQueue.push(request);
+            // Not charged if it was unloaded while in flight
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            ResourceId id = load->resource->getId();
+            if (m_registry.contains(id, load->resource.get())) {
+                chargeLocked(*load->resource);
+                if (!load->filePath.empty()) {
+                    m_fileToId[load->filePath] = id;
+                }
+            }
         }
-        m_queueCV.notify_one();
-    } else {
-        // Sync load
-        resource->setState(ResourceState::Loading);
+        ResourceMetrics::get().loadTime.record(elapsed);
         
-        auto startTime = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> statsLock(m_statsMutex);
+        m_stats.loadRequestsCompleted++;
+        m_stats.totalLoadTime += std::chrono::duration<f64>(elapsed).count();
+        m_stats.averageLoadTime = m_stats.totalLoadTime / m_stats.loadRequestsCompleted;
+    } else {
+        load->resource->setError("Failed to load resource");
         
-        if (loader->load(resource.get(), data)) {
-            resource->setState(ResourceState::Loaded);
-            
-            auto endTime = std::chrono::steady_clock::now();
-            f64 elapsed = std::chrono::duration<f64>(endTime - startTime).count();
-            
-            std::lock_guard<std::mutex> statsLock(m_statsMutex);
-            m_stats.loadRequestsCompleted++;
-            m_stats.totalLoadTime += elapsed;
-            m_stats.averageLoadTime = m_stats.totalLoadTime / m_stats.loadRequestsCompleted;
-        } else {
-            resource->setError("Failed to load resource");
-            
-            std::lock_guard<std::mutex> statsLock(m_statsMutex);
-            m_stats.loadRequestsFailed++;
-        }
+        std::lock_guard<std::mutex> statsLock(m_statsMutex);
+        m_stats.loadRequestsFailed++;
     }
     
-    // Store resource
+    std::vector<std::function<void(ResourceHandle<>)>> callbacks;
     {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        m_resources[id] = resource;
-        m_pathToId[path] = id;
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        auto it = m_inFlight.find(load->path);
+        if (it != m_inFlight.end() && it->second == load) {
+            m_inFlight.erase(it);
+        }
+        callbacks.swap(load->callbacks);
     }
     
-    return ResourceHandle<>(resource);
+    ResourceHandle<> handle(load->resource);
+    load->promise.set_value(handle);
+    for (auto& callback : callbacks) {
+        callback(handle);
+    }
+}
+
+void ResourceManager::finalizeLoads(f64 budgetSeconds) {
+    auto start = std::chrono::steady_clock::now();
+    for (;;) {
+        std::shared_ptr<PendingLoad> load;
+        {
+            std::lock_guard<std::mutex> lock(m_pipelineMutex);
+            if (m_finalizeQueue.empty()) {
+                return;
+            }
+            load = m_finalizeQueue.top().load;
+            m_finalizeQueue.pop();
+        }
+        
+        // Stale entries (already finalized by load()) cost nothing
+        if (load->stage.load(std::memory_order_acquire) != LoadStage::Decoded) {
+            continue;
+        }
+        finalizeLoad(load);
+        
+        if (std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count() >= budgetSeconds) {
+            return;
+        }
+    }
 }
 
 void ResourceManager::loadBatch(const std::vector<ResourcePath>& paths,
@@ -243,14 +618,7 @@ void ResourceManager::loadBatch(const std::vector<ResourcePath>& paths,
 }
 
 ResourceHandle<> ResourceManager::loadById(ResourceId id, LoadFlags flags) {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_resources.find(id);
-    if (it != m_resources.end()) {
-        return ResourceHandle<>(it->second);
-    }
-    
-    return ResourceHandle<>();
+    return ResourceHandle<>(findResource(id));
 }
 
 void ResourceManager::reload(ResourceHandle<> handle) {
@@ -259,19 +627,7 @@ void ResourceManager::reload(ResourceHandle<> handle) {
 }
 
 void ResourceManager::reload(const ResourcePath& path) {
-    std::shared_ptr<Resource> resource;
-    
-    {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        auto it = m_pathToId.find(path);
-        if (it == m_pathToId.end()) return;
-        
-        auto resIt = m_resources.find(it->second);
-        if (resIt == m_resources.end()) return;
-        
-        resource = resIt->second;
-    }
-    
+    std::shared_ptr<Resource> resource = findResource(path);
     if (!resource) return;
     
     // Unload current
@@ -292,6 +648,13 @@ void ResourceManager::reload(const ResourcePath& path) {
     
     if (loader->load(resource.get(), data)) {
         resource->setState(ResourceState::Loaded);
+        {
+            // Recharge at the new size
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            if (resource->m_charged) {
+                chargeLocked(*resource);
+            }
+        }
         
         if (m_hotReloadCallback) {
             m_hotReloadCallback(path);
@@ -303,13 +666,9 @@ void ResourceManager::reload(const ResourcePath& path) {
 
 void ResourceManager::reloadAll() {
     std::vector<ResourcePath> paths;
-    
-    {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        for (const auto& [path, id] : m_pathToId) {
-            paths.push_back(path);
-        }
-    }
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
+        paths.push_back(resource->getPath());
+    });
     
     for (const auto& path : paths) {
         reload(path);
@@ -320,67 +679,40 @@ void ResourceManager::reloadAll() {
 // Resource Access
 // ============================================================================
 
+std::shared_ptr<Resource> ResourceManager::findResource(const ResourcePath& path) const {
+    // IDs are path hashes; the path compare rules out a collision
+    auto resource = m_registry.find(ResourceId::fromPath(path.path));
+    return resource && resource->getPath() == path ? resource : nullptr;
+}
+
 bool ResourceManager::isLoaded(const ResourcePath& path) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_pathToId.find(path);
-    if (it == m_pathToId.end()) return false;
-    
-    auto resIt = m_resources.find(it->second);
-    if (resIt == m_resources.end()) return false;
-    
-    return resIt->second->isLoaded();
+    auto resource = findResource(path);
+    return resource && resource->isLoaded();
 }
 
 bool ResourceManager::isLoaded(ResourceId id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_resources.find(id);
-    if (it == m_resources.end()) return false;
-    
-    return it->second->isLoaded();
+    auto resource = findResource(id);
+    return resource && resource->isLoaded();
 }
 
 bool ResourceManager::isLoading(const ResourcePath& path) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_pathToId.find(path);
-    if (it == m_pathToId.end()) return false;
-    
-    auto resIt = m_resources.find(it->second);
-    if (resIt == m_resources.end()) return false;
-    
-    return resIt->second->isLoading();
+    auto resource = findResource(path);
+    return resource && resource->isLoading();
 }
 
 bool ResourceManager::isLoading(ResourceId id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_resources.find(id);
-    if (it == m_resources.end()) return false;
-    
-    return it->second->isLoading();
+    auto resource = findResource(id);
+    return resource && resource->isLoading();
 }
 
 ResourceState ResourceManager::getState(const ResourcePath& path) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_pathToId.find(path);
-    if (it == m_pathToId.end()) return ResourceState::Unloaded;
-    
-    auto resIt = m_resources.find(it->second);
-    if (resIt == m_resources.end()) return ResourceState::Unloaded;
-    
-    return resIt->second->getState();
+    auto resource = findResource(path);
+    return resource ? resource->getState() : ResourceState::Unloaded;
 }
 
 ResourceState ResourceManager::getState(ResourceId id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_resources.find(id);
-    if (it == m_resources.end()) return ResourceState::Unloaded;
-    
-    return it->second->getState();
+    auto resource = findResource(id);
+    return resource ? resource->getState() : ResourceState::Unloaded;
 }
 
 // ============================================================================
@@ -393,45 +725,40 @@ void ResourceManager::unload(ResourceHandle<> handle) {
 }
 
 void ResourceManager::unload(const ResourcePath& path) {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    auto it = m_pathToId.find(path);
-    if (it == m_pathToId.end()) return;
-    
-    unload(it->second);
+    if (auto resource = findResource(path)) {
+        unload(resource->getId());
+    }
 }
 
 void ResourceManager::unload(ResourceId id) {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     
-    auto it = m_resources.find(id);
-    if (it == m_resources.end()) return;
+    auto resource = m_registry.find(id);
+    if (!resource) return;
     
     // Don't unload persistent resources
-    if (hasFlag(it->second->m_flags, LoadFlags::Persistent)) {
+    if (hasFlag(resource->m_flags, LoadFlags::Persistent)) {
         return;
     }
     
-    it->second->unload();
-    it->second->setState(ResourceState::Unloaded);
-    
-    // Remove path mapping
-    m_pathToId.erase(it->second->getPath());
-    
-    m_resources.erase(it);
+    unloadLocked(*resource);
+}
+
+void ResourceManager::unloadLocked(Resource& resource) {
+    // Keep it alive until it is fully unloaded
+    auto removed = m_registry.erase(resource.getId(), &resource);
+    unchargeLocked(resource);
+    resource.unload();
+    resource.setState(ResourceState::Unloaded);
 }
 
 void ResourceManager::unloadType(ResourceType type) {
     std::vector<ResourceId> toUnload;
-    
-    {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        for (const auto& [id, resource] : m_resources) {
-            if (resource->getType() == type) {
-                toUnload.push_back(id);
-            }
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
+        if (resource->getType() == type) {
+            toUnload.push_back(resource->getId());
         }
-    }
+    });
     
     for (ResourceId id : toUnload) {
         unload(id);
@@ -440,15 +767,11 @@ void ResourceManager::unloadType(ResourceType type) {
 
 void ResourceManager::unloadUnused() {
     std::vector<ResourceId> toUnload;
-    
-    {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        for (const auto& [id, resource] : m_resources) {
-            if (resource.use_count() == 1) {  // Only manager holds reference
-                toUnload.push_back(id);
-            }
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
+        if (resource.use_count() == 1) {  // Only manager holds reference
+            toUnload.push_back(resource->getId());
         }
-    }
+    });
     
     for (ResourceId id : toUnload) {
         unload(id);
@@ -456,15 +779,15 @@ void ResourceManager::unloadUnused() {
 }
 
 void ResourceManager::unloadAll() {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     
-    for (auto& [id, resource] : m_resources) {
+    for (auto& resource : m_registry.takeAll()) {
+        unchargeLocked(*resource);
         resource->unload();
         resource->setState(ResourceState::Unloaded);
     }
     
-    m_resources.clear();
-    m_pathToId.clear();
+    m_fileToId.clear();
 }
 
 // ============================================================================
@@ -521,6 +844,9 @@ void ResourceManager::unmount(const std::string& virtualPath) {
 }
 
 bool ResourceManager::exists(const ResourcePath& path) const {
+    if (findPacked(path).entry) {
+        return true;
+    }
     std::string physPath = getPhysicalPath(path);
     return !physPath.empty() && fs::exists(physPath);
 }
@@ -552,6 +878,11 @@ std::vector<ResourcePath> ResourceManager::listFiles(const ResourcePath& directo
 }
 
 std::vector<u8> ResourceManager::readFile(const ResourcePath& path) const {
+    if (PackedFile packed = findPacked(path); packed.entry) {
+        auto data = packed.pack->read(*packed.entry);
+        return data ? std::move(*data) : std::vector<u8>();
+    }
+    
     std::string physPath = getPhysicalPath(path);
     if (physPath.empty()) {
         return {};
@@ -606,14 +937,37 @@ std::string ResourceManager::getPhysicalPath(const ResourcePath& path) const {
 // ============================================================================
 
 bool ResourceManager::loadBundle(const ResourcePath& bundlePath) {
+    std::string physPath = getPhysicalPath(bundlePath);
+    auto pack = ResourcePack::open(physPath.empty() ? bundlePath.path : physPath);
+    if (!pack) {
+        return false;
+    }
+    
     std::string stem = bundlePath.getStem();
+    const PackHeader& header = (*pack)->getHeader();
     
     ResourceBundle bundle;
     bundle.name = stem;
     bundle.path = bundlePath;
     bundle.isLoaded = true;
+    bundle.streamOffset = header.dataOffset;
+    bundle.streamSize = header.fileSize - header.dataOffset;
+    
+    auto entries = (*pack)->getEntries();
+    bundle.resources.reserve(entries.size());
+    for (const PackEntry& entry : entries) {
+        bundle.resources.push_back(entry.getId());
+        bundle.totalSize += entry.size;
+        bundle.isCompressed |= entry.isCompressed();
+    }
     
-    m_bundles[stem] = bundle;
+    {
+        std::lock_guard<std::mutex> lock(m_packMutex);
+        std::erase_if(m_packs, [&](const MountedPack& mounted) { return mounted.bundleName == stem; });
+        m_packs.insert(m_packs.begin(), MountedPack{stem, std::move(*pack)});
+    }
+    
+    m_bundles[stem] = std::move(bundle);
     return true;
 }
 
@@ -626,6 +980,12 @@ void ResourceManager::unloadBundle(const std::string& bundleName) {
         unload(id);
     }
     
+    // Loads in flight keep their own reference to the mapping
+    {
+        std::lock_guard<std::mutex> lock(m_packMutex);
+        std::erase_if(m_packs, [&](const MountedPack& mounted) { return mounted.bundleName == bundleName; });
+    }
+    
     m_bundles.erase(it);
 }
 
@@ -634,6 +994,26 @@ const ResourceBundle* ResourceManager::getBundle(const std::string& name) const
     return it != m_bundles.end() ? &it->second : nullptr;
 }
 
+ResourceManager::PackedFile ResourceManager::findPacked(const ResourcePath& path) const {
+    std::lock_guard<std::mutex> lock(m_packMutex);
+    for (const auto& mounted : m_packs) {
+        if (const PackEntry* entry = mounted.pack->find(path.path)) {
+            return {mounted.pack, entry};
+        }
+    }
+    return {};
+}
+
+bool ResourceManager::loadPacked(IResourceLoader& loader, Resource* resource, const PackedFile& file) const {
+    ResourceMetrics::get().packReads.add();
+    if (!file.entry->isCompressed()) {
+        return loader.loadFromMemory(resource, file.pack->view(*file.entry));
+    }
+    
+    auto data = file.pack->read(*file.entry);
+    return data && loader.load(resource, *data);
+}
+
 std::vector<std::string> ResourceManager::getBundleNames() const {
     std::vector<std::string> names;
     for (const auto& [name, bundle] : m_bundles) {
@@ -651,16 +1031,20 @@ void ResourceManager::setHotReloadEnabled(bool enabled) {
 }
 
 void ResourceManager::watchDirectory(const std::string& path) {
-    if (std::find(m_watchDirectories.begin(), m_watchDirectories.end(), path) == m_watchDirectories.end()) {
-        m_watchDirectories.push_back(path);
+    auto it = std::find_if(m_watchDirectories.begin(), m_watchDirectories.end(),
+                           [&](const WatchedDirectory& dir) { return dir.path == path; });
+    if (it == m_watchDirectories.end()) {
+        m_watchDirectories.push_back({path, platform::FileWatcher::get().watch(path)});
     }
 }
 
 void ResourceManager::unwatchDirectory(const std::string& path) {
-    m_watchDirectories.erase(
-        std::remove(m_watchDirectories.begin(), m_watchDirectories.end(), path),
-        m_watchDirectories.end()
-    );
+    auto it = std::find_if(m_watchDirectories.begin(), m_watchDirectories.end(),
+                           [&](const WatchedDirectory& dir) { return dir.path == path; });
+    if (it != m_watchDirectories.end()) {
+        platform::FileWatcher::get().unwatch(it->watch);
+        m_watchDirectories.erase(it);
+    }
 }
 
 void ResourceManager::setHotReloadCallback(std::function<void(const ResourcePath&)> callback) {
@@ -668,8 +1052,183 @@ void ResourceManager::setHotReloadCallback(std::function<void(const ResourcePath
 }
 
 void ResourceManager::checkHotReload() {
-    // Would use platform file watcher here
-    // For now, just check modification times periodically
+    auto& watcher = platform::FileWatcher::get();
+    std::vector<platform::FileEvent> events;
+    for (const auto& dir : m_watchDirectories) {
+        auto changes = watcher.poll(dir.watch);
+        events.insert(events.end(), std::make_move_iterator(changes.begin()), std::make_move_iterator(changes.end()));
+    }
+    if (events.empty()) {
+        return;
+    }
+    
+    // Only files that back loaded resources; removed files keep their
+    // last loaded contents
+    std::vector<std::shared_ptr<Resource>> targets;
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        std::unordered_set<ResourceId> seen;
+        for (const auto& event : events) {
+            if (event.change == platform::FileChange::Removed) {
+                continue;
+            }
+            auto file = m_fileToId.find(event.path);
+            if (file == m_fileToId.end() || !seen.insert(file->second).second) {
+                continue;
+            }
+            auto resource = m_registry.find(file->second);
+            if (resource && resource->isLoaded()) {
+                targets.push_back(std::move(resource));
+            }
+        }
+    }
+    
+    auto batch = std::make_shared<ReloadBatch>();
+    std::vector<std::shared_ptr<PendingLoad>> reloads;
+    for (auto& target : targets) {
+        IResourceLoader* loader = getLoader(target->getPath());
+        auto staged = loader ? loader->createResource() : nullptr;
+        if (!staged) {
+            continue;
+        }
+        staged->m_id = target->getId();
+        staged->m_path = target->getPath();
+        staged->m_name = target->getName();
+        staged->m_type = target->getType();
+        staged->m_flags = target->m_flags;
+        staged->setState(ResourceState::Queued);
+        
+        auto load = std::make_shared<PendingLoad>();
+        load->path = target->getPath();
+        load->resource = std::move(staged);
+        load->loader = loader;
+        load->priority.store(static_cast<u8>(LoadPriority::High), std::memory_order_relaxed);
+        load->requestTime = std::chrono::steady_clock::now();
+        load->target = target;
+        load->batch = batch;
+        batch->changed.push_back(target->getId());
+        reloads.push_back(std::move(load));
+    }
+    if (reloads.empty()) {
+        return;
+    }
+    
+    batch->remaining = reloads.size();
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        for (auto& load : reloads) {
+            pushLoad(m_ioQueue, load);
+        }
+    }
+    m_ioCV.notify_one();
+}
+
+void ResourceManager::finalizeReload(PendingLoad& load) {
+    Resource& target = *load.target;
+    bool reloaded = false;
+    if (load.succeeded) {
+        reloaded = target.adoptReload(*load.resource);
+        if (!reloaded) {
+            target.unload();
+            target.setState(ResourceState::Loading);
+            reloaded = load.loader->load(&target, load.data);
+            if (!reloaded) {
+                target.setError("Failed to reload resource");
+            }
+        }
+    }
+    load.data = {};
+    load.resource.reset();
+    
+    // A file that fails to decode leaves the previous contents in place
+    if (reloaded) {
+        target.setState(ResourceState::Loaded);
+        {
+            // Recharge at the new size
+            std::lock_guard<std::mutex> lock(m_cacheMutex);
+            if (target.m_charged) {
+                chargeLocked(target);
+            }
+        }
+        load.batch->reloaded.push_back(target.getId());
+        
+        if (m_hotReloadCallback) {
+            m_hotReloadCallback(target.getPath());
+        }
+    }
+    
+    if (--load.batch->remaining == 0) {
+        refinalizeDependents(load.batch->reloaded);
+    }
+}
+
+void ResourceManager::refinalizeDependents(const std::vector<ResourceId>& changed) {
+    // Everything downstream of the changed resources
+    std::unordered_set<ResourceId> affected;
+    std::vector<ResourceId> stack(changed.begin(), changed.end());
+    while (!stack.empty()) {
+        ResourceId id = stack.back();
+        stack.pop_back();
+        auto it = m_dependents.find(id);
+        if (it == m_dependents.end()) {
+            continue;
+        }
+        for (ResourceId dependent : it->second) {
+            if (affected.insert(dependent).second) {
+                stack.push_back(dependent);
+            }
+        }
+    }
+    if (affected.empty()) {
+        return;
+    }
+    
+    // Topological order of the affected subgraph: each resource after every
+    // affected resource it depends on
+    std::unordered_map<ResourceId, u32> waiting;
+    std::vector<ResourceId> order;
+    order.reserve(affected.size());
+    for (ResourceId id : affected) {
+        u32 count = 0;
+        if (auto it = m_dependencies.find(id); it != m_dependencies.end()) {
+            for (ResourceId dependency : it->second) {
+                count += affected.contains(dependency) ? 1 : 0;
+            }
+        }
+        if (count == 0) {
+            order.push_back(id);
+        } else {
+            waiting.emplace(id, count);
+        }
+    }
+    for (usize i = 0; i < order.size(); ++i) {
+        auto it = m_dependents.find(order[i]);
+        if (it == m_dependents.end()) {
+            continue;
+        }
+        for (ResourceId dependent : it->second) {
+            auto wait = waiting.find(dependent);
+            if (wait != waiting.end() && --wait->second == 0) {
+                order.push_back(dependent);
+                waiting.erase(wait);
+            }
+        }
+    }
+    // Cycles have no valid order; they go last
+    for (const auto& [id, count] : waiting) {
+        order.push_back(id);
+    }
+    
+    for (ResourceId id : order) {
+        auto resource = findResource(id);
+        if (!resource || !resource->isLoaded()) {
+            continue;
+        }
+        resource->onDependenciesReloaded();
+        if (m_hotReloadCallback) {
+            m_hotReloadCallback(resource->getPath());
+        }
+    }
 }
 
 // ============================================================================
@@ -682,13 +1241,27 @@ void ResourceManager::setCacheSize(usize bytes) {
 }
 
 usize ResourceManager::getUsedMemory() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
-    usize total = 0;
-    for (const auto& [id, resource] : m_resources) {
-        total += resource->getMemorySize();
+    return m_usedMemory.load(std::memory_order_relaxed);
+}
+
+void ResourceManager::setTypeBudget(ResourceType type, usize bytes) {
+    {
+        std::lock_guard<std::mutex> lock(m_cacheMutex);
+        m_typeCaches[type].budget = bytes;
     }
-    return total;
+    trimCache();
+}
+
+usize ResourceManager::getTypeBudget(ResourceType type) const {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto it = m_typeCaches.find(type);
+    return it != m_typeCaches.end() ? it->second.budget : ~usize(0);
+}
+
+usize ResourceManager::getTypeMemory(ResourceType type) const {
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
+    auto it = m_typeCaches.find(type);
+    return it != m_typeCaches.end() ? it->second.used : 0;
 }
 
 void ResourceManager::clearCache() {
@@ -696,42 +1269,122 @@ void ResourceManager::clearCache() {
 }
 
 void ResourceManager::trimCache() {
-    while (getUsedMemory() > m_cacheSize) {
-        evictLRU();
-    }
+    evict(std::numeric_limits<f64>::infinity());
 }
 
 void ResourceManager::setUnloadDelay(f32 seconds) {
     m_unloadDelay = seconds;
 }
 
-void ResourceManager::evictLRU() {
-    ResourceId oldest;
-    u64 oldestTime = ~0ULL;
+void ResourceManager::setFinalizeBudget(f32 seconds) {
+    m_finalizeBudget = std::max(seconds, 0.0f);
+}
+
+void ResourceManager::setEvictionBudget(f32 seconds) {
+    m_evictionBudget = std::max(seconds, 0.0f);
+}
+
+void ResourceManager::LruList::pushFront(Resource* resource) {
+    resource->m_lruPrev = nullptr;
+    resource->m_lruNext = head;
+    if (head) {
+        head->m_lruPrev = resource;
+    } else {
+        tail = resource;
+    }
+    head = resource;
+    size++;
+    resource->m_lruStamp = resource->getLastAccessTime();
+}
+
+void ResourceManager::LruList::remove(Resource* resource) {
+    (resource->m_lruPrev ? resource->m_lruPrev->m_lruNext : head) = resource->m_lruNext;
+    (resource->m_lruNext ? resource->m_lruNext->m_lruPrev : tail) = resource->m_lruPrev;
+    resource->m_lruPrev = nullptr;
+    resource->m_lruNext = nullptr;
+    size--;
+}
+
+void ResourceManager::chargeLocked(Resource& resource) {
+    unchargeLocked(resource);
     
-    {
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        
-        for (const auto& [id, resource] : m_resources) {
-            // Skip persistent resources
-            if (hasFlag(resource->m_flags, LoadFlags::Persistent)) {
-                continue;
-            }
-            
-            // Skip resources still in use
-            if (resource.use_count() > 1) {
-                continue;
-            }
-            
-            if (resource->getLastAccessTime() < oldestTime) {
-                oldestTime = resource->getLastAccessTime();
-                oldest = id;
-            }
+    TypeCache& cache = m_typeCaches[resource.getType()];
+    resource.m_chargedSize = resource.getMemorySize();
+    resource.m_charged = true;
+    m_usedMemory.fetch_add(resource.m_chargedSize, std::memory_order_relaxed);
+    cache.used += resource.m_chargedSize;
+    
+    resource.updateAccessTime();
+    if (!hasFlag(resource.m_flags, LoadFlags::Persistent)) {
+        cache.lru.pushFront(&resource);
+        resource.m_inLru = true;
+    }
+}
+
+void ResourceManager::unchargeLocked(Resource& resource) {
+    if (!resource.m_charged) {
+        return;
+    }
+    
+    TypeCache& cache = m_typeCaches[resource.getType()];
+    m_usedMemory.fetch_sub(resource.m_chargedSize, std::memory_order_relaxed);
+    cache.used -= resource.m_chargedSize;
+    if (resource.m_inLru) {
+        cache.lru.remove(&resource);
+        resource.m_inLru = false;
+    }
+    resource.m_chargedSize = 0;
+    resource.m_charged = false;
+}
+
+Resource* ResourceManager::findVictimLocked(TypeCache& cache) {
+    // Cache hits only stamp their access time, so the list is reordered
+    // here: resources used since they were linked, or still held outside
+    // the cache, go back to the front. Each is passed over at most once per
+    // pass instead of on every eviction.
+    for (usize remaining = cache.lru.size; remaining > 0; --remaining) {
+        Resource* candidate = cache.lru.tail;
+        if (candidate->getLastAccessTime() == candidate->m_lruStamp &&
+            candidate->weak_from_this().use_count() <= 1) {
+            return candidate;
         }
+        cache.lru.remove(candidate);
+        cache.lru.pushFront(candidate);
     }
+    return nullptr;
+}
+
+void ResourceManager::evict(f64 budgetSeconds) {
+    auto start = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(m_cacheMutex);
     
-    if (oldest.isValid()) {
-        unload(oldest);
+    for (;;) {
+        // Types over their own budget first, then the oldest of any type
+        Resource* victim = nullptr;
+        for (auto& [type, cache] : m_typeCaches) {
+            if (cache.used > cache.budget && (victim = findVictimLocked(cache))) {
+                break;
+            }
+        }
+        if (!victim && m_usedMemory.load(std::memory_order_relaxed) > m_cacheSize) {
+            for (auto& [type, cache] : m_typeCaches) {
+                Resource* candidate = findVictimLocked(cache);
+                if (candidate && (!victim || candidate->getLastAccessTime() < victim->getLastAccessTime())) {
+                    victim = candidate;
+                }
+            }
+        }
+        if (!victim) {
+            return;
+        }
+        
+        unloadLocked(*victim);
+        ResourceMetrics::get().evictions.add();
+        
+        std::chrono::duration<f64> elapsed = std::chrono::steady_clock::now() - start;
+        if (elapsed.count() >= budgetSeconds) {
+            return;
+        }
     }
 }
 
@@ -740,13 +1393,32 @@ void ResourceManager::evictLRU() {
 // ============================================================================
 
 CacheStats ResourceManager::getStats() const {
-    std::lock_guard<std::mutex> statsLock(m_statsMutex);
-    std::lock_guard<std::mutex> resLock(m_resourceMutex);
-    
-    CacheStats stats = m_stats;
+    u32 queued = 0;
+    u32 active = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_pipelineMutex);
+        for (const auto& [path, load] : m_inFlight) {
+            if (load->stage.load(std::memory_order_relaxed) == LoadStage::Queued) {
+                queued++;
+            } else {
+                active++;
+            }
+        }
+    }
     
-    stats.totalResources = static_cast<u32>(m_resources.size());
-    for (const auto& [id, resource] : m_resources) {
+    CacheStats stats;
+    {
+        std::lock_guard<std::mutex> lock(m_statsMutex);
+        stats = m_stats;
+    }
+    stats.loadRequestsQueued = queued;
+    stats.loadRequestsActive = active;
+    stats.cacheHits = m_cacheHits.load(std::memory_order_relaxed);
+    stats.cacheMisses = m_cacheMisses.load(std::memory_order_relaxed);
+    
+    stats.usedMemory = m_usedMemory.load(std::memory_order_relaxed);
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
+        stats.totalResources++;
         switch (resource->getState()) {
             case ResourceState::Loaded:
                 stats.loadedResources++;
@@ -761,9 +1433,8 @@ CacheStats ResourceManager::getStats() const {
             default:
                 break;
         }
-    }
+    });
     
-    stats.usedMemory = getUsedMemory();
     stats.cacheSize = m_cacheSize;
     stats.hitRate = (stats.cacheHits + stats.cacheMisses > 0) ?
         static_cast<f32>(stats.cacheHits) / (stats.cacheHits + stats.cacheMisses) : 0.0f;
@@ -774,6 +1445,8 @@ CacheStats ResourceManager::getStats() const {
 void ResourceManager::resetStats() {
     std::lock_guard<std::mutex> lock(m_statsMutex);
     m_stats = CacheStats();
+    m_cacheHits.store(0, std::memory_order_relaxed);
+    m_cacheMisses.store(0, std::memory_order_relaxed);
 }
 
 ResourceMetadata ResourceManager::getMetadata(const ResourcePath& path) const {
@@ -788,41 +1461,31 @@ ResourceMetadata ResourceManager::getMetadata(const ResourcePath& path) const {
         metadata.lastModified = static_cast<u64>(modTime.time_since_epoch().count());
     }
     
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    auto it = m_pathToId.find(path);
-    if (it != m_pathToId.end()) {
-        auto resIt = m_resources.find(it->second);
-        if (resIt != m_resources.end()) {
-            metadata.id = resIt->second->getId();
-            metadata.type = resIt->second->getType();
-        }
+    if (auto resource = findResource(path)) {
+        metadata.id = resource->getId();
+        metadata.type = resource->getType();
     }
     
     return metadata;
 }
 
 std::vector<ResourcePath> ResourceManager::getLoadedPaths() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
     std::vector<ResourcePath> paths;
-    for (const auto& [path, id] : m_pathToId) {
-        auto it = m_resources.find(id);
-        if (it != m_resources.end() && it->second->isLoaded()) {
-            paths.push_back(path);
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
+        if (resource->isLoaded()) {
+            paths.push_back(resource->getPath());
         }
-    }
+    });
     return paths;
 }
 
 std::vector<ResourceHandle<>> ResourceManager::getResourcesByType(ResourceType type) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    
     std::vector<ResourceHandle<>> result;
-    for (const auto& [id, resource] : m_resources) {
+    m_registry.forEach([&](const std::shared_ptr<Resource>& resource) {
         if (resource->getType() == type) {
             result.push_back(ResourceHandle<>(resource));
         }
-    }
+    });
     return result;
 }
 
@@ -846,32 +1509,90 @@ void ResourceManager::addDependency(ResourceId dependent, ResourceId dependency)
 }
 
 // ============================================================================
-// Worker Thread
+// Pipeline Threads
 // ============================================================================
 
-void ResourceManager::workerThread() {
-    while (m_running) {
-        LoadRequest request;
-        
+void ResourceManager::ioThread() {
+    std::vector<std::shared_ptr<PendingLoad>> batch;
+    std::vector<std::string> physicalPaths;
+    std::vector<PendingLoad*> looseFiles;
+    std::vector<std::vector<u8>> contents;
+    
+    while (true) {
+        batch.clear();
         {
-            std::unique_lock<std::mutex> lock(m_queueMutex);
-            m_queueCV.wait(lock, [this] { return !m_running || !m_loadQueue.empty(); });
+            std::unique_lock<std::mutex> lock(m_pipelineMutex);
+            m_ioCV.wait(lock, [this] { return !m_running || !m_ioQueue.empty(); });
+            if (!m_running) break;
             
+            while (!m_ioQueue.empty() && batch.size() < ResourceConfig::IO_BATCH_SIZE) {
+                auto load = m_ioQueue.top().load;
+                m_ioQueue.pop();
+                LoadStage expected = LoadStage::Queued;
+                if (load->stage.compare_exchange_strong(expected, LoadStage::Reading, std::memory_order_acq_rel)) {
+                    batch.push_back(std::move(load));
+                }
+            }
+        }
+        
+        // Resolve the batch, then read all loose files together
+        physicalPaths.clear();
+        looseFiles.clear();
+        for (auto& load : batch) {
+            if (!load->target) {
+                load->packed = findPacked(load->path);
+            }
+            if (load->packed.entry) {
+                continue;
+            }
+            std::string physPath = getPhysicalPath(load->path);
+            if (!physPath.empty()) {
+                load->filePath = platform::FileWatcher::normalizePath(physPath);
+                physicalPaths.push_back(std::move(physPath));
+                looseFiles.push_back(load.get());
+            }
+        }
+        readFiles(physicalPaths, contents);
+        for (usize i = 0; i < looseFiles.size(); ++i) {
+            looseFiles[i]->data = std::move(contents[i]);
+        }
+        
+        {
+            std::lock_guard<std::mutex> lock(m_pipelineMutex);
+            for (auto& load : batch) {
+                load->stage.store(LoadStage::Read, std::memory_order_release);
+                pushLoad(m_decodeQueue, load);
+            }
+        }
+        m_decodeCV.notify_all();
+        m_stageCV.notify_all();
+    }
+}
+
+void ResourceManager::workerThread() {
+    while (true) {
+        std::shared_ptr<PendingLoad> load;
+        {
+            std::unique_lock<std::mutex> lock(m_pipelineMutex);
+            m_decodeCV.wait(lock, [this] { return !m_running || !m_decodeQueue.empty(); });
             if (!m_running) break;
-            if (m_loadQueue.empty()) continue;
             
-            request = m_loadQueue.top();
-            m_loadQueue.pop();
+            load = m_decodeQueue.top().load;
+            m_decodeQueue.pop();
         }
         
-        // Process load request
-        auto handle = loadInternal(request.path, request.flags & ~LoadFlags::Async);
+        LoadStage expected = LoadStage::Read;
+        if (!load->stage.compare_exchange_strong(expected, LoadStage::Decoding, std::memory_order_acq_rel)) {
+            continue;
+        }
+        decodeStage(*load);
+        load->stage.store(LoadStage::Decoded, std::memory_order_release);
         
-        if (request.onComplete && handle.isValid()) {
-            request.onComplete(handle);
-        } else if (request.onError && !handle.isValid()) {
-            request.onError("Failed to load resource: " + request.path.path);
+        {
+            std::lock_guard<std::mutex> lock(m_pipelineMutex);
+            pushLoad(m_finalizeQueue, load);
         }
+        m_stageCV.notify_all();
     }
 }
 
@@ -0,0 +1,535 @@
+/**
+ * @file resource_pack.cpp
+ * @brief NovaCore Resource System™ - Memory-Mapped Resource Pack Implementation
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include <nova/core/resource/resource_pack.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <numeric>
+
+#if defined(NOVA_HAS_ZSTD)
+    #include <zstd.h>
+#endif
+
+namespace nova::resource {
+
+namespace {
+
+// ============================================================================
+// LZ4 Block Codec
+// ============================================================================
+
+// Block format limits: the last 5 bytes are always literals and the last
+// match starts at least 12 bytes before the end
+constexpr usize LZ4_MIN_MATCH = 4;
+constexpr usize LZ4_LAST_LITERALS = 5;
+constexpr usize LZ4_MATCH_FIND_LIMIT = 12;
+constexpr usize LZ4_MAX_OFFSET = 65535;
+constexpr u32 LZ4_HASH_BITS = 12;
+
+[[nodiscard]] u32 read32(const u8* p) noexcept {
+    u32 value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+void writeLength(std::vector<u8>& out, usize length) {
+    while (length >= 255) {
+        out.push_back(255);
+        length -= 255;
+    }
+    out.push_back(static_cast<u8>(length));
+}
+
+void writeSequence(std::vector<u8>& out, const u8* literals, usize literalLength,
+                   usize offset, usize matchLength) {
+    usize matchCode = matchLength - LZ4_MIN_MATCH;
+    u8 token = static_cast<u8>((std::min<usize>(literalLength, 15) << 4) |
+                               (matchLength > 0 ? std::min<usize>(matchCode, 15) : 0));
+    out.push_back(token);
+    if (literalLength >= 15) {
+        writeLength(out, literalLength - 15);
+    }
+    out.insert(out.end(), literals, literals + literalLength);
+
+    // The final sequence is literals only
+    if (matchLength == 0) {
+        return;
+    }
+    out.push_back(static_cast<u8>(offset));
+    out.push_back(static_cast<u8>(offset >> 8));
+    if (matchCode >= 15) {
+        writeLength(out, matchCode - 15);
+    }
+}
+
+/// Greedy single-probe compressor; packs are built offline, so this
+/// favours a small, obviously correct encoder over ratio
+std::vector<u8> compressLZ4(std::span<const u8> input) {
+    std::vector<u8> out;
+    out.reserve(input.size() + input.size() / 255 + 16);
+
+    const u8* src = input.data();
+    usize size = input.size();
+    usize anchor = 0;
+
+    if (size > LZ4_MATCH_FIND_LIMIT) {
+        constexpr u32 NO_POSITION = ~0u;
+        std::array<u32, 1u << LZ4_HASH_BITS> table;
+        table.fill(NO_POSITION);
+
+        usize matchEnd = size - LZ4_LAST_LITERALS;
+        usize i = 0;
+        while (i < size - LZ4_MATCH_FIND_LIMIT) {
+            u32 sequence = read32(src + i);
+            u32 hash = (sequence * 2654435761u) >> (32 - LZ4_HASH_BITS);
+            u32 candidate = table[hash];
+            table[hash] = static_cast<u32>(i);
+
+            if (candidate == NO_POSITION || i - candidate > LZ4_MAX_OFFSET ||
+                read32(src + candidate) != sequence) {
+                ++i;
+                continue;
+            }
+
+            usize length = LZ4_MIN_MATCH;
+            while (i + length < matchEnd && src[candidate + length] == src[i + length]) {
+                ++length;
+            }
+            writeSequence(out, src + anchor, i - anchor, i - candidate, length);
+            i += length;
+            anchor = i;
+        }
+    }
+
+    writeSequence(out, src + anchor, size - anchor, 0, 0);
+    return out;
+}
+
+bool decompressLZ4(std::span<const u8> input, u8* out, usize outSize) noexcept {
+    const u8* ip = input.data();
+    const u8* inEnd = ip + input.size();
+    u8* op = out;
+    u8* outEnd = out + outSize;
+
+    auto readLength = [&](usize& length) {
+        u8 byte;
+        do {
+            if (ip >= inEnd) {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (ip < inEnd) {
+        u8 token = *ip++;
+
+        usize literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<usize>(inEnd - ip) ||
+            literalLength > static_cast<usize>(outEnd - op)) {
+            return false;
+        }
+        std::memcpy(op, ip, literalLength);
+        ip += literalLength;
+        op += literalLength;
+
+        if (ip == inEnd) {
+            break;
+        }
+
+        if (inEnd - ip < 2) {
+            return false;
+        }
+        usize offset = ip[0] | (static_cast<usize>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<usize>(op - out)) {
+            return false;
+        }
+
+        usize matchLength = token & 15;
+        if (matchLength == 15 && !readLength(matchLength)) {
+            return false;
+        }
+        matchLength += LZ4_MIN_MATCH;
+        if (matchLength > static_cast<usize>(outEnd - op)) {
+            return false;
+        }
+
+        // Matches may overlap their own output
+        const u8* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        } else {
+            for (usize k = 0; k < matchLength; ++k) {
+                *op++ = match[k];
+            }
+        }
+    }
+
+    return op == outEnd;
+}
+
+// ============================================================================
+// Codec Dispatch
+// ============================================================================
+
+#if defined(NOVA_HAS_ZSTD)
+constexpr int ZSTD_PACK_LEVEL = 19;
+#endif
+
+std::vector<u8> compress(PackCompression compression, std::span<const u8> data) {
+    switch (compression) {
+        case PackCompression::LZ4:
+            return compressLZ4(data);
+#if defined(NOVA_HAS_ZSTD)
+        case PackCompression::Zstd: {
+            std::vector<u8> out(ZSTD_compressBound(data.size()));
+            usize written = ZSTD_compress(out.data(), out.size(), data.data(), data.size(), ZSTD_PACK_LEVEL);
+            if (ZSTD_isError(written)) {
+                return {};
+            }
+            out.resize(written);
+            return out;
+        }
+#endif
+        default:
+            return {};
+    }
+}
+
+bool decompress(PackCompression compression, std::span<const u8> data, u8* out, usize outSize) {
+    switch (compression) {
+        case PackCompression::LZ4:
+            return decompressLZ4(data, out, outSize);
+#if defined(NOVA_HAS_ZSTD)
+        case PackCompression::Zstd: {
+            usize written = ZSTD_decompress(out, outSize, data.data(), data.size());
+            return !ZSTD_isError(written) && written == outSize;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+/// Same hash as ResourceId::fromPath(), without copying the path
+[[nodiscard]] u64 hashPath(std::string_view path) noexcept {
+    u64 hash = 14695981039346656037ULL;
+    for (char c : path) {
+        hash ^= static_cast<u64>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+[[nodiscard]] bool fits(u64 offset, u64 size, u64 limit) noexcept {
+    return offset <= limit && size <= limit - offset;
+}
+
+} // namespace
+
+bool isPackCompressionSupported(PackCompression compression) {
+    switch (compression) {
+        case PackCompression::None:
+        case PackCompression::LZ4:
+            return true;
+        case PackCompression::Zstd:
+#if defined(NOVA_HAS_ZSTD)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+// ============================================================================
+// ResourcePack
+// ============================================================================
+
+ResourcePack::ResourcePack(std::string filePath, platform::MappedFile file) noexcept
+    : m_filePath(std::move(filePath))
+    , m_file(std::move(file))
+    , m_data(m_file.data())
+    , m_size(m_file.size())
+    , m_header(reinterpret_cast<const PackHeader*>(m_data))
+{
+}
+
+Result<std::shared_ptr<ResourcePack>> ResourcePack::open(const std::string& filePath) {
+    auto file = platform::MappedFile::open(filePath);
+    if (!file) {
+        return std::unexpected(file.error());
+    }
+
+    std::shared_ptr<ResourcePack> pack(new ResourcePack(filePath, std::move(*file)));
+    if (auto valid = pack->validate(); !valid) {
+        return std::unexpected(valid.error());
+    }
+
+    const PackHeader& header = *pack->m_header;
+    pack->m_entries = {reinterpret_cast<const PackEntry*>(pack->m_data + header.entriesOffset), header.entryCount};
+    pack->m_index = {reinterpret_cast<const u32*>(pack->m_data + header.indexOffset), header.indexSize};
+    pack->m_names = reinterpret_cast<const char*>(pack->m_data + header.namesOffset);
+    return pack;
+}
+
+Result<void> ResourcePack::validate() const {
+    auto invalid = [this](const char* reason) {
+        return std::unexpected(errors::parse(std::string("Invalid resource pack ") + m_filePath + ": " + reason));
+    };
+
+    if (m_size < sizeof(PackHeader)) {
+        return invalid("truncated header");
+    }
+    const PackHeader& header = *m_header;
+    if (header.magic != PackFormat::MAGIC) {
+        return invalid("bad magic");
+    }
+    if (header.version != PackFormat::VERSION) {
+        return invalid("unsupported version");
+    }
+    if (header.fileSize != m_size) {
+        return invalid("size mismatch");
+    }
+    if (!std::has_single_bit(header.dataAlignment) || header.dataAlignment > PackFormat::MAX_ALIGNMENT) {
+        return invalid("bad data alignment");
+    }
+
+    // The index needs at least one empty slot so probing terminates
+    if (!std::has_single_bit(header.indexSize) || header.indexSize <= header.entryCount) {
+        return invalid("bad index size");
+    }
+    if (header.entriesOffset % alignof(PackEntry) != 0 ||
+        !fits(header.entriesOffset, u64{header.entryCount} * sizeof(PackEntry), m_size)) {
+        return invalid("entry table out of bounds");
+    }
+    if (header.indexOffset % alignof(u32) != 0 ||
+        !fits(header.indexOffset, u64{header.indexSize} * sizeof(u32), m_size)) {
+        return invalid("index out of bounds");
+    }
+    if (!fits(header.namesOffset, header.namesSize, m_size)) {
+        return invalid("name table out of bounds");
+    }
+
+    // One sequential pass so lookups and views need no bounds checks
+    auto entries = reinterpret_cast<const PackEntry*>(m_data + header.entriesOffset);
+    for (u32 i = 0; i < header.entryCount; ++i) {
+        const PackEntry& entry = entries[i];
+        if (!fits(entry.offset, entry.storedSize, m_size) ||
+            !fits(entry.nameOffset, entry.nameLength, header.namesSize)) {
+            return invalid("entry out of bounds");
+        }
+        if (entry.compression == PackCompression::None ? entry.storedSize != entry.size
+                                                       : !isPackCompressionSupported(entry.compression)) {
+            return invalid("unsupported entry compression");
+        }
+        // read() allocates entry.size up front, so bound it before trusting it
+        if (entry.size > PackFormat::MAX_ENTRY_SIZE ||
+            (entry.compression == PackCompression::LZ4 && entry.size > entry.storedSize * PackFormat::LZ4_MAX_RATIO)) {
+            return invalid("entry size out of range");
+        }
+    }
+
+    // Each entry may occupy one slot, and one slot must stay empty so probing terminates
+    auto index = reinterpret_cast<const u32*>(m_data + header.indexOffset);
+    std::vector<bool> indexed(header.entryCount + 1, false);
+    bool hasEmptySlot = false;
+    for (u32 i = 0; i < header.indexSize; ++i) {
+        u32 entry = index[i];
+        if (entry > header.entryCount) {
+            return invalid("index slot out of range");
+        }
+        if (entry == 0) {
+            hasEmptySlot = true;
+        } else if (indexed[entry]) {
+            return invalid("duplicate index slot");
+        } else {
+            indexed[entry] = true;
+        }
+    }
+    if (!hasEmptySlot) {
+        return invalid("index has no empty slot");
+    }
+    return {};
+}
+
+const PackEntry* ResourcePack::find(std::string_view path) const noexcept {
+    u64 id = hashPath(path);
+    usize mask = m_index.size() - 1;
+    for (usize slot = id & mask;; slot = (slot + 1) & mask) {
+        u32 entry = m_index[slot];
+        if (entry == 0) {
+            return nullptr;
+        }
+        const PackEntry& candidate = m_entries[entry - 1];
+        if (candidate.id == id && getPath(candidate) == path) {
+            return &candidate;
+        }
+    }
+}
+
+const PackEntry* ResourcePack::find(ResourceId id) const noexcept {
+    usize mask = m_index.size() - 1;
+    for (usize slot = id.value & mask;; slot = (slot + 1) & mask) {
+        u32 entry = m_index[slot];
+        if (entry == 0) {
+            return nullptr;
+        }
+        if (m_entries[entry - 1].id == id.value) {
+            return &m_entries[entry - 1];
+        }
+    }
+}
+
+Result<std::vector<u8>> ResourcePack::read(const PackEntry& entry) const {
+    std::span<const u8> stored = view(entry);
+    if (!entry.isCompressed()) {
+        return std::vector<u8>(stored.begin(), stored.end());
+    }
+
+    std::vector<u8> data(static_cast<usize>(entry.size));
+    if (!decompress(entry.compression, stored, data.data(), data.size())) {
+        return std::unexpected(errors::parse("Corrupt resource pack entry: " + std::string(getPath(entry))));
+    }
+    return data;
+}
+
+// ============================================================================
+// ResourcePackWriter
+// ============================================================================
+
+ResourcePackWriter::ResourcePackWriter(u32 dataAlignment)
+    : m_dataAlignment(std::clamp(std::bit_ceil(dataAlignment), 1u, PackFormat::MAX_ALIGNMENT))
+{
+}
+
+bool ResourcePackWriter::add(const ResourcePath& path, std::span<const u8> data,
+                             ResourceType type, PackCompression compression) {
+    if (path.isEmpty() || !isPackCompressionSupported(compression) || m_paths.contains(path.path) ||
+        data.size() > PackFormat::MAX_ENTRY_SIZE) {
+        return false;
+    }
+
+    PendingEntry entry{path.path, type, PackCompression::None, data.size(), {}};
+    if (compression != PackCompression::None && !data.empty()) {
+        std::vector<u8> packed = compress(compression, data);
+        if (!packed.empty() && packed.size() < data.size()) {
+            entry.compression = compression;
+            entry.stored = std::move(packed);
+        }
+    }
+    if (entry.compression == PackCompression::None) {
+        entry.stored.assign(data.begin(), data.end());
+    }
+
+    m_paths.insert(path.path);
+    m_entries.push_back(std::move(entry));
+    return true;
+}
+
+Result<void> ResourcePackWriter::write(const std::string& filePath) const {
+    // Entries are laid out in path order so neighbouring assets share pages
+    std::vector<u32> order(m_entries.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::sort(order.begin(), order.end(), [this](u32 a, u32 b) {
+        return m_entries[a].path < m_entries[b].path;
+    });
+
+    auto entryCount = static_cast<u32>(m_entries.size());
+    PackHeader header;
+    header.entryCount = entryCount;
+    header.indexSize = std::bit_ceil(std::max<u32>(entryCount * 2, 2));
+    header.entriesOffset = alignUp<u64>(sizeof(PackHeader), alignof(PackEntry));
+    header.indexOffset = header.entriesOffset + u64{entryCount} * sizeof(PackEntry);
+    header.namesOffset = header.indexOffset + u64{header.indexSize} * sizeof(u32);
+    header.dataAlignment = m_dataAlignment;
+
+    std::vector<PackEntry> entries(entryCount);
+    std::vector<u32> index(header.indexSize, 0);
+    std::string names;
+    u64 offset = 0;
+    for (u32 i = 0; i < entryCount; ++i) {
+        const PendingEntry& pending = m_entries[order[i]];
+        if (names.size() + pending.path.size() > std::numeric_limits<u32>::max()) {
+            return std::unexpected(errors::invalidArgument("Resource pack name table exceeds 4 GiB"));
+        }
+
+        PackEntry& entry = entries[i];
+        entry.id = ResourceId::fromPath(pending.path).value;
+        entry.nameOffset = static_cast<u32>(names.size());
+        entry.nameLength = static_cast<u32>(pending.path.size());
+        entry.type = pending.type;
+        entry.compression = pending.compression;
+        entry.size = pending.size;
+        entry.storedSize = pending.stored.size();
+        entry.offset = alignUp<u64>(offset, m_dataAlignment);
+        offset = entry.offset + entry.storedSize;
+        names += pending.path;
+
+        usize mask = header.indexSize - 1;
+        usize slot = entry.id & mask;
+        while (index[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        index[slot] = i + 1;
+    }
+
+    header.namesSize = names.size();
+    header.dataOffset = alignUp<u64>(header.namesOffset + header.namesSize, m_dataAlignment);
+    header.fileSize = header.dataOffset + offset;
+    for (auto& entry : entries) {
+        entry.offset += header.dataOffset;
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        return std::unexpected(errors::io("Cannot create resource pack: " + filePath));
+    }
+
+    u64 position = 0;
+    auto put = [&](const void* bytes, usize size) {
+        file.write(static_cast<const char*>(bytes), static_cast<std::streamsize>(size));
+        position += size;
+    };
+    auto padTo = [&](u64 target) {
+        static constexpr std::array<char, 256> ZEROS{};
+        while (position < target) {
+            put(ZEROS.data(), static_cast<usize>(std::min<u64>(target - position, ZEROS.size())));
+        }
+    };
+
+    put(&header, sizeof(header));
+    padTo(header.entriesOffset);
+    put(entries.data(), entries.size() * sizeof(PackEntry));
+    put(index.data(), index.size() * sizeof(u32));
+    put(names.data(), names.size());
+    for (u32 i = 0; i < entryCount; ++i) {
+        padTo(entries[i].offset);
+        const auto& stored = m_entries[order[i]].stored;
+        put(stored.data(), stored.size());
+    }
+    padTo(header.fileSize);
+
+    if (!file.flush()) {
+        return std::unexpected(errors::io("Failed to write resource pack: " + filePath));
+    }
+    return {};
+}
+
+} // namespace nova::resource
@@ -7,6 +7,7 @@
  */
 
 #include <nova/core/script/script_engine.hpp>
+#include <nova/core/ecs/world.hpp>
 
 #include <algorithm>
 #include <fstream>
@@ -41,6 +42,7 @@ bool ScriptEngine::initialize() {
     registerBuiltinStringFunctions();
     registerBuiltinArrayFunctions();
     registerBuiltinConsoleFunctions();
+    registerBuiltinVectorFunctions();
     
     m_initialized = true;
     return true;
@@ -53,6 +55,8 @@ void ScriptEngine::shutdown() {
     
     // Destroy all objects
     m_objects.clear();
+    m_instanceStorage.clear();
+    m_classStorage.clear();
     
     // Unload all modules
     unloadAllModules();
@@ -60,6 +64,7 @@ void ScriptEngine::shutdown() {
     // Clear functions
     m_functions.clear();
     m_functionSignatures.clear();
+    m_natives.clear();
     
     // Clear classes
     m_classes.clear();
@@ -67,7 +72,6 @@ void ScriptEngine::shutdown() {
     // Clear globals
     m_globals.clear();
     
-    m_debugger.reset();
     m_initialized = false;
 }
 
@@ -81,6 +85,8 @@ void ScriptEngine::update(f32 deltaTime) {
         checkFileChanges();
         processReloadQueue();
     }
+    
+    tickInstances(deltaTime);
 }
 
 // ============================================================================
@@ -177,7 +183,14 @@ bool ScriptEngine::isModuleLoaded(const std::string& name) const {
 // ============================================================================
 
 void ScriptEngine::registerClass(const ScriptClass& cls) {
-    m_classes[cls.name] = cls;
+    ScriptClass& stored = m_classes[cls.name];
+    stored = cls;
+    
+    // Live batched instances follow the new property layout
+    auto it = m_classStorage.find(cls.name);
+    if (it != m_classStorage.end()) {
+        it->second->setClass(stored);
+    }
 }
 
 const ScriptClass* ScriptEngine::getClass(const std::string& name) const {
@@ -278,29 +291,200 @@ std::vector<std::shared_ptr<ScriptObject>> ScriptEngine::getObjectsOfClass(const
     return result;
 }
 
+// ============================================================================
+// Batched Instances
+// ============================================================================
+
+ScriptInstanceId ScriptEngine::createInstance(const std::string& className, ecs::Entity owner) {
+    const ScriptClass* cls = getClass(className);
+    if (!cls || cls->isAbstract) {
+        ScriptError error;
+        error.level = ScriptErrorLevel::Error;
+        error.message = (cls ? "Cannot instantiate abstract class: " : "Unknown class: ") + className;
+        reportError(error);
+        return INVALID_SCRIPT_INSTANCE;
+    }
+    
+    ScriptInstanceId id = m_nextInstanceId++;
+    if (m_tickingInstances) {
+        m_deferredCreates.push_back({id, className, owner});
+    } else {
+        addInstance(id, *cls, owner);
+    }
+    return id;
+}
+
+void ScriptEngine::addInstance(ScriptInstanceId id, const ScriptClass& cls, ecs::Entity owner) {
+    auto& storage = m_classStorage[cls.name];
+    if (!storage) {
+        storage = std::make_unique<ScriptClassStorage>(cls);
+    }
+    
+    storage->create(id, owner);
+    m_instanceStorage[id] = storage.get();
+    m_stats.objectsCreated++;
+}
+
+ScriptInstanceId ScriptEngine::attachInstance(ecs::World& world, ecs::Entity entity, const std::string& className) {
+    if (!world.isValid(entity)) {
+        return INVALID_SCRIPT_INSTANCE;
+    }
+    
+    ScriptInstanceId id = createInstance(className, entity);
+    if (id != INVALID_SCRIPT_INSTANCE) {
+        world.addComponent(entity, ScriptComponent{id});
+    }
+    return id;
+}
+
+bool ScriptEngine::destroyInstance(ScriptInstanceId instance) {
+    if (m_tickingInstances) {
+        // Not yet in a storage: cancel the pending create instead
+        auto pending = std::find_if(m_deferredCreates.begin(), m_deferredCreates.end(),
+                                    [instance](const DeferredInstance& d) { return d.id == instance; });
+        if (pending != m_deferredCreates.end()) {
+            m_deferredCreates.erase(pending);
+            return true;
+        }
+        
+        if (!m_instanceStorage.contains(instance) ||
+            std::find(m_deferredDestroys.begin(), m_deferredDestroys.end(), instance) != m_deferredDestroys.end()) {
+            return false;
+        }
+        m_deferredDestroys.push_back(instance);
+        return true;
+    }
+    
+    auto it = m_instanceStorage.find(instance);
+    if (it == m_instanceStorage.end()) {
+        return false;
+    }
+    
+    it->second->destroy(instance);
+    m_instanceStorage.erase(it);
+    m_stats.objectsDestroyed++;
+    return true;
+}
+
+ScriptClassStorage* ScriptEngine::getClassStorage(const std::string& className) {
+    auto it = m_classStorage.find(className);
+    return it != m_classStorage.end() ? it->second.get() : nullptr;
+}
+
+ScriptClassStorage* ScriptEngine::getInstanceStorage(ScriptInstanceId instance) {
+    auto it = m_instanceStorage.find(instance);
+    return it != m_instanceStorage.end() ? it->second : nullptr;
+}
+
+void ScriptEngine::tickInstances(f32 deltaTime) {
+    // Hooks may create or destroy instances; those changes wait until every
+    // storage has been ticked so neither m_classStorage nor a storage's rows
+    // change underneath the loop
+    m_tickingInstances = true;
+    for (auto& [name, storage] : m_classStorage) {
+        const ScriptClass& cls = storage->scriptClass();
+        if (storage->empty() || !cls.batchUpdate) {
+            continue;
+        }
+        
+        cls.batchUpdate(*storage, deltaTime);
+        m_stats.functionsExecuted++;
+    }
+    m_tickingInstances = false;
+    
+    applyDeferredInstances();
+}
+
+void ScriptEngine::applyDeferredInstances() {
+    for (ScriptInstanceId id : m_deferredDestroys) {
+        destroyInstance(id);
+    }
+    m_deferredDestroys.clear();
+    
+    for (const auto& pending : m_deferredCreates) {
+        if (const ScriptClass* cls = getClass(pending.className)) {
+            addInstance(pending.id, *cls, pending.owner);
+        }
+    }
+    m_deferredCreates.clear();
+}
+
 // ============================================================================
 // Function Execution
 // ============================================================================
 
+namespace {
+
+/// Expose a vector-based native through the span-based call table
+NativeCall adaptNativeFunction(NativeFunction func) {
+    return [func = std::move(func)](std::span<const PackedValue> args) {
+        std::vector<ScriptValue> converted;
+        converted.reserve(args.size());
+        for (const auto& arg : args) {
+            converted.push_back(arg.toScriptValue());
+        }
+        return PackedValue::from(func(converted));
+    };
+}
+
+} // anonymous namespace
+
 void ScriptEngine::registerFunction(const std::string& name, NativeFunction func) {
     std::string fullName = m_currentNamespace.empty() ? name : m_currentNamespace + "." + name;
-    m_functions[fullName] = func;
+    m_natives.bind(fullName, adaptNativeFunction(func));
+    m_functions[fullName] = std::move(func);
 }
 
 void ScriptEngine::registerFunction(const FunctionSignature& sig, NativeFunction func) {
     std::string fullName = m_currentNamespace.empty() ? sig.name : m_currentNamespace + "." + sig.name;
-    m_functions[fullName] = func;
+    m_natives.bind(fullName, adaptNativeFunction(func));
+    m_functions[fullName] = std::move(func);
     m_functionSignatures[fullName] = sig;
 }
 
+void ScriptEngine::registerNativeCall(const std::string& name, NativeCall call) {
+    std::string fullName = m_currentNamespace.empty() ? name : m_currentNamespace + "." + name;
+    m_functions.erase(fullName);
+    m_natives.bind(fullName, std::move(call));
+}
+
+FunctionHandle ScriptEngine::getFunctionHandle(const std::string& name) {
+    return m_natives.intern(name);
+}
+
 void ScriptEngine::unregisterFunction(const std::string& name) {
     m_functions.erase(name);
     m_functionSignatures.erase(name);
+    m_natives.unbind(name);
+}
+
+PackedValue ScriptEngine::callFunction(FunctionHandle handle, std::span<const PackedValue> args) {
+    if (!m_natives.isBound(handle)) {
+        ScriptError error;
+        error.level = ScriptErrorLevel::Error;
+        error.message = "Unbound function: " + m_natives.name(handle);
+        reportError(error);
+        return PackedValue();
+    }
+    
+    m_stats.functionsExecuted++;
+    return m_natives.call(handle, args);
 }
 
 ScriptValue ScriptEngine::callFunction(const std::string& name, const std::vector<ScriptValue>& args) {
     auto it = m_functions.find(name);
     if (it == m_functions.end()) {
+        // Fast-path natives are reachable by name too
+        FunctionHandle handle = m_natives.find(name);
+        if (m_natives.isBound(handle)) {
+            std::vector<PackedValue> packed;
+            packed.reserve(args.size());
+            for (const auto& arg : args) {
+                packed.push_back(PackedValue::from(arg));
+            }
+            return callFunction(handle, packed).toScriptValue();
+        }
+        
         ScriptError error;
         error.level = ScriptErrorLevel::Error;
         error.message = "Unknown function: " + name;
@@ -354,7 +538,7 @@ ScriptValue ScriptEngine::callMethod(std::shared_ptr<ScriptObject> obj,
 }
 
 bool ScriptEngine::hasFunction(const std::string& name) const {
-    return m_functions.find(name) != m_functions.end();
+    return m_functions.find(name) != m_functions.end() || m_natives.isBound(m_natives.find(name));
 }
 
 // ============================================================================
@@ -386,7 +570,7 @@ bool ScriptEngine::loadGraph(const std::string& path) {
     // Load graph file
     std::ifstream file(path, std::ios::binary);
     if (!file.is_open()) {
-        m_lastError.code = ScriptErrorCode::FileNotFound;
+        m_lastError.code = "FileNotFound";
         m_lastError.message = "Failed to open graph file: " + path;
         return false;
     }
@@ -397,7 +581,7 @@ bool ScriptEngine::loadGraph(const std::string& path) {
     std::string content = buffer.str();
     
     if (content.empty()) {
-        m_lastError.code = ScriptErrorCode::ParseError;
+        m_lastError.code = "ParseError";
         m_lastError.message = "Empty graph file: " + path;
         return false;
     }
@@ -409,7 +593,7 @@ bool ScriptEngine::loadGraph(const std::string& path) {
     // For now, validate that file contains expected structure markers
     if (content.find("nodes") == std::string::npos ||
         content.find("connections") == std::string::npos) {
-        m_lastError.code = ScriptErrorCode::ParseError;
+        m_lastError.code = "ParseError";
         m_lastError.message = "Invalid graph format: " + path;
         return false;
     }
@@ -420,7 +604,7 @@ bool ScriptEngine::loadGraph(const std::string& path) {
 bool ScriptEngine::saveGraph(const std::string& path, const ScriptGraph& graph) {
     std::ofstream file(path, std::ios::binary);
     if (!file.is_open()) {
-        m_lastError.code = ScriptErrorCode::RuntimeError;
+        m_lastError.code = "RuntimeError";
         m_lastError.message = "Failed to create graph file: " + path;
         return false;
     }
@@ -465,162 +649,107 @@ bool ScriptEngine::saveGraph(const std::string& path, const ScriptGraph& graph)
 }
 
 ScriptValue ScriptEngine::executeGraph(const ScriptGraph& graph, const std::vector<ScriptValue>& args) {
-    // Find entry node
-    const ScriptNode* entryNode = graph.findNode(graph.entryNodeId);
-    if (!entryNode) {
-        m_lastError.code = ScriptErrorCode::RuntimeError;
-        m_lastError.message = "Graph has no entry node";
+    auto compiled = compileGraph(graph);
+    if (!compiled) {
+        ScriptError error;
+        error.message = compiled.error().message();
+        error.location.function = graph.name;
+        reportError(error);
         return ScriptValue();
     }
     
-    // Create execution context
-    std::unordered_map<u64, ScriptValue> nodeOutputs;
-    std::vector<u64> executionStack;
-    executionStack.push_back(graph.entryNodeId);
+    std::vector<PackedValue> packed;
+    packed.reserve(args.size());
+    for (const auto& arg : args) {
+        packed.push_back(PackedValue::from(arg));
+    }
+    return executeGraph(*compiled, packed).toScriptValue();
+}
+
+PackedValue ScriptEngine::executeGraph(const CompiledGraph& graph, std::span<const PackedValue> args) {
+    u64 before = m_graphVM.getInstructionsExecuted();
+    auto result = m_graphVM.execute(graph, args);
     
-    // Execute nodes in topological order
-    while (!executionStack.empty()) {
-        u64 currentNodeId = executionStack.back();
-        executionStack.pop_back();
-        
-        const ScriptNode* currentNode = graph.findNode(currentNodeId);
-        if (!currentNode) continue;
-        
-        // Execute node based on type
-        ScriptValue result;
-        switch (currentNode->type) {
-            case NodeType::Entry:
-                // Entry node just passes through to connected nodes
-                break;
-                
-            case NodeType::Return:
-                // Return node - get input value and return it
-                if (!currentNode->inputs.empty()) {
-                    // Find connection to this input
-                    for (const auto& conn : graph.connections) {
-                        if (conn.toNode == currentNodeId && conn.toPin == 0) {
-                            auto it = nodeOutputs.find(conn.fromNode);
-                            if (it != nodeOutputs.end()) {
-                                return it->second;
-                            }
-                        }
-                    }
-                }
-                return result;
-                
-            case NodeType::Constant:
-                // Store constant value
-                nodeOutputs[currentNodeId] = currentNode->data;
-                break;
-                
-            case NodeType::MathOp:
-                // Execute math operation on inputs
-                {
-                    ScriptValue a, b;
-                    // Get input values from connected nodes
-                    for (const auto& conn : graph.connections) {
-                        if (conn.toNode == currentNodeId) {
-                            auto it = nodeOutputs.find(conn.fromNode);
-                            if (it != nodeOutputs.end()) {
-                                if (conn.toPin == 0) a = it->second;
-                                else if (conn.toPin == 1) b = it->second;
-                            }
-                        }
-                    }
-                    // Perform operation based on node name
-                    if (currentNode->name == "Add") {
-                        result = ScriptValue(a.toFloat() + b.toFloat());
-                    } else if (currentNode->name == "Subtract") {
-                        result = ScriptValue(a.toFloat() - b.toFloat());
-                    } else if (currentNode->name == "Multiply") {
-                        result = ScriptValue(a.toFloat() * b.toFloat());
-                    } else if (currentNode->name == "Divide") {
-                        f64 divisor = b.toFloat();
-                        result = ScriptValue(divisor != 0.0 ? a.toFloat() / divisor : 0.0);
-                    }
-                    nodeOutputs[currentNodeId] = result;
-                }
-                break;
-                
-            default:
-                // Other node types - store empty result
-                nodeOutputs[currentNodeId] = ScriptValue();
-                break;
-        }
-        
-        // Find and queue connected output nodes (for exec flow)
-        for (const auto& conn : graph.connections) {
-            if (conn.fromNode == currentNodeId) {
-                // Check if this is an exec connection
-                if (!currentNode->outputs.empty() && 
-                    currentNode->outputs[conn.fromPin].type == PinType::Exec) {
-                    executionStack.push_back(conn.toNode);
-                }
-            }
-        }
+    m_stats.functionsExecuted++;
+    m_stats.instructionsExecuted += m_graphVM.getInstructionsExecuted() - before;
+    
+    if (!result) {
+        ScriptError error;
+        error.message = result.error().message();
+        error.location.function = graph.name;
+        reportError(error);
+        return PackedValue();
     }
     
-    return ScriptValue();
+    return *result;
+}
+
+Result<CompiledGraph> ScriptEngine::compileGraph(const ScriptGraph& graph) const {
+    return GraphCompiler::compile(graph, m_natives);
 }
 
 bool ScriptEngine::compileGraph(const ScriptGraph& graph, const std::string& outputPath) {
-    // Validate graph
-    if (graph.nodes.empty()) {
-        m_lastError.code = ScriptErrorCode::CompileError;
-        m_lastError.message = "Cannot compile empty graph";
-        return false;
-    }
-    
-    // Find entry node
-    const ScriptNode* entryNode = graph.findNode(graph.entryNodeId);
-    if (!entryNode) {
-        m_lastError.code = ScriptErrorCode::CompileError;
-        m_lastError.message = "Graph has no entry node";
+    auto compiled = compileGraph(graph);
+    if (!compiled) {
+        ScriptError error;
+        error.message = compiled.error().message();
+        error.location.file = outputPath;
+        reportError(error);
         return false;
     }
     
     // Open output file
     std::ofstream file(outputPath, std::ios::binary);
     if (!file.is_open()) {
-        m_lastError.code = ScriptErrorCode::RuntimeError;
-        m_lastError.message = "Failed to create output file: " + outputPath;
+        ScriptError error;
+        error.message = "Failed to create output file: " + outputPath;
+        reportError(error);
         return false;
     }
     
+    auto writePod = [&file](const auto& value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto writeString = [&](const std::string& str) {
+        writePod(static_cast<u32>(str.size()));
+        file.write(str.data(), static_cast<std::streamsize>(str.size()));
+    };
+    
     // Write bytecode header
     const char magic[] = "NVGR"; // Nova Graph bytecode
     file.write(magic, 4);
     
-    u32 version = 1;
-    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
-    
-    u32 nodeCount = static_cast<u32>(graph.nodes.size());
-    file.write(reinterpret_cast<const char*>(&nodeCount), sizeof(nodeCount));
-    
-    u32 connCount = static_cast<u32>(graph.connections.size());
-    file.write(reinterpret_cast<const char*>(&connCount), sizeof(connCount));
-    
-    // Write entry node ID
-    file.write(reinterpret_cast<const char*>(&graph.entryNodeId), sizeof(graph.entryNodeId));
-    
-    // Write nodes
-    for (const auto& node : graph.nodes) {
-        file.write(reinterpret_cast<const char*>(&node.id), sizeof(node.id));
-        u8 nodeType = static_cast<u8>(node.type);
-        file.write(reinterpret_cast<const char*>(&nodeType), sizeof(nodeType));
-        
-        // Write name length and name
-        u16 nameLen = static_cast<u16>(node.name.size());
-        file.write(reinterpret_cast<const char*>(&nameLen), sizeof(nameLen));
-        file.write(node.name.c_str(), nameLen);
-    }
-    
-    // Write connections
-    for (const auto& conn : graph.connections) {
-        file.write(reinterpret_cast<const char*>(&conn.fromNode), sizeof(conn.fromNode));
-        file.write(reinterpret_cast<const char*>(&conn.fromPin), sizeof(conn.fromPin));
-        file.write(reinterpret_cast<const char*>(&conn.toNode), sizeof(conn.toNode));
-        file.write(reinterpret_cast<const char*>(&conn.toPin), sizeof(conn.toPin));
+    u32 version = 2;
+    writePod(version);
+    writePod(compiled->registerCount);
+    writePod(compiled->argumentBase);
+    writePod(compiled->argumentCount);
+    
+    // Code
+    writePod(static_cast<u32>(compiled->code.size()));
+    file.write(reinterpret_cast<const char*>(compiled->code.data()),
+               static_cast<std::streamsize>(compiled->code.size() * sizeof(Instruction)));
+    
+    // Call targets, re-resolved by name on load
+    writePod(static_cast<u32>(compiled->calls.size()));
+    for (FunctionHandle handle : compiled->calls) {
+        writeString(m_natives.name(handle));
+    }
+    
+    // Initial register values
+    for (const auto& value : compiled->initialRegisters) {
+        writePod(static_cast<u8>(value.type()));
+        switch (value.type()) {
+            case ScriptType::Bool:   writePod(static_cast<u8>(value.asBool())); break;
+            case ScriptType::Int:    writePod(value.asInt()); break;
+            case ScriptType::Float:  writePod(value.asFloat()); break;
+            case ScriptType::String: writeString(std::string(value.asString())); break;
+            case ScriptType::Vec2:   writePod(value.asVec2()); break;
+            case ScriptType::Vec3:   writePod(value.asVec3()); break;
+            case ScriptType::Vec4:   writePod(value.asVec4()); break;
+            case ScriptType::Quat:   writePod(value.asQuat()); break;
+            default: break;  // Runtime-only values start out void
+        }
     }
     
     return file.good();
@@ -697,16 +826,17 @@ void ScriptEngine::setHotReloadEnabled(bool enabled) {
 }
 
 void ScriptEngine::addWatchDirectory(const std::string& path) {
-    if (std::find(m_watchDirectories.begin(), m_watchDirectories.end(), path) == m_watchDirectories.end()) {
-        m_watchDirectories.push_back(path);
+    if (!m_watchDirectories.contains(path)) {
+        m_watchDirectories.emplace(path, platform::FileWatcher::get().watch(path, false));
     }
 }
 
 void ScriptEngine::removeWatchDirectory(const std::string& path) {
-    m_watchDirectories.erase(
-        std::remove(m_watchDirectories.begin(), m_watchDirectories.end(), path),
-        m_watchDirectories.end()
-    );
+    auto it = m_watchDirectories.find(path);
+    if (it != m_watchDirectories.end()) {
+        platform::FileWatcher::get().unwatch(it->second);
+        m_watchDirectories.erase(it);
+    }
 }
 
 void ScriptEngine::reloadAll() {
@@ -726,26 +856,25 @@ void ScriptEngine::setReloadCallback(ReloadCallback callback) {
 }
 
 void ScriptEngine::checkFileChanges() {
-    for (const auto& dir : m_watchDirectories) {
-        if (!fs::exists(dir)) continue;
-        
-        for (const auto& entry : fs::directory_iterator(dir)) {
-            if (!entry.is_regular_file()) continue;
-            
-            std::string ext = entry.path().extension().string();
+    auto& watcher = platform::FileWatcher::get();
+    for (const auto& [dir, watch] : m_watchDirectories) {
+        for (const auto& event : watcher.poll(watch)) {
+            fs::path path(event.path);
+            std::string ext = path.extension().string();
             if (ext != ".nova" && ext != ".ns") continue;
             
-            std::string moduleName = entry.path().stem().string();
-            auto it = m_modules.find(moduleName);
-            if (it == m_modules.end()) continue;
+            std::string moduleName = path.stem().string();
+            if (!m_modules.contains(moduleName)) continue;
             
-            // Check modification time
-            auto modTime = fs::last_write_time(entry).time_since_epoch().count();
-            if (static_cast<u64>(modTime) > it->second.lastModified) {
+            // A deleted file keeps its module loaded
+            ReloadEvent reloadEvent = ReloadEvent::FileChanged;
+            if (event.change == platform::FileChange::Removed) {
+                reloadEvent = ReloadEvent::FileDeleted;
+            } else {
                 m_modulesToReload.insert(moduleName);
-                if (m_reloadCallback) {
-                    m_reloadCallback(entry.path().string(), ReloadEvent::FileChanged);
-                }
+            }
+            if (m_reloadCallback) {
+                m_reloadCallback(event.path, reloadEvent);
             }
         }
     }
@@ -769,9 +898,6 @@ void ScriptEngine::processReloadQueue() {
 
 void ScriptEngine::setDebuggerEnabled(bool enabled) {
     m_debuggerEnabled = enabled;
-    if (enabled && !m_debugger) {
-        m_debugger = std::make_unique<ScriptDebugger>();
-    }
 }
 
 void ScriptEngine::setBreakpoint(const std::string& file, u32 line) {
@@ -798,21 +924,21 @@ void ScriptEngine::clearBreakpoints() {
 }
 
 void ScriptEngine::stepOver() {
-    if (m_debugger && m_isPaused) {
+    if (m_debuggerEnabled && m_isPaused) {
         m_stepMode = StepMode::Over;
         m_isPaused = false;
     }
 }
 
 void ScriptEngine::stepInto() {
-    if (m_debugger && m_isPaused) {
+    if (m_debuggerEnabled && m_isPaused) {
         m_stepMode = StepMode::Into;
         m_isPaused = false;
     }
 }
 
 void ScriptEngine::stepOut() {
-    if (m_debugger && m_isPaused) {
+    if (m_debuggerEnabled && m_isPaused) {
         m_stepMode = StepMode::Out;
         m_targetStackDepth = m_callStack.size() > 0 ? m_callStack.size() - 1 : 0;
         m_isPaused = false;
@@ -905,7 +1031,7 @@ ScriptValue ScriptEngine::evaluate(const std::string& expression) {
     }
     
     // Unknown expression
-    m_lastError.code = ScriptErrorCode::RuntimeError;
+    m_lastError.code = "RuntimeError";
     m_lastError.message = "Unknown identifier: " + expression;
     return ScriptValue();
 }
@@ -1215,6 +1341,48 @@ void ScriptEngine::registerBuiltinConsoleFunctions() {
     });
 }
 
+void ScriptEngine::registerBuiltinVectorFunctions() {
+    // Hot math goes through the span-based path so calls never allocate
+    beginNamespace("Vector3");
+    
+    registerNativeCall("add", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.size() < 2) return PackedValue(Vec3::zero());
+        return PackedValue(args[0].asVec3() + args[1].asVec3());
+    });
+    
+    registerNativeCall("sub", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.size() < 2) return PackedValue(Vec3::zero());
+        return PackedValue(args[0].asVec3() - args[1].asVec3());
+    });
+    
+    registerNativeCall("scale", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.size() < 2) return PackedValue(Vec3::zero());
+        return PackedValue(args[0].asVec3() * static_cast<f32>(args[1].asFloat()));
+    });
+    
+    registerNativeCall("dot", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.size() < 2) return PackedValue(0.0);
+        return PackedValue(args[0].asVec3().dot(args[1].asVec3()));
+    });
+    
+    registerNativeCall("cross", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.size() < 2) return PackedValue(Vec3::zero());
+        return PackedValue(args[0].asVec3().cross(args[1].asVec3()));
+    });
+    
+    registerNativeCall("length", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.empty()) return PackedValue(0.0);
+        return PackedValue(args[0].asVec3().length());
+    });
+    
+    registerNativeCall("normalize", [](std::span<const PackedValue> args) -> PackedValue {
+        if (args.empty()) return PackedValue(Vec3::zero());
+        return PackedValue(args[0].asVec3().normalized());
+    });
+    
+    endNamespace();
+}
+
 // ============================================================================
 // ScriptValue Operators
 // ============================================================================
@@ -0,0 +1,149 @@
+/**
+ * @file script_value.cpp
+ * @brief NovaCore Script System™ - Packed Values and Interned Native Calls
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include <nova/core/script/script_value.hpp>
+
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+
+namespace nova::script {
+
+// ============================================================================
+// String Interning
+// ============================================================================
+
+namespace {
+
+struct StringTable {
+    std::shared_mutex mutex;
+    std::deque<std::string> strings{std::string()};   // Deque keeps views stable
+    std::unordered_map<std::string_view, StringId> ids{{std::string_view(), 0}};
+};
+
+StringTable& stringTable() {
+    static StringTable table;
+    return table;
+}
+
+} // anonymous namespace
+
+StringId internString(std::string_view text) {
+    StringTable& table = stringTable();
+    {
+        std::shared_lock lock(table.mutex);
+        if (auto it = table.ids.find(text); it != table.ids.end()) {
+            return it->second;
+        }
+    }
+
+    std::unique_lock lock(table.mutex);
+    if (auto it = table.ids.find(text); it != table.ids.end()) {
+        return it->second;
+    }
+    auto id = static_cast<StringId>(table.strings.size());
+    const std::string& stored = table.strings.emplace_back(text);
+    table.ids.emplace(stored, id);
+    return id;
+}
+
+std::string_view internedString(StringId id) {
+    StringTable& table = stringTable();
+    std::shared_lock lock(table.mutex);
+    return id < table.strings.size() ? std::string_view(table.strings[id]) : std::string_view();
+}
+
+// ============================================================================
+// PackedValue
+// ============================================================================
+
+PackedValue PackedValue::from(const ScriptValue& value) {
+    switch (value.type) {
+        case ScriptType::Bool:   return PackedValue(value.asBool());
+        case ScriptType::Int:    return PackedValue(value.asInt());
+        case ScriptType::Float:  return PackedValue(value.asFloat());
+        case ScriptType::String: return string(internString(value.asString()));
+        case ScriptType::Vec2:   return PackedValue(value.asVec2());
+        case ScriptType::Vec3:   return PackedValue(value.asVec3());
+        case ScriptType::Vec4:   return PackedValue(value.asVec4());
+        case ScriptType::Color:  return color(value.asVec4());
+        case ScriptType::Quat:   return PackedValue(value.asQuat());
+        case ScriptType::Entity: return PackedValue(value.asEntity());
+        default:                 return PackedValue();
+    }
+}
+
+ScriptValue PackedValue::toScriptValue() const {
+    switch (m_type) {
+        case ScriptType::Bool:   return ScriptValue(m_payload.b);
+        case ScriptType::Int:    return ScriptValue(m_payload.i);
+        case ScriptType::Float:  return ScriptValue(m_payload.f);
+        case ScriptType::String: return ScriptValue(std::string(asString()));
+        case ScriptType::Vec2:   return ScriptValue(asVec2());
+        case ScriptType::Vec3:   return ScriptValue(asVec3());
+        case ScriptType::Vec4:   return ScriptValue(asVec4());
+        case ScriptType::Color: {
+            ScriptValue value(asVec4());
+            value.type = ScriptType::Color;
+            return value;
+        }
+        case ScriptType::Quat:   return ScriptValue(asQuat());
+        case ScriptType::Entity: return ScriptValue(asEntity());
+        default:                 return ScriptValue();
+    }
+}
+
+bool PackedValue::operator==(const PackedValue& other) const noexcept {
+    return m_type == other.m_type && std::memcmp(&m_payload, &other.m_payload, sizeof(Payload)) == 0;
+}
+
+// ============================================================================
+// NativeRegistry
+// ============================================================================
+
+FunctionHandle NativeRegistry::intern(const std::string& name) {
+    if (auto it = m_indices.find(name); it != m_indices.end()) {
+        return {it->second};
+    }
+    auto index = static_cast<u32>(m_calls.size());
+    m_calls.emplace_back();
+    m_names.push_back(name);
+    m_indices.emplace(name, index);
+    return {index};
+}
+
+FunctionHandle NativeRegistry::find(const std::string& name) const {
+    auto it = m_indices.find(name);
+    return it != m_indices.end() ? FunctionHandle{it->second} : FunctionHandle{};
+}
+
+FunctionHandle NativeRegistry::bind(const std::string& name, NativeCall call) {
+    FunctionHandle handle = intern(name);
+    m_calls[handle.index] = std::move(call);
+    return handle;
+}
+
+void NativeRegistry::unbind(const std::string& name) {
+    if (auto it = m_indices.find(name); it != m_indices.end()) {
+        m_calls[it->second] = nullptr;
+    }
+}
+
+const std::string& NativeRegistry::name(FunctionHandle handle) const {
+    static const std::string empty;
+    return handle.index < m_names.size() ? m_names[handle.index] : empty;
+}
+
+void NativeRegistry::clear() {
+    m_calls.clear();
+    m_names.clear();
+    m_indices.clear();
+}
+
+} // namespace nova::script
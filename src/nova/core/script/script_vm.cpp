@@ -0,0 +1,540 @@
+/**
+ * @file script_vm.cpp
+ * @brief NovaCore Script System™ - Graph Bytecode Compiler and Register VM
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ */
+
+#include <nova/core/script/script_vm.hpp>
+
+#include <limits>
+#include <unordered_set>
+
+namespace nova::script {
+
+namespace {
+
+constexpr usize MAX_REGISTERS = std::numeric_limits<u16>::max();
+constexpr usize MAX_CODE_SIZE = std::numeric_limits<u16>::max();
+
+constexpr u64 pinKey(u32 node, u32 pin) {
+    return (static_cast<u64>(node) << 32) | pin;
+}
+
+bool isNumeric(ScriptType type) {
+    return type == ScriptType::Int || type == ScriptType::Float;
+}
+
+// Script integers wrap on overflow instead of invoking undefined behavior
+i64 wrapAdd(i64 a, i64 b) { return static_cast<i64>(static_cast<u64>(a) + static_cast<u64>(b)); }
+i64 wrapSub(i64 a, i64 b) { return static_cast<i64>(static_cast<u64>(a) - static_cast<u64>(b)); }
+i64 wrapMul(i64 a, i64 b) { return static_cast<i64>(static_cast<u64>(a) * static_cast<u64>(b)); }
+
+/// Division by zero yields 0; INT64_MIN / -1 wraps to INT64_MIN
+i64 wrapDiv(i64 a, i64 b) {
+    if (b == 0) return 0;
+    if (b == -1) return wrapSub(0, a);
+    return a / b;
+}
+
+/**
+ * @brief Single-use compilation state for one graph
+ */
+class GraphBuilder {
+public:
+    GraphBuilder(const ScriptGraph& graph, const NativeRegistry& natives)
+        : m_graph(graph), m_natives(natives)
+    {
+        m_out.name = graph.name;
+    }
+
+    Result<CompiledGraph> build() {
+        for (const auto& node : m_graph.nodes) {
+            m_nodes[node.id] = &node;
+        }
+
+        for (const auto& conn : m_graph.connections) {
+            const ScriptNode* from = findNode(conn.fromNode);
+            if (!from || conn.fromPin >= from->outputs.size()) {
+                return std::unexpected(errors::script("Connection from unknown pin"));
+            }
+            if (from->outputs[conn.fromPin].pinType == PinType::Exec) {
+                m_execTargets.emplace(pinKey(conn.fromNode, conn.fromPin), conn.toNode);
+            } else {
+                m_dataSources[pinKey(conn.toNode, conn.toPin)] = {conn.fromNode, conn.fromPin};
+            }
+        }
+
+        const ScriptNode* entry = findNode(m_graph.entryNodeId);
+        if (!entry || entry->type != NodeType::Entry) {
+            return std::unexpected(errors::script("Graph has no entry node"));
+        }
+
+        // Arguments take the first registers so callers can copy them in directly
+        m_out.argumentBase = 0;
+        for (u32 pin = 0; pin < entry->outputs.size(); ++pin) {
+            if (entry->outputs[pin].pinType != PinType::Data) {
+                continue;
+            }
+            auto reg = newRegister(entry->outputs[pin].dataType);
+            if (!reg) return std::unexpected(reg.error());
+            m_slots[pinKey(entry->id, pin)] = *reg;
+            m_out.argumentCount++;
+        }
+
+        if (auto result = emitChain(entry->id); !result) {
+            return std::unexpected(result.error());
+        }
+        emit({OpCode::ReturnVoid});
+
+        if (m_out.code.size() > MAX_CODE_SIZE) {
+            return std::unexpected(errors::script("Graph compiles to too many instructions"));
+        }
+
+        m_out.natives = &m_natives;
+        m_out.registerCount = static_cast<u16>(m_out.initialRegisters.size());
+        return std::move(m_out);
+    }
+
+private:
+    struct Source {
+        u32 node = 0;
+        u32 pin = 0;
+    };
+
+    const ScriptGraph& m_graph;
+    const NativeRegistry& m_natives;
+    CompiledGraph m_out;
+    std::vector<ScriptType> m_types;
+
+    std::unordered_map<u32, const ScriptNode*> m_nodes;
+    std::unordered_map<u64, u32> m_execTargets;         // (node, exec out) -> node
+    std::unordered_map<u64, Source> m_dataSources;      // (node, data in) -> output pin
+    std::unordered_map<u64, u16> m_slots;               // (node, data out) -> register
+    std::unordered_map<std::string, u16> m_variables;
+    std::unordered_map<u32, u16> m_callIndices;         // handle -> calls[] index
+    std::unordered_set<u32> m_execPath;                 // Exec cycle detection
+    std::unordered_set<u32> m_evaluating;               // Data cycle detection
+
+    const ScriptNode* findNode(u32 id) const {
+        auto it = m_nodes.find(id);
+        return it != m_nodes.end() ? it->second : nullptr;
+    }
+
+    u32 execTarget(u32 node, u32 pin) const {
+        auto it = m_execTargets.find(pinKey(node, pin));
+        return it != m_execTargets.end() ? it->second : 0;
+    }
+
+    u16 here() const { return static_cast<u16>(m_out.code.size()); }
+
+    usize emit(const Instruction& instr) {
+        m_out.code.push_back(instr);
+        return m_out.code.size() - 1;
+    }
+
+    Result<u16> newRegister(ScriptType type, PackedValue initial = PackedValue()) {
+        if (m_out.initialRegisters.size() >= MAX_REGISTERS) {
+            return std::unexpected(errors::script("Graph needs too many registers"));
+        }
+        m_out.initialRegisters.push_back(initial);
+        m_types.push_back(type);
+        return static_cast<u16>(m_out.initialRegisters.size() - 1);
+    }
+
+    Result<u16> constant(const ScriptValue& value) {
+        return newRegister(value.type, PackedValue::from(value));
+    }
+
+    /// Register holding a graph variable
+    Result<u16> variable(const std::string& name) {
+        if (auto it = m_variables.find(name); it != m_variables.end()) {
+            return it->second;
+        }
+        for (const auto& var : m_graph.variables) {
+            if (var.name == name) {
+                auto reg = newRegister(var.type, PackedValue::from(var.defaultValue));
+                if (reg) m_variables[name] = *reg;
+                return reg;
+            }
+        }
+        return std::unexpected(errors::script("Unknown graph variable: " + name));
+    }
+
+    /// Register assigned to a node output written by an exec node
+    Result<u16> slot(const ScriptNode& node, u32 pin, ScriptType type) {
+        if (auto it = m_slots.find(pinKey(node.id, pin)); it != m_slots.end()) {
+            return it->second;
+        }
+        auto reg = newRegister(type);
+        if (reg) m_slots[pinKey(node.id, pin)] = *reg;
+        return reg;
+    }
+
+    Result<u16> input(const ScriptNode& node, u32 pin) {
+        auto it = m_dataSources.find(pinKey(node.id, pin));
+        if (it != m_dataSources.end()) {
+            return evaluate(it->second.node, it->second.pin);
+        }
+        if (pin >= node.inputs.size()) {
+            return std::unexpected(errors::script("Node '" + node.name + "' is missing an input pin"));
+        }
+        return constant(node.inputs[pin].defaultValue);
+    }
+
+    /// Emit code computing a data output and return its register
+    Result<u16> evaluate(u32 nodeId, u32 pin) {
+        const ScriptNode* node = findNode(nodeId);
+        if (!node || pin >= node->outputs.size()) {
+            return std::unexpected(errors::script("Data connection from unknown node"));
+        }
+
+        switch (node->type) {
+            case NodeType::Constant: {
+                if (auto it = m_slots.find(pinKey(nodeId, pin)); it != m_slots.end()) {
+                    return it->second;
+                }
+                auto reg = constant(node->outputs[pin].defaultValue);
+                if (reg) m_slots[pinKey(nodeId, pin)] = *reg;
+                return reg;
+            }
+            case NodeType::Variable:
+                return variable(node->name);
+            case NodeType::Entry:
+            case NodeType::ForLoop:
+            case NodeType::FunctionCall:
+                return slot(*node, pin, node->outputs[pin].dataType);
+            case NodeType::MathOp:
+            case NodeType::Compare:
+            case NodeType::Logic:
+                break;
+            default:
+                return std::unexpected(errors::script("Node '" + node->name + "' has no compilable data output"));
+        }
+
+        if (!m_evaluating.insert(nodeId).second) {
+            return std::unexpected(errors::script("Data cycle through node '" + node->name + "'"));
+        }
+        auto result = emitPure(*node);
+        m_evaluating.erase(nodeId);
+        return result;
+    }
+
+    Result<u16> emitPure(const ScriptNode& node) {
+        auto lhs = input(node, 0);
+        if (!lhs) return lhs;
+
+        const bool unary = node.type == NodeType::Logic && node.name == "Not";
+        Result<u16> rhs = unary ? *lhs : input(node, 1);
+        if (!rhs) return rhs;
+
+        const ScriptType tb = m_types[*lhs];
+        const ScriptType tc = m_types[*rhs];
+        const bool ints = tb == ScriptType::Int && tc == ScriptType::Int;
+
+        OpCode op;
+        ScriptType resultType = ScriptType::Bool;
+        const std::string& name = node.name;
+
+        if (node.type == NodeType::MathOp) {
+            resultType = ints ? ScriptType::Int : ScriptType::Float;
+            if (name == "Add")           op = ints ? OpCode::AddI : OpCode::AddF;
+            else if (name == "Subtract") op = ints ? OpCode::SubI : OpCode::SubF;
+            else if (name == "Multiply") op = ints ? OpCode::MulI : OpCode::MulF;
+            else if (name == "Divide")   op = ints ? OpCode::DivI : OpCode::DivF;
+            else return std::unexpected(errors::script("Unknown math op: " + name));
+        } else if (node.type == NodeType::Compare) {
+            const bool numbers = isNumeric(tb) && isNumeric(tc);
+            if (name == "Less")              op = ints ? OpCode::LtI : OpCode::LtF;
+            else if (name == "LessEqual")    op = ints ? OpCode::LeI : OpCode::LeF;
+            else if (name == "Greater")      op = ints ? OpCode::GtI : OpCode::GtF;
+            else if (name == "GreaterEqual") op = ints ? OpCode::GeI : OpCode::GeF;
+            else if (name == "Equal")        op = ints ? OpCode::EqI : (numbers ? OpCode::EqF : OpCode::Eq);
+            else if (name == "NotEqual")     op = ints ? OpCode::NeI : (numbers ? OpCode::NeF : OpCode::Ne);
+            else return std::unexpected(errors::script("Unknown comparison: " + name));
+        } else {
+            if (name == "And")      op = OpCode::And;
+            else if (name == "Or")  op = OpCode::Or;
+            else if (name == "Not") op = OpCode::Not;
+            else return std::unexpected(errors::script("Unknown logic op: " + name));
+        }
+
+        // One destination per node; it is recomputed at every use
+        auto dst = slot(node, 0, resultType);
+        if (!dst) return dst;
+        emit({op, 0, *dst, *lhs, *rhs});
+        return dst;
+    }
+
+    Result<void> emitChain(u32 id) {
+        std::vector<u32> visited;
+        Result<void> result;
+
+        while (id != 0 && result) {
+            const ScriptNode* node = findNode(id);
+            if (!node) {
+                result = std::unexpected(errors::script("Exec connection to unknown node"));
+                break;
+            }
+            if (!m_execPath.insert(id).second) {
+                result = std::unexpected(errors::script("Exec cycle through node '" + node->name +
+                                                        "'; use a ForLoop node to repeat"));
+                break;
+            }
+            visited.push_back(id);
+
+            auto next = emitNode(*node);
+            if (!next) {
+                result = std::unexpected(next.error());
+                break;
+            }
+            id = *next;
+        }
+
+        for (u32 nodeId : visited) {
+            m_execPath.erase(nodeId);
+        }
+        return result;
+    }
+
+    /// Emit one exec node; returns the node that continues the chain (0 = none)
+    Result<u32> emitNode(const ScriptNode& node) {
+        switch (node.type) {
+            case NodeType::Entry:
+                return execTarget(node.id, 0);
+
+            case NodeType::Return: {
+                if (node.inputs.size() < 2) {
+                    emit({OpCode::ReturnVoid});
+                    return 0u;
+                }
+                auto value = input(node, 1);
+                if (!value) return std::unexpected(value.error());
+                emit({OpCode::Return, 0, *value});
+                return 0u;
+            }
+
+            case NodeType::Branch: {
+                auto cond = input(node, 1);
+                if (!cond) return std::unexpected(cond.error());
+                usize jumpFalse = emit({OpCode::JumpIfFalse, 0, 0, *cond});
+                if (auto r = emitChain(execTarget(node.id, 0)); !r) return std::unexpected(r.error());
+                usize jumpEnd = emit({OpCode::Jump});
+                m_out.code[jumpFalse].a = here();
+                if (auto r = emitChain(execTarget(node.id, 1)); !r) return std::unexpected(r.error());
+                m_out.code[jumpEnd].a = here();
+                return 0u;
+            }
+
+            case NodeType::Sequence:
+                for (u32 pin = 0; pin < node.outputs.size(); ++pin) {
+                    if (auto r = emitChain(execTarget(node.id, pin)); !r) return std::unexpected(r.error());
+                }
+                return 0u;
+
+            case NodeType::ForLoop: {
+                auto first = input(node, 1);
+                if (!first) return std::unexpected(first.error());
+                auto lastValue = input(node, 2);
+                if (!lastValue) return std::unexpected(lastValue.error());
+                auto index = slot(node, 1, ScriptType::Int);
+                if (!index) return std::unexpected(index.error());
+                auto last = newRegister(ScriptType::Int);
+                auto one = newRegister(ScriptType::Int, PackedValue(static_cast<i64>(1)));
+                auto cond = newRegister(ScriptType::Bool);
+                if (!last || !one || !cond) {
+                    return std::unexpected(errors::script("Graph needs too many registers"));
+                }
+
+                // The bound is latched so body code cannot change the trip count
+                emit({OpCode::Move, 0, *index, *first});
+                emit({OpCode::Move, 0, *last, *lastValue});
+                u16 loopStart = here();
+                emit({OpCode::LeI, 0, *cond, *index, *last});
+                usize exitJump = emit({OpCode::JumpIfFalse, 0, 0, *cond});
+                if (auto r = emitChain(execTarget(node.id, 0)); !r) return std::unexpected(r.error());
+                emit({OpCode::AddI, 0, *index, *index, *one});
+                emit({OpCode::Jump, 0, loopStart});
+                m_out.code[exitJump].a = here();
+                return execTarget(node.id, 2);
+            }
+
+            case NodeType::Variable: {
+                // Setter form: exec in, value in
+                if (node.inputs.size() < 2 || node.inputs[0].pinType != PinType::Exec) {
+                    return std::unexpected(errors::script("Variable getter '" + node.name + "' used as exec node"));
+                }
+                auto var = variable(node.name);
+                if (!var) return std::unexpected(var.error());
+                auto value = input(node, 1);
+                if (!value) return std::unexpected(value.error());
+                emit({OpCode::Move, 0, *var, *value});
+                return execTarget(node.id, 0);
+            }
+
+            case NodeType::FunctionCall:
+                return emitCall(node);
+
+            default:
+                return std::unexpected(errors::script("Node '" + node.name + "' is not supported by the graph compiler"));
+        }
+    }
+
+    Result<u32> emitCall(const ScriptNode& node) {
+        FunctionHandle handle = m_natives.find(node.name);
+        if (!m_natives.isBound(handle)) {
+            return std::unexpected(errors::script("Unknown function: " + node.name));
+        }
+
+        u16 callIndex;
+        if (auto it = m_callIndices.find(handle.index); it != m_callIndices.end()) {
+            callIndex = it->second;
+        } else {
+            callIndex = static_cast<u16>(m_out.calls.size());
+            m_out.calls.push_back(handle);
+            m_callIndices[handle.index] = callIndex;
+        }
+
+        // Gather argument values, then copy them into a contiguous block
+        std::vector<u16> argRegs;
+        for (u32 pin = 0; pin < node.inputs.size(); ++pin) {
+            if (node.inputs[pin].pinType != PinType::Data) {
+                continue;
+            }
+            auto value = input(node, pin);
+            if (!value) return std::unexpected(value.error());
+            argRegs.push_back(*value);
+        }
+        if (argRegs.size() > ScriptConfig::MAX_FUNCTION_PARAMS) {
+            return std::unexpected(errors::script("Too many arguments for " + node.name));
+        }
+
+        u16 argBase = static_cast<u16>(m_out.initialRegisters.size());
+        for (usize i = 0; i < argRegs.size(); ++i) {
+            auto reg = newRegister(m_types[argRegs[i]]);
+            if (!reg) return std::unexpected(reg.error());
+            emit({OpCode::Move, 0, *reg, argRegs[i]});
+        }
+
+        u32 returnPin = 0;
+        for (u32 pin = 0; pin < node.outputs.size(); ++pin) {
+            if (node.outputs[pin].pinType == PinType::Data) {
+                returnPin = pin;
+                break;
+            }
+        }
+        ScriptType returnType = returnPin < node.outputs.size() ? node.outputs[returnPin].dataType : ScriptType::Any;
+        auto dst = slot(node, returnPin, returnType);
+        if (!dst) return std::unexpected(dst.error());
+
+        emit({OpCode::CallNative, static_cast<u8>(argRegs.size()), *dst, callIndex, argBase});
+        return execTarget(node.id, 0);
+    }
+};
+
+} // anonymous namespace
+
+// ============================================================================
+// GraphCompiler
+// ============================================================================
+
+Result<CompiledGraph> GraphCompiler::compile(const ScriptGraph& graph, const NativeRegistry& natives) {
+    GraphBuilder builder(graph, natives);
+    return builder.build();
+}
+
+// ============================================================================
+// ScriptVM
+// ============================================================================
+
+Result<PackedValue> ScriptVM::execute(const CompiledGraph& graph, std::span<const PackedValue> args) {
+    if (graph.empty()) {
+        return std::unexpected(errors::script("Graph is not compiled"));
+    }
+
+    m_registers.assign(graph.initialRegisters.begin(), graph.initialRegisters.end());
+    const usize argCount = std::min<usize>(args.size(), graph.argumentCount);
+    for (usize i = 0; i < argCount; ++i) {
+        m_registers[graph.argumentBase + i] = args[i];
+    }
+
+    PackedValue* r = m_registers.data();
+    const Instruction* code = graph.code.data();
+    u64 executed = 0;
+    u32 pc = 0;
+
+    for (;;) {
+        const Instruction& in = code[pc++];
+        ++executed;
+
+        switch (in.op) {
+            case OpCode::Move: r[in.a] = r[in.b]; break;
+
+            case OpCode::AddI: r[in.a] = PackedValue(wrapAdd(r[in.b].asInt(), r[in.c].asInt())); break;
+            case OpCode::SubI: r[in.a] = PackedValue(wrapSub(r[in.b].asInt(), r[in.c].asInt())); break;
+            case OpCode::MulI: r[in.a] = PackedValue(wrapMul(r[in.b].asInt(), r[in.c].asInt())); break;
+            case OpCode::DivI: r[in.a] = PackedValue(wrapDiv(r[in.b].asInt(), r[in.c].asInt())); break;
+
+            case OpCode::AddF: r[in.a] = PackedValue(r[in.b].asFloat() + r[in.c].asFloat()); break;
+            case OpCode::SubF: r[in.a] = PackedValue(r[in.b].asFloat() - r[in.c].asFloat()); break;
+            case OpCode::MulF: r[in.a] = PackedValue(r[in.b].asFloat() * r[in.c].asFloat()); break;
+            case OpCode::DivF: {
+                f64 divisor = r[in.c].asFloat();
+                r[in.a] = PackedValue(divisor != 0.0 ? r[in.b].asFloat() / divisor : 0.0);
+                break;
+            }
+
+            case OpCode::LtI: r[in.a] = PackedValue(r[in.b].asInt() <  r[in.c].asInt()); break;
+            case OpCode::LeI: r[in.a] = PackedValue(r[in.b].asInt() <= r[in.c].asInt()); break;
+            case OpCode::GtI: r[in.a] = PackedValue(r[in.b].asInt() >  r[in.c].asInt()); break;
+            case OpCode::GeI: r[in.a] = PackedValue(r[in.b].asInt() >= r[in.c].asInt()); break;
+            case OpCode::EqI: r[in.a] = PackedValue(r[in.b].asInt() == r[in.c].asInt()); break;
+            case OpCode::NeI: r[in.a] = PackedValue(r[in.b].asInt() != r[in.c].asInt()); break;
+
+            case OpCode::LtF: r[in.a] = PackedValue(r[in.b].asFloat() <  r[in.c].asFloat()); break;
+            case OpCode::LeF: r[in.a] = PackedValue(r[in.b].asFloat() <= r[in.c].asFloat()); break;
+            case OpCode::GtF: r[in.a] = PackedValue(r[in.b].asFloat() >  r[in.c].asFloat()); break;
+            case OpCode::GeF: r[in.a] = PackedValue(r[in.b].asFloat() >= r[in.c].asFloat()); break;
+            case OpCode::EqF: r[in.a] = PackedValue(r[in.b].asFloat() == r[in.c].asFloat()); break;
+            case OpCode::NeF: r[in.a] = PackedValue(r[in.b].asFloat() != r[in.c].asFloat()); break;
+
+            case OpCode::Eq: r[in.a] = PackedValue(r[in.b] == r[in.c]); break;
+            case OpCode::Ne: r[in.a] = PackedValue(r[in.b] != r[in.c]); break;
+
+            case OpCode::And: r[in.a] = PackedValue(r[in.b].asBool() && r[in.c].asBool()); break;
+            case OpCode::Or:  r[in.a] = PackedValue(r[in.b].asBool() || r[in.c].asBool()); break;
+            case OpCode::Not: r[in.a] = PackedValue(!r[in.b].asBool()); break;
+
+            case OpCode::Jump:
+                // Only loops jump backwards, so the budget is checked here
+                if (m_instructionLimit != 0 && executed > m_instructionLimit) {
+                    m_instructionsExecuted += executed;
+                    return std::unexpected(errors::script("Graph exceeded its instruction limit"));
+                }
+                pc = in.a;
+                break;
+
+            case OpCode::JumpIfFalse:
+                if (!r[in.b].asBool()) {
+                    pc = in.a;
+                }
+                break;
+
+            case OpCode::CallNative:
+                r[in.a] = graph.natives->call(graph.calls[in.b],
+                                              std::span<const PackedValue>(r + in.c, in.argc));
+                break;
+
+            case OpCode::Return:
+                m_instructionsExecuted += executed;
+                return r[in.a];
+
+            case OpCode::ReturnVoid:
+                m_instructionsExecuted += executed;
+                return PackedValue();
+        }
+    }
+}
+
+} // namespace nova::script
@@ -0,0 +1,248 @@
+/**
+ * @file font.cpp
+ * @brief Nova UI™ - Font faces, glyph atlas and font registry implementation
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/ui/font.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nova::ui {
+
+namespace {
+
+/// Columns of each printable ASCII glyph (0x20-0x7E), bit 0 = top row
+constexpr u8 GLYPHS_5X7[95][5] = {
+    {0x00, 0x00, 0x00, 0x00, 0x00}, {0x00, 0x00, 0x5F, 0x00, 0x00}, {0x00, 0x07, 0x00, 0x07, 0x00},
+    {0x14, 0x7F, 0x14, 0x7F, 0x14}, {0x24, 0x2A, 0x7F, 0x2A, 0x12}, {0x23, 0x13, 0x08, 0x64, 0x62},
+    {0x36, 0x49, 0x55, 0x22, 0x50}, {0x00, 0x05, 0x03, 0x00, 0x00}, {0x00, 0x1C, 0x22, 0x41, 0x00},
+    {0x00, 0x41, 0x22, 0x1C, 0x00}, {0x08, 0x2A, 0x1C, 0x2A, 0x08}, {0x08, 0x08, 0x3E, 0x08, 0x08},
+    {0x00, 0x50, 0x30, 0x00, 0x00}, {0x08, 0x08, 0x08, 0x08, 0x08}, {0x00, 0x60, 0x60, 0x00, 0x00},
+    {0x20, 0x10, 0x08, 0x04, 0x02}, {0x3E, 0x51, 0x49, 0x45, 0x3E}, {0x00, 0x42, 0x7F, 0x40, 0x00},
+    {0x42, 0x61, 0x51, 0x49, 0x46}, {0x21, 0x41, 0x45, 0x4B, 0x31}, {0x18, 0x14, 0x12, 0x7F, 0x10},
+    {0x27, 0x45, 0x45, 0x45, 0x39}, {0x3C, 0x4A, 0x49, 0x49, 0x30}, {0x01, 0x71, 0x09, 0x05, 0x03},
+    {0x36, 0x49, 0x49, 0x49, 0x36}, {0x06, 0x49, 0x49, 0x29, 0x1E}, {0x00, 0x36, 0x36, 0x00, 0x00},
+    {0x00, 0x56, 0x36, 0x00, 0x00}, {0x08, 0x14, 0x22, 0x41, 0x00}, {0x14, 0x14, 0x14, 0x14, 0x14},
+    {0x00, 0x41, 0x22, 0x14, 0x08}, {0x02, 0x01, 0x51, 0x09, 0x06}, {0x32, 0x49, 0x79, 0x41, 0x3E},
+    {0x7E, 0x11, 0x11, 0x11, 0x7E}, {0x7F, 0x49, 0x49, 0x49, 0x36}, {0x3E, 0x41, 0x41, 0x41, 0x22},
+    {0x7F, 0x41, 0x41, 0x22, 0x1C}, {0x7F, 0x49, 0x49, 0x49, 0x41}, {0x7F, 0x09, 0x09, 0x09, 0x01},
+    {0x3E, 0x41, 0x49, 0x49, 0x7A}, {0x7F, 0x08, 0x08, 0x08, 0x7F}, {0x00, 0x41, 0x7F, 0x41, 0x00},
+    {0x20, 0x40, 0x41, 0x3F, 0x01}, {0x7F, 0x08, 0x14, 0x22, 0x41}, {0x7F, 0x40, 0x40, 0x40, 0x40},
+    {0x7F, 0x02, 0x0C, 0x02, 0x7F}, {0x7F, 0x04, 0x08, 0x10, 0x7F}, {0x3E, 0x41, 0x41, 0x41, 0x3E},
+    {0x7F, 0x09, 0x09, 0x09, 0x06}, {0x3E, 0x41, 0x51, 0x21, 0x5E}, {0x7F, 0x09, 0x19, 0x29, 0x46},
+    {0x46, 0x49, 0x49, 0x49, 0x31}, {0x01, 0x01, 0x7F, 0x01, 0x01}, {0x3F, 0x40, 0x40, 0x40, 0x3F},
+    {0x1F, 0x20, 0x40, 0x20, 0x1F}, {0x3F, 0x40, 0x38, 0x40, 0x3F}, {0x63, 0x14, 0x08, 0x14, 0x63},
+    {0x07, 0x08, 0x70, 0x08, 0x07}, {0x61, 0x51, 0x49, 0x45, 0x43}, {0x00, 0x7F, 0x41, 0x41, 0x00},
+    {0x02, 0x04, 0x08, 0x10, 0x20}, {0x00, 0x41, 0x41, 0x7F, 0x00}, {0x04, 0x02, 0x01, 0x02, 0x04},
+    {0x40, 0x40, 0x40, 0x40, 0x40}, {0x00, 0x01, 0x02, 0x04, 0x00}, {0x20, 0x54, 0x54, 0x54, 0x78},
+    {0x7F, 0x48, 0x44, 0x44, 0x38}, {0x38, 0x44, 0x44, 0x44, 0x20}, {0x38, 0x44, 0x44, 0x48, 0x7F},
+    {0x38, 0x54, 0x54, 0x54, 0x18}, {0x08, 0x7E, 0x09, 0x01, 0x02}, {0x0C, 0x52, 0x52, 0x52, 0x3E},
+    {0x7F, 0x08, 0x04, 0x04, 0x78}, {0x00, 0x44, 0x7D, 0x40, 0x00}, {0x20, 0x40, 0x44, 0x3D, 0x00},
+    {0x7F, 0x10, 0x28, 0x44, 0x00}, {0x00, 0x41, 0x7F, 0x40, 0x00}, {0x7C, 0x04, 0x18, 0x04, 0x78},
+    {0x7C, 0x08, 0x04, 0x04, 0x78}, {0x38, 0x44, 0x44, 0x44, 0x38}, {0x7C, 0x14, 0x14, 0x14, 0x08},
+    {0x08, 0x14, 0x14, 0x18, 0x7C}, {0x7C, 0x08, 0x04, 0x04, 0x08}, {0x48, 0x54, 0x54, 0x54, 0x20},
+    {0x04, 0x3F, 0x44, 0x40, 0x20}, {0x3C, 0x40, 0x40, 0x20, 0x7C}, {0x1C, 0x20, 0x40, 0x20, 0x1C},
+    {0x3C, 0x40, 0x30, 0x40, 0x3C}, {0x44, 0x28, 0x10, 0x28, 0x44}, {0x0C, 0x50, 0x50, 0x50, 0x3C},
+    {0x44, 0x64, 0x54, 0x4C, 0x44}, {0x00, 0x08, 0x36, 0x41, 0x00}, {0x00, 0x00, 0x7F, 0x00, 0x00},
+    {0x00, 0x41, 0x36, 0x08, 0x00}, {0x08, 0x04, 0x08, 0x10, 0x08},
+};
+
+constexpr u32 BITMAP_COLUMNS = 5;
+constexpr u32 BITMAP_ROWS = 7;
+
+/// Glyph box relative to the font size
+constexpr f32 BUILTIN_ADVANCE = 0.6f;
+constexpr f32 BUILTIN_GLYPH_WIDTH = 0.5f;
+constexpr f32 BUILTIN_GLYPH_HEIGHT = 0.7f;
+constexpr f32 BUILTIN_BEARING_X = 0.05f;
+
+/// Supersampling per axis when scaling the bitmap
+constexpr u32 SUPERSAMPLE = 4;
+
+/// Empty pixels around each packed glyph (stops bilinear bleeding)
+constexpr u32 GLYPH_PADDING = 1;
+
+/// Side of the reserved white block at the atlas origin
+constexpr u32 WHITE_BLOCK = 4;
+
+[[nodiscard]] u64 glyphKey(FontId font, u32 codepoint, u32 pixelSize) noexcept {
+    return (static_cast<u64>(font & 0xFFFF) << 48) | (static_cast<u64>(pixelSize & 0xFFFF) << 32) | codepoint;
+}
+
+} // namespace
+
+// ============================================================================
+// BuiltinFont
+// ============================================================================
+
+f32 BuiltinFont::getAdvance(u32 /*codepoint*/) const {
+    return BUILTIN_ADVANCE;
+}
+
+bool BuiltinFont::rasterize(u32 codepoint, u32 pixelSize, GlyphBitmap& out) const {
+    if (codepoint < 0x20 || codepoint > 0x7E) {
+        codepoint = '?';
+    }
+    const u8* columns = GLYPHS_5X7[codepoint - 0x20];
+    if (std::all_of(columns, columns + BITMAP_COLUMNS, [](u8 c) { return c == 0; })) {
+        return false;
+    }
+
+    f32 size = static_cast<f32>(pixelSize);
+    out.width = std::max(1u, static_cast<u32>(std::lround(size * BUILTIN_GLYPH_WIDTH)));
+    out.height = std::max(1u, static_cast<u32>(std::lround(size * BUILTIN_GLYPH_HEIGHT)));
+    out.bearingX = std::round(size * BUILTIN_BEARING_X);
+    out.bearingY = static_cast<f32>(out.height);
+    out.pixels.assign(static_cast<usize>(out.width) * out.height, 0);
+
+    // Box-filter the bitmap into the target size
+    for (u32 y = 0; y < out.height; ++y) {
+        for (u32 x = 0; x < out.width; ++x) {
+            u32 covered = 0;
+            for (u32 sy = 0; sy < SUPERSAMPLE; ++sy) {
+                u32 row = ((y * SUPERSAMPLE + sy) * BITMAP_ROWS) / (out.height * SUPERSAMPLE);
+                for (u32 sx = 0; sx < SUPERSAMPLE; ++sx) {
+                    u32 column = ((x * SUPERSAMPLE + sx) * BITMAP_COLUMNS) / (out.width * SUPERSAMPLE);
+                    covered += (columns[column] >> row) & 1u;
+                }
+            }
+            out.pixels[y * out.width + x] = static_cast<u8>((covered * 255) / (SUPERSAMPLE * SUPERSAMPLE));
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// GlyphAtlas
+// ============================================================================
+
+GlyphAtlas::GlyphAtlas() {
+    reset(INITIAL_SIZE);
+}
+
+void GlyphAtlas::reset(u32 size) {
+    m_size = size;
+    ++m_generation;
+    m_dirty = true;
+    m_pixels.assign(static_cast<usize>(size) * size, 0);
+    m_shelves.clear();
+    m_nextShelfY = 0;
+    m_glyphs.clear();
+
+    u32 x = 0;
+    u32 y = 0;
+    allocate(WHITE_BLOCK, WHITE_BLOCK, x, y);
+    for (u32 row = 0; row < WHITE_BLOCK; ++row) {
+        std::fill_n(m_pixels.begin() + static_cast<std::ptrdiff_t>(row * m_size), WHITE_BLOCK, u8{255});
+    }
+}
+
+void GlyphAtlas::clear() {
+    reset(m_size);
+}
+
+Rect GlyphAtlas::getWhiteUV() const noexcept {
+    // Centre of the block, so filtering never reaches its edges
+    f32 centre = static_cast<f32>(WHITE_BLOCK) * 0.5f / static_cast<f32>(m_size);
+    return Rect(centre, centre, 0.0f, 0.0f);
+}
+
+bool GlyphAtlas::allocate(u32 width, u32 height, u32& x, u32& y) {
+    width += GLYPH_PADDING;
+    height += GLYPH_PADDING;
+
+    // Best-fitting existing shelf with room left
+    Shelf* best = nullptr;
+    for (auto& shelf : m_shelves) {
+        if (shelf.height >= height && shelf.x + width <= m_size &&
+            (!best || shelf.height < best->height)) {
+            best = &shelf;
+        }
+    }
+
+    if (!best) {
+        if (m_nextShelfY + height > m_size || width > m_size) {
+            return false;
+        }
+        m_shelves.push_back({m_nextShelfY, height, 0});
+        m_nextShelfY += height;
+        best = &m_shelves.back();
+    }
+
+    x = best->x;
+    y = best->y;
+    best->x += width;
+    return true;
+}
+
+AtlasGlyph GlyphAtlas::getGlyph(FontId font, const FontFace& face, u32 codepoint, u32 pixelSize) {
+    u64 key = glyphKey(font, codepoint, pixelSize);
+    if (auto it = m_glyphs.find(key); it != m_glyphs.end()) {
+        return it->second;
+    }
+
+    AtlasGlyph glyph;
+    GlyphBitmap bitmap;
+    if (!face.rasterize(codepoint, pixelSize, bitmap) || bitmap.width == 0 || bitmap.height == 0) {
+        return m_glyphs.emplace(key, glyph).first->second;
+    }
+
+    u32 x = 0;
+    u32 y = 0;
+    while (!allocate(bitmap.width, bitmap.height, x, y)) {
+        if (bitmap.width + GLYPH_PADDING > MAX_SIZE || bitmap.height + GLYPH_PADDING > MAX_SIZE) {
+            return glyph;
+        }
+        // Repack from scratch in a larger page, or start over at the limit
+        reset(std::min(m_size * 2, MAX_SIZE));
+    }
+
+    for (u32 row = 0; row < bitmap.height; ++row) {
+        std::copy_n(bitmap.pixels.begin() + static_cast<std::ptrdiff_t>(row * bitmap.width), bitmap.width,
+                    m_pixels.begin() + static_cast<std::ptrdiff_t>((y + row) * m_size + x));
+    }
+    m_dirty = true;
+
+    f32 scale = 1.0f / static_cast<f32>(m_size);
+    glyph.uv = Rect(static_cast<f32>(x) * scale, static_cast<f32>(y) * scale,
+                    static_cast<f32>(bitmap.width) * scale, static_cast<f32>(bitmap.height) * scale);
+    glyph.offset = Vec2(bitmap.bearingX, -bitmap.bearingY);
+    glyph.size = Vec2(static_cast<f32>(bitmap.width), static_cast<f32>(bitmap.height));
+    return m_glyphs.emplace(key, glyph).first->second;
+}
+
+// ============================================================================
+// FontLibrary
+// ============================================================================
+
+FontLibrary::FontLibrary() {
+    registerFont("default", std::make_unique<BuiltinFont>());
+}
+
+FontLibrary& FontLibrary::get() {
+    static FontLibrary library;
+    return library;
+}
+
+FontId FontLibrary::registerFont(const std::string& family, std::unique_ptr<FontFace> face) {
+    auto id = static_cast<FontId>(m_faces.size());
+    m_faces.push_back(std::move(face));
+    m_families[family] = id;
+    return id;
+}
+
+FontId FontLibrary::findFont(std::string_view family) const {
+    auto it = m_families.find(std::string(family));
+    return it != m_families.end() ? it->second : DEFAULT_FONT;
+}
+
+const FontFace& FontLibrary::getFace(FontId font) const {
+    return *m_faces[font < m_faces.size() ? font : DEFAULT_FONT];
+}
+
+} // namespace nova::ui
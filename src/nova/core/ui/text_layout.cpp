@@ -0,0 +1,230 @@
+/**
+ * @file text_layout.cpp
+ * @brief Nova UI™ - Text shaping cache and line breaking implementation
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/ui/text_layout.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+namespace nova::ui {
+
+namespace {
+
+/// Slack when fitting lines, so text laid out into its own measured width
+/// (after padding round-trips) does not wrap
+constexpr f32 LINE_FIT_EPSILON = 0.01f;
+
+constexpr u32 REPLACEMENT_CHARACTER = 0xFFFD;
+
+/// Decode one UTF-8 sequence at @p i and advance past it
+[[nodiscard]] u32 decodeUtf8(std::string_view text, usize& i) noexcept {
+    auto byte = [&](usize at) { return static_cast<u8>(text[at]); };
+    u8 lead = byte(i++);
+    if (lead < 0x80) {
+        return lead;
+    }
+
+    u32 length = lead >= 0xF0 ? 3 : lead >= 0xE0 ? 2 : lead >= 0xC0 ? 1 : 0;
+    if (length == 0 || i + length > text.size()) {
+        return REPLACEMENT_CHARACTER;
+    }
+    u32 codepoint = lead & (0x3F >> length);
+    for (u32 k = 0; k < length; ++k) {
+        u8 next = byte(i);
+        if ((next & 0xC0) != 0x80) {
+            return REPLACEMENT_CHARACTER;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+        ++i;
+    }
+    return codepoint;
+}
+
+[[nodiscard]] u64 shapeKey(std::string_view text, FontId font, f32 fontSize) noexcept {
+    // FNV-1a over the text, then the font and size
+    u64 hash = 0xCBF29CE484222325ull;
+    auto mix = [&hash](u64 value) {
+        hash ^= value;
+        hash *= 0x100000001B3ull;
+    };
+    for (char c : text) {
+        mix(static_cast<u8>(c));
+    }
+    mix(font);
+    mix(std::bit_cast<u32>(fontSize));
+    return hash;
+}
+
+} // namespace
+
+// ============================================================================
+// Line Breaking
+// ============================================================================
+
+void breakLines(const ShapedText& shaped, f32 maxWidth, u32 maxLines, std::vector<TextLine>& lines) {
+    lines.clear();
+
+    const auto& glyphs = shaped.glyphs;
+    auto count = static_cast<u32>(glyphs.size());
+    f32 limit = maxWidth > 0.0f ? maxWidth + LINE_FIT_EPSILON : std::numeric_limits<f32>::infinity();
+    auto full = [&] { return maxLines > 0 && lines.size() >= maxLines; };
+
+    u32 start = 0;
+    while (start < count && !full()) {
+        auto newline = std::lower_bound(shaped.newlines.begin(), shaped.newlines.end(), start);
+        u32 hardEnd = newline != shaped.newlines.end() ? *newline : count;
+
+        f32 width = shaped.width(start, hardEnd);
+        if (width <= limit) {
+            lines.push_back({start, hardEnd, width});
+            start = hardEnd < count ? hardEnd + 1 : count;
+            continue;
+        }
+
+        // First glyph whose right edge overflows (at least one glyph per line)
+        f32 originX = glyphs[start].x;
+        auto over = std::partition_point(glyphs.begin() + start, glyphs.begin() + hardEnd,
+                                         [&](const ShapedGlyph& g) { return g.x + g.advance - originX <= limit; });
+        u32 overflow = std::max(start + 1, static_cast<u32>(over - glyphs.begin()));
+
+        // Prefer the last space at or before the overflow point
+        auto space = std::upper_bound(shaped.spaces.begin(), shaped.spaces.end(), overflow);
+        if (space != shaped.spaces.begin() && *std::prev(space) > start) {
+            u32 breakAt = *std::prev(space);
+            lines.push_back({start, breakAt, shaped.width(start, breakAt)});
+            start = breakAt + 1;
+        } else {
+            lines.push_back({start, overflow, shaped.width(start, overflow)});
+            start = overflow;
+        }
+    }
+
+    // A trailing newline opens one more (empty) line
+    if (count > 0 && glyphs.back().codepoint == '\n' && start == count && !full()) {
+        lines.push_back({count, count, 0.0f});
+    }
+    if (lines.empty()) {
+        lines.push_back({0, 0, 0.0f});
+    }
+}
+
+// ============================================================================
+// TextShaper
+// ============================================================================
+
+TextShaper& TextShaper::get() {
+    static TextShaper shaper;
+    return shaper;
+}
+
+std::shared_ptr<const ShapedText> TextShaper::shapeUncached(std::string_view text, FontId font, f32 fontSize) {
+    auto shaped = std::make_shared<ShapedText>();
+    shaped->text = text;
+    shaped->font = font;
+    shaped->fontSize = fontSize;
+    shaped->glyphs.reserve(text.size());
+
+    const FontFace& face = FontLibrary::get().getFace(font);
+    f32 pen = 0.0f;
+    u32 previous = 0;
+    for (usize i = 0; i < text.size();) {
+        auto cluster = static_cast<u32>(i);
+        u32 codepoint = decodeUtf8(text, i);
+        auto index = static_cast<u32>(shaped->glyphs.size());
+
+        if (codepoint == '\n') {
+            shaped->newlines.push_back(index);
+            shaped->glyphs.push_back({codepoint, cluster, pen, 0.0f});
+            previous = 0;
+            continue;
+        }
+        if (codepoint == ' ' || codepoint == '\t') {
+            shaped->spaces.push_back(index);
+        }
+        if (previous != 0) {
+            pen += face.getKerning(previous, codepoint) * fontSize;
+        }
+
+        f32 advance = face.getAdvance(codepoint) * fontSize;
+        shaped->glyphs.push_back({codepoint, cluster, pen, advance});
+        pen += advance;
+        previous = codepoint;
+    }
+    shaped->advance = pen;
+    return shaped;
+}
+
+std::shared_ptr<const ShapedText> TextShaper::shape(std::string_view text, FontId font, f32 fontSize) {
+    u64 hash = shapeKey(text, font, fontSize);
+    if (auto it = m_index.find(hash); it != m_index.end()) {
+        const auto& shaped = *it->second->shaped;
+        if (shaped.font == font && shaped.fontSize == fontSize && shaped.text == text) {
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            ++m_hits;
+            return it->second->shaped;
+        }
+        // Hash collision: the newer string takes the slot
+        m_lru.erase(it->second);
+        m_index.erase(it);
+    }
+
+    ++m_misses;
+    m_lru.push_front({hash, shapeUncached(text, font, fontSize)});
+    m_index.emplace(hash, m_lru.begin());
+    evict();
+    return m_lru.front().shaped;
+}
+
+TextLayout TextShaper::layout(std::string_view text, const TextStyle& style, f32 maxWidth, u32 maxLines) {
+    auto& fonts = FontLibrary::get();
+    FontId font = fonts.findFont(style.fontFamily);
+    FontMetrics metrics = fonts.getFace(font).getMetrics();
+
+    TextLayout result;
+    result.shaped = shape(text, font, style.fontSize);
+    breakLines(*result.shaped, maxWidth, maxLines, result.lines);
+
+    // Centre the glyph box vertically in the line
+    result.lineHeight = style.fontSize * style.lineHeight;
+    result.ascent = (result.lineHeight - (metrics.ascent + metrics.descent) * style.fontSize) * 0.5f +
+                    metrics.ascent * style.fontSize;
+
+    f32 width = 0.0f;
+    for (const auto& line : result.lines) {
+        width = std::max(width, line.width);
+    }
+    result.size = Vec2(width, static_cast<f32>(result.lines.size()) * result.lineHeight);
+    return result;
+}
+
+void TextShaper::setCapacity(usize capacity) {
+    m_capacity = std::max<usize>(capacity, 1);
+    evict();
+}
+
+void TextShaper::evict() {
+    while (m_lru.size() > m_capacity) {
+        m_index.erase(m_lru.back().hash);
+        m_lru.pop_back();
+    }
+}
+
+TextShaperStats TextShaper::getStats() const noexcept {
+    return {m_hits, m_misses, m_lru.size()};
+}
+
+void TextShaper::clear() {
+    m_lru.clear();
+    m_index.clear();
+    m_hits = 0;
+    m_misses = 0;
+}
+
+} // namespace nova::ui
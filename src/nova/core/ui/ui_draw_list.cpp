@@ -0,0 +1,265 @@
+/**
+ * @file ui_draw_list.cpp
+ * @brief Nova UI™ - Retained draw list builder implementation
+ *
+ * Part of the NovaCore Engine - World's Best Mobile-First Game Engine
+ *
+ * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
+ */
+
+#include "nova/core/ui/ui_draw_list.hpp"
+#include "nova/core/ui/text_layout.hpp"
+#include "nova/core/ui/widget.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace nova::ui {
+
+namespace {
+
+/// Builds repeated when the glyph atlas was repacked mid-build
+constexpr u32 MAX_BUILD_PASSES = 2;
+
+[[nodiscard]] u32 packColor(const Color& color, f32 opacity) noexcept {
+    auto channel = [](f32 v) {
+        return static_cast<u32>(std::clamp(v, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    return channel(color.r) | (channel(color.g) << 8) | (channel(color.b) << 16) |
+           (channel(color.a * opacity) << 24);
+}
+
+} // namespace
+
+// ============================================================================
+// UIPainter
+// ============================================================================
+
+void UIPainter::quad(const Rect& rect, const Rect& uv, UITextureId texture, const Color& color) {
+    u32 packed = packColor(color, m_opacity);
+    if ((packed >> 24) == 0 || rect.width <= 0.0f || rect.height <= 0.0f) {
+        return;
+    }
+
+    auto& vertices = m_geometry.vertices;
+    auto& indices = m_geometry.indices;
+    auto& segments = m_geometry.segments;
+
+    u32 base = static_cast<u32>(vertices.size());
+    vertices.push_back({Vec2(rect.left(), rect.top()), Vec2(uv.left(), uv.top()), packed});
+    vertices.push_back({Vec2(rect.right(), rect.top()), Vec2(uv.right(), uv.top()), packed});
+    vertices.push_back({Vec2(rect.right(), rect.bottom()), Vec2(uv.right(), uv.bottom()), packed});
+    vertices.push_back({Vec2(rect.left(), rect.bottom()), Vec2(uv.left(), uv.bottom()), packed});
+
+    u32 indexOffset = static_cast<u32>(indices.size());
+    for (u32 i : {0u, 1u, 2u, 2u, 3u, 0u}) {
+        indices.push_back(base + i);
+    }
+
+    if (!segments.empty() && segments.back().texture == texture) {
+        segments.back().indexCount += 6;
+    } else {
+        segments.push_back({texture, indexOffset, 6});
+    }
+}
+
+void UIPainter::fillRect(const Rect& rect, const Color& color) {
+    quad(rect, FontLibrary::get().getAtlas().getWhiteUV(), UI_TEXTURE_ATLAS, color);
+}
+
+void UIPainter::strokeRect(const Rect& rect, f32 width, const Color& color) {
+    width = std::min({width, rect.width * 0.5f, rect.height * 0.5f});
+    if (width <= 0.0f) {
+        return;
+    }
+    fillRect(Rect(rect.x, rect.y, rect.width, width), color);
+    fillRect(Rect(rect.x, rect.bottom() - width, rect.width, width), color);
+    fillRect(Rect(rect.x, rect.y + width, width, rect.height - 2.0f * width), color);
+    fillRect(Rect(rect.right() - width, rect.y + width, width, rect.height - 2.0f * width), color);
+}
+
+void UIPainter::drawImage(const Rect& rect, const std::string& source, const Color& tint) {
+    quad(rect, Rect(0.0f, 0.0f, 1.0f, 1.0f), m_list.textureId(source), tint);
+}
+
+void UIPainter::drawText(const Rect& rect, std::string_view text, const TextStyle& style, u32 maxLines) {
+    drawText(rect, TextShaper::get().layout(text, style, rect.width, maxLines), style);
+}
+
+void UIPainter::drawText(const Rect& rect, const TextLayout& layout, const TextStyle& style) {
+    const ShapedText& shaped = *layout.shaped;
+    auto& fonts = FontLibrary::get();
+    const FontFace& face = fonts.getFace(shaped.font);
+    GlyphAtlas& atlas = fonts.getAtlas();
+
+    // Rasterize at the nearest integer size and scale the quads to fit
+    u32 pixelSize = std::max(1u, static_cast<u32>(std::lround(shaped.fontSize)));
+    f32 scale = shaped.fontSize / static_cast<f32>(pixelSize);
+
+    f32 baseline = rect.y + layout.ascent;
+    for (const auto& line : layout.lines) {
+        f32 x = rect.x;
+        if (style.textAlign == TextAlign::Center) {
+            x += (rect.width - line.width) * 0.5f;
+        } else if (style.textAlign == TextAlign::Right) {
+            x += rect.width - line.width;
+        }
+        x -= shaped.width(0, line.begin);
+
+        for (u32 i = line.begin; i < line.end; ++i) {
+            const ShapedGlyph& glyph = shaped.glyphs[i];
+            AtlasGlyph placed = atlas.getGlyph(shaped.font, face, glyph.codepoint, pixelSize);
+            if (placed.size.x <= 0.0f) {
+                continue;
+            }
+            quad(Rect(x + glyph.x + placed.offset.x * scale, baseline + placed.offset.y * scale,
+                      placed.size.x * scale, placed.size.y * scale),
+                 placed.uv, UI_TEXTURE_ATLAS, style.color);
+        }
+        baseline += layout.lineHeight;
+    }
+}
+
+// ============================================================================
+// UIDrawList
+// ============================================================================
+
+bool UIDrawList::build(Widget* root) {
+    const GlyphAtlas& atlas = FontLibrary::get().getAtlas();
+    u32 rebuilt = 0;
+    for (u32 pass = 0; pass < MAX_BUILD_PASSES; ++pass) {
+        // A repacked atlas moves every glyph, so all cached geometry is stale
+        if (atlas.getGeneration() != m_atlasGeneration) {
+            m_atlasGeneration = atlas.getGeneration();
+            for (auto& [handle, geometry] : m_geometry) {
+                geometry.valid = false;
+            }
+        }
+
+        ++m_buildIndex;
+        m_stats = {};
+        m_items.clear();
+        if (root) {
+            visit(root, 1.0f, root->getBounds());
+        }
+        rebuilt += m_stats.widgetsRebuilt;
+
+        if (atlas.getGeneration() == m_atlasGeneration) {
+            break;
+        }
+    }
+    m_stats.widgetsRebuilt = rebuilt;
+
+    bool changed = m_stats.widgetsRebuilt > 0 || m_items != m_previousItems;
+    if (changed) {
+        assemble();
+    }
+    std::swap(m_items, m_previousItems);
+
+    // Forget widgets that were removed or hidden
+    if (m_geometry.size() > m_stats.widgets) {
+        std::erase_if(m_geometry, [this](const auto& entry) { return entry.second.lastBuild != m_buildIndex; });
+    }
+
+    m_stats.vertices = static_cast<u32>(m_vertices.size());
+    m_stats.indices = static_cast<u32>(m_indices.size());
+    m_stats.batches = static_cast<u32>(m_batches.size());
+    m_stats.changed = changed;
+    return changed;
+}
+
+void UIDrawList::visit(Widget* widget, f32 opacity, const Rect& clip) {
+    const Style& style = widget->getStyle();
+    if (!widget->isVisible() || style.display == Display::None) {
+        return;
+    }
+    opacity *= style.opacity;
+    if (opacity <= 0.0f) {
+        return;
+    }
+
+    ++m_stats.widgets;
+    auto& geometry = m_geometry[widget->getHandle().value];
+    geometry.lastBuild = m_buildIndex;
+
+    if (!geometry.valid || geometry.paintVersion != widget->m_paintVersion ||
+        geometry.bounds != widget->getBounds() || geometry.opacity != opacity) {
+        geometry.vertices.clear();
+        geometry.indices.clear();
+        geometry.segments.clear();
+
+        UIPainter painter(*this, geometry, opacity);
+        widget->paint(painter);
+
+        geometry.paintVersion = widget->m_paintVersion;
+        geometry.bounds = widget->getBounds();
+        geometry.opacity = opacity;
+        geometry.valid = true;
+        ++m_stats.widgetsRebuilt;
+    }
+
+    if (!geometry.indices.empty()) {
+        m_items.push_back({&geometry, clip});
+    }
+
+    Rect childClip = style.overflow == Overflow::Visible ? clip : clip.intersection(widget->getBounds());
+    for (const auto& child : widget->getChildren()) {
+        visit(child.get(), opacity, childClip);
+    }
+}
+
+void UIDrawList::assemble() {
+    m_vertices.clear();
+    m_indices.clear();
+    m_batches.clear();
+
+    for (const auto& item : m_items) {
+        const auto& geometry = *item.geometry;
+        u32 vertexBase = static_cast<u32>(m_vertices.size());
+        u32 indexBase = static_cast<u32>(m_indices.size());
+
+        m_vertices.insert(m_vertices.end(), geometry.vertices.begin(), geometry.vertices.end());
+        for (u32 index : geometry.indices) {
+            m_indices.push_back(vertexBase + index);
+        }
+
+        for (const auto& segment : geometry.segments) {
+            u32 offset = indexBase + segment.indexOffset;
+            if (!m_batches.empty()) {
+                auto& last = m_batches.back();
+                if (last.texture == segment.texture && last.clip == item.clip &&
+                    last.indexOffset + last.indexCount == offset) {
+                    last.indexCount += segment.indexCount;
+                    continue;
+                }
+            }
+            m_batches.push_back({segment.texture, offset, segment.indexCount, item.clip});
+        }
+    }
+}
+
+void UIDrawList::clear() {
+    m_geometry.clear();
+    m_items.clear();
+    m_previousItems.clear();
+    m_vertices.clear();
+    m_indices.clear();
+    m_batches.clear();
+    m_stats = {};
+    m_atlasGeneration = 0;
+}
+
+UITextureId UIDrawList::textureId(const std::string& source) {
+    auto [it, inserted] = m_textureIds.try_emplace(source, static_cast<UITextureId>(m_textureSources.size() + 1));
+    if (inserted) {
+        m_textureSources.push_back(source);
+    }
+    return it->second;
+}
+
+const std::string& UIDrawList::textureSource(UITextureId id) const {
+    static const std::string atlas;
+    return (id == UI_TEXTURE_ATLAS || id > m_textureSources.size()) ? atlas : m_textureSources[id - 1];
+}
+
+} // namespace nova::ui
@@ -8,6 +8,8 @@
  */
 
 #include "nova/core/ui/ui_system.hpp"
+#include "nova/core/ui/ui_draw_list.hpp"
+#include "nova/core/ui/text_layout.hpp"
 #include "nova/core/logging/logging.hpp"
 
 #include <algorithm>
@@ -180,6 +182,14 @@ Widget::Widget(Widget&& other) noexcept
     , m_handle(other.m_handle)
     , m_id(std::move(other.m_id))
     , m_parent(other.m_parent)
+    , m_paintVersion(other.m_paintVersion)
+    , m_childNeedsLayout(other.m_childNeedsLayout)
+    , m_hasLayout(other.m_hasLayout)
+    , m_lastAvailableSpace(other.m_lastAvailableSpace)
+    , m_measureCache(other.m_measureCache)
+    , m_measureCacheNext(other.m_measureCacheNext)
+    , m_subtreeWidgets(other.m_subtreeWidgets)
+    , m_subtreeVisible(other.m_subtreeVisible)
     , m_animations(std::move(other.m_animations))
     , m_nextAnimationId(other.m_nextAnimationId)
 {
@@ -207,6 +217,14 @@ Widget& Widget::operator=(Widget&& other) noexcept {
         m_hovered = other.m_hovered;
         m_pressed = other.m_pressed;
         m_accessibility = std::move(other.m_accessibility);
+        m_paintVersion = other.m_paintVersion;
+        m_childNeedsLayout = other.m_childNeedsLayout;
+        m_hasLayout = other.m_hasLayout;
+        m_lastAvailableSpace = other.m_lastAvailableSpace;
+        m_measureCache = other.m_measureCache;
+        m_measureCacheNext = other.m_measureCacheNext;
+        m_subtreeWidgets = other.m_subtreeWidgets;
+        m_subtreeVisible = other.m_subtreeVisible;
         m_animations = std::move(other.m_animations);
         m_nextAnimationId = other.m_nextAnimationId;
         
@@ -228,6 +246,7 @@ Widget* Widget::getChildAt(usize index) const {
 void Widget::addChild(std::unique_ptr<Widget> child) {
     if (child) {
         child->m_parent = this;
+        adjustSubtreeCounts(static_cast<i32>(child->m_subtreeWidgets), static_cast<i32>(child->m_subtreeVisible));
         m_children.push_back(std::move(child));
         markLayoutDirty();
     }
@@ -236,6 +255,7 @@ void Widget::addChild(std::unique_ptr<Widget> child) {
 void Widget::insertChild(usize index, std::unique_ptr<Widget> child) {
     if (child) {
         child->m_parent = this;
+        adjustSubtreeCounts(static_cast<i32>(child->m_subtreeWidgets), static_cast<i32>(child->m_subtreeVisible));
         if (index >= m_children.size()) {
             m_children.push_back(std::move(child));
         } else {
@@ -252,6 +272,7 @@ std::unique_ptr<Widget> Widget::removeChild(Widget* child) {
     if (it != m_children.end()) {
         auto removed = std::move(*it);
         removed->m_parent = nullptr;
+        adjustSubtreeCounts(-static_cast<i32>(removed->m_subtreeWidgets), -static_cast<i32>(removed->m_subtreeVisible));
         m_children.erase(it);
         markLayoutDirty();
         return removed;
@@ -263,6 +284,7 @@ std::unique_ptr<Widget> Widget::removeChildAt(usize index) {
     if (index < m_children.size()) {
         auto removed = std::move(m_children[index]);
         removed->m_parent = nullptr;
+        adjustSubtreeCounts(-static_cast<i32>(removed->m_subtreeWidgets), -static_cast<i32>(removed->m_subtreeVisible));
         m_children.erase(m_children.begin() + static_cast<i32>(index));
         markLayoutDirty();
         return removed;
@@ -273,6 +295,7 @@ std::unique_ptr<Widget> Widget::removeChildAt(usize index) {
 void Widget::clearChildren() {
     for (auto& child : m_children) {
         child->m_parent = nullptr;
+        adjustSubtreeCounts(-static_cast<i32>(child->m_subtreeWidgets), -static_cast<i32>(child->m_subtreeVisible));
     }
     m_children.clear();
     markLayoutDirty();
@@ -326,6 +349,10 @@ bool Widget::isAncestorOf(const Widget* widget) const {
 void Widget::setStyle(const Style& style) {
     m_style = style;
     markLayoutDirty();
+    // The widget's own size may have changed, even if it is a boundary
+    if (m_parent) {
+        m_parent->markLayoutDirty();
+    }
     onStyleChanged();
 }
 
@@ -339,18 +366,79 @@ Rect Widget::getContentBounds() const noexcept {
 }
 
 void Widget::markLayoutDirty() {
-    m_layoutDirty = true;
-    if (m_parent) {
-        m_parent->markLayoutDirty();
+    // Only this widget's content changed; ancestors repaint if their bounds move
+    markPaintDirty();
+    
+    for (Widget* widget = this; widget; widget = widget->m_parent) {
+        widget->m_layoutDirty = true;
+        widget->invalidateMeasureCache();
+        if (widget->m_parent && widget->isRelayoutBoundary()) {
+            // Our size cannot change, so the parent's layout stays valid
+            widget->m_parent->markChildNeedsLayout();
+            return;
+        }
+    }
+}
+
+void Widget::markChildNeedsLayout() {
+    for (Widget* widget = this; widget; widget = widget->m_parent) {
+        widget->m_childNeedsLayout = true;
+    }
+}
+
+void Widget::invalidateMeasureCache() {
+    for (auto& entry : m_measureCache) {
+        entry.valid = false;
+    }
+}
+
+void Widget::adjustSubtreeCounts(i32 widgets, i32 visible) {
+    for (Widget* widget = this; widget; widget = widget->m_parent) {
+        widget->m_subtreeWidgets = static_cast<u32>(static_cast<i32>(widget->m_subtreeWidgets) + widgets);
+        widget->m_subtreeVisible = static_cast<u32>(static_cast<i32>(widget->m_subtreeVisible) + visible);
+    }
+}
+
+Vec2 Widget::measure(f32 availableWidth, f32 availableHeight) {
+    for (const auto& entry : m_measureCache) {
+        if (entry.valid && entry.availableWidth == availableWidth && entry.availableHeight == availableHeight) {
+            return entry.size;
+        }
+    }
+    
+    Vec2 size = measureContent(availableWidth, availableHeight);
+    auto& entry = m_measureCache[m_measureCacheNext];
+    entry = MeasureCacheEntry{availableWidth, availableHeight, size, true};
+    m_measureCacheNext = (m_measureCacheNext + 1) % MEASURE_CACHE_SIZE;
+    return size;
+}
+
+void Widget::layoutDirtyChildren() {
+    m_childNeedsLayout = false;
+    for (auto& child : m_children) {
+        if (child->needsLayout()) {
+            child->layout(child->m_lastAvailableSpace);
+        }
     }
 }
 
 void Widget::layout(const Rect& availableSpace) {
     if (!m_visible || m_style.display == Display::None) {
         m_bounds = Rect();
+        m_hasLayout = false;
         return;
     }
     
+    // Same constraints and nothing changed here: only dirty descendants move
+    if (!m_layoutDirty && m_hasLayout && availableSpace == m_lastAvailableSpace) {
+        if (m_childNeedsLayout) {
+            layoutDirtyChildren();
+        }
+        return;
+    }
+    
+    m_lastAvailableSpace = availableSpace;
+    m_hasLayout = true;
     Rect oldBounds = m_bounds;
     
     // Calculate dimensions
@@ -381,7 +469,7 @@ void Widget::layout(const Rect& availableSpace) {
     
     // Measure content if auto-sized
     if (m_style.width.isAuto() || m_style.height.isAuto()) {
-        Vec2 contentSize = measureContent(width, height);
+        Vec2 contentSize = measure(width, height);
         if (m_style.width.isAuto()) {
             width = contentSize.x + m_style.padding.horizontal();
         }
@@ -413,6 +501,7 @@ void Widget::layout(const Rect& availableSpace) {
     layoutChildren();
     
     m_layoutDirty = false;
+    m_childNeedsLayout = false;
     
     if (m_bounds.x != oldBounds.x || m_bounds.y != oldBounds.y ||
         m_bounds.width != oldBounds.width || m_bounds.height != oldBounds.height) {
@@ -423,7 +512,12 @@ void Widget::layout(const Rect& availableSpace) {
 void Widget::setVisible(bool visible) {
     if (m_visible != visible) {
         m_visible = visible;
+        adjustSubtreeCounts(0, visible ? 1 : -1);
         markLayoutDirty();
+        // Showing or hiding changes the space this widget takes in its parent
+        if (m_parent) {
+            m_parent->markLayoutDirty();
+        }
     }
 }
 
@@ -454,14 +548,21 @@ Widget* Widget::hitTest(Vec2 point) {
         return nullptr;
     }
     
+    if (Widget* hit = hitTestChildren(point)) {
+        return hit;
+    }
+    
+    return this;
+}
+
+Widget* Widget::hitTestChildren(Vec2 point) {
     // Check children in reverse order (front to back)
     for (auto it = m_children.rbegin(); it != m_children.rend(); ++it) {
         if (Widget* hit = (*it)->hitTest(point)) {
             return hit;
         }
     }
-    
-    return this;
+    return nullptr;
 }
 
 AnimationState& Widget::startAnimation(const PropertyAnimation& animation) {
@@ -487,6 +588,9 @@ void Widget::updateAnimations(f32 deltaTime) {
     for (auto& [anim, state] : m_animations) {
         if (!state.isPlaying) continue;
         
+        // Animated properties are visual only
+        markPaintDirty();
+        
         state.elapsed += deltaTime;
         
         // Calculate progress
@@ -586,6 +690,15 @@ void Widget::updateAnimations(f32 deltaTime) {
 void Widget::onStyleChanged() {}
 void Widget::onBoundsChanged() {}
 
+void Widget::paint(UIPainter& painter) const {
+    if (m_style.backgroundColor.a > 0.0f) {
+        painter.fillRect(m_bounds, m_style.backgroundColor);
+    }
+    if (m_style.border.width > 0.0f) {
+        painter.strokeRect(m_bounds, m_style.border.width, m_style.border.color);
+    }
+}
+
 Vec2 Widget::measureContent(f32 /*availableWidth*/, f32 /*availableHeight*/) {
     return Vec2(0, 0);
 }
@@ -711,10 +824,16 @@ void Container::layoutChildren() {
         if (cs.flexGrow > 0) {
             totalFlex += cs.flexGrow;
         } else {
-            // Measure fixed-size child
-            Vec2 size = child->measureContent(mainAxisSize, crossAxisSize);
-            f32 fixedSize = isRow ? size.x : size.y;
-            fixedSize += cs.margin.horizontal() + cs.padding.horizontal();
+            // Explicit sizes are used as-is; only auto-sized children are measured
+            const Dimension& mainDimension = isRow ? cs.width : cs.height;
+            f32 fixedSize = isRow ? cs.margin.horizontal() : cs.margin.vertical();
+            if (!mainDimension.isAuto()) {
+                fixedSize += mainDimension.resolve(mainAxisSize);
+            } else {
+                Vec2 size = isRow ? child->measure(mainAxisSize, crossAxisSize)
+                                  : child->measure(crossAxisSize, mainAxisSize);
+                fixedSize += isRow ? size.x + cs.padding.horizontal() : size.y + cs.padding.vertical();
+            }
             totalFixed += fixedSize;
             childMainSizes[i] = fixedSize;
         }
@@ -794,42 +913,13 @@ void Label::setText(const std::string& text) {
 }
 
 Vec2 Label::measureContent(f32 availableWidth, f32 /*availableHeight*/) {
-    // Simplified text measurement (would use actual font metrics)
-    f32 fontSize = m_style.text.fontSize;
-    f32 charWidth = fontSize * 0.6f;  // Approximate
-    f32 lineHeight = fontSize * m_style.text.lineHeight;
-    
-    if (m_text.empty()) {
-        return Vec2(0, lineHeight);
-    }
-    
-    // Calculate text bounds
-    f32 maxLineWidth = availableWidth > 0 ? availableWidth : 100000.0f;
-    f32 currentLineWidth = 0.0f;
-    u32 lineCount = 1;
-    
-    for (char c : m_text) {
-        if (c == '\n') {
-            lineCount++;
-            currentLineWidth = 0;
-            continue;
-        }
-        
-        currentLineWidth += charWidth;
-        if (currentLineWidth > maxLineWidth) {
-            lineCount++;
-            currentLineWidth = charWidth;
-        }
-    }
-    
-    if (m_maxLines > 0 && lineCount > m_maxLines) {
-        lineCount = m_maxLines;
-    }
-    
-    f32 width = std::min(static_cast<f32>(m_text.length()) * charWidth, maxLineWidth);
-    f32 height = static_cast<f32>(lineCount) * lineHeight;
-    
-    return Vec2(width, height);
+    // Shaped runs are cached by TextShaper; only line breaking runs here
+    return TextShaper::get().layout(m_text, m_style.text, availableWidth, m_maxLines).size;
+}
+
+void Label::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    painter.drawText(getContentBounds(), m_text, m_style.text, m_maxLines);
 }
 
 // ============================================================================
@@ -882,16 +972,20 @@ void Button::onPointerLeave(const PointerEvent& event) {
     Widget::onPointerLeave(event);
 }
 
-Vec2 Button::measureContent(f32 availableWidth, f32 availableHeight) {
-    f32 fontSize = m_style.text.fontSize;
-    f32 charWidth = fontSize * 0.6f;
-    f32 textWidth = static_cast<f32>(m_text.length()) * charWidth;
-    f32 textHeight = fontSize * m_style.text.lineHeight;
-    
-    (void)availableWidth;
-    (void)availableHeight;
+Vec2 Button::measureContent(f32 /*availableWidth*/, f32 /*availableHeight*/) {
+    return TextShaper::get().layout(m_text, m_style.text, 0.0f, 1).size;
+}
+
+void Button::paint(UIPainter& painter) const {
+    Widget::paint(painter);
     
-    return Vec2(textWidth, textHeight);
+    // Single line, centred in the content box
+    Rect content = getContentBounds();
+    f32 textHeight = m_style.text.fontSize * m_style.text.lineHeight;
+    TextStyle text = m_style.text;
+    text.textAlign = TextAlign::Center;
+    painter.drawText(Rect(content.x, content.y + (content.height - textHeight) * 0.5f, content.width, textHeight),
+                     m_text, text, 1);
 }
 
 // ============================================================================
@@ -1045,6 +1139,13 @@ Vec2 Image::measureContent(f32 availableWidth, f32 availableHeight) {
     return m_naturalSize;
 }
 
+void Image::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    if (!m_source.empty()) {
+        painter.drawImage(getContentBounds(), m_source);
+    }
+}
+
 // ============================================================================
 // TextInput Implementation
 // ============================================================================
@@ -1062,6 +1163,7 @@ void TextInput::setValue(const std::string& value) {
     if (m_value != value) {
         m_value = value;
         m_cursorPosition = value.length();
+        markPaintDirty();
         if (m_onChange) {
             m_onChange(value);
         }
@@ -1077,6 +1179,8 @@ bool TextInput::onPointerDown(const PointerEvent& event) {
 bool TextInput::onKeyDown(const KeyEvent& event) {
     if (!m_focused) return false;
     
+    markPaintDirty();
+    
     if (event.key == "Backspace" && m_cursorPosition > 0) {
         m_value.erase(m_cursorPosition - 1, 1);
         m_cursorPosition--;
@@ -1106,11 +1210,13 @@ bool TextInput::onKeyDown(const KeyEvent& event) {
 void TextInput::onFocus(const FocusEvent& event) {
     Widget::onFocus(event);
     m_style.border.color = Color::fromHex(0x6200EE);
+    markPaintDirty();
 }
 
 void TextInput::onBlur(const FocusEvent& event) {
     Widget::onBlur(event);
     m_style.border.color = Color::fromHex(0xCCCCCC);
+    markPaintDirty();
 }
 
 Vec2 TextInput::measureContent(f32 /*availableWidth*/, f32 /*availableHeight*/) {
@@ -1124,6 +1230,20 @@ Vec2 TextInput::measureContent(f32 /*availableWidth*/, f32 /*availableHeight*/)
     return Vec2(DEFAULT_TEXT_INPUT_MIN_WIDTH, height);
 }
 
+void TextInput::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    
+    TextStyle text = m_style.text;
+    if (m_value.empty()) {
+        text.color = Color::fromHex(0x999999);
+        painter.drawText(getContentBounds(), m_placeholder, text, m_multiline ? 0 : 1);
+    } else if (m_isPassword) {
+        painter.drawText(getContentBounds(), std::string(m_value.size(), '*'), text, 1);
+    } else {
+        painter.drawText(getContentBounds(), m_value, text, m_multiline ? 0 : 1);
+    }
+}
+
 // ============================================================================
 // ScrollView Implementation
 // ============================================================================
@@ -1141,7 +1261,10 @@ void ScrollView::setScrollOffset(Vec2 offset) {
     if (!m_horizontalEnabled) offset.x = 0;
     if (!m_verticalEnabled) offset.y = 0;
     
-    m_scrollOffset = offset;
+    if (offset.x != m_scrollOffset.x || offset.y != m_scrollOffset.y) {
+        m_scrollOffset = offset;
+        markLayoutDirty();
+    }
 }
 
 void ScrollView::scrollTo(Vec2 position, bool /*animated*/) {
@@ -1226,6 +1349,210 @@ bool ScrollView::onPointerUp(const PointerEvent& event) {
     return Widget::onPointerUp(event);
 }
 
+// ============================================================================
+// ListView Implementation
+// ============================================================================
+
+void ListView::setRowFactory(RowFactory factory) {
+    m_factory = std::move(factory);
+    clearChildren();
+    m_rowItems.clear();
+    m_firstBound = 0;
+    m_endBound = 0;
+    markLayoutDirty();
+}
+
+void ListView::setItemCount(usize count) {
+    m_itemCount = count;
+    rebuildOffsets();
+    invalidateRows();
+}
+
+void ListView::setRowHeight(f32 height) {
+    m_rowHeight = std::max(height, 1.0f);
+    rebuildOffsets();
+    markLayoutDirty();
+}
+
+void ListView::setRowHeightProvider(RowHeightProvider provider) {
+    m_heightProvider = std::move(provider);
+    rebuildOffsets();
+    markLayoutDirty();
+}
+
+void ListView::notifyDataChanged() {
+    rebuildOffsets();
+    invalidateRows();
+}
+
+void ListView::notifyItemChanged(usize index) {
+    if (index >= m_itemCount) return;
+    
+    if (m_heightProvider) {
+        // Shift everything below by the height delta instead of re-querying all rows
+        f32 delta = getRowHeight(index) - (m_offsets[index + 1] - m_offsets[index]);
+        if (delta != 0.0f) {
+            for (usize i = index + 1; i < m_offsets.size(); ++i) {
+                m_offsets[i] += delta;
+            }
+            m_contentSize.y = m_offsets.back();
+        }
+    }
+    
+    if (Widget* row = getRowForItem(index); row && m_binder) {
+        m_binder(*row, index);
+    }
+    markLayoutDirty();
+}
+
+f32 ListView::getRowHeight(usize index) const {
+    return m_heightProvider ? std::max(m_heightProvider(index), 0.0f) : m_rowHeight;
+}
+
+f32 ListView::getItemOffset(usize index) const {
+    index = std::min(index, m_itemCount);
+    return m_heightProvider ? m_offsets[index] : static_cast<f32>(index) * m_rowHeight;
+}
+
+usize ListView::getItemAt(f32 contentY) const {
+    if (contentY < 0.0f || contentY >= getItemOffset(m_itemCount)) {
+        return NO_ITEM;
+    }
+    if (!m_heightProvider) {
+        return std::min(static_cast<usize>(contentY / m_rowHeight), m_itemCount - 1);
+    }
+    auto it = std::upper_bound(m_offsets.begin(), m_offsets.end(), contentY);
+    return static_cast<usize>(it - m_offsets.begin()) - 1;
+}
+
+Widget* ListView::getRowForItem(usize index) const {
+    for (usize i = 0; i < m_rowItems.size(); ++i) {
+        if (m_rowItems[i] == index) {
+            return m_children[i].get();
+        }
+    }
+    return nullptr;
+}
+
+void ListView::scrollToItem(usize index, bool animated) {
+    if (index >= m_itemCount) return;
+    
+    f32 top = getItemOffset(index);
+    f32 bottom = top + getRowHeight(index);
+    f32 viewHeight = getContentBounds().height;
+    
+    Vec2 target = m_scrollOffset;
+    if (top < m_scrollOffset.y) {
+        target.y = top;
+    } else if (bottom > m_scrollOffset.y + viewHeight) {
+        target.y = bottom - viewHeight;
+    }
+    scrollTo(target, animated);
+}
+
+void ListView::rebuildOffsets() {
+    if (m_heightProvider) {
+        m_offsets.resize(m_itemCount + 1);
+        m_offsets[0] = 0.0f;
+        for (usize i = 0; i < m_itemCount; ++i) {
+            m_offsets[i + 1] = m_offsets[i] + getRowHeight(i);
+        }
+    } else {
+        m_offsets.clear();
+    }
+    m_contentSize.y = getItemOffset(m_itemCount);
+}
+
+void ListView::invalidateRows() {
+    std::fill(m_rowItems.begin(), m_rowItems.end(), NO_ITEM);
+    m_firstBound = 0;
+    m_endBound = 0;
+    markLayoutDirty();
+}
+
+Vec2 ListView::measureContent(f32 availableWidth, f32 availableHeight) {
+    f32 total = getItemOffset(m_itemCount);
+    return Vec2(availableWidth, availableHeight > 0 ? std::min(total, availableHeight) : total);
+}
+
+void ListView::layoutChildren() {
+    Rect contentBounds = getContentBounds();
+    f32 total = getItemOffset(m_itemCount);
+    m_contentSize = Vec2(contentBounds.width, total);
+    m_scrollOffset.y = std::max(0.0f, std::min(m_scrollOffset.y, total - m_bounds.height));
+    
+    // Visible window plus overscan
+    usize first = 0;
+    usize end = 0;
+    if (m_factory && m_itemCount > 0 && contentBounds.height > 0) {
+        first = getItemAt(m_scrollOffset.y);
+        if (first == NO_ITEM) first = 0;
+        end = first;
+        f32 viewBottom = m_scrollOffset.y + contentBounds.height;
+        while (end < m_itemCount && getItemOffset(end) < viewBottom) {
+            ++end;
+        }
+        first = first > m_overscan ? first - m_overscan : 0;
+        end = std::min(m_itemCount, end + m_overscan);
+    }
+    
+    // Release rows that left the window; rows still inside keep their binding
+    std::vector<bool> bound(end - first, false);
+    for (usize& item : m_rowItems) {
+        if (item != NO_ITEM && (item < first || item >= end)) {
+            item = NO_ITEM;
+        } else if (item != NO_ITEM) {
+            bound[item - first] = true;
+        }
+    }
+    
+    // Grow the pool to cover the window
+    while (m_children.size() < end - first) {
+        auto row = m_factory();
+        if (!row) break;
+        addChild(std::move(row));
+        m_rowItems.push_back(NO_ITEM);
+    }
+    
+    // Bind free rows to uncovered items
+    usize freeRow = 0;
+    for (usize item = first; item < end; ++item) {
+        if (bound[item - first]) continue;
+        while (freeRow < m_rowItems.size() && m_rowItems[freeRow] != NO_ITEM) {
+            ++freeRow;
+        }
+        if (freeRow == m_rowItems.size()) break;
+        m_rowItems[freeRow] = item;
+        if (m_binder) {
+            m_binder(*m_children[freeRow], item);
+        }
+    }
+    
+    for (usize i = 0; i < m_children.size(); ++i) {
+        Widget& row = *m_children[i];
+        usize item = m_rowItems[i];
+        row.setVisible(item != NO_ITEM);
+        if (item == NO_ITEM) continue;
+        
+        row.layout(Rect(contentBounds.x - m_scrollOffset.x,
+                        contentBounds.y - m_scrollOffset.y + getItemOffset(item),
+                        contentBounds.width, getRowHeight(item)));
+    }
+    
+    m_firstBound = first;
+    m_endBound = end;
+}
+
+Widget* ListView::hitTestChildren(Vec2 point) {
+    Rect contentBounds = getContentBounds();
+    usize item = getItemAt(point.y - contentBounds.y + m_scrollOffset.y);
+    if (item == NO_ITEM) {
+        return nullptr;
+    }
+    Widget* row = getRowForItem(item);
+    return row ? row->hitTest(point) : nullptr;
+}
+
 // ============================================================================
 // Checkbox Implementation
 // ============================================================================
@@ -1240,6 +1567,7 @@ void Checkbox::setChecked(bool checked) {
     if (m_checked != checked) {
         m_checked = checked;
         m_accessibility.isChecked = checked;
+        markPaintDirty();
         if (m_onChange) {
             m_onChange(checked);
         }
@@ -1264,15 +1592,32 @@ bool Checkbox::onKeyDown(const KeyEvent& event) {
 
 Vec2 Checkbox::measureContent(f32 /*availableWidth*/, f32 /*availableHeight*/) {
     f32 checkboxSize = 20.0f;
-    f32 fontSize = m_style.text.fontSize;
-    f32 charWidth = fontSize * 0.6f;
+    Vec2 text = TextShaper::get().layout(m_label, m_style.text, 0.0f, 1).size;
     
-    f32 width = checkboxSize + 8.0f + static_cast<f32>(m_label.length()) * charWidth;
-    f32 height = std::max(checkboxSize, fontSize * m_style.text.lineHeight);
+    f32 width = checkboxSize + 8.0f + text.x;
+    f32 height = std::max(checkboxSize, text.y);
     
     return Vec2(width, height);
 }
 
+void Checkbox::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    
+    constexpr f32 checkboxSize = 20.0f;
+    Rect content = getContentBounds();
+    Rect box(content.x, content.y + (content.height - checkboxSize) * 0.5f, checkboxSize, checkboxSize);
+    painter.strokeRect(box, 2.0f, m_style.text.color);
+    if (m_checked) {
+        painter.fillRect(Rect(box.x + 5.0f, box.y + 5.0f, box.width - 10.0f, box.height - 10.0f),
+                         Color::fromHex(0x6200EE));
+    }
+    
+    f32 textHeight = m_style.text.fontSize * m_style.text.lineHeight;
+    painter.drawText(Rect(box.right() + 8.0f, content.y + (content.height - textHeight) * 0.5f,
+                          content.right() - box.right() - 8.0f, textHeight),
+                     m_label, m_style.text, 1);
+}
+
 // ============================================================================
 // Slider Implementation
 // ============================================================================
@@ -1295,6 +1640,7 @@ void Slider::setValue(f32 value) {
     if (m_value != value) {
         m_value = value;
         m_accessibility.value = std::to_string(value);
+        markPaintDirty();
         if (m_onChange) {
             m_onChange(value);
         }
@@ -1326,6 +1672,22 @@ Vec2 Slider::measureContent(f32 availableWidth, f32 /*availableHeight*/) {
     return Vec2(availableWidth > 0 ? availableWidth : 200.0f, 24.0f);
 }
 
+void Slider::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    
+    // Track, filled portion and thumb (16px, matching updateValueFromPosition)
+    f32 range = m_max - m_min;
+    f32 t = range > 0.0f ? (m_value - m_min) / range : 0.0f;
+    f32 trackX = m_bounds.x + 8.0f;
+    f32 trackWidth = std::max(0.0f, m_bounds.width - 16.0f);
+    f32 centerY = m_bounds.y + m_bounds.height * 0.5f;
+    f32 thumbX = trackX + trackWidth * t;
+    
+    painter.fillRect(Rect(trackX, centerY - 2.0f, trackWidth, 4.0f), Color::fromHex(0xCCCCCC));
+    painter.fillRect(Rect(trackX, centerY - 2.0f, thumbX - trackX, 4.0f), Color::fromHex(0x6200EE));
+    painter.fillRect(Rect(thumbX - 8.0f, centerY - 8.0f, 16.0f, 16.0f), Color::fromHex(0x6200EE));
+}
+
 void Slider::updateValueFromPosition(Vec2 position) {
     f32 trackWidth = m_bounds.width - 16.0f;  // Subtract thumb width
     f32 relativeX = position.x - m_bounds.x - 8.0f;  // Half thumb width
@@ -1350,6 +1712,7 @@ ProgressBar::ProgressBar() {
 
 void ProgressBar::setProgress(f32 progress) {
     m_progress = std::max(0.0f, std::min(1.0f, progress));
+    markPaintDirty();
     m_accessibility.value = std::to_string(static_cast<int>(m_progress * 100)) + "%";
 }
 
@@ -1357,6 +1720,14 @@ Vec2 ProgressBar::measureContent(f32 availableWidth, f32 /*availableHeight*/) {
     return Vec2(availableWidth > 0 ? availableWidth : 200.0f, 8.0f);
 }
 
+void ProgressBar::paint(UIPainter& painter) const {
+    Widget::paint(painter);
+    if (!m_indeterminate) {
+        painter.fillRect(Rect(m_bounds.x, m_bounds.y, m_bounds.width * m_progress, m_bounds.height),
+                         Color::fromHex(0x6200EE));
+    }
+}
+
 // ============================================================================
 // UISystem Implementation
 // ============================================================================
@@ -1402,6 +1773,7 @@ void UISystem::shutdown() {
     m_pressedWidget = nullptr;
     m_root.reset();
     m_widgetRegistry.clear();
+    m_drawList.clear();
     
     m_initialized = false;
     
@@ -1416,8 +1788,8 @@ void UISystem::update(f32 deltaTime) {
     // Update animations
     m_root->updateAnimations(deltaTime);
     
-    // Perform layout if needed
-    if (m_root->isLayoutDirty()) {
+    // Perform layout if anything in the tree changed
+    if (m_root->needsLayout()) {
         performLayout();
     }
 }
@@ -1434,18 +1806,13 @@ void UISystem::performLayout() {
     
     auto endTime = std::chrono::high_resolution_clock::now();
     m_lastLayoutTimeMs = std::chrono::duration<f32, std::milli>(endTime - startTime).count();
+    static auto& layoutTime = profiling::MetricsRegistry::get().histogram(
+        "ui.layout", "UI layout pass duration");
+    layoutTime.record(endTime - startTime);
     
-    // Count widgets
-    m_widgetCount = 0;
-    m_visibleWidgetCount = 0;
-    std::vector<Widget*> allWidgets;
-    collectWidgets(m_root.get(), allWidgets);
-    m_widgetCount = static_cast<u32>(allWidgets.size());
-    for (Widget* w : allWidgets) {
-        if (w->isVisible()) {
-            m_visibleWidgetCount++;
-        }
-    }
+    // Counts are maintained incrementally as widgets are added, removed and shown
+    m_widgetCount = m_root->m_subtreeWidgets;
+    m_visibleWidgetCount = m_root->m_subtreeVisible;
 }
 
 void UISystem::setScreenSize(f32 width, f32 height) {
@@ -1638,6 +2005,11 @@ Widget* UISystem::hitTest(Vec2 screenPosition) {
     return m_root ? m_root->hitTest(screenPosition) : nullptr;
 }
 
+const UIDrawList& UISystem::buildDrawList() {
+    m_drawList.build(m_root.get());
+    return m_drawList;
+}
+
 std::vector<Widget*> UISystem::getWidgetsToRender() const {
     std::vector<Widget*> widgets;
     if (m_root) {
@@ -7,6 +7,7 @@
  */
 
 #include <nova/platform/application.hpp>
+#include <nova/core/memory/memory.hpp>
 
 #include <chrono>
 #include <thread>
@@ -171,6 +172,9 @@ int Application::run() {
         }
         
         m_frameInfo.frameNumber++;
+        
+        // Recycle per-thread frame scratch memory
+        memory::FrameMemory::endFrame();
     }
     
     return m_exitCode;
@@ -10,6 +10,9 @@
 #include <catch2/catch_approx.hpp>
 #include <nova/core/animation/animation.hpp>
 
+#include <filesystem>
+#include <fstream>
+
 using namespace nova;
 using namespace nova::animation;
 using namespace nova::math;
@@ -558,6 +561,142 @@ TEST_CASE("Animation System - Update", "[animation][system]") {
     system.shutdown();
 }
 
+// ============================================================================
+// Cooked Animation Tests
+// ============================================================================
+
+namespace {
+
+SkeletonData makeArmSkeleton() {
+    SkeletonData data;
+    data.name = "Arm";
+    const char* names[] = {"Shoulder", "Elbow", "Wrist"};
+    for (i32 i = 0; i < 3; ++i) {
+        BoneInfo bone;
+        bone.name = names[i];
+        bone.parentIndex = i - 1;
+        bone.bindPose.position = Vec3(0.0f, static_cast<f32>(i), 0.0f);
+        bone.bindPose.rotation = Quat(0.0f, 0.0f, 0.6f, 0.8f);
+        bone.inverseBindMatrix = Mat4::translate(Vec3(0.0f, -static_cast<f32>(i), 0.0f));
+        data.boneNameToIndex[bone.name] = i;
+        data.bones.push_back(bone);
+    }
+    return data;
+}
+
+} // namespace
+
+TEST_CASE("Cooked Animation - Skeleton round trip", "[animation][cooked]") {
+    auto blob = cookSkeleton(makeArmSkeleton());
+    REQUIRE(blob.has_value());
+
+    auto skeleton = CookedSkeleton::view(*blob);
+    REQUIRE(skeleton.has_value());
+    REQUIRE(skeleton->getName() == "Arm");
+    REQUIRE(skeleton->getBones().size() == 3);
+    REQUIRE(skeleton->findBone("Wrist") == 2);
+    REQUIRE(skeleton->findBone("Shoulder") == 0);
+    REQUIRE(skeleton->findBone("Finger") == -1);
+
+    SkeletonData data = skeleton->unpack();
+    REQUIRE(data.bones[2].parentIndex == 1);
+    REQUIRE(data.bones[1].bindPose.position.y == 1.0f);
+    REQUIRE(data.bones[1].bindPose.rotation.w == 0.8f);
+    REQUIRE(data.bones[2].inverseBindMatrix.columns[3].y == -2.0f);
+    REQUIRE(data.findBone("Elbow") == 1);
+
+    SECTION("Corrupt blobs are rejected") {
+        std::vector<u8> truncated(blob->begin(), blob->end() - 1);
+        REQUIRE_FALSE(CookedSkeleton::view(truncated).has_value());
+
+        auto badParent = *blob;
+        auto* header = reinterpret_cast<CookedSkeletonHeader*>(badParent.data());
+        reinterpret_cast<CookedBone*>(badParent.data() + header->bonesOffset)[0].parentIndex = 2;
+        REQUIRE_FALSE(CookedSkeleton::view(badParent).has_value());
+    }
+
+    SECTION("Children must follow their parents") {
+        SkeletonData unordered = makeArmSkeleton();
+        unordered.bones[0].parentIndex = 2;
+        REQUIRE_FALSE(cookSkeleton(unordered).has_value());
+    }
+}
+
+TEST_CASE("Cooked Animation - Clip keys are sorted", "[animation][cooked]") {
+    AnimationClipData clip;
+    clip.name = "Wave";
+
+    AnimationChannel wrist;
+    wrist.boneIndex = 2;
+    wrist.boneName = "Wrist";
+    wrist.positionKeys.push_back({1.0f, Vec3(0.0f, 1.0f, 0.0f), InterpolationMode::Linear, {}, {}});
+    wrist.positionKeys.push_back({0.0f, Vec3(), InterpolationMode::Step, {}, {}});
+    wrist.rotationKeys.push_back({0.5f, Quat(), InterpolationMode::Linear});
+    AnimationChannel shoulder;
+    shoulder.boneIndex = 0;
+    shoulder.boneName = "Shoulder";
+    shoulder.scaleKeys.push_back({2.0f, Vec3(2.0f, 2.0f, 2.0f), InterpolationMode::Linear, {}, {}});
+    clip.channels = {wrist, shoulder};
+
+    AnimationEvent footstep;
+    footstep.time = 0.25f;
+    footstep.name = "Footstep";
+    footstep.stringParam = "grass";
+    clip.events.push_back(footstep);
+
+    auto blob = cookClip(clip);
+    REQUIRE(blob.has_value());
+    auto cooked = CookedClip::view(*blob);
+    REQUIRE(cooked.has_value());
+    REQUIRE(cooked->getHeader().duration == 2.0f);
+
+    // Channels by bone, keys by time
+    auto channels = cooked->getChannels();
+    REQUIRE(channels.size() == 2);
+    REQUIRE(cooked->getBoneName(channels[0]) == "Shoulder");
+    auto keys = cooked->getPositionKeys(channels[1]);
+    REQUIRE(keys.size() == 2);
+    REQUIRE(keys[0].time == 0.0f);
+    REQUIRE(keys[0].interpolation == static_cast<u32>(InterpolationMode::Step));
+
+    AnimationClipData data = cooked->unpack();
+    REQUIRE(data.channels[1].boneName == "Wrist");
+    REQUIRE(data.channels[1].positionKeys[1].position.y == 1.0f);
+    REQUIRE(data.channels[0].scaleKeys[0].scale.x == 2.0f);
+    REQUIRE(data.events[0].stringParam == "grass");
+}
+
+TEST_CASE("Animation System - Loads cooked files", "[animation][cooked]") {
+    auto dir = std::filesystem::temp_directory_path() / "nova_test_cooked_animation";
+    std::filesystem::create_directories(dir);
+    auto write = [&](const char* name, const std::vector<u8>& bytes) {
+        std::ofstream(dir / name, std::ios::binary)
+            .write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        return (dir / name).string();
+    };
+
+    AnimationClipData clip;
+    clip.name = "Idle";
+    clip.duration = 3.0f;
+    auto skeletonPath = write("arm.nvskel", *cookSkeleton(makeArmSkeleton()));
+    auto clipPath = write("idle.nvanim", *cookClip(clip));
+
+    auto& system = AnimationSystem::get();
+    system.initialize();
+
+    auto skeleton = system.loadSkeleton(skeletonPath);
+    REQUIRE(skeleton.isValid());
+    REQUIRE(system.getSkeleton(skeleton)->findBone("Wrist") == 2);
+
+    auto loaded = system.loadClip(clipPath);
+    REQUIRE(loaded.isValid());
+    REQUIRE(system.getClip(loaded)->name == "Idle");
+    REQUIRE(system.getClip(loaded)->duration == 3.0f);
+
+    system.shutdown();
+    std::filesystem::remove_all(dir);
+}
+
 // ============================================================================
 // IK Solver Tests - Comprehensive Coverage for All IK Types
 // ============================================================================
@@ -735,6 +735,31 @@ TEST_CASE("Stress test: Many entities", "[ecs][stress]") {
         
         REQUIRE(world.entityCount() == 0);
     }
+
+    SECTION("Destroy entities spanning many chunks") {
+        std::vector<Entity> entities;
+        for (int i = 0; i < ENTITY_COUNT; ++i) {
+            entities.push_back(world.createEntity(
+                Position{static_cast<f32>(i), 0.0f, 0.0f},
+                Velocity{1.0f, 0.0f, 0.0f}
+            ));
+        }
+
+        // Emptying early chunks must not invalidate locations in later ones
+        for (int i = 0; i < ENTITY_COUNT / 2; ++i) {
+            world.destroyEntity(entities[i]);
+        }
+        for (int i = ENTITY_COUNT / 2; i < ENTITY_COUNT; ++i) {
+            auto* pos = world.getComponent<Position>(entities[i]);
+            REQUIRE(pos != nullptr);
+            REQUIRE(pos->x == static_cast<f32>(i));
+        }
+        for (int i = ENTITY_COUNT / 2; i < ENTITY_COUNT; ++i) {
+            world.destroyEntity(entities[i]);
+        }
+
+        REQUIRE(world.entityCount() == 0);
+    }
 }
 
 // ============================================================================
@@ -7,8 +7,12 @@
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <array>
+#include <condition_variable>
+#include <memory>
 #include <sstream>
 #include <thread>
+#include <vector>
 
 #include "nova/core/logging/logging.hpp"
 
@@ -125,6 +129,235 @@ TEST_CASE("Logger category filtering", "[logging][logger]") {
     logger.setLevel(LogLevel::Info);
 }
 
+// =============================================================================
+// Async Logger Tests
+// =============================================================================
+
+namespace {
+
+/// Sink that records messages; can hold the backend inside write()
+class CaptureSink final : public LogSink {
+public:
+    void write(const LogMessage& msg) override {
+        std::unique_lock lock(m_mutex);
+        m_gateCv.wait(lock, [this] { return m_gateOpen; });
+        messages.push_back(msg);
+    }
+    void flush() override {}
+    [[nodiscard]] const char* getName() const noexcept override { return "Capture"; }
+    
+    void closeGate() { std::lock_guard lock(m_mutex); m_gateOpen = false; }
+    void openGate() {
+        { std::lock_guard lock(m_mutex); m_gateOpen = true; }
+        m_gateCv.notify_all();
+    }
+    
+    std::vector<LogMessage> messages;
+    
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_gateCv;
+    bool m_gateOpen = true;
+};
+
+} // anonymous namespace
+
+TEST_CASE("Async logger delivers formatted messages in per-thread order", "[logging][async]") {
+    auto& logger = Logger::instance();
+    CaptureSink sink;
+    logger.addSink(&sink);
+    logger.startAsync();
+    REQUIRE(logger.isAsync());
+    
+    constexpr int THREADS = 4;
+    constexpr int MESSAGES = 500;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < THREADS; ++t) {
+        threads.emplace_back([t, &logger] {
+            std::string tag = "worker" + std::to_string(t);
+            for (int i = 0; i < MESSAGES; ++i) {
+                logger.logFmt(LogLevel::Info, LogCategory::Core, "{} {} {}", tag, i, 0.5f);
+            }
+        });
+    }
+    for (auto& thread : threads) thread.join();
+    logger.flush();
+    
+    REQUIRE(sink.messages.size() == THREADS * MESSAGES);
+    std::array<int, THREADS> next{};
+    for (const auto& msg : sink.messages) {
+        int t = msg.message[6] - '0';
+        REQUIRE(msg.message == std::format("worker{} {} {}", t, next[t], 0.5f));
+        ++next[t];
+    }
+    
+    logger.log(LogLevel::Warning, LogCategory::Core, "preformatted");
+    logger.stopAsync();
+    REQUIRE_FALSE(logger.isAsync());
+    REQUIRE(sink.messages.back().message == "preformatted");
+    REQUIRE(sink.messages.back().line != 0);
+    
+    auto stats = logger.getAsyncStats();
+    REQUIRE(stats.dropped == 0);
+    REQUIRE(stats.processed >= THREADS * MESSAGES + 1);
+    
+    logger.removeSink(&sink);
+}
+
+TEST_CASE("Async logger overflow policies", "[logging][async]") {
+    auto& logger = Logger::instance();
+    CaptureSink sink;
+    logger.addSink(&sink);
+    
+    auto runOverflow = [&](LogOverflowPolicy policy) {
+        sink.messages.clear();
+        AsyncLogConfig config;
+        config.bufferSize = 1024;
+        config.overflowPolicy = policy;
+        logger.startAsync(config);
+        
+        // Hold the backend inside the sink so the ring fills up
+        sink.closeGate();
+        logger.logFmt(LogLevel::Info, LogCategory::Core, "first");
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        
+        u64 droppedBefore = logger.getAsyncStats().dropped;
+        for (int i = 0; i < 200; ++i) {
+            logger.logFmt(LogLevel::Info, LogCategory::Core, "message {}", i);
+        }
+        u64 dropped = logger.getAsyncStats().dropped - droppedBefore;
+        
+        sink.openGate();
+        logger.stopAsync();
+        return dropped;
+    };
+    
+    SECTION("Drop discards silently") {
+        u64 dropped = runOverflow(LogOverflowPolicy::Drop);
+        REQUIRE(dropped > 0);
+        REQUIRE(sink.messages.size() == 201 - dropped);
+    }
+    
+    SECTION("Count reports the loss") {
+        u64 dropped = runOverflow(LogOverflowPolicy::Count);
+        REQUIRE(dropped > 0);
+        REQUIRE(sink.messages.size() == 201 - dropped + 1);
+        REQUIRE(sink.messages.back().level == LogLevel::Warning);
+        REQUIRE(sink.messages.back().message.find(std::to_string(dropped)) != std::string::npos);
+    }
+    
+    logger.removeSink(&sink);
+}
+
+TEST_CASE("Async logger stops while a blocked writer waits for space", "[logging][async]") {
+    auto& logger = Logger::instance();
+    CaptureSink sink;
+    logger.addSink(&sink);
+    
+    AsyncLogConfig config;
+    config.bufferSize = 1024;
+    config.overflowPolicy = LogOverflowPolicy::Block;
+    logger.startAsync(config);
+    AsyncLogStats before = logger.getAsyncStats();
+    
+    // The backend is held in the sink while the writer fills its ring and blocks
+    sink.closeGate();
+    constexpr int MESSAGES = 400;
+    std::thread writer([&logger] {
+        for (int i = 0; i < MESSAGES; ++i) {
+            logger.logFmt(LogLevel::Info, LogCategory::Core, "message {}", i);
+        }
+    });
+    while (logger.getAsyncStats().blocked == before.blocked) {
+        std::this_thread::yield();
+    }
+    
+    std::thread stopper([&logger] { logger.stopAsync(); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    sink.openGate();
+    
+    stopper.join();
+    writer.join();
+    REQUIRE_FALSE(logger.isAsync());
+    
+    // Every message was either delivered or counted as dropped
+    u64 dropped = logger.getAsyncStats().dropped - before.dropped;
+    REQUIRE(sink.messages.size() + dropped == MESSAGES);
+    logger.removeSink(&sink);
+}
+
+TEST_CASE("Async logger restarts while threads are logging", "[logging][async]") {
+    auto& logger = Logger::instance();
+    CaptureSink sink;
+    logger.addSink(&sink);
+    
+    std::atomic<bool> done{false};
+    std::thread writer([&] {
+        for (int i = 0; !done.load(std::memory_order_relaxed); ++i) {
+            logger.logFmt(LogLevel::Info, LogCategory::Core, "message {}", i);
+        }
+    });
+    
+    // Each session changes the ring size and policy under the running writer
+    for (int session = 0; session < 20; ++session) {
+        AsyncLogConfig config;
+        config.bufferSize = session % 2 ? 1024 : 4096;
+        config.overflowPolicy = session % 2 ? LogOverflowPolicy::Drop : LogOverflowPolicy::Block;
+        logger.startAsync(config);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        logger.stopAsync();
+    }
+    
+    done = true;
+    writer.join();
+    REQUIRE_FALSE(logger.isAsync());
+    logger.removeSink(&sink);
+}
+
+TEST_CASE("Async logger throughput", "[.][benchmark][logging][async]") {
+    auto& logger = Logger::instance();
+    
+    /// Discards messages so only the logging path is measured
+    class NullSink final : public LogSink {
+    public:
+        void write(const LogMessage&) override {}
+        void flush() override {}
+        [[nodiscard]] const char* getName() const noexcept override { return "Null"; }
+    } sink;
+    logger.addSink(&sink);
+    
+    constexpr int MESSAGES = 200000;
+    for (int threadCount : {1, 2, 4, 8}) {
+        for (bool async : {false, true}) {
+            if (async) {
+                // Large rings so producers rarely wait on the backend
+                AsyncLogConfig config;
+                config.bufferSize = 16 * 1024 * 1024;
+                logger.startAsync(config);
+            }
+            
+            std::vector<std::thread> threads;
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < threadCount; ++t) {
+                threads.emplace_back([&logger] {
+                    for (int i = 0; i < MESSAGES; ++i) {
+                        logger.logFmt(LogLevel::Info, LogCategory::Game, "frame {} value {}", i, 1.25);
+                    }
+                });
+            }
+            for (auto& thread : threads) thread.join();
+            f64 seconds = std::chrono::duration<f64>(std::chrono::steady_clock::now() - start).count();
+            
+            if (async) logger.stopAsync();
+            
+            WARN(std::format("{} x{}: {:.0f} msgs/sec per thread",
+                             async ? "async" : "sync ", threadCount, MESSAGES / seconds));
+        }
+    }
+    
+    logger.removeSink(&sink);
+}
+
 // =============================================================================
 // Timer Tests
 // =============================================================================
@@ -246,6 +479,180 @@ TEST_CASE("Zone color constants", "[profiling][zone]") {
     REQUIRE(render.b == 100);
 }
 
+// =============================================================================
+// Profiler Capture Tests
+// =============================================================================
+
+TEST_CASE("Profiler capture records zones, counters and frames", "[profiling][capture]") {
+    auto& profiler = Profiler::instance();
+    REQUIRE_FALSE(Profiler::isCapturing());
+    
+    // Nothing is recorded while capture is off
+    Profiler::counter("Ignored", 1);
+    
+    profiler.startCapture();
+    REQUIRE(Profiler::isCapturing());
+    profiler.setThreadName("Main \"thread\"");
+    
+    u64 start = ticks();
+    Profiler::zone("Update", ZoneColor::core(), start, start + 1000);
+    Profiler::counter("Entities", 42);
+    Profiler::plot("FrameTime", 16.5);
+    Profiler::frameMark();
+    
+    std::thread worker([] {
+        Profiler::zone("Worker", ZoneColor::gray(), ticks(), ticks());
+    });
+    worker.join();
+    
+    auto stats = profiler.getStats();
+    REQUIRE(stats.events == 5);
+    REQUIRE(stats.threads == 2);
+    REQUIRE(stats.frames == 1);
+    REQUIRE(stats.dropped == 0);
+    
+    profiler.stopCapture();
+    Profiler::counter("Ignored", 2);
+    REQUIRE(profiler.getStats().events == 5);
+    
+    std::ostringstream json;
+    profiler.exportChromeTrace(json);
+    std::string trace = json.str();
+    REQUIRE(trace.find("\"traceEvents\"") != std::string::npos);
+    REQUIRE(trace.find("\"name\":\"Update\",\"pid\":1,\"tid\":0") != std::string::npos);
+    REQUIRE(trace.find("\"ph\":\"X\"") != std::string::npos);
+    REQUIRE(trace.find("\"color\":\"#ffc864\"") != std::string::npos);
+    REQUIRE(trace.find("\"value\":42") != std::string::npos);
+    REQUIRE(trace.find("\"ph\":\"i\"") != std::string::npos);
+    REQUIRE(trace.find("Main \\\"thread\\\"") != std::string::npos);
+    REQUIRE(trace.find("\"Worker\"") != std::string::npos);
+    REQUIRE(trace.find("Ignored") == std::string::npos);
+}
+
+TEST_CASE("Profiler drops events beyond the thread limit", "[profiling][capture]") {
+    auto& profiler = Profiler::instance();
+    ProfilerConfig config;
+    config.maxEventsPerThread = 10;
+    profiler.startCapture(config);
+    
+    for (usize i = 0; i < ProfileThreadBuffer::CHUNK_EVENTS + 5; ++i) {
+        Profiler::counter("Spam", static_cast<i64>(i));
+    }
+    profiler.stopCapture();
+    
+    // The limit is rounded up to whole chunks
+    auto stats = profiler.getStats();
+    REQUIRE(stats.events == ProfileThreadBuffer::CHUNK_EVENTS);
+    REQUIRE(stats.dropped == 5);
+}
+
+#if NOVA_PROFILING_ENABLED
+TEST_CASE("Profiler zone overhead", "[.][benchmark][profiling][capture]") {
+    constexpr int ZONES = 1000000;
+    auto& profiler = Profiler::instance();
+    
+    for (bool capture : {false, true}) {
+        if (capture) profiler.startCapture();
+        
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < ZONES; ++i) {
+            NOVA_PROFILE_ZONE("Zone");
+        }
+        f64 ns = std::chrono::duration<f64, std::nano>(std::chrono::steady_clock::now() - start).count();
+        
+        if (capture) profiler.stopCapture();
+        WARN(std::format("capture {}: {:.1f} ns per zone", capture ? "on " : "off", ns / ZONES));
+    }
+}
+#endif
+
+// =============================================================================
+// Metrics Tests
+// =============================================================================
+
+TEST_CASE("Histogram percentiles over rolling windows", "[profiling][metrics]") {
+    SECTION("Buckets are exact below 32 and within 1/16 above") {
+        const u64 values[] = {0, 1, 31, 32, 1000, 16'666'667, Histogram::MAX_VALUE};
+        for (u64 v : values) {
+            u32 index = Histogram::bucketIndex(v);
+            REQUIRE(index < Histogram::BUCKET_COUNT);
+            u64 upper = Histogram::bucketUpperBound(index);
+            REQUIRE(upper >= v);
+            REQUIRE(upper - v <= v / 16);
+        }
+        REQUIRE(Histogram::bucketUpperBound(Histogram::BUCKET_COUNT - 1) == Histogram::MAX_VALUE);
+    }
+
+    SECTION("Percentiles, totals and window expiry") {
+        auto histogram = std::make_unique<Histogram>();
+        for (u64 v = 1; v <= 1000; ++v) {
+            histogram->record(v * 1000);
+        }
+
+        auto snap = histogram->snapshot();
+        REQUIRE(snap.count == 1000);
+        REQUIRE(snap.min == 1000);
+        REQUIRE(snap.max == 1'000'000);
+        REQUIRE(snap.mean() == Catch::Approx(500'500.0));
+        REQUIRE(snap.p50 == Catch::Approx(500'000.0).epsilon(0.0625));
+        REQUIRE(snap.p99 == Catch::Approx(990'000.0).epsilon(0.0625));
+        REQUIRE(snap.p999 <= snap.max);
+        REQUIRE(histogram->percentile(0.5) == snap.p50);
+
+        // Later windows shift the percentiles; old windows age out
+        histogram->rotate();
+        histogram->record(std::chrono::milliseconds(50));
+        REQUIRE(histogram->percentile(1.0) == 50'000'000);
+        REQUIRE(histogram->snapshot().p50 <= 510'000);
+        for (u32 i = 0; i < Histogram::WINDOW_COUNT - 1; ++i) {
+            histogram->rotate();
+        }
+        snap = histogram->snapshot();
+        REQUIRE(snap.windowCount == 1);
+        REQUIRE(snap.p50 == snap.max);
+        REQUIRE(snap.count == 1001);
+    }
+}
+
+TEST_CASE("Metrics registry snapshot and text export", "[profiling][metrics]") {
+    auto& registry = MetricsRegistry::get();
+    auto& counter = registry.counter("test.requests", "Requests handled");
+    auto& gauge = registry.gauge("test.queue_depth");
+    auto& latency = registry.histogram("test.latency");
+    REQUIRE(&registry.counter("test.requests") == &counter);
+
+    std::vector<std::thread> writers;
+    for (int t = 0; t < 4; ++t) {
+        writers.emplace_back([&] {
+            for (int i = 0; i < 1000; ++i) {
+                counter.add();
+                latency.record(std::chrono::microseconds(100));
+            }
+        });
+    }
+    for (auto& writer : writers) {
+        writer.join();
+    }
+    gauge.set(7.5);
+
+    auto snap = registry.snapshot();
+    REQUIRE(snap.findCounter("test.requests")->value == 4000.0);
+    REQUIRE(snap.findGauge("test.queue_depth")->value == 7.5);
+    REQUIRE(snap.findHistogram("test.latency")->count == 4000);
+    REQUIRE(snap.findHistogram("test.missing") == nullptr);
+
+    std::string text = registry.formatText();
+    REQUIRE(text.find("# HELP nova_test_requests_total Requests handled\n") != std::string::npos);
+    REQUIRE(text.find("nova_test_requests_total 4000\n") != std::string::npos);
+    REQUIRE(text.find("nova_test_queue_depth 7.5\n") != std::string::npos);
+    REQUIRE(text.find("# TYPE nova_test_latency_seconds summary\n") != std::string::npos);
+    REQUIRE(text.find("nova_test_latency_seconds_count 4000\n") != std::string::npos);
+
+    registry.reset();
+    REQUIRE(counter.value() == 0);
+    REQUIRE(latency.count() == 0);
+}
+
 // =============================================================================
 // Timestamp Utilities Tests
 // =============================================================================
@@ -6,8 +6,11 @@
 // =============================================================================
 
 #include <catch2/catch_test_macros.hpp>
+#include <algorithm>
 #include <vector>
 #include <cstring>
+#include <limits>
+#include <thread>
 
 #include "nova/core/memory/memory.hpp"
 
@@ -390,3 +393,282 @@ TEST_CASE("Memory utility functions", "[memory][utils]") {
         }
     }
 }
+
+// =============================================================================
+// Scalable Allocator Tests
+// =============================================================================
+
+TEST_CASE("ScalableAllocator size classes", "[memory][scalable]") {
+    REQUIRE(ScalableAllocator::getSizeClassSize(0) == 16);
+    REQUIRE(ScalableAllocator::getSizeClassSize(ScalableAllocator::SIZE_CLASS_COUNT - 1) ==
+            ScalableAllocator::MAX_SMALL_SIZE);
+    REQUIRE(ScalableAllocator::getSizeClass(ScalableAllocator::MAX_SMALL_SIZE + 1) ==
+            ScalableAllocator::SIZE_CLASS_COUNT);
+
+    // Every size maps to the smallest class that holds it
+    for (usize size = 1; size <= ScalableAllocator::MAX_SMALL_SIZE; ++size) {
+        u32 sizeClass = ScalableAllocator::getSizeClass(size);
+        REQUIRE(ScalableAllocator::getSizeClassSize(sizeClass) >= size);
+        if (sizeClass > 0) {
+            REQUIRE(ScalableAllocator::getSizeClassSize(sizeClass - 1) < size);
+        }
+    }
+}
+
+TEST_CASE("ScalableAllocator basic operations", "[memory][scalable]") {
+    ScalableAllocator allocator("TestScalable");
+    REQUIRE(std::strcmp(allocator.getName(), "TestScalable") == 0);
+
+    SECTION("Small blocks are distinct and reused") {
+        std::vector<void*> ptrs;
+        for (usize i = 0; i < 1000; ++i) {
+            void* ptr = allocator.allocate(48);
+            REQUIRE(ptr != nullptr);
+            REQUIRE(allocator.owns(ptr));
+            std::memset(ptr, static_cast<int>(i), 48);
+            ptrs.push_back(ptr);
+        }
+        std::sort(ptrs.begin(), ptrs.end());
+        REQUIRE(std::adjacent_find(ptrs.begin(), ptrs.end()) == ptrs.end());
+
+        void* last = ptrs.back();
+        allocator.deallocate(last);
+        REQUIRE(allocator.allocate(48) == last);
+
+        for (void* ptr : ptrs) {
+            allocator.deallocate(ptr);
+        }
+        REQUIRE(allocator.getStats().allocationCount == 0);
+    }
+
+    SECTION("Alignment is honoured") {
+        for (usize alignment : {usize{16}, usize{64}, usize{256}, usize{4096}, usize{16384}}) {
+            for (usize size : {usize{1}, usize{100}, usize{5000}, usize{40000}}) {
+                void* ptr = allocator.allocate(size, alignment);
+                REQUIRE(ptr != nullptr);
+                REQUIRE(reinterpret_cast<uintptr_t>(ptr) % alignment == 0);
+                REQUIRE(allocator.usableSize(ptr) >= size);
+                allocator.deallocate(ptr);
+            }
+        }
+        REQUIRE(allocator.allocate(64, 3) == nullptr);
+    }
+
+    SECTION("Large blocks bypass size classes") {
+        constexpr usize size = 1024 * 1024;
+        auto* ptr = static_cast<u8*>(allocator.allocate(size));
+        REQUIRE(ptr != nullptr);
+        REQUIRE(allocator.owns(ptr));
+        REQUIRE(allocator.usableSize(ptr) == size);
+        ptr[0] = 1;
+        ptr[size - 1] = 2;
+
+        AllocationStats stats = allocator.getStats();
+        REQUIRE(stats.totalAllocated == size);
+        REQUIRE(stats.peakAllocated >= size);
+
+        allocator.deallocate(ptr);
+        REQUIRE(allocator.getStats().totalFreed == size);
+    }
+
+    SECTION("Reallocate keeps contents") {
+        auto* ptr = static_cast<u8*>(allocator.allocate(32));
+        for (u8 i = 0; i < 32; ++i) {
+            ptr[i] = i;
+        }
+        REQUIRE(allocator.reallocate(ptr, 30) == ptr);
+
+        auto* grown = static_cast<u8*>(allocator.reallocate(ptr, 20000));
+        REQUIRE(grown != nullptr);
+        for (u8 i = 0; i < 30; ++i) {
+            REQUIRE(grown[i] == i);
+        }
+        allocator.deallocate(grown);
+    }
+
+    SECTION("Statistics per size class") {
+        u32 sizeClass = ScalableAllocator::getSizeClass(256);
+        void* a = allocator.allocate(256);
+        void* b = allocator.allocate(256);
+        allocator.deallocate(a);
+
+        AllocationStats stats = allocator.getSizeClassStats(sizeClass);
+        REQUIRE(stats.totalAllocationCount == 2);
+        REQUIRE(stats.totalFreeCount == 1);
+        REQUIRE(stats.totalAllocated == 256);
+        REQUIRE(stats.peakAllocated == ScalableAllocator::PAGE_SIZE);
+        allocator.deallocate(b);
+    }
+}
+
+TEST_CASE("ScalableAllocator cross-thread frees", "[memory][scalable]") {
+    ScalableAllocator allocator;
+    constexpr usize count = 10000;
+
+    // Give this thread its own heap first
+    allocator.deallocate(allocator.allocate(16));
+
+    std::vector<void*> ptrs(count);
+    std::thread producer([&] {
+        for (usize i = 0; i < count; ++i) {
+            ptrs[i] = allocator.allocate(16 + (i % 64) * 16);
+            std::memset(ptrs[i], 0xCD, 16);
+        }
+    });
+    producer.join();
+
+    // Frees from this thread go to the producer heap's remote queues
+    for (void* ptr : ptrs) {
+        allocator.deallocate(ptr);
+    }
+    REQUIRE(allocator.getStats().allocationCount == 0);
+
+    // A new thread adopts the exited producer's heap and drains its queues
+    usize heapsBefore = allocator.getHeapCount();
+    std::thread consumer([&] {
+        for (usize i = 0; i < count; ++i) {
+            ptrs[i] = allocator.allocate(16 + (i % 64) * 16);
+        }
+        for (void* ptr : ptrs) {
+            allocator.deallocate(ptr);
+        }
+    });
+    consumer.join();
+    REQUIRE(allocator.getHeapCount() == heapsBefore);
+
+    AllocationStats stats = allocator.getStats();
+    REQUIRE(stats.totalAllocationCount == 2 * count + 1);
+    REQUIRE(stats.totalFreeCount == 2 * count + 1);
+}
+
+TEST_CASE("StdAllocator adapter", "[memory][scalable]") {
+    ScalableAllocator allocator;
+    std::vector<u64, StdAllocator<u64>> values{StdAllocator<u64>(allocator)};
+    for (u64 i = 0; i < 10000; ++i) {
+        values.push_back(i * i);
+    }
+    REQUIRE(values[9999] == 9999ull * 9999ull);
+    REQUIRE(allocator.owns(values.data()));
+
+    values.clear();
+    values.shrink_to_fit();
+    REQUIRE(allocator.getStats().allocationCount == 0);
+}
+
+// =============================================================================
+// Frame Allocator Tests
+// =============================================================================
+
+TEST_CASE("FrameAllocator ring", "[memory][frame]") {
+    constexpr usize capacity = 1024;
+    FrameAllocator allocator(capacity, 2, "TestFrame");
+    REQUIRE(allocator.getFramesInFlight() == 2);
+    REQUIRE(std::strcmp(allocator.getName(), "TestFrame") == 0);
+
+    SECTION("Memory survives until its slot comes around again") {
+        auto* frame0 = static_cast<u32*>(allocator.allocate(sizeof(u32)));
+        *frame0 = 0xF00D;
+        REQUIRE(allocator.owns(frame0));
+
+        allocator.beginFrame(1);
+        void* frame1 = allocator.allocate(sizeof(u32));
+        REQUIRE(frame1 != frame0);
+        REQUIRE(*frame0 == 0xF00D);
+
+        // Frame 2 reuses frame 0's slot from the start
+        allocator.beginFrame(2);
+        REQUIRE(allocator.allocate(sizeof(u32)) == frame0);
+    }
+
+    SECTION("Per-frame peak and overflow") {
+        (void)allocator.allocate(600);
+        (void)allocator.allocate(600);     // Does not fit: spills
+        REQUIRE(allocator.getFrameStats().peakBytes == 600);
+        REQUIRE(allocator.getFrameStats().overflowBytes == 600);
+        REQUIRE(allocator.getFrameStats().allocationCount == 2);
+
+        allocator.beginFrame(1);
+        (void)allocator.allocate(100);
+        allocator.beginFrame(2);
+
+        FrameMemoryStats last = allocator.getLastFrameStats();
+        REQUIRE(last.frame == 1);
+        REQUIRE(last.peakBytes == 100);
+        REQUIRE(last.overflowBytes == 0);
+        REQUIRE(allocator.getMaxFramePeak() == 600);
+    }
+
+    SECTION("Markers rewind ring and overflow allocations") {
+        (void)allocator.allocate(100);
+        FrameAllocator::Marker marker = allocator.getMarker();
+        (void)allocator.allocate(200);
+        (void)allocator.allocate(4096);
+        allocator.resetToMarker(marker);
+        REQUIRE(allocator.getAllocatedSize() == 100);
+        REQUIRE(allocator.getFrameStats().peakBytes >= 300);
+    }
+}
+
+TEST_CASE("FrameAllocator without a ring spills every allocation", "[memory][frame]") {
+    // Too large to reserve, so the allocator falls back to its overflow path
+    FrameAllocator allocator(std::numeric_limits<usize>::max() / 4, 2);
+    REQUIRE(allocator.getCapacityPerFrame() == 0);
+
+    void* ptr = allocator.allocate(64);
+    REQUIRE(ptr != nullptr);
+    REQUIRE_FALSE(allocator.owns(ptr));
+    REQUIRE(allocator.getFrameStats().overflowBytes == 64);
+    allocator.beginFrame(1);
+}
+
+TEST_CASE("AllocatorResource equality", "[memory][frame]") {
+    FrameAllocator allocator(1024);
+    AllocatorResource first(allocator);
+    AllocatorResource second(allocator);
+    REQUIRE(first.is_equal(first));
+    REQUIRE_FALSE(first.is_equal(second));
+}
+
+TEST_CASE("FrameScope containers", "[memory][frame]") {
+    FrameAllocator allocator(64 * 1024);
+    usize before = allocator.getAllocatedSize();
+    {
+        FrameScope scratch(allocator);
+        auto values = scratch.makeVector<u32>(100);
+        for (u32 i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        REQUIRE(allocator.owns(values.data()));
+
+        std::pmr::vector<u64> wide(scratch.resource());
+        wide.assign(50, 7);
+        REQUIRE(allocator.owns(wide.data()));
+        REQUIRE(allocator.getAllocatedSize() > before);
+    }
+    REQUIRE(allocator.getAllocatedSize() == before);
+}
+
+TEST_CASE("FrameMemory per-thread rings", "[memory][frame]") {
+    FrameAllocator& main = FrameMemory::threadAllocator();
+    REQUIRE(&FrameMemory::threadAllocator() == &main);
+    REQUIRE(main.getFrame() == FrameMemory::getFrame());
+
+    FrameAllocator* worker = nullptr;
+    std::thread thread([&] {
+        worker = &FrameMemory::threadAllocator();
+        FrameScope scratch;
+        (void)scratch.makeVector<u8>(256);
+    });
+    thread.join();
+    REQUIRE(worker != &main);
+
+    (void)main.allocate(512);
+    u64 frame = FrameMemory::getFrame();
+    FrameMemory::endFrame();
+    REQUIRE(FrameMemory::getFrame() == frame + 1);
+
+    // The ring catches up on its next use
+    REQUIRE(FrameMemory::threadAllocator().getFrame() == frame + 1);
+    REQUIRE(main.getLastFrameStats().peakBytes >= 512);
+    REQUIRE(FrameMemory::getLastFrameStats().peakBytes >= 512);
+}
@@ -8,6 +8,9 @@
 #include <catch2/catch_approx.hpp>
 #include <nova/core/network/network_types.hpp>
 #include <nova/core/network/network_system.hpp>
+#include <nova/core/network/network_replication.hpp>
+
+#include <cstring>
 
 using namespace nova;
 using namespace nova::network;
@@ -229,3 +232,498 @@ TEST_CASE("Network: NetworkError", "[network][types]") {
         REQUIRE(NetworkError::ServerFull != NetworkError::Banned);
     }
 }
+
+// =============================================================================
+// Sequence Buffer Tests
+// =============================================================================
+
+TEST_CASE("Network: SequenceBuffer", "[network][reliability]") {
+    SECTION("Wraparound comparison") {
+        REQUIRE(sequenceGreaterThan(1, 0));
+        REQUIRE(sequenceGreaterThan(0, 65535));
+        REQUIRE_FALSE(sequenceGreaterThan(65535, 0));
+        REQUIRE_FALSE(sequenceGreaterThan(5, 5));
+    }
+    
+    SECTION("Insert, find and remove") {
+        SequenceBuffer<u32, 16> buffer;
+        REQUIRE(buffer.empty());
+        
+        *buffer.insert(3) = 42;
+        REQUIRE(buffer.exists(3));
+        REQUIRE(*buffer.find(3) == 42);
+        REQUIRE_FALSE(buffer.exists(19));  // Same slot, different sequence
+        
+        buffer.remove(3);
+        REQUIRE_FALSE(buffer.exists(3));
+    }
+    
+    SECTION("Advancing clears skipped slots and rejects stale sequences") {
+        SequenceBuffer<u8, 16> buffer;
+        buffer.insert(65530);
+        buffer.insert(65534);
+        buffer.insert(4);  // Wraps past 65535
+        
+        REQUIRE(buffer.newest() == 4);
+        REQUIRE(buffer.exists(65530));
+        REQUIRE(buffer.exists(65534));
+        REQUIRE_FALSE(buffer.exists(0));
+        REQUIRE(buffer.insert(static_cast<u16>(4 - 16)) == nullptr);
+    }
+}
+
+// =============================================================================
+// Send Pipeline Tests
+// =============================================================================
+
+namespace {
+
+/// Pair of connections wired back to back through an in-memory link
+struct LoopbackPair {
+    NetworkConnection a{1, NetworkEndpoint::localhost(1000)};
+    NetworkConnection b{2, NetworkEndpoint::localhost(2000)};
+    std::vector<std::vector<u8>> received;
+    
+    LoopbackPair() {
+        a.establish();
+        b.establish();
+        b.setDataCallback([this](u64, ChannelType, const u8* data, usize size) {
+            received.emplace_back(data, data + size);
+        });
+    }
+    
+    u32 pump(NetworkConnection& from, NetworkConnection& to, bool drop = false) {
+        return from.flush([&to, drop](const u8* data, usize size) {
+            REQUIRE(size <= DEFAULT_MTU);
+            if (!drop) {
+                to.processDatagram(data, size);
+            }
+        });
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("Network: Message coalescing and acks", "[network][reliability]") {
+    LoopbackPair link;
+    
+    SECTION("Small messages share datagrams") {
+        for (u8 i = 0; i < 100; ++i) {
+            u8 payload[16] = {i};
+            REQUIRE(link.a.send(ChannelType::Default, payload, sizeof(payload),
+                                DeliveryMode::Reliable).has_value());
+        }
+        REQUIRE(link.a.getPendingReliableCount() == 100);
+        
+        u32 datagrams = link.pump(link.a, link.b);
+        REQUIRE(datagrams == 4);  // 32 reliable messages per datagram
+        REQUIRE(link.received.size() == 100);
+        REQUIRE(link.received[42][0] == 42);
+        
+        // Acks piggyback on b's next datagram
+        REQUIRE(link.pump(link.b, link.a) == 1);
+        REQUIRE(link.a.getPendingReliableCount() == 0);
+        REQUIRE(link.a.getStats().reliableAcked == 100);
+    }
+    
+    SECTION("Unreliable messages are packed to the MTU") {
+        std::vector<u8> payload(100, 7);
+        for (int i = 0; i < 30; ++i) {
+            REQUIRE(link.a.send(ChannelType::Movement, payload.data(), payload.size(),
+                                DeliveryMode::Unreliable).has_value());
+        }
+        
+        REQUIRE(link.pump(link.a, link.b) == 3);  // 10 framed messages per datagram
+        REQUIRE(link.received.size() == 30);
+        REQUIRE(link.a.getPendingReliableCount() == 0);
+    }
+    
+    SECTION("Oversized messages are rejected") {
+        std::vector<u8> payload(MAX_MESSAGE_SIZE + 1);
+        REQUIRE_FALSE(link.a.send(ChannelType::Default, payload.data(), payload.size()).has_value());
+    }
+}
+
+TEST_CASE("Network: Reliable resend scheduling", "[network][reliability]") {
+    LoopbackPair link;
+    
+    u8 payload[4] = {1, 2, 3, 4};
+    REQUIRE(link.a.send(ChannelType::Default, payload, sizeof(payload)).has_value());
+    
+    // First transmission is lost
+    REQUIRE(link.pump(link.a, link.b, true) == 1);
+    REQUIRE(link.received.empty());
+    
+    // Nothing is resent before the timeout expires
+    link.a.update(0.01f);
+    REQUIRE(link.pump(link.a, link.b) == 0);
+    
+    link.a.update(RESEND_TIMEOUT_INITIAL_MS / 1000.0f);
+    REQUIRE(link.pump(link.a, link.b) == 1);
+    REQUIRE(link.received.size() == 1);
+    REQUIRE(link.a.getStats().reliableResent == 1);
+    
+    // The ack yields an RTT sample that drives the next timeout
+    link.a.update(0.05f);
+    link.pump(link.b, link.a);
+    REQUIRE(link.a.getPendingReliableCount() == 0);
+    REQUIRE(link.a.getRtt() == Approx(50.0f));
+    REQUIRE(link.a.getResendTimeoutMs() >= RESEND_TIMEOUT_MIN_MS);
+    REQUIRE(link.a.getResendTimeoutMs() <= RESEND_TIMEOUT_MAX_MS);
+}
+
+TEST_CASE("Network: Duplicate reliable delivery is suppressed", "[network][reliability]") {
+    LoopbackPair link;
+    
+    u8 payload[2] = {9, 9};
+    REQUIRE(link.a.send(ChannelType::Default, payload, sizeof(payload)).has_value());
+    link.pump(link.a, link.b);
+    REQUIRE(link.received.size() == 1);
+    
+    // b's ack is lost, so a resends a message b already delivered
+    link.pump(link.b, link.a, true);
+    link.a.update(RESEND_TIMEOUT_MAX_MS / 1000.0f);
+    REQUIRE(link.pump(link.a, link.b) == 1);
+    
+    REQUIRE(link.received.size() == 1);
+    REQUIRE(link.b.getStats().packetsDuplicate == 1);
+    
+    // The resend's ack still clears the sender
+    link.pump(link.b, link.a);
+    REQUIRE(link.a.getPendingReliableCount() == 0);
+}
+
+// =============================================================================
+// Handshake Tests
+// =============================================================================
+
+namespace {
+
+constexpr u16 HANDSHAKE_TEST_PORT = 47731;
+
+/// Server started on the loopback test port, ticked at 60 Hz
+struct HandshakeServer {
+    NetworkServer server;
+    
+    HandshakeServer() {
+        ServerConfig config;
+        config.port = HANDSHAKE_TEST_PORT;
+        REQUIRE(server.start(config).has_value());
+    }
+    
+    void tick() { server.update(1.0f / 60.0f); }
+};
+
+} // anonymous namespace
+
+TEST_CASE("Network: Server handshake survives updates before the response", "[network][handshake]") {
+    HandshakeServer host;
+    NetworkClient client;
+    
+    ClientConfig config;
+    config.serverEndpoint = NetworkEndpoint::localhost(HANDSHAKE_TEST_PORT);
+    REQUIRE(client.connect(config).has_value());
+    
+    // Request arrives: the server issues a challenge and keeps the connection pending
+    host.tick();
+    REQUIRE(host.server.getConnectionCount() == 1);
+    REQUIRE(host.server.getConnectedClients().empty());
+    
+    // Ticks before the client answers must not drop the pending connection
+    host.tick();
+    host.tick();
+    REQUIRE(host.server.getConnectionCount() == 1);
+    
+    client.update(1.0f / 60.0f);  // Receives challenge, sends response
+    host.tick();                   // Verifies token, sends acceptance
+    client.update(1.0f / 60.0f);
+    
+    REQUIRE(client.isConnected());
+    REQUIRE(host.server.getConnectedClients().size() == 1);
+}
+
+TEST_CASE("Network: Server rejects responses with the wrong challenge", "[network][handshake]") {
+    HandshakeServer host;
+    
+    NetworkSocket spoofer;
+    REQUIRE(spoofer.bind(SocketProtocol::UDP, 0).has_value());
+    const NetworkEndpoint serverEndpoint = NetworkEndpoint::localhost(HANDSHAKE_TEST_PORT);
+    
+    auto request = NetworkPacket::create(PacketType::ConnectionRequest);
+    auto requestData = request.serialize();
+    REQUIRE(spoofer.sendTo(serverEndpoint, requestData.data(), requestData.size()).has_value());
+    host.tick();
+    REQUIRE(host.server.getConnectionCount() == 1);
+    
+    // Answer without having read the challenge
+    auto response = NetworkPacket::create(PacketType::ConnectionResponse);
+    ConnectionResponse responseData{};
+    responseData.challengeToken = 0x0123456789ABCDEFull;
+    response.payload.resize(sizeof(ConnectionResponse));
+    std::memcpy(response.payload.data(), &responseData, sizeof(ConnectionResponse));
+    auto serialized = response.serialize();
+    REQUIRE(spoofer.sendTo(serverEndpoint, serialized.data(), serialized.size()).has_value());
+    host.tick();
+    
+    REQUIRE(host.server.getConnectedClients().empty());
+    REQUIRE(host.server.getConnectionCount() == 1);
+}
+
+TEST_CASE("Network: Server ignores data from pending connections", "[network][handshake]") {
+    HandshakeServer host;
+    u32 delivered = 0;
+    host.server.setDataCallback([&delivered](u64, ChannelType, const u8*, usize) { ++delivered; });
+    
+    NetworkSocket spoofer;
+    REQUIRE(spoofer.bind(SocketProtocol::UDP, 0).has_value());
+    const NetworkEndpoint serverEndpoint = NetworkEndpoint::localhost(HANDSHAKE_TEST_PORT);
+    
+    auto request = NetworkPacket::create(PacketType::ConnectionRequest);
+    auto requestData = request.serialize();
+    REQUIRE(spoofer.sendTo(serverEndpoint, requestData.data(), requestData.size()).has_value());
+    host.tick();
+    REQUIRE(host.server.getConnectionCount() == 1);
+    
+    // Game data sent as if the handshake had completed, without echoing the token
+    NetworkConnection forged(1, serverEndpoint);
+    forged.establish();
+    auto sendForged = [&] {
+        u8 payload[4] = {1, 2, 3, 4};
+        REQUIRE(forged.send(ChannelType::Default, payload, sizeof(payload), DeliveryMode::Reliable).has_value());
+        (void)forged.flush([&](const u8* data, usize size) {
+            REQUIRE(spoofer.sendTo(serverEndpoint, data, size).has_value());
+        });
+    };
+    
+    sendForged();
+    host.tick();
+    REQUIRE(delivered == 0);
+    
+    // Nor does it keep the pending connection from timing out
+    const f32 halfTimeout = DEFAULT_TIMEOUT_MS / 1000.0f * 0.6f;
+    host.server.update(halfTimeout);
+    sendForged();
+    host.server.update(halfTimeout);
+    REQUIRE(delivered == 0);
+    REQUIRE(host.server.getConnectionCount() == 0);
+}
+
+// ============================================================================
+// Replication Tests
+// ============================================================================
+
+namespace {
+
+struct NetTransform {
+    f32 x = 0.0f;
+    f32 y = 0.0f;
+    f32 z = 0.0f;
+    i32 health = 100;
+};
+
+struct NetFlags {
+    bool visible = true;
+};
+
+struct ReplicationFixture {
+    ReplicationRegistry registry;
+    ecs::World server;
+    ecs::World client;
+    std::vector<u8> update;
+    
+    ReplicationFixture() {
+        REQUIRE(registry.registerComponent<NetTransform>({
+            ReplicatedField::f32Quantized(offsetof(NetTransform, x), -1024.0f, 1024.0f, 20),
+            ReplicatedField::f32Quantized(offsetof(NetTransform, y), -1024.0f, 1024.0f, 20),
+            ReplicatedField::f32Quantized(offsetof(NetTransform, z), -1024.0f, 1024.0f, 20),
+            ReplicatedField::integer(offsetof(NetTransform, health), 8),
+        }, 0).has_value());
+        REQUIRE(registry.registerComponent<NetFlags>({
+            ReplicatedField::boolean(offsetof(NetFlags, visible)),
+        }).has_value());
+    }
+    
+    ecs::Entity spawn(u64 id, f32 x, f32 z) {
+        ecs::Entity entity = server.createEntity();
+        server.addComponent(entity, Replicated{NetworkId(id), ReplicationPriority::Normal});
+        server.addComponent(entity, NetTransform{x, 0.0f, z, 100});
+        return entity;
+    }
+};
+
+} // anonymous namespace
+
+TEST_CASE("Network: BitWriter/BitReader round trip", "[network][replication]") {
+    std::vector<u8> buffer;
+    BitWriter writer(buffer);
+    writer.write(5, 3);
+    writer.writeBool(true);
+    writer.write(0xDEADBEEF, 32);
+    writer.writeVarint(300);
+    
+    usize mark = writer.bitPosition();
+    writer.write(0x7F, 7);
+    writer.rollback(mark);
+    writer.write(1, 2);
+    
+    BitReader reader(buffer.data(), buffer.size());
+    REQUIRE(reader.read(3) == 5);
+    REQUIRE(reader.readBool());
+    REQUIRE(reader.read(32) == 0xDEADBEEF);
+    REQUIRE(reader.readVarint() == 300);
+    REQUIRE(reader.read(2) == 1);
+    REQUIRE_FALSE(reader.overflowed());
+    
+    reader.read(32);
+    REQUIRE(reader.overflowed());
+}
+
+TEST_CASE("Network: Replicated field quantization", "[network][replication]") {
+    auto field = ReplicatedField::f32Quantized(0, -10.0f, 10.0f, 16);
+    f32 value = 3.14159f;
+    u32 encoded = ReplicationRegistry::encodeField(field, &value);
+    REQUIRE(encoded < (1u << 16));
+    REQUIRE(ReplicationRegistry::dequantize(field, encoded) == Approx(value).margin(0.001));
+    
+    f32 outOfRange = 50.0f;
+    REQUIRE(ReplicationRegistry::encodeField(field, &outOfRange) == 0xFFFF);
+    
+    auto integer = ReplicatedField::integer(0, 8, -100);
+    i32 decoded = 0;
+    i32 input = -42;
+    ReplicationRegistry::decodeField(integer, ReplicationRegistry::encodeField(integer, &input), &decoded);
+    REQUIRE(decoded == -42);
+}
+
+TEST_CASE("Network: Replication full then delta updates", "[network][replication]") {
+    ReplicationFixture fx;
+    ecs::Entity moving = fx.spawn(1, 10.0f, 10.0f);
+    fx.spawn(2, -20.0f, 5.0f);
+    
+    NetworkReplicator replicator(fx.registry);
+    ReplicationReceiver receiver(fx.registry);
+    replicator.setClient(7, {});
+    
+    // Tick 1: everything is new
+    replicator.captureSnapshot(fx.server, 1);
+    REQUIRE(replicator.buildUpdate(7, fx.update));
+    REQUIRE(replicator.getStats().fullRecords == 2);
+    usize fullSize = fx.update.size();
+    
+    auto tick = receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size());
+    REQUIRE(tick.has_value());
+    REQUIRE(*tick == 1);
+    REQUIRE(receiver.entityCount() == 2);
+    replicator.acknowledge(7, *tick);
+    
+    // Tick 2: only one entity changed, and only one of its fields
+    fx.server.getComponent<NetTransform>(moving)->x = 12.5f;
+    replicator.captureSnapshot(fx.server, 2);
+    REQUIRE(replicator.buildUpdate(7, fx.update));
+    REQUIRE(replicator.getStats().deltaRecords == 1);
+    REQUIRE(replicator.getStats().fullRecords == 0);
+    REQUIRE(fx.update.size() < fullSize / 2);
+    
+    REQUIRE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+    ecs::Entity mirrored = receiver.findEntity(NetworkId(1));
+    REQUIRE(mirrored.isValid());
+    auto* transform = fx.client.getComponent<NetTransform>(mirrored);
+    REQUIRE(transform != nullptr);
+    REQUIRE(transform->x == Approx(12.5f).margin(0.01));
+    REQUIRE(transform->z == Approx(10.0f).margin(0.01));
+    REQUIRE(transform->health == 100);
+    
+    // Replaying an old update is rejected
+    REQUIRE_FALSE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+}
+
+TEST_CASE("Network: Replication delta without baseline is rejected", "[network][replication]") {
+    ReplicationFixture fx;
+    ecs::Entity entity = fx.spawn(1, 0.0f, 0.0f);
+    
+    NetworkReplicator replicator(fx.registry);
+    ReplicationReceiver receiver(fx.registry);
+    replicator.setClient(1, {});
+    
+    // Server believes tick 1 was received, but the client never saw it
+    replicator.captureSnapshot(fx.server, 1);
+    REQUIRE(replicator.buildUpdate(1, fx.update));
+    replicator.acknowledge(1, 1);
+    
+    fx.server.getComponent<NetTransform>(entity)->y = 3.0f;
+    replicator.captureSnapshot(fx.server, 2);
+    REQUIRE(replicator.buildUpdate(1, fx.update));
+    
+    REQUIRE_FALSE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+    REQUIRE(receiver.entityCount() == 0);
+}
+
+TEST_CASE("Network: Replication interest and removal", "[network][replication]") {
+    ReplicationFixture fx;
+    ecs::Entity wanderer = fx.spawn(1, 10.0f, 0.0f);
+    fx.spawn(2, 900.0f, 900.0f);
+    
+    NetworkReplicator replicator(fx.registry);
+    ReplicationReceiver receiver(fx.registry);
+    ReplicationClientConfig config;
+    config.interestRadius = 100.0f;
+    replicator.setClient(3, config);
+    
+    replicator.captureSnapshot(fx.server, 1);
+    REQUIRE(replicator.buildUpdate(3, fx.update));
+    REQUIRE(replicator.getStats().entitiesSent == 1);
+    REQUIRE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+    REQUIRE(receiver.findEntity(NetworkId(1)).isValid());
+    REQUIRE_FALSE(receiver.findEntity(NetworkId(2)).isValid());
+    replicator.acknowledge(3, 1);
+    
+    // Moving out of range removes it on the client
+    fx.server.getComponent<NetTransform>(wanderer)->x = 500.0f;
+    replicator.captureSnapshot(fx.server, 2);
+    REQUIRE(replicator.buildUpdate(3, fx.update));
+    REQUIRE(replicator.getStats().removals == 1);
+    REQUIRE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+    REQUIRE(receiver.entityCount() == 0);
+    replicator.acknowledge(3, 2);
+    
+    // Once acked the removal is not repeated
+    replicator.captureSnapshot(fx.server, 3);
+    REQUIRE(replicator.buildUpdate(3, fx.update));
+    REQUIRE(replicator.getStats().removals == 0);
+}
+
+TEST_CASE("Network: Replication budget defers low priority entities", "[network][replication]") {
+    ReplicationFixture fx;
+    for (u64 id = 1; id <= 200; ++id) {
+        fx.spawn(id, static_cast<f32>(id % 20), static_cast<f32>(id / 20));
+    }
+    
+    NetworkReplicator replicator(fx.registry);
+    ReplicationReceiver receiver(fx.registry);
+    ReplicationClientConfig config;
+    config.budgetBytes = 256;
+    replicator.setClient(1, config);
+    
+    u32 tick = 1;
+    u32 rounds = 0;
+    while (receiver.entityCount() < 200 && rounds < 50) {
+        replicator.captureSnapshot(fx.server, tick);
+        REQUIRE(replicator.buildUpdate(1, fx.update));
+        REQUIRE(fx.update.size() <= config.budgetBytes);
+        if (rounds == 0) {
+            REQUIRE(replicator.getStats().deferredByBudget > 0);
+        }
+        REQUIRE(receiver.applyUpdate(fx.client, fx.update.data(), fx.update.size()).has_value());
+        replicator.acknowledge(1, tick);
+        ++tick;
+        ++rounds;
+    }
+    
+    REQUIRE(receiver.entityCount() == 200);
+    REQUIRE(rounds > 1);
+    
+    // Nothing changed, so a steady-state update carries no records
+    replicator.captureSnapshot(fx.server, tick);
+    REQUIRE(replicator.buildUpdate(1, fx.update));
+    REQUIRE(replicator.getStats().entitiesSent == 0);
+}
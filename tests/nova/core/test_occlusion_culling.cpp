@@ -7,6 +7,7 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include <nova/core/render/occlusion_culling.hpp>
+#include <nova/core/platform/worker_pool.hpp>
 
 using namespace nova;
 using Catch::Approx;
@@ -631,11 +632,401 @@ TEST_CASE("OcclusionCullingManager frame lifecycle", "[occlusion][manager]") {
         manager.recordResult(1, VisibilityResult::Visible);
         manager.recordResult(2, VisibilityResult::Occluded);
         
+        REQUIRE(manager.isVisible(1));
+        REQUIRE_FALSE(manager.isVisible(2));
+        
         manager.endFrame();
+        manager.beginFrame(1);
         
-        // Results should be available for next frame's temporal coherence
-        // Can't directly test private maps, but shouldn't crash
+        // Last frame's results drive temporal coherence
+        REQUIRE_FALSE(manager.wasOccluded(1));
+        REQUIRE(manager.wasOccluded(2));
+        REQUIRE_FALSE(manager.wasOccluded(100000));
+        REQUIRE_FALSE(manager.isVisible(1));
+    }
+}
+
+// =============================================================================
+// Visibility Bitset Tests
+// =============================================================================
+
+TEST_CASE("VisibilityBitset functionality", "[occlusion][bitset]") {
+    VisibilityBitset bits;
+    
+    SECTION("Grows on demand") {
+        REQUIRE_FALSE(bits.test(5));
+        bits.set(5);
+        bits.set(200);
+        REQUIRE(bits.test(5));
+        REQUIRE(bits.test(200));
+        REQUIRE_FALSE(bits.test(6));
+        REQUIRE(bits.count() == 2);
+        REQUIRE(bits.getWords().size() == 4);
+    }
+    
+    SECTION("Assign and clear keep storage") {
+        bits.assign(70, true);
+        bits.assign(70, false);
+        bits.assign(1000, false);
+        REQUIRE_FALSE(bits.test(70));
+        REQUIRE(bits.getWords().size() == 2);
+        
+        bits.set(3);
+        bits.clear();
+        REQUIRE(bits.count() == 0);
+        REQUIRE(bits.getWords().size() == 2);
+    }
+}
+
+// =============================================================================
+// Software Occlusion Tests
+// =============================================================================
+
+namespace {
+
+Mat4 testViewProjection() {
+    Mat4 view = Mat4::lookAt(Vec3{0.0f, 0.0f, 0.0f}, Vec3{0.0f, 0.0f, -1.0f}, Vec3{0.0f, 1.0f, 0.0f});
+    Mat4 proj = Mat4::perspective(math::radians(60.0f), 320.0f / 192.0f, 0.1f, 100.0f);
+    return proj * view;
+}
+
+/// Wall facing the camera at depth z, spanning [-halfSize, halfSize]
+struct TestWall {
+    std::array<Vec3, 4> vertices;
+    std::array<u32, 6> indices = {0, 1, 2, 0, 2, 3};
+    
+    TestWall(f32 z, f32 halfSize)
+        : vertices{Vec3{-halfSize, -halfSize, z}, Vec3{halfSize, -halfSize, z},
+                   Vec3{halfSize, halfSize, z}, Vec3{-halfSize, halfSize, z}} {}
+};
+
+AABB boxAt(f32 x, f32 y, f32 z, f32 halfSize = 0.5f) {
+    return AABB::fromCenterHalfExtents(Vec3{x, y, z}, Vec3{halfSize, halfSize, halfSize});
+}
+
+} // namespace
+
+TEST_CASE("SoftwareOcclusionBuffer rasterization", "[occlusion][software]") {
+    SoftwareOcclusionBuffer buffer;
+    buffer.setViewProjection(testViewProjection());
+    buffer.beginFrame();
+    
+    TestWall wall(-10.0f, 5.0f);
+    REQUIRE(buffer.addOccluder(wall.vertices, wall.indices, Mat4::identity()));
+    buffer.rasterize();
+    
+    SECTION("Depth is stored as 1/w") {
+        REQUIRE(buffer.getWidth() == OcclusionConfig::SOFTWARE_BUFFER_WIDTH);
+        REQUIRE(buffer.getHeight() == OcclusionConfig::SOFTWARE_BUFFER_HEIGHT);
+        REQUIRE(buffer.getDepth(160, 96) == Approx(0.1f));
+        REQUIRE(buffer.getDepth(0, 0) == 0.0f);
+        REQUIRE(buffer.getStats().triangles == 2);
+        REQUIRE(buffer.getStats().binnedTriangles >= 2);
+    }
+    
+    SECTION("Boxes behind the wall are occluded") {
+        REQUIRE_FALSE(buffer.testAABB(boxAt(0.0f, 0.0f, -20.0f)));
+        REQUIRE_FALSE(buffer.testAABB(boxAt(2.0f, -2.0f, -50.0f, 2.0f)));
+    }
+    
+    SECTION("Boxes in front, beside or through the wall are visible") {
+        REQUIRE(buffer.testAABB(boxAt(0.0f, 0.0f, -5.0f)));
+        REQUIRE(buffer.testAABB(boxAt(20.0f, 0.0f, -30.0f)));
+        REQUIRE(buffer.testAABB(boxAt(0.0f, 0.0f, -10.0f)));
+        REQUIRE(buffer.testAABB(boxAt(0.0f, 0.0f, 0.0f)));
+    }
+    
+    SECTION("Box peeking past the edge is visible") {
+        // Wall edge projects to x = 5 at depth 10, so x = 14.5 at depth 30
+        REQUIRE(buffer.testAABB(boxAt(15.0f, 0.0f, -30.0f, 0.75f)));
+        REQUIRE_FALSE(buffer.testAABB(boxAt(13.0f, 0.0f, -30.0f, 0.75f)));
+    }
+    
+    SECTION("Next frame starts empty") {
+        buffer.beginFrame();
+        REQUIRE_FALSE(buffer.hasOccluders());
+        REQUIRE(buffer.getDepth(160, 96) == 0.0f);
+        REQUIRE(buffer.testAABB(boxAt(0.0f, 0.0f, -20.0f)));
+    }
+}
+
+TEST_CASE("SoftwareOcclusionBuffer clips occluders at the near plane", "[occlusion][software]") {
+    SoftwareOcclusionBuffer buffer;
+    buffer.setViewProjection(testViewProjection());
+    buffer.beginFrame();
+    
+    // A floor running from behind the camera into the distance
+    std::array<Vec3, 4> floor = {Vec3{-50.0f, -1.0f, 10.0f}, Vec3{50.0f, -1.0f, 10.0f},
+                                 Vec3{50.0f, -1.0f, -90.0f}, Vec3{-50.0f, -1.0f, -90.0f}};
+    std::array<u32, 6> indices = {0, 1, 2, 0, 2, 3};
+    buffer.addOccluder(floor, indices, Mat4::identity());
+    buffer.rasterize();
+    
+    REQUIRE(buffer.getStats().triangles > 2);
+    REQUIRE_FALSE(buffer.testAABB(boxAt(0.0f, -3.0f, -20.0f)));
+    REQUIRE(buffer.testAABB(boxAt(0.0f, 1.0f, -20.0f)));
+}
+
+TEST_CASE("SoftwareOcclusionBuffer threads agree", "[occlusion][software][parallel]") {
+    std::vector<TestWall> walls;
+    for (u32 i = 0; i < 24; ++i) {
+        f32 x = static_cast<f32>(i % 6) * 6.0f - 15.0f;
+        f32 y = static_cast<f32>(i / 6) * 4.0f - 6.0f;
+        walls.emplace_back(-15.0f - static_cast<f32>(i % 5), 2.0f + static_cast<f32>(i % 3));
+        for (auto& v : walls.back().vertices) {
+            v.x += x;
+            v.y += y;
+        }
+    }
+    std::vector<AABB> boxes;
+    for (u32 i = 0; i < 1000; ++i) {
+        boxes.push_back(boxAt(static_cast<f32>(i % 40) - 20.0f, static_cast<f32>(i % 25) * 0.6f - 7.0f,
+                              -12.0f - static_cast<f32>(i % 17) * 2.0f, 0.3f + static_cast<f32>(i % 4) * 0.2f));
+    }
+    
+    auto run = [&](u32 threads, std::vector<u64>& bits, std::vector<f32>& depth) {
+        SoftwareOcclusionBuffer buffer;
+        buffer.setThreadCount(threads);
+        buffer.setViewProjection(testViewProjection());
+        buffer.beginFrame();
+        for (const auto& wall : walls) {
+            buffer.addOccluder(wall.vertices, wall.indices, Mat4::identity());
+        }
+        buffer.rasterize();
+        bits.assign((boxes.size() + 63) / 64, 0);
+        buffer.testAABBs(boxes, bits);
+        for (u32 y = 0; y < buffer.getHeight(); ++y) {
+            for (u32 x = 0; x < buffer.getWidth(); ++x) {
+                depth.push_back(buffer.getDepth(x, y));
+            }
+        }
+    };
+    
+    std::vector<u64> serialBits, parallelBits;
+    std::vector<f32> serialDepth, parallelDepth;
+    run(1, serialBits, serialDepth);
+    run(4, parallelBits, parallelDepth);
+    
+    REQUIRE(serialDepth == parallelDepth);
+    REQUIRE(serialBits == parallelBits);
+    
+    u32 visible = 0;
+    for (u64 word : serialBits) visible += static_cast<u32>(std::popcount(word));
+    REQUIRE(visible > 0);
+    REQUIRE(visible < boxes.size());
+}
+
+TEST_CASE("OcclusionCullingManager software raster culling", "[occlusion][manager][software]") {
+    OcclusionCullingManager manager;
+    manager.setTechnique(OcclusionTechnique::SoftwareRaster);
+    manager.updateFrustum(testViewProjection());
+    manager.beginFrame(0);
+    
+    TestWall wall(-10.0f, 5.0f);
+    REQUIRE(manager.addOccluder(wall.vertices, wall.indices, Mat4::identity()));
+    manager.rasterizeOccluders();
+    
+    std::array<u32, 4> ids = {3, 10, 64, 130};
+    std::array<AABB, 4> bounds = {boxAt(0.0f, 0.0f, -20.0f),   // behind the wall
+                                  boxAt(0.0f, 0.0f, -5.0f),    // in front
+                                  boxAt(0.0f, 0.0f, 20.0f),    // behind the camera
+                                  boxAt(20.0f, 0.0f, -30.0f)}; // beside
+    manager.cullObjects(ids, bounds);
+    
+    REQUIRE_FALSE(manager.isVisible(3));
+    REQUIRE(manager.isVisible(10));
+    REQUIRE_FALSE(manager.isVisible(64));
+    REQUIRE(manager.isVisible(130));
+    REQUIRE(manager.getVisibleSet().count() == 2);
+    
+    const auto& stats = manager.getStats();
+    REQUIRE(stats.totalObjects == 4);
+    REQUIRE(stats.frustumCulled == 1);
+    REQUIRE(stats.occlusionCulled == 1);
+    REQUIRE(stats.occlusionPassed == 2);
+    
+    REQUIRE(manager.testVisibility(3, bounds[0]) == VisibilityResult::Occluded);
+    
+    manager.endFrame();
+    manager.beginFrame(1);
+    REQUIRE(manager.wasOccluded(3));
+    REQUIRE_FALSE(manager.wasOccluded(64));
+}
+
+// =============================================================================
+// Batch Frustum Culling Tests
+// =============================================================================
+
+namespace {
+
+/// Deterministic scatter of boxes around and beyond the test frustum
+std::vector<AABB> scatterBoxes(u32 count, u32 seed = 1) {
+    std::vector<AABB> boxes;
+    u32 state = seed;
+    auto next = [&state] {
+        state = state * 1664525u + 1013904223u;
+        return static_cast<f32>(state >> 8) / static_cast<f32>(1u << 24);
+    };
+    for (u32 i = 0; i < count; ++i) {
+        boxes.push_back(boxAt(next() * 160.0f - 80.0f, next() * 100.0f - 50.0f, next() * 140.0f - 120.0f,
+                              0.1f + next() * 4.0f));
+    }
+    return boxes;
+}
+
+bool testBit(std::span<const u64> bits, u32 index) {
+    return (bits[index / 64] >> (index % 64)) & 1;
+}
+
+} // namespace
+
+TEST_CASE("BoundsSoA storage", "[occlusion][batch]") {
+    BoundsSoA bounds;
+    REQUIRE(bounds.empty());
+    
+    AABB box(Vec3{1.0f, 2.0f, 3.0f}, Vec3{3.0f, 6.0f, 4.0f});
+    for (u32 i = 0; i < 9; ++i) {
+        REQUIRE(bounds.add(box) == i);
+    }
+    REQUIRE(bounds.size() == 9);
+    REQUIRE(bounds.getCenters(1)[4] == Approx(4.0f));
+    REQUIRE(bounds.getExtents(0)[4] == Approx(1.0f));
+    REQUIRE(bounds.get(8).max.y == Approx(6.0f));
+    
+    bounds.set(8, boxAt(0.0f, 0.0f, 0.0f));
+    REQUIRE(bounds.get(8).min.x == Approx(-0.5f));
+    
+    // Padding after the last object reads as empty
+    REQUIRE(bounds.getCenters(0)[15] == 0.0f);
+    
+    bounds.clear();
+    REQUIRE(bounds.size() == 0);
+}
+
+TEST_CASE("cullFrustum matches per-object tests", "[occlusion][batch]") {
+    Frustum frustum;
+    frustum.extractFromMatrix(testViewProjection());
+    
+    auto boxes = scatterBoxes(5003);
+    BoundsSoA bounds;
+    for (const auto& box : boxes) bounds.add(box);
+    
+    std::vector<u64> bits((boxes.size() + 63) / 64, ~u64{0});
+    cullFrustum(frustum, bounds, bits);
+    
+    u32 visible = 0;
+    for (u32 i = 0; i < boxes.size(); ++i) {
+        bool expected = frustum.isAABBVisible(boxes[i]);
+        visible += expected ? 1 : 0;
+        if (testBit(bits, i) != expected) {
+            FAIL("object " << i << " differs from Frustum::testAABB");
+        }
     }
+    REQUIRE(visible > 0);
+    REQUIRE(visible < boxes.size());
+    
+    // Bits past the last object stay clear
+    REQUIRE((bits.back() >> (boxes.size() % 64)) == 0);
+    
+    SECTION("Threads agree") {
+        WorkerPool pool(4);
+        std::vector<u64> parallelBits(bits.size(), ~u64{0});
+        cullFrustum(frustum, bounds, parallelBits, &pool);
+        REQUIRE(parallelBits == bits);
+    }
+}
+
+TEST_CASE("cullFrustumHierarchical uses parent bounds", "[occlusion][batch]") {
+    Frustum frustum;
+    frustum.extractFromMatrix(testViewProjection());
+    
+    // 64 clusters of 40 objects, then 17 ungrouped objects
+    BoundsSoA objects;
+    BoundsSoA groupBounds;
+    std::vector<CullingGroup> groups;
+    auto centers = scatterBoxes(64, 7);
+    for (u32 g = 0; g < centers.size(); ++g) {
+        Vec3 center = centers[g].getCenter();
+        CullingGroup group;
+        group.firstObject = objects.size();
+        AABB enclosing = boxAt(center.x, center.y, center.z, 0.0f);
+        for (const auto& box : scatterBoxes(40, g + 100)) {
+            Vec3 offset = box.getCenter();
+            AABB child = boxAt(center.x + offset.x * 0.05f, center.y + offset.y * 0.05f,
+                               center.z + offset.z * 0.05f, 0.25f);
+            enclosing.expandToInclude(child);
+            objects.add(child);
+            group.objectCount++;
+        }
+        groups.push_back(group);
+        groupBounds.add(enclosing);
+    }
+    for (const auto& box : scatterBoxes(17, 3)) objects.add(box);
+    
+    std::vector<u64> flat((objects.size() + 63) / 64);
+    std::vector<u64> hierarchical(flat.size(), ~u64{0});
+    cullFrustum(frustum, objects, flat);
+    cullFrustumHierarchical(frustum, groupBounds, groups, objects, hierarchical);
+    
+    // Parents fully inside, fully outside and straddling are all covered
+    std::array<u32, 3> groupStates{};
+    for (u32 g = 0; g < groups.size(); ++g) {
+        groupStates[static_cast<usize>(frustum.testAABB(groupBounds.get(g)) + 1)]++;
+    }
+    REQUIRE(groupStates[0] > 0);
+    REQUIRE(groupStates[1] > 0);
+    REQUIRE(groupStates[2] > 0);
+    
+    // Objects lie within their parents, so skipping the tests of parents
+    // fully inside or outside gives the flat answer
+    for (u32 i = 0; i < objects.size(); ++i) {
+        if (testBit(flat, i) != testBit(hierarchical, i)) {
+            FAIL("object " << i << " differs from the flat test");
+        }
+    }
+    
+    SECTION("Threads agree") {
+        WorkerPool pool(3);
+        std::vector<u64> parallel(flat.size(), ~u64{0});
+        cullFrustumHierarchical(frustum, groupBounds, groups, objects, parallel, &pool);
+        REQUIRE(parallel == hierarchical);
+    }
+    
+    SECTION("Culled parents hide their objects") {
+        // Parent bounds decide: a group moved behind the camera culls its
+        // objects even though they are still in view
+        BoundsSoA moved = groupBounds;
+        for (u32 g = 0; g < groups.size(); ++g) {
+            moved.set(g, boxAt(0.0f, 0.0f, 50.0f));
+        }
+        std::vector<u64> bits(flat.size(), ~u64{0});
+        cullFrustumHierarchical(frustum, moved, groups, objects, bits);
+        for (u32 i = 0; i < groups.back().firstObject + groups.back().objectCount; ++i) {
+            REQUIRE_FALSE(testBit(bits, i));
+        }
+        for (u32 i = groups.back().firstObject + groups.back().objectCount; i < objects.size(); ++i) {
+            REQUIRE(testBit(bits, i) == testBit(flat, i));
+        }
+    }
+}
+
+TEST_CASE("OcclusionCullingManager batch frustum test", "[occlusion][manager][batch]") {
+    OcclusionCullingManager manager;
+    manager.updateFrustum(testViewProjection());
+    manager.beginFrame(0);
+    
+    BoundsSoA bounds;
+    bounds.add(boxAt(0.0f, 0.0f, -10.0f));
+    bounds.add(boxAt(0.0f, 0.0f, 10.0f));
+    bounds.add(boxAt(200.0f, 0.0f, -10.0f));
+    
+    std::array<u64, 1> bits{};
+    manager.testFrustumBatch(bounds, bits);
+    
+    REQUIRE(bits[0] == 0b001);
+    REQUIRE(manager.getStats().totalObjects == 3);
+    REQUIRE(manager.getStats().frustumPassed == 1);
+    REQUIRE(manager.getStats().frustumCulled == 2);
 }
 
 // =============================================================================
@@ -8,6 +8,8 @@
  * - Graph compilation and execution
  * - Pass culling
  * - Resource lifetime tracking
+ * - Transient memory aliasing and barrier generation
+ * - Compiled plan caching and parallel recording
  * 
  * @copyright Copyright (c) 2025 WeNova Interactive (Kayden Shawn Massengill)
  */
@@ -16,6 +18,9 @@
 #include <catch2/catch_approx.hpp>
 #include "nova/core/render/render_graph.hpp"
 
+#include <mutex>
+#include <thread>
+
 using namespace nova;
 using namespace nova::render;
 using Catch::Approx;
@@ -662,3 +667,356 @@ TEST_CASE("PostProcessSetup::create", "[render_graph][helpers]") {
     REQUIRE(pp.input.isValid());
     REQUIRE(pp.output.isValid());
 }
+
+// ============================================================================
+// Transient Memory and Barrier Tests
+// ============================================================================
+
+namespace {
+
+/// Three full-screen passes, each reading the previous pass's target, then a
+/// pass writing the back buffer. Targets: A [0,1], B [1,2], C [2,3].
+struct ChainGraph {
+    RenderGraph graph;
+    RGTextureHandle a, b, c, backBuffer;
+    
+    ChainGraph() {
+        backBuffer = graph.importBackBuffer(TextureHandle(1), 1024, 1024);
+        graph.addGraphicsPass("GBuffer",
+            [&](RenderGraphBuilder& builder) {
+                a = builder.createTexture(RGTextureDesc::renderTarget("A", 1024, 1024));
+                builder.setRenderTarget(0, a);
+            },
+            [](RenderGraphContext&) {});
+        graph.addGraphicsPass("Lighting",
+            [&](RenderGraphBuilder& builder) {
+                builder.read(a, ResourceAccess::FragmentShader);
+                b = builder.createTexture(RGTextureDesc::renderTarget("B", 1024, 1024));
+                builder.setRenderTarget(0, b);
+            },
+            [](RenderGraphContext&) {});
+        graph.addGraphicsPass("Bloom",
+            [&](RenderGraphBuilder& builder) {
+                builder.read(b, ResourceAccess::FragmentShader);
+                c = builder.createTexture(RGTextureDesc::renderTarget("C", 1024, 1024));
+                builder.setRenderTarget(0, c);
+            },
+            [](RenderGraphContext&) {});
+        graph.addGraphicsPass("Final",
+            [&](RenderGraphBuilder& builder) {
+                builder.read(c, ResourceAccess::FragmentShader);
+                builder.setRenderTarget(0, backBuffer);
+            },
+            [](RenderGraphContext&) {});
+        graph.compile();
+    }
+};
+
+} // namespace
+
+TEST_CASE("RenderGraph aliases transient resources with disjoint lifetimes", "[render_graph][aliasing]") {
+    ChainGraph chain;
+    const auto& graph = chain.graph;
+    const auto& a = graph.getResource(chain.a);
+    const auto& b = graph.getResource(chain.b);
+    const auto& c = graph.getResource(chain.c);
+    
+    REQUIRE(graph.getHeaps().size() == 1);
+    REQUIRE(graph.getHeaps()[0].type == RGHeapType::RenderTargets);
+    REQUIRE(a.allocationSize == 4u * 1024 * 1024);
+    
+    // A is dead once C is first written, so C reuses its memory
+    REQUIRE(c.heapOffset == a.heapOffset);
+    REQUIRE(b.heapOffset != a.heapOffset);
+    REQUIRE(c.aliasedResource == chain.a.index);
+    REQUIRE(b.aliasedResource == ~0u);
+    
+    const auto& stats = graph.getMemoryStats();
+    REQUIRE(stats.transientResources == 3);
+    REQUIRE(stats.transientBytes == 3 * a.allocationSize);
+    REQUIRE(stats.heapBytes == 2 * a.allocationSize);
+    REQUIRE(stats.savedBytes() == a.allocationSize);
+    REQUIRE(stats.aliasedResources == 1);
+    
+    // Imported resources are never placed
+    REQUIRE(graph.getResource(chain.backBuffer).heapIndex == ~0u);
+}
+
+TEST_CASE("RenderGraph never overlaps memory of live resources", "[render_graph][aliasing]") {
+    RenderGraph graph;
+    std::vector<RGTextureHandle> textures;
+    std::vector<RGBufferHandle> buffers;
+    u32 seed = 12345;
+    auto next = [&seed](u32 range) {
+        seed = seed * 1664525u + 1013904223u;
+        return (seed >> 8) % range;
+    };
+    
+    for (u32 p = 0; p < 24; ++p) {
+        graph.addComputePass("Pass" + std::to_string(p),
+            [&](RenderGraphBuilder& builder) {
+                for (u32 r = 0; r < 2 && !textures.empty(); ++r) {
+                    builder.read(textures[next(static_cast<u32>(textures.size()))]);
+                }
+                if (!buffers.empty()) {
+                    builder.read(buffers[next(static_cast<u32>(buffers.size()))]);
+                }
+                u32 size = 64 << next(5);
+                textures.push_back(builder.createTexture(RGTextureDesc::renderTarget("T", size, size)));
+                builder.write(textures.back());
+                buffers.push_back(builder.createBuffer(RGBufferDesc::storage("B", 1000 + next(100000))));
+                builder.write(buffers.back());
+                builder.setFlags(RGPassFlags::NoCulling);
+            },
+            [](RenderGraphContext&) {});
+    }
+    graph.compile();
+    
+    usize heapTotal = 0;
+    for (const auto& heap : graph.getHeaps()) heapTotal += heap.size;
+    const auto& stats = graph.getMemoryStats();
+    REQUIRE(stats.transientResources == 48);
+    REQUIRE(stats.heapBytes == heapTotal);
+    REQUIRE(stats.heapBytes < stats.transientBytes);
+    
+    for (u32 i = 0; i < graph.getResourceCount(); ++i) {
+        const auto& x = graph.getResource({i, 0});
+        REQUIRE(x.heapIndex != ~0u);
+        REQUIRE(x.heapOffset + x.allocationSize <= graph.getHeaps()[x.heapIndex].size);
+        for (u32 j = i + 1; j < graph.getResourceCount(); ++j) {
+            const auto& y = graph.getResource({j, 0});
+            bool live = x.firstPassUsage <= y.lastPassUsage && y.firstPassUsage <= x.lastPassUsage;
+            bool shared = x.heapIndex == y.heapIndex &&
+                          x.heapOffset < y.heapOffset + y.allocationSize &&
+                          y.heapOffset < x.heapOffset + x.allocationSize;
+            REQUIRE_FALSE((live && shared));
+        }
+    }
+}
+
+TEST_CASE("RenderGraph generates transition and aliasing barriers", "[render_graph][barriers]") {
+    ChainGraph chain;
+    const auto& graph = chain.graph;
+    
+    // GBuffer: initial layout of A
+    const auto& gbuffer = graph.getPass(0).barriers;
+    REQUIRE(gbuffer.size() == 1);
+    REQUIRE(gbuffer[0].resource == chain.a.index);
+    REQUIRE(gbuffer[0].before == ResourceAccess::None);
+    
+    // Lighting: A from attachment to shader read, initial layout of B
+    const auto& lighting = graph.getPass(1).barriers;
+    REQUIRE(lighting.size() == 2);
+    REQUIRE(lighting[0].resource == chain.a.index);
+    REQUIRE(hasAccess(lighting[0].before, ResourceAccess::ColorAttachment));
+    REQUIRE(hasAccess(lighting[0].after, ResourceAccess::FragmentShader));
+    REQUIRE(lighting[0].split == RGBarrierSplit::None);
+    
+    // Bloom: C takes over A's memory
+    const auto& bloom = graph.getPass(2).barriers;
+    REQUIRE(bloom.size() == 2);
+    REQUIRE(bloom[1].type == RGBarrierType::Aliasing);
+    REQUIRE(bloom[1].resource == chain.c.index);
+    REQUIRE(bloom[1].aliasedResource == chain.a.index);
+    
+    std::string dump = graph.dump();
+    REQUIRE(dump.find("alias of A") != std::string::npos);
+    REQUIRE(dump.find("--- Memory ---") != std::string::npos);
+    REQUIRE(graph.exportGraphViz().find("label=\"aliased\"") != std::string::npos);
+}
+
+TEST_CASE("RenderGraph splits barriers and skips read-after-read", "[render_graph][barriers]") {
+    RenderGraph graph;
+    RGBufferHandle data;
+    auto noop = [](RenderGraphContext&) {};
+    
+    graph.addComputePass("Produce",
+        [&](RenderGraphBuilder& builder) {
+            data = builder.createBuffer(RGBufferDesc::storage("Data", 4096));
+            builder.write(data, ResourceAccess::ComputeShader);
+            builder.setFlags(RGPassFlags::NoCulling);
+        }, noop);
+    graph.addComputePass("Unrelated",
+        [&](RenderGraphBuilder& builder) { builder.setFlags(RGPassFlags::NoCulling); }, noop);
+    graph.addGraphicsPass("ReadFragment",
+        [&](RenderGraphBuilder& builder) {
+            builder.read(data, ResourceAccess::FragmentShader);
+            builder.setFlags(RGPassFlags::NoCulling);
+        }, noop);
+    graph.addComputePass("ReadCompute",
+        [&](RenderGraphBuilder& builder) {
+            builder.read(data, ResourceAccess::ComputeShader);
+            builder.setFlags(RGPassFlags::NoCulling);
+        }, noop);
+    graph.addComputePass("Overwrite",
+        [&](RenderGraphBuilder& builder) {
+            builder.write(data, ResourceAccess::ComputeShader);
+            builder.setFlags(RGPassFlags::NoCulling);
+        }, noop);
+    graph.compile();
+    REQUIRE(graph.getExecutionOrder() == std::vector<u32>{0, 1, 2, 3, 4});
+    
+    // Buffers need no barrier on first use
+    REQUIRE(graph.getPass(0).barriers.empty());
+    
+    // Write -> read with a pass in between: begins after the producer
+    REQUIRE(graph.getPass(1).barriers.size() == 1);
+    REQUIRE(graph.getPass(1).barriers[0].split == RGBarrierSplit::Begin);
+    REQUIRE(graph.getPass(2).barriers.size() == 1);
+    REQUIRE(graph.getPass(2).barriers[0].split == RGBarrierSplit::End);
+    
+    // Second read in the same state needs nothing
+    REQUIRE(graph.getPass(3).barriers.empty());
+    
+    // The overwrite waits for both readers
+    const auto& overwrite = graph.getPass(4).barriers;
+    REQUIRE(overwrite.size() == 1);
+    REQUIRE(overwrite[0].split == RGBarrierSplit::None);
+    REQUIRE(hasAccess(overwrite[0].before, ResourceAccess::FragmentShader));
+    REQUIRE(hasAccess(overwrite[0].before, ResourceAccess::ComputeShader));
+    
+    const auto& stats = graph.getMemoryStats();
+    REQUIRE(stats.barrierCount == 3);
+    REQUIRE(stats.splitBarrierCount == 1);
+}
+
+// ============================================================================
+// Plan Caching and Parallel Recording Tests
+// ============================================================================
+
+namespace {
+
+/// A frame of the deferred pipeline: shadow, gbuffer, lighting, present
+void buildFrame(RenderGraph& graph, u32 width, TextureHandle backBuffer) {
+    auto bb = graph.importBackBuffer(backBuffer, width, 720);
+    RGTextureHandle shadow, albedo, lit;
+    graph.addGraphicsPass("Shadow",
+        [&](RenderGraphBuilder& builder) { shadow = ShadowMapSetup::create(builder).shadowMap; },
+        [](RenderGraphContext&) {});
+    graph.addGraphicsPass("GBuffer",
+        [&](RenderGraphBuilder& builder) { albedo = GBufferSetup::create(builder, width, 720).albedo; },
+        [](RenderGraphContext&) {});
+    graph.addGraphicsPass("Lighting",
+        [&](RenderGraphBuilder& builder) {
+            builder.read(shadow, ResourceAccess::FragmentShader);
+            lit = PostProcessSetup::create(builder, albedo, "Lit", width, 720).output;
+        },
+        [](RenderGraphContext&) {});
+    graph.addGraphicsPass("Present",
+        [&](RenderGraphBuilder& builder) {
+            builder.read(lit, ResourceAccess::FragmentShader);
+            builder.setRenderTarget(0, bb);
+        },
+        [](RenderGraphContext&) {});
+}
+
+} // namespace
+
+TEST_CASE("RenderGraph reuses the compiled plan for an unchanged structure", "[render_graph][cache]") {
+    RenderGraph graph;
+    
+    buildFrame(graph, 1280, TextureHandle(1));
+    graph.compile();
+    auto first = graph.getFrameStats();
+    auto order = graph.getExecutionOrder();
+    auto heaps = graph.getHeaps();
+    auto barriers = graph.getPass(2).barriers;
+    REQUIRE_FALSE(first.planReused);
+    REQUIRE(first.planCacheMisses == 1);
+    
+    // Same structure, different swap chain image
+    graph.reset();
+    buildFrame(graph, 1280, TextureHandle(2));
+    graph.compile();
+    const auto& second = graph.getFrameStats();
+    REQUIRE(second.planReused);
+    REQUIRE(second.planCacheHits == 1);
+    REQUIRE(second.structureHash == first.structureHash);
+    REQUIRE(graph.getExecutionOrder() == order);
+    REQUIRE(graph.getHeaps().size() == heaps.size());
+    REQUIRE(graph.getHeaps()[0].size == heaps[0].size);
+    REQUIRE(graph.getPass(2).barriers.size() == barriers.size());
+    REQUIRE(graph.getPass(1).dependents == std::vector<u32>{2});
+    
+    // Imported handles come from this frame, not the cached plan
+    RenderGraphContext ctx(graph, graph.getPass(3));
+    REQUIRE(ctx.getTexture(graph.getBackBuffer()) == TextureHandle(2));
+    
+    // A resized target changes the structure
+    graph.reset();
+    buildFrame(graph, 1920, TextureHandle(1));
+    graph.compile();
+    REQUIRE_FALSE(graph.getFrameStats().planReused);
+    REQUIRE(graph.getFrameStats().structureHash != first.structureHash);
+    REQUIRE(graph.getFrameStats().planCacheMisses == 2);
+}
+
+TEST_CASE("RenderGraph records batches in parallel and submits in order", "[render_graph][parallel]") {
+    RenderGraph graph;
+    constexpr u32 PASS_COUNT = 23;
+    std::vector<u32> recordedBatch(PASS_COUNT, ~0u);
+    std::vector<std::thread::id> recordedThread(PASS_COUNT);
+    std::vector<CommandBuffer*> recordedList(PASS_COUNT);
+    
+    RGBufferHandle previous;
+    for (u32 p = 0; p < PASS_COUNT; ++p) {
+        graph.addComputePass("Pass" + std::to_string(p),
+            [&, p](RenderGraphBuilder& builder) {
+                if (previous.isValid()) builder.read(previous);
+                previous = builder.createBuffer(RGBufferDesc::storage("Data", 1024));
+                builder.write(previous);
+                builder.setFlags(p == 10 ? RGPassFlags::NoCulling | RGPassFlags::ForceSerial
+                                         : RGPassFlags::NoCulling);
+            },
+            [&, p](RenderGraphContext& ctx) {
+                recordedBatch[p] = ctx.getBatch();
+                recordedThread[p] = std::this_thread::get_id();
+                recordedList[p] = ctx.getCommandList();
+            });
+    }
+    graph.compile();
+    
+    // Fake command lists; the graph never dereferences them
+    std::mutex acquireMutex;
+    u32 acquired = 0;
+    std::vector<CommandBuffer*> submitted;
+    RGExecuteOptions options;
+    options.threadCount = 4;
+    options.acquireCommandList = [&](u32 batch) {
+        std::lock_guard<std::mutex> lock(acquireMutex);
+        acquired++;
+        return reinterpret_cast<CommandBuffer*>(static_cast<uintptr_t>(batch) + 1);
+    };
+    options.submit = [&](std::span<CommandBuffer* const> lists) {
+        submitted.assign(lists.begin(), lists.end());
+    };
+    
+    for (int frame = 0; frame < 3; ++frame) {
+        graph.execute(options);
+        
+        // Four parallel batches around one serial batch
+        const auto& stats = graph.getFrameStats();
+        REQUIRE(stats.recordBatches == 5);
+        REQUIRE(stats.recordThreads == 4);
+        REQUIRE(submitted.size() == 5);
+        for (u32 b = 0; b < submitted.size(); ++b) {
+            REQUIRE(reinterpret_cast<uintptr_t>(submitted[b]) == b + 1);
+        }
+        
+        // Batches are contiguous and increase along the execution order
+        for (u32 i = 1; i < PASS_COUNT; ++i) {
+            u32 pass = graph.getExecutionOrder()[i];
+            u32 prev = graph.getExecutionOrder()[i - 1];
+            REQUIRE(recordedBatch[pass] >= recordedBatch[prev]);
+            REQUIRE(recordedBatch[pass] <= recordedBatch[prev] + 1);
+            REQUIRE(recordedList[pass] == submitted[recordedBatch[pass]]);
+        }
+        REQUIRE(recordedThread[10] == std::this_thread::get_id());
+    }
+    REQUIRE(acquired == 15);
+    
+    // One thread gives one list in execution order
+    graph.execute();
+    REQUIRE(graph.getFrameStats().recordBatches == 3);
+    REQUIRE(graph.getFrameStats().recordThreads == 1);
+}
@@ -10,6 +10,13 @@
 #include <catch2/catch_approx.hpp>
 #include <nova/core/resource/resource.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <thread>
+
 using namespace nova;
 using namespace nova::resource;
 using Catch::Approx;
@@ -105,3 +112,743 @@ TEST_CASE("Resource Types - ResourcePath", "[resource][types]") {
         REQUIRE(path.path == "textures/player.png");
     }
 }
+
+// ============================================================================
+// Resource Pack Tests
+// ============================================================================
+
+namespace {
+
+/// Temporary file removed at scope exit
+struct TempFile {
+    std::filesystem::path path;
+
+    explicit TempFile(const char* name) : path(std::filesystem::temp_directory_path() / name) {}
+    ~TempFile() {
+        std::error_code ec;
+        std::filesystem::remove(path, ec);
+    }
+};
+
+std::vector<u8> repeatedText(usize size) {
+    const std::string_view pattern = "the quick brown fox jumps over the lazy dog ";
+    std::vector<u8> data(size);
+    for (usize i = 0; i < size; ++i) {
+        data[i] = static_cast<u8>(pattern[i % pattern.size()]);
+    }
+    return data;
+}
+
+std::vector<u8> noise(usize size) {
+    std::vector<u8> data(size);
+    u32 state = 0x12345678u;
+    for (auto& byte : data) {
+        state = state * 1664525u + 1013904223u;
+        byte = static_cast<u8>(state >> 24);
+    }
+    return data;
+}
+
+class PackBlob : public Resource {
+public:
+    std::vector<u8> bytes;
+
+protected:
+    bool load(const std::vector<u8>& data) override {
+        bytes = data;
+        return true;
+    }
+    void unload() override { bytes.clear(); }
+    usize calculateMemorySize() const override { return bytes.size(); }
+};
+
+class PackBlobLoader : public IResourceLoader {
+public:
+    u32* inPlaceLoads;
+
+    explicit PackBlobLoader(u32* counter) : inPlaceLoads(counter) {}
+
+    std::vector<std::string> getSupportedExtensions() const override { return {"packblob"}; }
+    ResourceType getResourceType() const override { return ResourceType::Unknown; }
+    bool canLoad(const ResourcePath& path) const override { return path.getExtension() == "packblob"; }
+    std::shared_ptr<Resource> createResource() override { return std::make_shared<PackBlob>(); }
+    bool load(Resource* resource, const std::vector<u8>& data) override {
+        static_cast<PackBlob*>(resource)->bytes = data;
+        return true;
+    }
+    bool loadFromMemory(Resource* resource, std::span<const u8> data) override {
+        ++*inPlaceLoads;
+        static_cast<PackBlob*>(resource)->bytes.assign(data.begin(), data.end());
+        return true;
+    }
+    const char* getName() const override { return "PackBlobLoader"; }
+};
+
+} // namespace
+
+TEST_CASE("Resource Pack - Write and map", "[resource][pack]") {
+    TempFile file("nova_test_pack.pak");
+    auto text = repeatedText(4096);
+    auto random = noise(1000);
+    std::vector<u8> small = {1, 2, 3};
+
+    ResourcePackWriter writer(64);
+    REQUIRE(writer.add("textures/b.png", random, ResourceType::Texture2D, PackCompression::LZ4));
+    REQUIRE(writer.add("shaders/a.glsl", text, ResourceType::Shader, PackCompression::LZ4));
+    REQUIRE(writer.add("data/c.bin", small));
+    REQUIRE(writer.add("data/empty.bin", {}));
+    REQUIRE_FALSE(writer.add("data/c.bin", small));
+    REQUIRE(writer.write(file.path.string()));
+
+    auto opened = ResourcePack::open(file.path.string());
+    REQUIRE(opened);
+    const ResourcePack& pack = **opened;
+    REQUIRE(pack.getEntries().size() == 4);
+    REQUIRE(pack.getPath(pack.getEntries().front()) == "data/c.bin");
+
+    SECTION("Compressible entries are compressed, others stored") {
+        const PackEntry* shader = pack.find("shaders/a.glsl");
+        REQUIRE(shader != nullptr);
+        REQUIRE(shader->compression == PackCompression::LZ4);
+        REQUIRE(shader->storedSize < text.size());
+        REQUIRE(shader->type == ResourceType::Shader);
+        REQUIRE(pack.read(*shader).value() == text);
+
+        const PackEntry* texture = pack.find("textures/b.png");
+        REQUIRE(texture != nullptr);
+        REQUIRE_FALSE(texture->isCompressed());
+        REQUIRE(pack.read(*texture).value() == random);
+    }
+
+    SECTION("Uncompressed entries are aligned views of the mapping") {
+        const PackEntry* entry = pack.find(ResourceId::fromPath("data/c.bin"));
+        REQUIRE(entry != nullptr);
+        REQUIRE(entry->offset % 64 == 0);
+        auto view = pack.view(*entry);
+        REQUIRE(std::vector<u8>(view.begin(), view.end()) == small);
+        REQUIRE(reinterpret_cast<uintptr_t>(view.data()) % 64 == 0);
+
+        const PackEntry* empty = pack.find("data/empty.bin");
+        REQUIRE(empty != nullptr);
+        REQUIRE(pack.view(*empty).empty());
+    }
+
+    SECTION("Missing paths are not found") {
+        REQUIRE(pack.find("data/missing.bin") == nullptr);
+        REQUIRE(pack.find(ResourceId::fromPath("data/missing.bin")) == nullptr);
+    }
+}
+
+TEST_CASE("Resource Pack - LZ4 round trip at many sizes", "[resource][pack]") {
+    TempFile file("nova_test_pack_lz4.pak");
+    ResourcePackWriter writer;
+    std::vector<std::vector<u8>> blobs;
+    for (usize size : {1, 12, 13, 17, 255, 256, 270, 4096, 70000}) {
+        auto blob = repeatedText(size);
+        // Break up the pattern so matches of many lengths and offsets appear
+        for (usize i = 0; i < size; i += 97) {
+            blob[i] = static_cast<u8>(i);
+        }
+        REQUIRE(writer.add("blob" + std::to_string(size), blob, ResourceType::Unknown, PackCompression::LZ4));
+        blobs.push_back(std::move(blob));
+    }
+    REQUIRE(writer.write(file.path.string()));
+
+    auto pack = ResourcePack::open(file.path.string());
+    REQUIRE(pack);
+    for (const auto& blob : blobs) {
+        const PackEntry* entry = (*pack)->find("blob" + std::to_string(blob.size()));
+        REQUIRE(entry != nullptr);
+        REQUIRE((*pack)->read(*entry).value() == blob);
+    }
+}
+
+TEST_CASE("Resource Pack - Rejects invalid files", "[resource][pack]") {
+    TempFile file("nova_test_pack_bad.pak");
+
+    SECTION("Missing file") {
+        REQUIRE_FALSE(ResourcePack::open(file.path.string()));
+    }
+
+    SECTION("Not a pack") {
+        std::ofstream(file.path, std::ios::binary) << "definitely not a resource pack, just some text";
+        REQUIRE_FALSE(ResourcePack::open(file.path.string()));
+    }
+
+    SECTION("Truncated pack") {
+        ResourcePackWriter writer;
+        REQUIRE(writer.add("a.bin", noise(256)));
+        REQUIRE(writer.write(file.path.string()));
+        std::filesystem::resize_file(file.path, std::filesystem::file_size(file.path) - 1);
+        REQUIRE_FALSE(ResourcePack::open(file.path.string()));
+    }
+
+    // Valid single-entry pack whose bytes the sections below corrupt
+    auto patchPack = [&](auto&& patch) {
+        ResourcePackWriter writer;
+        REQUIRE(writer.add("a.txt", repeatedText(4096), ResourceType::Unknown, PackCompression::LZ4));
+        REQUIRE(writer.write(file.path.string()));
+
+        std::vector<u8> bytes(std::filesystem::file_size(file.path));
+        std::ifstream(file.path, std::ios::binary).read(reinterpret_cast<char*>(bytes.data()),
+                                                        static_cast<std::streamsize>(bytes.size()));
+        PackHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        patch(bytes, header);
+        std::ofstream(file.path, std::ios::binary).write(reinterpret_cast<const char*>(bytes.data()),
+                                                         static_cast<std::streamsize>(bytes.size()));
+    };
+
+    SECTION("Index without an empty slot") {
+        patchPack([](std::vector<u8>& bytes, const PackHeader& header) {
+            const u32 slot = 1;
+            for (u32 i = 0; i < header.indexSize; ++i) {
+                std::memcpy(bytes.data() + header.indexOffset + i * sizeof(u32), &slot, sizeof(slot));
+            }
+        });
+        REQUIRE_FALSE(ResourcePack::open(file.path.string()));
+    }
+
+    SECTION("Entry larger than its compressed data allows") {
+        patchPack([](std::vector<u8>& bytes, const PackHeader& header) {
+            PackEntry entry;
+            std::memcpy(&entry, bytes.data() + header.entriesOffset, sizeof(entry));
+            REQUIRE(entry.compression == PackCompression::LZ4);
+            entry.size = entry.storedSize * PackFormat::LZ4_MAX_RATIO + 1;
+            std::memcpy(bytes.data() + header.entriesOffset, &entry, sizeof(entry));
+        });
+        REQUIRE_FALSE(ResourcePack::open(file.path.string()));
+    }
+}
+
+TEST_CASE("Resource Manager - Bundles serve packed resources", "[resource][pack]") {
+    TempFile file("nova_test_bundle.pak");
+    auto text = repeatedText(2048);
+    std::vector<u8> raw = {9, 8, 7, 6};
+
+    ResourcePackWriter writer;
+    REQUIRE(writer.add("packed/raw.packblob", raw));
+    REQUIRE(writer.add("packed/text.packblob", text, ResourceType::Unknown, PackCompression::LZ4));
+    REQUIRE(writer.write(file.path.string()));
+
+    auto& manager = ResourceManager::get();
+    REQUIRE(manager.initialize(ResourceConfig::DEFAULT_CACHE_SIZE, 1));
+    u32 inPlaceLoads = 0;
+    manager.registerLoader(std::make_unique<PackBlobLoader>(&inPlaceLoads));
+
+    REQUIRE_FALSE(manager.loadBundle("missing/bundle.pak"));
+    REQUIRE(manager.loadBundle(file.path.string()));
+
+    const ResourceBundle* bundle = manager.getBundle("nova_test_bundle");
+    REQUIRE(bundle != nullptr);
+    REQUIRE(bundle->resources.size() == 2);
+    REQUIRE(bundle->totalSize == raw.size() + text.size());
+    REQUIRE(bundle->isCompressed);
+    REQUIRE(manager.exists("packed/raw.packblob"));
+
+    auto rawHandle = manager.load<PackBlob>("packed/raw.packblob");
+    REQUIRE(rawHandle.isValid());
+    REQUIRE(rawHandle->bytes == raw);
+    REQUIRE(inPlaceLoads == 1);
+
+    auto textHandle = manager.load<PackBlob>("packed/text.packblob");
+    REQUIRE(textHandle.isValid());
+    REQUIRE(textHandle->bytes == text);
+    REQUIRE(inPlaceLoads == 1);
+
+    REQUIRE(manager.readFile("packed/text.packblob") == text);
+
+    rawHandle = {};
+    textHandle = {};
+    manager.unloadBundle("nova_test_bundle");
+    REQUIRE(manager.getBundle("nova_test_bundle") == nullptr);
+    REQUIRE_FALSE(manager.exists("packed/raw.packblob"));
+
+    manager.shutdown();
+}
+
+// ============================================================================
+// Load Pipeline Tests
+// ============================================================================
+
+namespace {
+
+/// Records decode order; decoding "gate" paths blocks until released
+class PipelineLoader : public IResourceLoader {
+public:
+    std::mutex mutex;
+    std::vector<std::string> decoded;
+    std::atomic<bool> gateEntered{false};
+    std::atomic<bool> gateOpen{true};
+
+    std::vector<std::string> getSupportedExtensions() const override { return {"pipeblob"}; }
+    ResourceType getResourceType() const override { return ResourceType::Unknown; }
+    bool canLoad(const ResourcePath& path) const override { return path.getExtension() == "pipeblob"; }
+    std::shared_ptr<Resource> createResource() override { return std::make_shared<PackBlob>(); }
+    bool load(Resource* resource, const std::vector<u8>& data) override {
+        return loadFromMemory(resource, data);
+    }
+    bool loadFromMemory(Resource* resource, std::span<const u8> data) override {
+        if (resource->getPath().path.find("gate") != std::string::npos) {
+            gateEntered = true;
+            while (!gateOpen) {
+                std::this_thread::yield();
+            }
+        }
+        {
+            std::lock_guard lock(mutex);
+            decoded.push_back(resource->getPath().path);
+        }
+        static_cast<PackBlob*>(resource)->bytes.assign(data.begin(), data.end());
+        return true;
+    }
+    const char* getName() const override { return "PipelineLoader"; }
+
+    usize decodeCount(const std::string& path) {
+        std::lock_guard lock(mutex);
+        return static_cast<usize>(std::count(decoded.begin(), decoded.end(), path));
+    }
+};
+
+/// Pack of small .pipeblob entries mounted into an initialized manager
+struct PipelineFixture {
+    TempFile file{"nova_test_pipeline.pak"};
+    PipelineLoader* loader = nullptr;
+
+    explicit PipelineFixture(std::initializer_list<const char*> paths) {
+        ResourcePackWriter writer;
+        for (const char* path : paths) {
+            REQUIRE(writer.add(path, repeatedText(64)));
+        }
+        REQUIRE(writer.write(file.path.string()));
+
+        auto& manager = ResourceManager::get();
+        REQUIRE(manager.initialize(ResourceConfig::DEFAULT_CACHE_SIZE, 1));
+        auto owned = std::make_unique<PipelineLoader>();
+        loader = owned.get();
+        manager.registerLoader(std::move(owned));
+        REQUIRE(manager.loadBundle(file.path.string()));
+    }
+
+    ~PipelineFixture() {
+        ResourceManager::get().shutdown();
+    }
+
+    /// Run update() until every future is ready
+    static bool pump(std::initializer_list<const ResourceManager::LoadFuture*> futures) {
+        auto ready = [&] {
+            return std::all_of(futures.begin(), futures.end(), [](const ResourceManager::LoadFuture* future) {
+                return future->wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+            });
+        };
+        for (int i = 0; i < 5000 && !ready(); ++i) {
+            ResourceManager::get().update(0.0f);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return ready();
+    }
+};
+
+} // namespace
+
+TEST_CASE("Resource Manager - Duplicate async requests share one load", "[resource][pipeline]") {
+    PipelineFixture fixture({"pipe/a.pipeblob"});
+    auto& manager = ResourceManager::get();
+
+    int callbacks = 0;
+    auto first = manager.requestLoad("pipe/a.pipeblob", LoadPriority::Low, LoadFlags::Async,
+                                     [&](ResourceHandle<>) { ++callbacks; });
+    auto second = manager.requestLoad("pipe/a.pipeblob", LoadPriority::High, LoadFlags::Async,
+                                      [&](ResourceHandle<>) { ++callbacks; });
+    manager.loadAsync<PackBlob>("pipe/a.pipeblob", [&](ResourceHandle<PackBlob> blob) {
+        REQUIRE(blob.isValid());
+        ++callbacks;
+    });
+
+    REQUIRE(PipelineFixture::pump({&first, &second}));
+    REQUIRE(first.get() == second.get());
+    REQUIRE(first.get().isLoaded());
+    REQUIRE(callbacks == 3);
+    REQUIRE(fixture.loader->decodeCount("pipe/a.pipeblob") == 1);
+
+    // Requests after completion are served from the cache
+    auto third = manager.requestLoad("pipe/a.pipeblob");
+    REQUIRE(third.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    REQUIRE(third.get() == first.get());
+    REQUIRE(fixture.loader->decodeCount("pipe/a.pipeblob") == 1);
+}
+
+TEST_CASE("Resource Manager - Priority reorders queued loads", "[resource][pipeline]") {
+    PipelineFixture fixture({"pipe/gate.pipeblob", "pipe/a.pipeblob", "pipe/b.pipeblob", "pipe/c.pipeblob"});
+    auto& manager = ResourceManager::get();
+
+    // Occupy the only decode worker
+    fixture.loader->gateOpen = false;
+    auto gate = manager.requestLoad("pipe/gate.pipeblob");
+    while (!fixture.loader->gateEntered) {
+        std::this_thread::yield();
+    }
+
+    auto a = manager.requestLoad("pipe/a.pipeblob", LoadPriority::Low);
+    auto b = manager.requestLoad("pipe/b.pipeblob", LoadPriority::Low);
+    auto c = manager.requestLoad("pipe/c.pipeblob", LoadPriority::High);
+    auto aAgain = manager.requestLoad("pipe/a.pipeblob", LoadPriority::Immediate);
+    fixture.loader->gateOpen = true;
+
+    REQUIRE(PipelineFixture::pump({&gate, &a, &b, &c, &aAgain}));
+    std::vector<std::string> expected = {"pipe/gate.pipeblob", "pipe/a.pipeblob", "pipe/c.pipeblob", "pipe/b.pipeblob"};
+    REQUIRE(fixture.loader->decoded == expected);
+}
+
+TEST_CASE("Resource Manager - Synchronous load joins an async request", "[resource][pipeline]") {
+    PipelineFixture fixture({"pipe/a.pipeblob"});
+    auto& manager = ResourceManager::get();
+
+    auto future = manager.requestLoad("pipe/a.pipeblob", LoadPriority::Background);
+    auto handle = manager.load<PackBlob>("pipe/a.pipeblob");
+    REQUIRE(handle.isLoaded());
+    REQUIRE(handle->bytes == repeatedText(64));
+
+    // load() finalized it, so the future is ready without update()
+    REQUIRE(future.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    REQUIRE(future.get().get() == handle.get());
+    REQUIRE(fixture.loader->decodeCount("pipe/a.pipeblob") == 1);
+}
+
+TEST_CASE("Resource Manager - Concurrent synchronous loads share one load", "[resource][pipeline]") {
+    PipelineFixture fixture({"pipe/gate.pipeblob"});
+    auto& manager = ResourceManager::get();
+
+    // The first load decodes on its own thread and holds the gate
+    fixture.loader->gateOpen = false;
+    ResourceHandle<PackBlob> first;
+    std::thread owner([&] { first = manager.load<PackBlob>("pipe/gate.pipeblob"); });
+    while (!fixture.loader->gateEntered) {
+        std::this_thread::yield();
+    }
+
+    // The second joins the in-flight load and waits for its decode
+    ResourceHandle<PackBlob> second;
+    std::thread joiner([&] { second = manager.load<PackBlob>("pipe/gate.pipeblob"); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    fixture.loader->gateOpen = true;
+
+    owner.join();
+    joiner.join();
+    REQUIRE(first.isLoaded());
+    REQUIRE(second.get() == first.get());
+    REQUIRE(fixture.loader->decodeCount("pipe/gate.pipeblob") == 1);
+}
+
+TEST_CASE("Resource Manager - Failed async loads resolve", "[resource][pipeline]") {
+    PipelineFixture fixture({"pipe/a.pipeblob"});
+    auto& manager = ResourceManager::get();
+
+    auto missing = manager.requestLoad("pipe/missing.pipeblob");
+    auto noLoader = manager.requestLoad("pipe/a.unknown");
+    REQUIRE(PipelineFixture::pump({&missing, &noLoader}));
+    REQUIRE(missing.get().isValid());
+    REQUIRE(missing.get()->isFailed());
+    REQUIRE_FALSE(noLoader.get().isValid());
+    REQUIRE(manager.getStats().loadRequestsFailed >= 1);
+}
+
+// ============================================================================
+// Cache Budgets
+// ============================================================================
+
+namespace {
+
+class SizedBlob : public Resource {
+public:
+    SizedBlob(ResourceType type, usize size, LoadFlags flags = LoadFlags::None) : m_size(size) {
+        m_type = type;
+        m_flags = flags;
+    }
+
+protected:
+    bool load(const std::vector<u8>&) override { return true; }
+    void unload() override {}
+    usize calculateMemorySize() const override { return m_size; }
+
+private:
+    usize m_size;
+};
+
+/// Restores the shared manager's cache settings after a test
+struct CacheFixture {
+    ~CacheFixture() {
+        auto& manager = ResourceManager::get();
+        manager.unloadAll();
+        manager.setTypeBudget(ResourceType::Texture2D, ~usize(0));
+        manager.setTypeBudget(ResourceType::Mesh, ~usize(0));
+        manager.setCacheSize(ResourceConfig::DEFAULT_CACHE_SIZE);
+    }
+
+    static void add(const char* path, ResourceType type, usize size, LoadFlags flags = LoadFlags::None) {
+        ResourceManager::get().registerResource(std::make_shared<SizedBlob>(type, size, flags), path);
+    }
+};
+
+} // namespace
+
+TEST_CASE("Resource Manager - Memory is accounted incrementally", "[resource][cache]") {
+    CacheFixture fixture;
+    auto& manager = ResourceManager::get();
+    manager.unloadAll();
+    REQUIRE(manager.getUsedMemory() == 0);
+
+    CacheFixture::add("cache/a", ResourceType::Texture2D, 100);
+    CacheFixture::add("cache/b", ResourceType::Mesh, 250);
+    REQUIRE(manager.getUsedMemory() == 350);
+    REQUIRE(manager.getTypeMemory(ResourceType::Texture2D) == 100);
+    REQUIRE(manager.getTypeMemory(ResourceType::Mesh) == 250);
+    REQUIRE(manager.getStats().usedMemory == 350);
+
+    // Re-registering a path replaces its charge
+    CacheFixture::add("cache/a", ResourceType::Texture2D, 40);
+    REQUIRE(manager.getUsedMemory() == 290);
+
+    manager.unload(ResourcePath("cache/b"));
+    REQUIRE(manager.getUsedMemory() == 40);
+    REQUIRE(manager.getTypeMemory(ResourceType::Mesh) == 0);
+
+    manager.unloadAll();
+    REQUIRE(manager.getUsedMemory() == 0);
+}
+
+TEST_CASE("Resource Manager - Trimming evicts least recently used first", "[resource][cache]") {
+    CacheFixture fixture;
+    auto& manager = ResourceManager::get();
+    manager.unloadAll();
+
+    CacheFixture::add("cache/a", ResourceType::Texture2D, 100);
+    CacheFixture::add("cache/b", ResourceType::Mesh, 100);
+    CacheFixture::add("cache/c", ResourceType::Texture2D, 100);
+    CacheFixture::add("cache/d", ResourceType::Mesh, 100, LoadFlags::Persistent);
+
+    // A cache hit makes a the most recently used
+    REQUIRE(manager.load("cache/a").isValid());
+
+    manager.setCacheSize(300);
+    REQUIRE_FALSE(manager.isLoaded(ResourcePath("cache/b")));
+    REQUIRE(manager.isLoaded(ResourcePath("cache/a")));
+    REQUIRE(manager.isLoaded(ResourcePath("cache/c")));
+
+    // Held and persistent resources stay even when over budget
+    auto held = manager.load("cache/c");
+    manager.setCacheSize(0);
+    REQUIRE_FALSE(manager.isLoaded(ResourcePath("cache/a")));
+    REQUIRE(manager.isLoaded(ResourcePath("cache/c")));
+    REQUIRE(manager.isLoaded(ResourcePath("cache/d")));
+    REQUIRE(manager.getUsedMemory() == 200);
+}
+
+TEST_CASE("Resource Manager - Type budgets evict within the type", "[resource][cache]") {
+    CacheFixture fixture;
+    auto& manager = ResourceManager::get();
+    manager.unloadAll();
+
+    CacheFixture::add("cache/mesh", ResourceType::Mesh, 100);
+    CacheFixture::add("cache/t1", ResourceType::Texture2D, 100);
+    CacheFixture::add("cache/t2", ResourceType::Texture2D, 100);
+    CacheFixture::add("cache/t3", ResourceType::Texture2D, 100);
+
+    manager.setTypeBudget(ResourceType::Texture2D, 150);
+    REQUIRE(manager.getTypeBudget(ResourceType::Texture2D) == 150);
+    REQUIRE(manager.getTypeMemory(ResourceType::Texture2D) == 100);
+    REQUIRE(manager.isLoaded(ResourcePath("cache/t3")));
+    REQUIRE(manager.isLoaded(ResourcePath("cache/mesh")));
+    REQUIRE(manager.getUsedMemory() == 200);
+}
+
+namespace {
+
+/// Tagged, so handle casts compare types instead of using RTTI
+class TaggedBlob : public SizedBlob {
+public:
+    static constexpr ResourceType RESOURCE_TYPE = ResourceType::Shader;
+
+    TaggedBlob() : SizedBlob(RESOURCE_TYPE, 64) {}
+};
+
+} // namespace
+
+TEST_CASE("Resource Manager - Concurrent hits and tagged casts", "[resource][registry]") {
+    CacheFixture fixture;
+    auto& manager = ResourceManager::get();
+    manager.unloadAll();
+    manager.resetStats();
+
+    constexpr u32 RESOURCE_COUNT = 64;
+    for (u32 i = 0; i < RESOURCE_COUNT; ++i) {
+        manager.registerResource(std::make_shared<TaggedBlob>(), "registry/" + std::to_string(i));
+    }
+    CacheFixture::add("registry/mesh", ResourceType::Mesh, 64);
+    REQUIRE(manager.getStats().totalResources == RESOURCE_COUNT + 1);
+
+    // Tagged casts check the type tag
+    REQUIRE(manager.get<TaggedBlob>("registry/0").isValid());
+    REQUIRE_FALSE(manager.get<TaggedBlob>("registry/mesh").isValid());
+    REQUIRE(manager.get<SizedBlob>("registry/mesh").isValid());
+
+    // Hits from many threads while another thread re-registers and unloads
+    constexpr u32 THREAD_COUNT = 4;
+    constexpr u32 LOOKUPS = 2000;
+    std::atomic<u32> found{0};
+    std::vector<std::thread> threads;
+    for (u32 t = 0; t < THREAD_COUNT; ++t) {
+        threads.emplace_back([&, t] {
+            for (u32 i = 0; i < LOOKUPS; ++i) {
+                auto path = "registry/" + std::to_string((i + t) % RESOURCE_COUNT);
+                found += manager.load(path).cast<TaggedBlob>().isValid() ? 1 : 0;
+            }
+        });
+    }
+    threads.emplace_back([&] {
+        for (u32 i = 0; i < LOOKUPS; ++i) {
+            manager.registerResource(std::make_shared<TaggedBlob>(), "registry/churn");
+            manager.unload(ResourcePath("registry/churn"));
+        }
+    });
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(found == THREAD_COUNT * LOOKUPS);
+    REQUIRE(manager.getStats().cacheHits == THREAD_COUNT * LOOKUPS);
+    REQUIRE(manager.getUsedMemory() == (RESOURCE_COUNT + 1) * 64);
+}
+
+// ============================================================================
+// Hot Reload Tests
+// ============================================================================
+
+namespace {
+
+/// Adopts reloads and logs dependency notifications by name
+class HotBlob : public PackBlob {
+public:
+    static inline std::vector<std::string> refinalized;
+    u32 adopted = 0;
+
+protected:
+    bool adoptReload(Resource& staged) override {
+        bytes = std::move(static_cast<HotBlob&>(staged).bytes);
+        ++adopted;
+        return true;
+    }
+    void onDependenciesReloaded() override { refinalized.push_back(getName()); }
+};
+
+class HotBlobLoader : public IResourceLoader {
+public:
+    std::vector<std::string> getSupportedExtensions() const override { return {"hotblob"}; }
+    ResourceType getResourceType() const override { return ResourceType::Unknown; }
+    bool canLoad(const ResourcePath& path) const override { return path.getExtension() == "hotblob"; }
+    std::shared_ptr<Resource> createResource() override { return std::make_shared<HotBlob>(); }
+    bool load(Resource* resource, const std::vector<u8>& data) override {
+        static_cast<HotBlob*>(resource)->bytes = data;
+        return true;
+    }
+    const char* getName() const override { return "HotBlobLoader"; }
+};
+
+/// Scratch directory and an initialized manager that loads .hotblob files
+struct HotReloadFixture {
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "nova_test_hot_reload";
+
+    HotReloadFixture() {
+        std::filesystem::remove_all(dir);
+        std::filesystem::create_directories(dir);
+        platform::FileWatcher::get().setDebounce(0.01f);
+
+        auto& manager = ResourceManager::get();
+        REQUIRE(manager.initialize(ResourceConfig::DEFAULT_CACHE_SIZE, 1));
+        manager.registerLoader(std::make_unique<HotBlobLoader>());
+        manager.setHotReloadEnabled(true);
+    }
+
+    ~HotReloadFixture() {
+        ResourceManager::get().shutdown();
+        ResourceManager::get().setHotReloadCallback(nullptr);
+        platform::FileWatcher::get().setDebounce(platform::FileWatcher::DEFAULT_DEBOUNCE);
+        std::error_code ec;
+        std::filesystem::remove_all(dir, ec);
+    }
+
+    std::string write(const char* name, std::string_view text) const {
+        auto path = dir / name;
+        std::ofstream(path, std::ios::binary) << text;
+        return path.string();
+    }
+
+    static std::vector<u8> bytes(std::string_view text) { return {text.begin(), text.end()}; }
+
+    template<typename Predicate>
+    static bool pumpUntil(Predicate done) {
+        for (int i = 0; i < 5000 && !done(); ++i) {
+            ResourceManager::get().update(0.0f);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return done();
+    }
+};
+
+} // namespace
+
+TEST_CASE("File Watcher - Bursts of writes settle into one event", "[resource][hotreload]") {
+    HotReloadFixture fixture;
+    auto& watcher = platform::FileWatcher::get();
+    auto watch = watcher.watch(fixture.dir.string());
+    REQUIRE(watch != platform::FileWatcher::INVALID_WATCH);
+
+    std::string path;
+    for (int i = 0; i < 10; ++i) {
+        path = fixture.write("burst.txt", std::string(static_cast<usize>(i + 1), 'x'));
+    }
+
+    std::vector<platform::FileEvent> events;
+    for (int i = 0; i < 5000 && events.empty(); ++i) {
+        events = watcher.poll(watch);
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    watcher.unwatch(watch);
+
+    REQUIRE(events.size() == 1);
+    REQUIRE(events[0].path == platform::FileWatcher::normalizePath(path));
+    REQUIRE(events[0].change == platform::FileChange::Created);
+}
+
+TEST_CASE("Resource Manager - Hot reload updates dependents in order", "[resource][hotreload]") {
+    HotReloadFixture fixture;
+    auto& manager = ResourceManager::get();
+
+    auto a = manager.load<HotBlob>(fixture.write("a.hotblob", "a1"));
+    auto b = manager.load<HotBlob>(fixture.write("b.hotblob", "b1"));
+    auto c = manager.load<HotBlob>(fixture.write("c.hotblob", "c1"));
+    REQUIRE(a.isLoaded());
+    REQUIRE(b.isLoaded());
+    REQUIRE(c.isLoaded());
+
+    // c uses b and a, b uses a
+    manager.addDependency(c->getId(), a->getId());
+    manager.addDependency(c->getId(), b->getId());
+    manager.addDependency(b->getId(), a->getId());
+
+    std::vector<std::string> notified;
+    manager.setHotReloadCallback([&](const ResourcePath& path) { notified.push_back(path.path); });
+    HotBlob::refinalized.clear();
+    manager.watchDirectory(fixture.dir.string());
+
+    fixture.write("a.hotblob", "a2");
+    REQUIRE(HotReloadFixture::pumpUntil([] { return HotBlob::refinalized.size() == 2; }));
+
+    // The existing handle sees the new contents; nothing else was re-read
+    REQUIRE(a->bytes == HotReloadFixture::bytes("a2"));
+    REQUIRE(a->adopted == 1);
+    REQUIRE(b->adopted == 0);
+    REQUIRE(c->adopted == 0);
+    REQUIRE(HotBlob::refinalized == std::vector<std::string>{"b", "c"});
+    REQUIRE(notified == std::vector<std::string>{a->getPath().path, b->getPath().path, c->getPath().path});
+}
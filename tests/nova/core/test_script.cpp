@@ -9,6 +9,10 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
 #include <nova/core/script/script.hpp>
+#include <nova/core/ecs/world.hpp>
+
+#include <limits>
+#include <string>
 
 using namespace nova;
 using namespace nova::script;
@@ -143,3 +147,644 @@ TEST_CASE("Script Types - ScriptParam", "[script][types]") {
         REQUIRE(param.defaultValue.asFloat() == Approx(1.0));
     }
 }
+
+TEST_CASE("Script VM - Bytecode layout", "[script][vm]") {
+    SECTION("Instructions are compact") {
+        REQUIRE(sizeof(Instruction) == 8);
+        
+        Instruction instr;
+        REQUIRE(instr.op == OpCode::ReturnVoid);
+        REQUIRE(instr.argc == 0);
+    }
+    
+    SECTION("Default compiled graph is empty") {
+        CompiledGraph graph;
+        REQUIRE(graph.empty());
+        REQUIRE(graph.registerCount == 0);
+        REQUIRE(graph.argumentCount == 0);
+    }
+}
+
+TEST_CASE("Script Types - PackedValue", "[script][types]") {
+    SECTION("Compact and trivially copyable") {
+        REQUIRE(std::is_trivially_copyable_v<PackedValue>);
+        REQUIRE(sizeof(PackedValue) == 24);
+    }
+    
+    SECTION("Default is void") {
+        PackedValue val;
+        REQUIRE(val.isVoid());
+        REQUIRE(val.asInt() == 0);
+    }
+    
+    SECTION("Scalars keep ScriptValue coercions") {
+        PackedValue intVal(42);
+        REQUIRE(intVal.type() == ScriptType::Int);
+        REQUIRE(intVal.asFloat() == Approx(42.0));
+        
+        PackedValue floatVal(2.5f);
+        REQUIRE(floatVal.isFloat());
+        REQUIRE(floatVal.asInt() == 2);
+        
+        PackedValue boolVal(true);
+        REQUIRE(boolVal.asBool());
+        REQUIRE(boolVal.asInt() == 1);
+    }
+    
+    SECTION("Vectors are stored inline") {
+        PackedValue val(Vec3(1.0f, 2.0f, 3.0f));
+        REQUIRE(val.type() == ScriptType::Vec3);
+        Vec3 v = val.asVec3();
+        REQUIRE(v.x == Approx(1.0f));
+        REQUIRE(v.y == Approx(2.0f));
+        REQUIRE(v.z == Approx(3.0f));
+        REQUIRE(val.asVec2().x == Approx(0.0f));
+    }
+    
+    SECTION("Handles") {
+        PackedValue obj = PackedValue::handle(ScriptType::Object, 77);
+        REQUIRE(obj.asHandle() == 77);
+        REQUIRE(PackedValue(5).asHandle() == 0);
+    }
+}
+
+TEST_CASE("Script Types - FunctionHandle", "[script][types]") {
+    FunctionHandle handle;
+    REQUIRE_FALSE(handle.isValid());
+    
+    FunctionHandle bound{3};
+    REQUIRE(bound.isValid());
+    REQUIRE(bound == FunctionHandle{3});
+}
+
+TEST_CASE("Script Types - PackedValue ScriptValue round trip", "[script][types]") {
+    auto roundTrip = [](const ScriptValue& value) {
+        PackedValue packed = PackedValue::from(value);
+        REQUIRE(packed.type() == value.type);
+        ScriptValue back = packed.toScriptValue();
+        REQUIRE(back.type == value.type);
+        REQUIRE(PackedValue::from(back) == packed);
+        return back;
+    };
+
+    SECTION("Value types keep their tag and payload") {
+        REQUIRE(roundTrip(ScriptValue()).isVoid());
+        REQUIRE(roundTrip(ScriptValue(true)).asBool());
+        REQUIRE(roundTrip(ScriptValue(static_cast<i64>(-1234567890123))).asInt() == -1234567890123);
+        REQUIRE(roundTrip(ScriptValue(0.125)).asFloat() == 0.125);
+        REQUIRE(roundTrip(ScriptValue("interned")).asString() == "interned");
+
+        Vec2 v2 = roundTrip(ScriptValue(Vec2(1.0f, -2.0f))).asVec2();
+        REQUIRE(v2.x == 1.0f);
+        REQUIRE(v2.y == -2.0f);
+
+        Vec3 v3 = roundTrip(ScriptValue(Vec3(1.0f, 2.0f, 3.0f))).asVec3();
+        REQUIRE(v3.z == 3.0f);
+
+        Vec4 v4 = roundTrip(ScriptValue(Vec4(1.0f, 2.0f, 3.0f, 4.0f))).asVec4();
+        REQUIRE(v4.w == 4.0f);
+
+        Quat q = roundTrip(ScriptValue(Quat(0.0f, 0.6f, 0.0f, 0.8f))).asQuat();
+        REQUIRE(q.y == 0.6f);
+        REQUIRE(q.w == 0.8f);
+
+        ScriptValue color(Vec4(1.0f, 0.5f, 0.25f, 1.0f));
+        color.type = ScriptType::Color;
+        REQUIRE(roundTrip(color).asVec4().z == 0.25f);
+
+        ecs::Entity entity(42, 7);
+        REQUIRE(roundTrip(ScriptValue(entity)).asEntity() == entity);
+    }
+
+    SECTION("Strings intern to the same ID") {
+        PackedValue a = PackedValue::from(ScriptValue("same text"));
+        PackedValue b = PackedValue::from(ScriptValue(std::string("same text")));
+        REQUIRE(a == b);
+        REQUIRE(a.asStringId() != 0);
+        REQUIRE(PackedValue::from(ScriptValue("")).asStringId() == 0);
+    }
+
+    SECTION("Reference types have no packed form") {
+        for (ScriptType type : {ScriptType::Object, ScriptType::Array, ScriptType::Map, ScriptType::Function}) {
+            ScriptValue ref;
+            ref.type = type;
+            ref.data = std::shared_ptr<void>();
+            REQUIRE(PackedValue::from(ref).isVoid());
+            REQUIRE(PackedValue::handle(type, 9).toScriptValue().isVoid());
+        }
+    }
+}
+
+TEST_CASE("Script Types - NativeRegistry dispatch", "[script][types]") {
+    NativeRegistry natives;
+
+    SECTION("Calls receive their arguments as a span") {
+        FunctionHandle sum = natives.bind("Sum", [](std::span<const PackedValue> args) {
+            i64 total = 0;
+            for (const auto& arg : args) total += arg.asInt();
+            return PackedValue(total);
+        });
+
+        const PackedValue args[] = {PackedValue(1), PackedValue(2), PackedValue(39)};
+        REQUIRE(natives.call(sum, args).asInt() == 42);
+        REQUIRE(natives.call(sum, {}).asInt() == 0);
+        REQUIRE(natives.find("Sum") == sum);
+        REQUIRE(natives.name(sum) == "Sum");
+    }
+
+    SECTION("Handles taken before binding resolve once bound") {
+        FunctionHandle early = natives.intern("Later");
+        REQUIRE_FALSE(natives.isBound(early));
+        REQUIRE(natives.call(early, {}).isVoid());
+
+        natives.bind("Later", [](std::span<const PackedValue>) { return PackedValue(7); });
+        REQUIRE(natives.call(early, {}).asInt() == 7);
+
+        natives.unbind("Later");
+        REQUIRE(natives.call(early, {}).isVoid());
+        REQUIRE(natives.intern("Later") == early);
+    }
+
+    SECTION("Engine dispatches native calls by handle and by name") {
+        ScriptEngine& engine = ScriptEngine::get();
+        engine.registerNativeCall("test_native_twice", [](std::span<const PackedValue> args) {
+            return PackedValue(args.empty() ? i64{0} : args[0].asInt() * 2);
+        });
+
+        FunctionHandle handle = engine.getFunctionHandle("test_native_twice");
+        const PackedValue args[] = {PackedValue(21)};
+        REQUIRE(engine.callFunction(handle, args).asInt() == 42);
+        REQUIRE(engine.callFunction("test_native_twice", {ScriptValue(static_cast<i64>(5))}).asInt() == 10);
+
+        engine.unregisterFunction("test_native_twice");
+        REQUIRE(engine.callFunction(handle, args).isVoid());
+    }
+
+    SECTION("Unknown names and cleared registries") {
+        REQUIRE_FALSE(natives.find("Missing").isValid());
+        natives.bind("Temp", [](std::span<const PackedValue>) { return PackedValue(true); });
+        natives.clear();
+        REQUIRE(natives.size() == 0);
+        REQUIRE_FALSE(natives.find("Temp").isValid());
+    }
+}
+
+// ============================================================================
+// Graph Compiler and VM Tests
+// ============================================================================
+
+namespace {
+
+ScriptPin execPin(PinDirection direction) {
+    ScriptPin pin;
+    pin.direction = direction;
+    pin.pinType = PinType::Exec;
+    return pin;
+}
+
+ScriptPin dataPin(PinDirection direction, ScriptType type, ScriptValue value = ScriptValue()) {
+    ScriptPin pin;
+    pin.direction = direction;
+    pin.dataType = type;
+    pin.defaultValue = std::move(value);
+    return pin;
+}
+
+/// Builds ScriptGraphs node by node; node IDs start at 1
+struct GraphBuilderHelper {
+    ScriptGraph graph;
+
+    u32 add(NodeType type, const std::string& name,
+            std::vector<ScriptPin> inputs, std::vector<ScriptPin> outputs) {
+        ScriptNode node;
+        node.id = graph.nextNodeId++;
+        node.type = type;
+        node.name = name;
+        node.inputs = std::move(inputs);
+        node.outputs = std::move(outputs);
+        graph.nodes.push_back(std::move(node));
+        if (type == NodeType::Entry) {
+            graph.entryNodeId = graph.nodes.back().id;
+        }
+        return graph.nodes.back().id;
+    }
+
+    /// Entry node whose data outputs are Int arguments
+    u32 entry(u32 intArgs) {
+        std::vector<ScriptPin> outputs{execPin(PinDirection::Output)};
+        for (u32 i = 0; i < intArgs; ++i) {
+            outputs.push_back(dataPin(PinDirection::Output, ScriptType::Int));
+        }
+        return add(NodeType::Entry, "Entry", {}, std::move(outputs));
+    }
+
+    u32 binary(NodeType type, const std::string& name, ScriptType operands, ScriptType result,
+               ScriptValue lhs = ScriptValue(), ScriptValue rhs = ScriptValue()) {
+        return add(type, name,
+                   {dataPin(PinDirection::Input, operands, std::move(lhs)),
+                    dataPin(PinDirection::Input, operands, std::move(rhs))},
+                   {dataPin(PinDirection::Output, result)});
+    }
+
+    u32 ret() {
+        return add(NodeType::Return, "Return",
+                   {execPin(PinDirection::Input), dataPin(PinDirection::Input, ScriptType::Any)}, {});
+    }
+
+    void link(u32 fromNode, u32 fromPin, u32 toNode, u32 toPin) {
+        graph.connections.push_back({fromNode, fromPin, toNode, toPin});
+    }
+
+    Result<PackedValue> run(const NativeRegistry& natives, std::initializer_list<PackedValue> args) {
+        auto compiled = GraphCompiler::compile(graph, natives);
+        if (!compiled) return std::unexpected(compiled.error());
+        ScriptVM vm;
+        return vm.execute(*compiled, std::span<const PackedValue>(args.begin(), args.size()));
+    }
+};
+
+/// Entry(a, b) -> Return(a <name> b)
+GraphBuilderHelper binaryGraph(const std::string& op) {
+    GraphBuilderHelper g;
+    u32 entry = g.entry(2);
+    u32 math = g.binary(NodeType::MathOp, op, ScriptType::Int, ScriptType::Int);
+    u32 ret = g.ret();
+    g.link(entry, 0, ret, 0);
+    g.link(entry, 1, math, 0);
+    g.link(entry, 2, math, 1);
+    g.link(math, 0, ret, 1);
+    return g;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Script VM - Arithmetic graphs", "[script][vm]") {
+    NativeRegistry natives;
+
+    SECTION("Integer expression over arguments") {
+        // (a + b) * 3 - b / 2
+        GraphBuilderHelper g;
+        u32 entry = g.entry(2);
+        u32 sum = g.binary(NodeType::MathOp, "Add", ScriptType::Int, ScriptType::Int);
+        u32 scaled = g.binary(NodeType::MathOp, "Multiply", ScriptType::Int, ScriptType::Int,
+                              ScriptValue(), ScriptValue(static_cast<i64>(3)));
+        u32 half = g.binary(NodeType::MathOp, "Divide", ScriptType::Int, ScriptType::Int,
+                            ScriptValue(), ScriptValue(static_cast<i64>(2)));
+        u32 result = g.binary(NodeType::MathOp, "Subtract", ScriptType::Int, ScriptType::Int);
+        u32 ret = g.ret();
+        g.link(entry, 0, ret, 0);
+        g.link(entry, 1, sum, 0);
+        g.link(entry, 2, sum, 1);
+        g.link(sum, 0, scaled, 0);
+        g.link(entry, 2, half, 0);
+        g.link(scaled, 0, result, 0);
+        g.link(half, 0, result, 1);
+        g.link(result, 0, ret, 1);
+
+        auto value = g.run(natives, {PackedValue(7), PackedValue(4)});
+        REQUIRE(value.has_value());
+        REQUIRE(value->isInt());
+        REQUIRE(value->asInt() == 31);
+    }
+
+    SECTION("Mixed operands promote to float") {
+        GraphBuilderHelper g;
+        u32 entry = g.entry(1);
+        u32 math = g.binary(NodeType::MathOp, "Multiply", ScriptType::Float, ScriptType::Float,
+                            ScriptValue(), ScriptValue(0.5));
+        u32 ret = g.ret();
+        g.link(entry, 0, ret, 0);
+        g.link(entry, 1, math, 0);
+        g.link(math, 0, ret, 1);
+
+        auto value = g.run(natives, {PackedValue(5)});
+        REQUIRE(value.has_value());
+        REQUIRE(value->isFloat());
+        REQUIRE(value->asFloat() == Approx(2.5));
+    }
+
+    SECTION("Integer division edge cases do not trap") {
+        GraphBuilderHelper div = binaryGraph("Divide");
+        constexpr i64 minInt = std::numeric_limits<i64>::min();
+
+        REQUIRE(div.run(natives, {PackedValue(minInt), PackedValue(-1)})->asInt() == minInt);
+        REQUIRE(div.run(natives, {PackedValue(9), PackedValue(0)})->asInt() == 0);
+        REQUIRE(div.run(natives, {PackedValue(-9), PackedValue(2)})->asInt() == -4);
+    }
+
+    SECTION("Integer overflow wraps") {
+        constexpr i64 maxInt = std::numeric_limits<i64>::max();
+        REQUIRE(binaryGraph("Add").run(natives, {PackedValue(maxInt), PackedValue(1)})->asInt() ==
+                std::numeric_limits<i64>::min());
+        REQUIRE(binaryGraph("Multiply").run(natives, {PackedValue(maxInt), PackedValue(2)})->asInt() == -2);
+    }
+
+    SECTION("Unknown math ops fail to compile") {
+        GraphBuilderHelper g = binaryGraph("Power");
+        REQUIRE_FALSE(GraphCompiler::compile(g.graph, natives).has_value());
+    }
+}
+
+TEST_CASE("Script VM - Branch graphs", "[script][vm]") {
+    NativeRegistry natives;
+
+    // Entry(x) -> Branch(x > 10) -> Return 1 / Return 2
+    GraphBuilderHelper g;
+    u32 entry = g.entry(1);
+    u32 greater = g.binary(NodeType::Compare, "Greater", ScriptType::Int, ScriptType::Bool,
+                           ScriptValue(), ScriptValue(static_cast<i64>(10)));
+    u32 branch = g.add(NodeType::Branch, "Branch",
+                       {execPin(PinDirection::Input), dataPin(PinDirection::Input, ScriptType::Bool)},
+                       {execPin(PinDirection::Output), execPin(PinDirection::Output)});
+    u32 retTrue = g.add(NodeType::Return, "Return",
+                        {execPin(PinDirection::Input),
+                         dataPin(PinDirection::Input, ScriptType::Int, ScriptValue(static_cast<i64>(1)))}, {});
+    u32 retFalse = g.add(NodeType::Return, "Return",
+                         {execPin(PinDirection::Input),
+                          dataPin(PinDirection::Input, ScriptType::Int, ScriptValue(static_cast<i64>(2)))}, {});
+    g.link(entry, 0, branch, 0);
+    g.link(entry, 1, greater, 0);
+    g.link(greater, 0, branch, 1);
+    g.link(branch, 0, retTrue, 0);
+    g.link(branch, 1, retFalse, 0);
+
+    auto compiled = GraphCompiler::compile(g.graph, natives);
+    REQUIRE(compiled.has_value());
+
+    ScriptVM vm;
+    const PackedValue high[] = {PackedValue(11)};
+    const PackedValue low[] = {PackedValue(10)};
+    REQUIRE(vm.execute(*compiled, high)->asInt() == 1);
+    REQUIRE(vm.execute(*compiled, low)->asInt() == 2);
+}
+
+TEST_CASE("Script VM - Loop graphs", "[script][vm]") {
+    NativeRegistry natives;
+
+    // sum = 0; for i in [1, n]: sum = sum + i; return sum
+    GraphBuilderHelper g;
+    ScriptProperty sumVar;
+    sumVar.name = "sum";
+    sumVar.type = ScriptType::Int;
+    sumVar.defaultValue = ScriptValue(static_cast<i64>(0));
+    g.graph.variables.push_back(sumVar);
+
+    u32 entry = g.entry(1);
+    u32 loop = g.add(NodeType::ForLoop, "ForLoop",
+                     {execPin(PinDirection::Input),
+                      dataPin(PinDirection::Input, ScriptType::Int, ScriptValue(static_cast<i64>(1))),
+                      dataPin(PinDirection::Input, ScriptType::Int)},
+                     {execPin(PinDirection::Output), dataPin(PinDirection::Output, ScriptType::Int),
+                      execPin(PinDirection::Output)});
+    u32 getSum = g.add(NodeType::Variable, "sum", {}, {dataPin(PinDirection::Output, ScriptType::Int)});
+    u32 add = g.binary(NodeType::MathOp, "Add", ScriptType::Int, ScriptType::Int);
+    u32 setSum = g.add(NodeType::Variable, "sum",
+                       {execPin(PinDirection::Input), dataPin(PinDirection::Input, ScriptType::Int)},
+                       {execPin(PinDirection::Output), dataPin(PinDirection::Output, ScriptType::Int)});
+    u32 ret = g.ret();
+
+    g.link(entry, 0, loop, 0);
+    g.link(entry, 1, loop, 2);
+    g.link(loop, 0, setSum, 0);
+    g.link(getSum, 0, add, 0);
+    g.link(loop, 1, add, 1);
+    g.link(add, 0, setSum, 1);
+    g.link(loop, 2, ret, 0);
+    g.link(getSum, 0, ret, 1);
+
+    auto compiled = GraphCompiler::compile(g.graph, natives);
+    REQUIRE(compiled.has_value());
+
+    ScriptVM vm;
+    const PackedValue ten[] = {PackedValue(10)};
+    REQUIRE(vm.execute(*compiled, ten)->asInt() == 55);
+
+    // Variables restart from their defaults on every execution
+    const PackedValue hundred[] = {PackedValue(100)};
+    REQUIRE(vm.execute(*compiled, hundred)->asInt() == 5050);
+
+    SECTION("Instruction limit stops long loops") {
+        vm.setInstructionLimit(50);
+        REQUIRE_FALSE(vm.execute(*compiled, hundred).has_value());
+        REQUIRE(vm.execute(*compiled, std::span<const PackedValue>{})->asInt() == 0);
+    }
+}
+
+TEST_CASE("Script VM - Native call graphs", "[script][vm]") {
+    NativeRegistry natives;
+    natives.bind("Scale", [](std::span<const PackedValue> args) {
+        return PackedValue(args[0].asInt() * args[1].asInt());
+    });
+
+    // Entry(x) -> Scale(x, 6) -> Return
+    GraphBuilderHelper g;
+    u32 entry = g.entry(1);
+    u32 call = g.add(NodeType::FunctionCall, "Scale",
+                     {execPin(PinDirection::Input), dataPin(PinDirection::Input, ScriptType::Int),
+                      dataPin(PinDirection::Input, ScriptType::Int, ScriptValue(static_cast<i64>(6)))},
+                     {execPin(PinDirection::Output), dataPin(PinDirection::Output, ScriptType::Int)});
+    u32 ret = g.ret();
+    g.link(entry, 0, call, 0);
+    g.link(entry, 1, call, 1);
+    g.link(call, 0, ret, 0);
+    g.link(call, 1, ret, 1);
+
+    auto compiled = GraphCompiler::compile(g.graph, natives);
+    REQUIRE(compiled.has_value());
+    REQUIRE(compiled->calls.size() == 1);
+
+    ScriptVM vm;
+    const PackedValue seven[] = {PackedValue(7)};
+    REQUIRE(vm.execute(*compiled, seven)->asInt() == 42);
+
+    SECTION("Rebinding after compilation is picked up") {
+        natives.bind("Scale", [](std::span<const PackedValue> args) {
+            return PackedValue(args[0].asInt() + args[1].asInt());
+        });
+        REQUIRE(vm.execute(*compiled, seven)->asInt() == 13);
+    }
+
+    SECTION("Unbound functions fail to compile") {
+        NativeRegistry empty;
+        REQUIRE_FALSE(GraphCompiler::compile(g.graph, empty).has_value());
+    }
+}
+
+// ============================================================================
+// Batched Instance Tests
+// ============================================================================
+
+namespace {
+
+ScriptProperty floatProperty(const std::string& name, f64 value) {
+    ScriptProperty prop;
+    prop.name = name;
+    prop.type = ScriptType::Float;
+    prop.defaultValue = ScriptValue(value);
+    return prop;
+}
+
+ScriptClass batchedClass(const std::string& name, ScriptBatchUpdate update = nullptr) {
+    ScriptClass cls;
+    cls.name = name;
+    cls.properties = {floatProperty("x", 0.0), floatProperty("speed", 2.0)};
+    cls.batchUpdate = std::move(update);
+    return cls;
+}
+
+} // anonymous namespace
+
+TEST_CASE("Script Batch - ScriptClassStorage rows", "[script][batch]") {
+    ScriptClass cls = batchedClass("StorageRows");
+    ScriptClassStorage storage(cls);
+    const u32 x = storage.propertyIndex("x");
+    const u32 speed = storage.propertyIndex("speed");
+    REQUIRE(storage.propertyIndex("missing") == ScriptClassStorage::INVALID_PROPERTY);
+
+    REQUIRE(storage.create(1) == 0);
+    REQUIRE(storage.create(2) == 1);
+    REQUIRE(storage.create(3) == 2);
+    REQUIRE(storage.create(2) == ScriptClassStorage::INVALID_ROW);
+    REQUIRE(storage.at(1, speed).asFloat() == 2.0);
+
+    storage.at(2, x) = PackedValue(30.0);
+    REQUIRE(storage.destroy(1));
+    REQUIRE_FALSE(storage.destroy(1));
+
+    // The last row moved into the freed slot
+    REQUIRE(storage.size() == 2);
+    REQUIRE(storage.rowOf(3) == 0);
+    REQUIRE(storage.at(0, x).asFloat() == 30.0);
+    REQUIRE(storage.ids()[1] == 2);
+
+    SECTION("Re-registration keeps values by property name") {
+        ScriptClass changed = cls;
+        changed.properties = {floatProperty("health", 100.0), floatProperty("x", 0.0)};
+        storage.setClass(changed);
+        REQUIRE(storage.propertyCount() == 2);
+        REQUIRE(storage.at(storage.rowOf(3), storage.propertyIndex("x")).asFloat() == 30.0);
+        REQUIRE(storage.at(0, storage.propertyIndex("health")).asFloat() == 100.0);
+    }
+}
+
+TEST_CASE("Script Batch - Engine instances", "[script][batch]") {
+    ScriptEngine& engine = ScriptEngine::get();
+    u32 hookCalls = 0;
+    engine.registerClass(batchedClass("BatchMover", [&hookCalls](ScriptClassStorage& instances, f32 dt) {
+        const u32 x = instances.propertyIndex("x");
+        const u32 speed = instances.propertyIndex("speed");
+        auto xs = instances.column(x);
+        auto speeds = instances.column(speed);
+        for (u32 row = 0; row < instances.size(); ++row) {
+            xs[row] = PackedValue(xs[row].asFloat() + speeds[row].asFloat() * static_cast<f64>(dt));
+        }
+        hookCalls++;
+    }));
+
+    ScriptInstanceId a = engine.createInstance("BatchMover");
+    ScriptInstanceId b = engine.createInstance("BatchMover");
+    ScriptInstanceId c = engine.createInstance("BatchMover");
+    REQUIRE(a != INVALID_SCRIPT_INSTANCE);
+    REQUIRE(engine.createInstance("NoSuchBatchClass") == INVALID_SCRIPT_INSTANCE);
+
+    ScriptClassStorage* storage = engine.getClassStorage("BatchMover");
+    REQUIRE(storage != nullptr);
+    REQUIRE(engine.getInstanceStorage(b) == storage);
+    const u32 x = storage->propertyIndex("x");
+
+    engine.tickInstances(0.5f);
+    REQUIRE(hookCalls == 1);
+    REQUIRE(storage->at(storage->rowOf(a), x).asFloat() == Approx(1.0));
+
+    REQUIRE(engine.destroyInstance(b));
+    REQUIRE_FALSE(engine.destroyInstance(b));
+    REQUIRE(engine.getInstanceStorage(b) == nullptr);
+
+    engine.tickInstances(0.5f);
+    REQUIRE(storage->size() == 2);
+    REQUIRE(storage->at(storage->rowOf(c), x).asFloat() == Approx(2.0));
+
+    SECTION("Attached instances are owned by their entity") {
+        ecs::World world;
+        ecs::Entity entity = world.createEntity();
+        ScriptInstanceId attached = engine.attachInstance(world, entity, "BatchMover");
+        REQUIRE(attached != INVALID_SCRIPT_INSTANCE);
+
+        auto* component = world.getComponent<ScriptComponent>(entity);
+        REQUIRE(component != nullptr);
+        REQUIRE(component->instance == attached);
+        REQUIRE(storage->owners()[storage->rowOf(attached)] == entity);
+        REQUIRE(engine.destroyInstance(attached));
+    }
+
+    engine.destroyInstance(a);
+    engine.destroyInstance(c);
+    REQUIRE(storage->empty());
+}
+
+TEST_CASE("Script Batch - Hooks may create and destroy instances", "[script][batch]") {
+    ScriptEngine& engine = ScriptEngine::get();
+    constexpr u32 SPAWNED_CLASSES = 32;
+    constexpr u32 INITIAL = 40;
+    for (u32 i = 0; i < SPAWNED_CLASSES; ++i) {
+        engine.registerClass(batchedClass("BatchSpawned" + std::to_string(i)));
+    }
+
+    std::vector<ScriptInstanceId> initial;
+    std::vector<ScriptInstanceId> spawned;
+    u32 rowsSeen = 0;
+
+    // Every row spawns an instance of its own class and of a class with no
+    // storage yet, and the first row destroys another instance: without
+    // deferral these would move the rows and rehash the storage map mid-tick
+    engine.registerClass(batchedClass("BatchSpawner", [&](ScriptClassStorage& instances, f32) {
+        const u32 rows = instances.size();
+        for (u32 row = 0; row < rows; ++row) {
+            spawned.push_back(engine.createInstance("BatchSpawner"));
+            spawned.push_back(engine.createInstance("BatchSpawned" + std::to_string(row % SPAWNED_CLASSES)));
+            if (row == 0) {
+                REQUIRE(engine.destroyInstance(initial[5]));
+            } else {
+                REQUIRE_FALSE(engine.destroyInstance(initial[5]));  // Already queued
+            }
+            REQUIRE(instances.size() == rows);
+            rowsSeen++;
+        }
+    }));
+
+    for (u32 i = 0; i < INITIAL; ++i) {
+        initial.push_back(engine.createInstance("BatchSpawner"));
+    }
+
+    engine.tickInstances(1.0f / 60.0f);
+    REQUIRE(rowsSeen == INITIAL);
+
+    ScriptClassStorage* spawners = engine.getClassStorage("BatchSpawner");
+    REQUIRE(spawners->size() == INITIAL - 1 + INITIAL);
+    REQUIRE_FALSE(spawners->contains(initial[5]));
+    REQUIRE(engine.getInstanceStorage(initial[5]) == nullptr);
+    for (ScriptInstanceId id : spawned) {
+        REQUIRE(engine.getInstanceStorage(id) != nullptr);
+    }
+
+    SECTION("Destroying a pending instance cancels it") {
+        ScriptInstanceId cancelled = INVALID_SCRIPT_INSTANCE;
+        engine.registerClass(batchedClass("BatchSpawner", [&](ScriptClassStorage&, f32) {
+            if (cancelled == INVALID_SCRIPT_INSTANCE) {
+                cancelled = engine.createInstance("BatchSpawner");
+                REQUIRE(engine.destroyInstance(cancelled));
+            }
+        }));
+        u32 before = spawners->size();
+        engine.tickInstances(1.0f / 60.0f);
+        REQUIRE(spawners->size() == before);
+        REQUIRE(engine.getInstanceStorage(cancelled) == nullptr);
+    }
+
+    // Leave the shared engine without live instances
+    std::vector<ScriptInstanceId> live(spawners->ids().begin(), spawners->ids().end());
+    live.insert(live.end(), spawned.begin(), spawned.end());
+    for (ScriptInstanceId id : live) {
+        engine.destroyInstance(id);
+    }
+}
@@ -9,6 +9,7 @@
 #include <nova/core/ui/ui_types.hpp>
 #include <nova/core/ui/ui_system.hpp>
 #include <nova/core/ui/widget.hpp>
+#include <nova/core/ui/text_layout.hpp>
 
 using namespace nova;
 using namespace nova::ui;
@@ -266,6 +267,386 @@ TEST_CASE("UI: UISystem singleton", "[ui][system]") {
     }
 }
 
+// =============================================================================
+// Incremental Layout Tests
+// =============================================================================
+
+namespace {
+
+struct CountingLabel : Label {
+    using Label::Label;
+    u32 measures = 0;
+    
+    Vec2 measureContent(f32 availableWidth, f32 availableHeight) override {
+        ++measures;
+        return Label::measureContent(availableWidth, availableHeight);
+    }
+};
+
+struct CountingContainer : Container {
+    u32 layouts = 0;
+    
+protected:
+    void layoutChildren() override {
+        ++layouts;
+        Container::layoutChildren();
+    }
+};
+
+} // namespace
+
+TEST_CASE("UI: Incremental layout", "[ui][layout]") {
+    CountingContainer root;
+    
+    auto fixedPanel = std::make_unique<CountingContainer>();
+    fixedPanel->getStyle().width = Dimension::pixels(200);
+    fixedPanel->getStyle().height = Dimension::pixels(100);
+    auto fixedLabel = std::make_unique<CountingLabel>("ammo 30");
+    
+    auto autoPanel = std::make_unique<CountingContainer>();
+    auto autoLabel = std::make_unique<CountingLabel>("score 0");
+    
+    auto* fixed = fixedPanel.get();
+    auto* fixedText = fixedLabel.get();
+    auto* autoSized = autoPanel.get();
+    auto* autoText = autoLabel.get();
+    fixedPanel->addChild(std::move(fixedLabel));
+    autoPanel->addChild(std::move(autoLabel));
+    root.addChild(std::move(fixedPanel));
+    root.addChild(std::move(autoPanel));
+    
+    const Rect screen(0, 0, 800, 600);
+    root.layout(screen);
+    REQUIRE_FALSE(root.needsLayout());
+    REQUIRE(root.layouts == 1);
+    REQUIRE(fixed->layouts == 1);
+    REQUIRE(autoSized->layouts == 1);
+    REQUIRE(fixed->isRelayoutBoundary());
+    REQUIRE_FALSE(autoSized->isRelayoutBoundary());
+    
+    SECTION("Clean tree is not laid out again") {
+        root.layout(screen);
+        REQUIRE(root.layouts == 1);
+        REQUIRE(fixed->layouts == 1);
+    }
+    
+    SECTION("Changes inside a relayout boundary stay inside it") {
+        u32 measures = fixedText->measures;
+        fixedText->setText("ammo 29");
+        REQUIRE_FALSE(root.isLayoutDirty());
+        REQUIRE(root.needsLayout());
+        
+        root.layout(screen);
+        REQUIRE(root.layouts == 1);
+        REQUIRE(fixed->layouts == 2);
+        REQUIRE(autoSized->layouts == 1);
+        REQUIRE(fixedText->measures > measures);
+        REQUIRE_FALSE(root.needsLayout());
+    }
+    
+    SECTION("Changes in auto-sized widgets propagate to the parent") {
+        autoText->setText("score 1500");
+        REQUIRE(root.isLayoutDirty());
+        
+        root.layout(screen);
+        REQUIRE(root.layouts == 2);
+        REQUIRE(autoSized->layouts == 2);
+        // The fixed panel got the same space and had no changes
+        REQUIRE(fixed->layouts == 1);
+    }
+    
+    SECTION("Measurements are cached per constraint") {
+        u32 measures = autoText->measures;
+        Vec2 first = autoText->measure(120.0f, 40.0f);
+        Vec2 second = autoText->measure(120.0f, 40.0f);
+        REQUIRE(autoText->measures == measures + 1);
+        REQUIRE(first.x == second.x);
+        
+        autoText->setMaxLines(1);
+        (void)autoText->measure(120.0f, 40.0f);
+        REQUIRE(autoText->measures == measures + 2);
+    }
+}
+
+TEST_CASE("UI: Widget counts are maintained incrementally", "[ui][system]") {
+    auto& ui = UISystem::instance();
+    REQUIRE(ui.initialize(800.0f, 600.0f).has_value());
+    
+    auto panel = std::make_unique<Container>();
+    panel->addChild(std::make_unique<Label>("a"));
+    panel->addChild(std::make_unique<Label>("b"));
+    auto* panelPtr = panel.get();
+    ui.getRoot()->addChild(std::move(panel));
+    
+    ui.update(0.0f);
+    REQUIRE(ui.getWidgetCount() == 4);
+    REQUIRE(ui.getVisibleWidgetCount() == 4);
+    
+    panelPtr->getChildAt(0)->setVisible(false);
+    ui.update(0.0f);
+    REQUIRE(ui.getVisibleWidgetCount() == 3);
+    
+    auto removed = ui.getRoot()->removeChild(panelPtr);
+    ui.update(0.0f);
+    REQUIRE(ui.getWidgetCount() == 1);
+    REQUIRE(ui.getVisibleWidgetCount() == 1);
+    
+    ui.shutdown();
+}
+
+TEST_CASE("UI: Retained draw list", "[ui][render]") {
+    Container root;
+    root.getStyle().width = Dimension::pixels(800);
+    root.getStyle().height = Dimension::pixels(600);
+    root.getStyle().backgroundColor = Color::white();
+    
+    auto panel = std::make_unique<Container>();
+    panel->getStyle().width = Dimension::pixels(200);
+    panel->getStyle().height = Dimension::pixels(100);
+    panel->getStyle().backgroundColor = Color::black();
+    auto label = std::make_unique<Label>("HP 100");
+    auto* text = label.get();
+    panel->addChild(std::move(label));
+    auto* panelPtr = panel.get();
+    root.addChild(std::move(panel));
+    root.layout(Rect(0, 0, 800, 600));
+    
+    UIDrawList drawList;
+    REQUIRE(drawList.build(&root));
+    REQUIRE(drawList.stats().widgets == 3);
+    REQUIRE(drawList.stats().widgetsRebuilt == 3);
+    
+    SECTION("Fills and text share the atlas batch") {
+        // Two backgrounds plus five glyphs ("HP 100" without the space)
+        REQUIRE(drawList.vertices().size() == 7 * 4);
+        REQUIRE(drawList.indices().size() == 7 * 6);
+        REQUIRE(drawList.batches().size() == 1);
+        REQUIRE(drawList.batches()[0].texture == UI_TEXTURE_ATLAS);
+    }
+    
+    SECTION("Unchanged tree reuses everything") {
+        REQUIRE_FALSE(drawList.build(&root));
+        REQUIRE(drawList.stats().widgetsRebuilt == 0);
+        REQUIRE(drawList.vertices().size() == 7 * 4);
+    }
+    
+    SECTION("Only the changed widget is re-tessellated") {
+        text->setText("HP 99");
+        root.layout(Rect(0, 0, 800, 600));
+        REQUIRE(drawList.build(&root));
+        REQUIRE(drawList.stats().widgetsRebuilt == 1);
+        REQUIRE(drawList.vertices().size() == 6 * 4);
+    }
+    
+    SECTION("Images break batches") {
+        auto image = std::make_unique<Image>();
+        image->getStyle().width = Dimension::pixels(32);
+        image->getStyle().height = Dimension::pixels(32);
+        image->setSource("icons/heart.png");
+        panelPtr->addChild(std::move(image));
+        root.layout(Rect(0, 0, 800, 600));
+        
+        REQUIRE(drawList.build(&root));
+        REQUIRE(drawList.batches().size() == 2);
+        REQUIRE(drawList.batches()[1].texture != UI_TEXTURE_ATLAS);
+        REQUIRE(drawList.textureSource(drawList.batches()[1].texture) == "icons/heart.png");
+    }
+    
+    SECTION("Hidden widgets are dropped") {
+        panelPtr->setVisible(false);
+        REQUIRE(drawList.build(&root));
+        REQUIRE(drawList.stats().widgets == 1);
+        REQUIRE(drawList.vertices().size() == 4);
+    }
+}
+
+TEST_CASE("UI: Virtualized list", "[ui][list]") {
+    constexpr usize ITEMS = 10'000;
+    
+    ListView list;
+    list.getStyle().width = Dimension::pixels(300);
+    list.getStyle().height = Dimension::pixels(400);
+    list.setOverscan(2);
+    
+    u32 created = 0;
+    u32 binds = 0;
+    list.setRowFactory([&] {
+        ++created;
+        return std::make_unique<Label>("");
+    });
+    list.setRowBinder([&](Widget& row, usize index) {
+        ++binds;
+        static_cast<Label&>(row).setText("entry " + std::to_string(index));
+    });
+    list.setItemCount(ITEMS);
+    
+    const Rect screen(0, 0, 800, 600);
+    list.layout(screen);
+    
+    SECTION("Only the visible window is instantiated") {
+        // 10 visible rows of 40px plus 2 overscan rows below
+        REQUIRE(list.getBoundRange() == std::pair<usize, usize>(0, 12));
+        REQUIRE(list.getPoolSize() == 12);
+        REQUIRE(created == 12);
+        REQUIRE(binds == 12);
+        
+        auto* row = static_cast<Label*>(list.getRowForItem(3));
+        REQUIRE(row != nullptr);
+        REQUIRE(row->getText() == "entry 3");
+        REQUIRE(row->getBounds().y == 120.0f);
+        REQUIRE(list.getRowForItem(50) == nullptr);
+    }
+    
+    SECTION("Scrolling recycles rows") {
+        list.setScrollOffset(Vec2(0, 200'000.0f));
+        list.layout(screen);
+        REQUIRE(list.getBoundRange() == std::pair<usize, usize>(4'998, 5'012));
+        REQUIRE(list.getPoolSize() <= 14);
+        
+        // A small scroll only binds the rows that entered the window
+        u32 before = binds;
+        list.setScrollOffset(Vec2(0, 200'040.0f));
+        list.layout(screen);
+        REQUIRE(binds == before + 1);
+        
+        list.setScrollOffset(Vec2(0, 1e9f));
+        list.layout(screen);
+        REQUIRE(list.getBoundRange().second == ITEMS);
+        REQUIRE(list.getScrollOffset().y == 40.0f * ITEMS - 400.0f);
+    }
+    
+    SECTION("Hit testing maps through row offsets") {
+        list.setScrollOffset(Vec2(0, 4'000.0f));
+        list.layout(screen);
+        Widget* hit = list.hitTest(Vec2(10.0f, 85.0f));
+        REQUIRE(hit == list.getRowForItem(102));
+        REQUIRE(list.hitTest(Vec2(10.0f, 900.0f)) == nullptr);
+    }
+    
+    SECTION("Variable row heights") {
+        list.setRowHeightProvider([](usize index) { return index % 2 == 0 ? 20.0f : 60.0f; });
+        REQUIRE(list.getItemOffset(3) == 100.0f);
+        REQUIRE(list.getItemAt(85.0f) == 2);
+        REQUIRE(list.getItemAt(101.0f) == 3);
+        REQUIRE(list.getItemAt(40.0f * ITEMS) == ListView::NO_ITEM);
+        
+        list.layout(screen);
+        REQUIRE(list.getRowForItem(3)->getBounds().y == 100.0f);
+    }
+    
+    SECTION("Item updates rebind only visible rows") {
+        u32 before = binds;
+        list.notifyItemChanged(5'000);
+        REQUIRE(binds == before);
+        list.notifyItemChanged(5);
+        REQUIRE(binds == before + 1);
+    }
+}
+
+TEST_CASE("UI: Glyph atlas", "[ui][text]") {
+    BuiltinFont font;
+    GlyphBitmap bitmap;
+    REQUIRE(font.rasterize('A', 16, bitmap));
+    REQUIRE(bitmap.width == 8);
+    REQUIRE(bitmap.height == 11);
+    REQUIRE(std::any_of(bitmap.pixels.begin(), bitmap.pixels.end(), [](u8 p) { return p == 255; }));
+    REQUIRE_FALSE(font.rasterize(' ', 16, bitmap));
+    
+    GlyphAtlas atlas;
+    u32 generation = atlas.getGeneration();
+    AtlasGlyph a = atlas.getGlyph(DEFAULT_FONT, font, 'A', 16);
+    AtlasGlyph again = atlas.getGlyph(DEFAULT_FONT, font, 'A', 16);
+    REQUIRE(a.size.x == 8.0f);
+    REQUIRE(a.uv == again.uv);
+    REQUIRE(atlas.getGlyphCount() == 1);
+    
+    SECTION("Glyphs at different sizes are packed separately") {
+        AtlasGlyph big = atlas.getGlyph(DEFAULT_FONT, font, 'A', 32);
+        REQUIRE(big.size.x == 16.0f);
+        REQUIRE_FALSE(big.uv == a.uv);
+        REQUIRE(atlas.getGeneration() == generation);
+    }
+    
+    SECTION("A full page grows and invalidates UVs") {
+        for (u32 size = 8; atlas.getGeneration() == generation; ++size) {
+            for (u32 c = 'A'; c <= 'Z'; ++c) {
+                (void)atlas.getGlyph(DEFAULT_FONT, font, c, size);
+            }
+        }
+        REQUIRE(atlas.getSize() == GlyphAtlas::INITIAL_SIZE * 2);
+    }
+}
+
+TEST_CASE("UI: Text shaping cache and line breaking", "[ui][text]") {
+    auto& shaper = TextShaper::get();
+    shaper.clear();
+    
+    TextStyle style;
+    style.fontSize = 10.0f;     // 6px advance with the builtin font
+    style.lineHeight = 1.5f;
+    
+    SECTION("Runs are shaped once") {
+        auto first = shaper.shape("score 1500", DEFAULT_FONT, 10.0f);
+        auto second = shaper.shape("score 1500", DEFAULT_FONT, 10.0f);
+        REQUIRE(first == second);
+        REQUIRE(first->advance == Approx(60.0f));
+        REQUIRE(shaper.getStats().hits == 1);
+        REQUIRE(shaper.getStats().misses == 1);
+        
+        (void)shaper.shape("score 1500", DEFAULT_FONT, 12.0f);
+        REQUIRE(shaper.getStats().misses == 2);
+    }
+    
+    SECTION("Least recently used runs are evicted") {
+        shaper.setCapacity(2);
+        (void)shaper.shape("a", DEFAULT_FONT, 10.0f);
+        (void)shaper.shape("b", DEFAULT_FONT, 10.0f);
+        (void)shaper.shape("a", DEFAULT_FONT, 10.0f);
+        (void)shaper.shape("c", DEFAULT_FONT, 10.0f);
+        REQUIRE(shaper.getStats().entries == 2);
+        
+        (void)shaper.shape("a", DEFAULT_FONT, 10.0f);
+        REQUIRE(shaper.getStats().hits == 2);
+        (void)shaper.shape("b", DEFAULT_FONT, 10.0f);
+        REQUIRE(shaper.getStats().misses == 4);
+        shaper.setCapacity(TextShaper::DEFAULT_CAPACITY);
+    }
+    
+    SECTION("Lines break at spaces, then inside long words") {
+        TextLayout layout = shaper.layout("hello world foo", style, 40.0f);
+        REQUIRE(layout.lines.size() == 3);
+        REQUIRE(layout.lines[1].begin == 6);
+        REQUIRE(layout.lines[1].end == 11);
+        REQUIRE(layout.size.x == Approx(30.0f));
+        REQUIRE(layout.size.y == Approx(45.0f));
+        
+        REQUIRE(shaper.layout("hello world foo", style, 70.0f).lines.size() == 2);
+        REQUIRE(shaper.layout("abcdefghij", style, 25.0f).lines.size() == 3);
+        REQUIRE(shaper.layout("hello world foo", style, 40.0f, 2).lines.size() == 2);
+        REQUIRE(shaper.getStats().misses == 2);
+    }
+    
+    SECTION("Newlines and empty text") {
+        REQUIRE(shaper.layout("a\nb\n", style, 0.0f).lines.size() == 3);
+        TextLayout empty = shaper.layout("", style, 0.0f);
+        REQUIRE(empty.lines.size() == 1);
+        REQUIRE(empty.size.x == 0.0f);
+        REQUIRE(empty.size.y == Approx(15.0f));
+    }
+    
+    SECTION("Labels measure through the cache") {
+        Label label("hello world foo");
+        label.getStyle().text = style;
+        Vec2 size = label.measure(40.0f, 100.0f);
+        REQUIRE(size.x == Approx(30.0f));
+        REQUIRE(size.y == Approx(45.0f));
+        
+        u64 misses = shaper.getStats().misses;
+        (void)label.measure(70.0f, 100.0f);
+        REQUIRE(shaper.getStats().misses == misses);
+    }
+}
+
 // =============================================================================
 // Easing Functions Tests (removed - not exposed)
 // =============================================================================
@@ -0,0 +1,434 @@
+/**
+ * @file nova_cook.cpp
+ * @brief NovaCore Engine - Offline Asset Cooker
+ *
+ * NovaForge Platform | NovaCore Engine
+ * Copyright (c) 2025 WeNova Interactive (operating as Kayden Shawn Massengill)
+ *
+ * Usage: nova_cook [options] <source-dir> <output-dir>
+ *   --jobs <n>          Worker threads (default: hardware threads)
+ *   --force             Cook everything, ignoring the cache
+ *   --pack <file.pak>   Also bundle the cooked files into a resource pack
+ *
+ * Converts source assets under <source-dir> into the runtime-ready formats
+ * the engine maps in place, mirroring the directory layout:
+ *   .nvskel (streamed, version 1)  ->  .nvskel (cooked, version 2)
+ *   .nvclip (text)                 ->  .nvanim
+ *
+ * Each cooked file is keyed by a hash of its source contents and the
+ * cooked format version, kept in <output-dir>/.nova_cook_cache; files
+ * whose key is unchanged are not cooked again. The exit code is 1 if any
+ * asset failed to cook.
+ */
+
+#include <nova/core/animation/cooked_animation.hpp>
+#include <nova/core/platform/mapped_file.hpp>
+#include <nova/core/resource/resource_pack.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace nova::cook {
+
+namespace fs = std::filesystem;
+
+using animation::AnimationClipData;
+using animation::InterpolationMode;
+
+namespace {
+
+constexpr std::string_view CACHE_FILE = ".nova_cook_cache";
+
+// ============================================================================
+// Text Clip Source (.nvclip)
+// ============================================================================
+//
+//   # comment
+//   clip <name>                         default: file stem
+//   fps <frames-per-second>
+//   duration <seconds>                  default: last key
+//   rootmotion <x> <y> <z> <yaw>
+//   channel <bone-name> [bone-index]
+//   position <time> <x> <y> <z> [interp]
+//   rotation <time> <x> <y> <z> <w> [interp]
+//   scale <time> <x> <y> <z> [interp]
+//   event <time> <name> [string-param]
+//
+// interp is one of step, linear (default), bezier, hermite, catmullrom.
+
+[[nodiscard]] bool parseInterpolation(std::istringstream& in, InterpolationMode& mode) {
+    std::string name;
+    if (!(in >> name)) {
+        mode = InterpolationMode::Linear;
+        return true;
+    }
+    static const std::unordered_map<std::string, InterpolationMode> modes = {
+        {"step", InterpolationMode::Step},
+        {"linear", InterpolationMode::Linear},
+        {"bezier", InterpolationMode::Bezier},
+        {"hermite", InterpolationMode::Hermite},
+        {"catmullrom", InterpolationMode::CatmullRom},
+    };
+    auto it = modes.find(name);
+    if (it == modes.end()) {
+        return false;
+    }
+    mode = it->second;
+    return true;
+}
+
+[[nodiscard]] Result<AnimationClipData> parseClipSource(std::span<const u8> data, const std::string& stem) {
+    AnimationClipData clip;
+    clip.name = stem;
+
+    std::istringstream source(std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+    std::string line;
+    u32 lineNumber = 0;
+    auto fail = [&](std::string_view reason) {
+        return std::unexpected(errors::parse("line " + std::to_string(lineNumber) + ": " + std::string(reason)));
+    };
+
+    while (std::getline(source, line)) {
+        ++lineNumber;
+        std::istringstream in(line);
+        std::string keyword;
+        if (!(in >> keyword) || keyword[0] == '#') {
+            continue;
+        }
+
+        bool ok = true;
+        if (keyword == "clip") {
+            ok = static_cast<bool>(in >> clip.name);
+        } else if (keyword == "fps") {
+            ok = static_cast<bool>(in >> clip.framesPerSecond) && clip.framesPerSecond > 0.0f;
+        } else if (keyword == "duration") {
+            ok = static_cast<bool>(in >> clip.duration);
+        } else if (keyword == "rootmotion") {
+            auto& p = clip.rootMotionPosition;
+            ok = static_cast<bool>(in >> p.x >> p.y >> p.z >> clip.rootMotionRotation);
+            clip.hasRootMotion = true;
+        } else if (keyword == "channel") {
+            auto& channel = clip.channels.emplace_back();
+            ok = static_cast<bool>(in >> channel.boneName);
+            if (ok && !(in >> channel.boneIndex)) {
+                channel.boneIndex = -1;
+            }
+        } else if (keyword == "position" || keyword == "scale") {
+            if (clip.channels.empty()) {
+                return fail(keyword + " before any channel");
+            }
+            f32 time = 0.0f;
+            Vec3 value;
+            InterpolationMode interp{};
+            ok = static_cast<bool>(in >> time >> value.x >> value.y >> value.z) && parseInterpolation(in, interp);
+            if (keyword == "position") {
+                clip.channels.back().positionKeys.push_back({time, value, interp, {}, {}});
+            } else {
+                clip.channels.back().scaleKeys.push_back({time, value, interp, {}, {}});
+            }
+        } else if (keyword == "rotation") {
+            if (clip.channels.empty()) {
+                return fail("rotation before any channel");
+            }
+            animation::RotationKeyframe key;
+            auto& q = key.rotation;
+            ok = static_cast<bool>(in >> key.time >> q.x >> q.y >> q.z >> q.w) && parseInterpolation(in, key.interp);
+            clip.channels.back().rotationKeys.push_back(key);
+        } else if (keyword == "event") {
+            auto& event = clip.events.emplace_back();
+            ok = static_cast<bool>(in >> event.time >> event.name);
+            in >> event.stringParam;
+        } else {
+            return fail("unknown keyword '" + keyword + "'");
+        }
+
+        if (!ok) {
+            return fail("malformed " + keyword);
+        }
+    }
+    return clip;
+}
+
+// ============================================================================
+// Cookers
+// ============================================================================
+
+using CookFn = Result<std::vector<u8>> (*)(std::span<const u8> source, const std::string& stem);
+
+struct Cooker {
+    std::string_view sourceExtension;
+    std::string_view cookedExtension;
+    u32 formatVersion;                  ///< Part of the cache key
+    resource::ResourceType type;
+    CookFn cook;
+};
+
+Result<std::vector<u8>> cookSkeletonSource(std::span<const u8> source, const std::string& stem) {
+    auto skeleton = animation::readSkeletonSource(source);
+    if (!skeleton) {
+        return std::unexpected(skeleton.error());
+    }
+    if (skeleton->name.empty()) {
+        skeleton->name = stem;
+    }
+    return animation::cookSkeleton(*skeleton);
+}
+
+Result<std::vector<u8>> cookClipSource(std::span<const u8> source, const std::string& stem) {
+    auto clip = parseClipSource(source, stem);
+    if (!clip) {
+        return std::unexpected(clip.error());
+    }
+    return animation::cookClip(*clip);
+}
+
+constexpr Cooker COOKERS[] = {
+    {".nvskel", ".nvskel", animation::CookedFormat::SKELETON_VERSION, resource::ResourceType::Skeleton, cookSkeletonSource},
+    {".nvclip", ".nvanim", animation::CookedFormat::CLIP_VERSION, resource::ResourceType::Animation, cookClipSource},
+};
+
+[[nodiscard]] const Cooker* findCooker(const fs::path& path) {
+    std::string extension = path.extension().string();
+    for (const Cooker& cooker : COOKERS) {
+        if (extension == cooker.sourceExtension) {
+            return &cooker;
+        }
+    }
+    return nullptr;
+}
+
+// ============================================================================
+// Jobs
+// ============================================================================
+
+enum class Outcome : u8 {
+    Cooked,
+    UpToDate,
+    Failed
+};
+
+struct Job {
+    fs::path source;
+    std::string cookedPath;             ///< Relative to the output directory, '/' separated
+    const Cooker* cooker = nullptr;
+
+    Outcome outcome = Outcome::Failed;
+    u64 key = 0;
+    std::string message;
+};
+
+using Cache = std::unordered_map<std::string, u64>;
+
+[[nodiscard]] Cache readCache(const fs::path& file) {
+    Cache cache;
+    std::ifstream in(file);
+    std::string line;
+    while (std::getline(in, line)) {
+        usize space = line.find(' ');
+        u64 key = 0;
+        if (space == std::string::npos ||
+            std::from_chars(line.data(), line.data() + space, key, 16).ec != std::errc{}) {
+            continue;
+        }
+        cache.emplace(line.substr(space + 1), key);
+    }
+    return cache;
+}
+
+[[nodiscard]] bool writeFile(const fs::path& path, std::span<const u8> bytes) {
+    // Through a temporary so readers never see a partial file
+    fs::path temp = path;
+    temp += ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out.write(reinterpret_cast<const char*>(bytes.data()), static_cast<std::streamsize>(bytes.size()));
+        if (!out) {
+            return false;
+        }
+    }
+    std::error_code ec;
+    fs::rename(temp, path, ec);
+    return !ec;
+}
+
+void runJob(Job& job, const fs::path& outputDir, const Cache& cache, bool force) {
+    auto source = platform::MappedFile::open(job.source.string());
+    if (!source) {
+        job.message = source.error().message();
+        return;
+    }
+
+    job.key = fnv1aHash(source->data(), source->size()) ^ (u64{job.cooker->formatVersion} * 0x9E3779B97F4A7C15ULL);
+    fs::path output = outputDir / fs::path(job.cookedPath);
+    if (!force) {
+        auto it = cache.find(job.cookedPath);
+        if (it != cache.end() && it->second == job.key && fs::exists(output)) {
+            job.outcome = Outcome::UpToDate;
+            return;
+        }
+    }
+
+    auto cooked = job.cooker->cook(source->bytes(), job.source.stem().string());
+    if (!cooked) {
+        job.message = cooked.error().message();
+        return;
+    }
+
+    std::error_code ec;
+    fs::create_directories(output.parent_path(), ec);
+    if (!writeFile(output, *cooked)) {
+        job.message = "cannot write " + output.string();
+        return;
+    }
+    job.outcome = Outcome::Cooked;
+}
+
+// ============================================================================
+// Command Line
+// ============================================================================
+
+struct Options {
+    fs::path sourceDir;
+    fs::path outputDir;
+    fs::path packPath;
+    u32 jobs = std::max(1u, std::thread::hardware_concurrency());
+    bool force = false;
+};
+
+void printUsage() {
+    std::printf("usage: nova_cook [--jobs n] [--force] [--pack file.pak] <source-dir> <output-dir>\n");
+}
+
+[[nodiscard]] bool parseOptions(int argc, char** argv, Options& options) {
+    std::vector<std::string_view> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+
+        if (arg == "--force") {
+            options.force = true;
+        } else if (arg == "--jobs") {
+            const char* value = next();
+            if (!value) return false;
+            options.jobs = static_cast<u32>(std::max(1, std::atoi(value)));
+        } else if (arg == "--pack") {
+            const char* value = next();
+            if (!value) return false;
+            options.packPath = value;
+        } else if (arg.starts_with("--")) {
+            return false;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+    if (positional.size() != 2) {
+        return false;
+    }
+    options.sourceDir = positional[0];
+    options.outputDir = positional[1];
+    return true;
+}
+
+} // namespace
+
+int run(const Options& options) {
+    std::error_code ec;
+    if (!fs::is_directory(options.sourceDir, ec)) {
+        std::fprintf(stderr, "nova_cook: '%s' is not a directory\n", options.sourceDir.string().c_str());
+        return 2;
+    }
+    if (fs::equivalent(options.sourceDir, options.outputDir, ec)) {
+        std::fprintf(stderr, "nova_cook: source and output directories must differ\n");
+        return 2;
+    }
+    fs::create_directories(options.outputDir, ec);
+
+    std::vector<Job> jobs;
+    for (const auto& entry : fs::recursive_directory_iterator(options.sourceDir)) {
+        const Cooker* cooker = entry.is_regular_file() ? findCooker(entry.path()) : nullptr;
+        if (!cooker) {
+            continue;
+        }
+        fs::path cooked = fs::relative(entry.path(), options.sourceDir);
+        cooked.replace_extension(cooker->cookedExtension);
+        Job& job = jobs.emplace_back();
+        job.source = entry.path();
+        job.cookedPath = cooked.generic_string();
+        job.cooker = cooker;
+    }
+    std::sort(jobs.begin(), jobs.end(), [](const Job& a, const Job& b) { return a.cookedPath < b.cookedPath; });
+
+    const fs::path cacheFile = options.outputDir / CACHE_FILE;
+    const Cache cache = readCache(cacheFile);
+
+    std::atomic<usize> nextJob{0};
+    std::vector<std::thread> workers;
+    for (u32 t = 0; t < std::min<usize>(options.jobs, jobs.size()); ++t) {
+        workers.emplace_back([&] {
+            for (usize i; (i = nextJob.fetch_add(1, std::memory_order_relaxed)) < jobs.size();) {
+                runJob(jobs[i], options.outputDir, cache, options.force);
+            }
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    u32 counts[3] = {};
+    std::ofstream cacheOut(cacheFile, std::ios::trunc);
+    for (const Job& job : jobs) {
+        counts[static_cast<u8>(job.outcome)]++;
+        if (job.outcome == Outcome::Failed) {
+            std::fprintf(stderr, "nova_cook: %s: %s\n", job.source.string().c_str(), job.message.c_str());
+            continue;
+        }
+        if (job.outcome == Outcome::Cooked) {
+            std::printf("cooked %s\n", job.cookedPath.c_str());
+        }
+        char key[17];
+        auto end = std::to_chars(key, key + 16, job.key, 16).ptr;
+        cacheOut << std::string_view(key, static_cast<usize>(end - key)) << ' ' << job.cookedPath << '\n';
+    }
+
+    if (!options.packPath.empty()) {
+        resource::ResourcePackWriter writer;
+        for (const Job& job : jobs) {
+            if (job.outcome == Outcome::Failed) {
+                continue;
+            }
+            auto cooked = platform::MappedFile::open((options.outputDir / fs::path(job.cookedPath)).string());
+            if (!cooked || !writer.add(job.cookedPath, cooked->bytes(), job.cooker->type)) {
+                std::fprintf(stderr, "nova_cook: cannot pack %s\n", job.cookedPath.c_str());
+                counts[static_cast<u8>(Outcome::Failed)]++;
+            }
+        }
+        if (auto written = writer.write(options.packPath.string()); !written) {
+            std::fprintf(stderr, "nova_cook: %s\n", written.error().message().c_str());
+            return 1;
+        }
+    }
+
+    std::printf("nova_cook: %u cooked, %u up to date, %u failed\n",
+                counts[static_cast<u8>(Outcome::Cooked)], counts[static_cast<u8>(Outcome::UpToDate)],
+                counts[static_cast<u8>(Outcome::Failed)]);
+    return counts[static_cast<u8>(Outcome::Failed)] > 0 ? 1 : 0;
+}
+
+} // namespace nova::cook
+
+int main(int argc, char** argv) {
+    nova::cook::Options options;
+    if (!nova::cook::parseOptions(argc, argv, options)) {
+        nova::cook::printUsage();
+        return 2;
+    }
+    return nova::cook::run(options);
+}